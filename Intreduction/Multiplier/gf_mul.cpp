@@ -4,7 +4,7 @@
 #include <ap_axi_sdata.h>
 #include <ap_int.h>
 
-
+#include "../intmul_size.h"
 
 using u8   = ap_uint<8>;
 using u16  = ap_uint<16>;
@@ -20,13 +20,11 @@ typedef ap_axiu<128, 0, 0, 0> axis128_t;
 
 
 
-static const int LOG_BITS = 6;
-static const int HEIGHT   = 1 << LOG_BITS;   // 64
-// static const int N_VARS   = 4;
-static const int N_VARS   = 15;
+// benchmark length: one multiply per row of the full-size kernel (cycle
+// counts below are for N = 32768)
+typedef IntMulSize<15> BenchSize;
 
-static const int N        = 1 << N_VARS;     // 32768
-static const int B_LEAVES_LEN = HEIGHT * N;  // 2097152
+static const int N        = BenchSize::N;    // 32768
 
 // ============================================================
 // GF(2^128) GHASH arithmetic
@@ -35,6 +33,9 @@ static const int B_LEAVES_LEN = HEIGHT * N;  // 2097152
 
 static u64 reverse_bits_64(u64 x) {
 #pragma HLS INLINE off//
+#if HLS_NATIVE_SIM
+    return hls_native::bit_reverse64(x.to_uint64());
+#else
     u64 r = 0;
     for (int i = 0; i < 64; i++) {
 #pragma HLS UNROLL //不要用流水，就一个周期
@@ -42,6 +43,7 @@ static u64 reverse_bits_64(u64 x) {
         r[63 - i] = x[i];
     }
     return r;
+#endif
 }
 
 
@@ -78,6 +80,9 @@ static u128 clmul64(u64 a, u64 b) {
 // #pragma HLS PIPELINE II=1
 
 #pragma HLS INLINE off
+#if HLS_NATIVE_SIM
+    return hls_native::clmul64(a.to_uint64(), b.to_uint64());
+#else
     u128 acc = 0;
     for (int i = 0; i < 64; i++) {
         #pragma HLS UNROLL   // 完全展开，组合逻辑
@@ -86,6 +91,7 @@ static u128 clmul64(u64 a, u64 b) {
         }
     }
     return acc;
+#endif
 }
 
 // //块写法，尝试增加频率
@@ -159,6 +165,9 @@ static u128 ghash_mul_pipe_half(u128 x, u128 y) {
 
 static u64 clmul32_base(u32 a, u32 b) {
 #pragma HLS INLINE off
+#if HLS_NATIVE_SIM
+    return (uint64_t)hls_native::clmul64(a.to_uint64(), b.to_uint64());
+#else
     u64 acc = 0;
 
     for (int blk = 0; blk < 8; blk++) {
@@ -177,6 +186,7 @@ static u64 clmul32_base(u32 a, u32 b) {
     }
 
     return acc;
+#endif
 }
 
 static u128 clmul64_karatsuba32(u64 a, u64 b) {
@@ -209,6 +219,9 @@ static u128 clmul64_karatsuba32(u64 a, u64 b) {
 
 static u128 clmul64_serial(u64 a, u64 b) {
 #pragma HLS INLINE off
+#if HLS_NATIVE_SIM
+    return hls_native::clmul64(a.to_uint64(), b.to_uint64());
+#else
     u128 acc = 0;
 
     for (int blk = 0; blk < 16; blk++) {
@@ -227,6 +240,7 @@ static u128 clmul64_serial(u64 a, u64 b) {
     }
 
     return acc;
+#endif
 }
 
 static u128 ghash_mul_pipe_serial(u128 x, u128 y) {
@@ -345,6 +359,9 @@ static u8 clmul4_lut(ap_uint<4> a, ap_uint<4> b) {
 
 static u8 clmul4_comb(ap_uint<4> a, ap_uint<4> b) {
 #pragma HLS INLINE off
+#if HLS_NATIVE_SIM
+    return (uint64_t)hls_native::clmul64(a.to_uint64(), b.to_uint64());
+#else
     u8 acc = 0;
 
     for (int i = 0; i < 4; i++) {
@@ -355,11 +372,15 @@ static u8 clmul4_comb(ap_uint<4> a, ap_uint<4> b) {
     }
 
     return acc;
+#endif
 }
 
 
 static u16 clmul8_partial4(u8 a, u8 b) {
 #pragma HLS INLINE off
+#if HLS_NATIVE_SIM
+    return (uint64_t)hls_native::clmul64(a.to_uint64(), b.to_uint64());
+#else
     u16 acc = 0;
     for (int blk = 0; blk < 2; blk++) {
 #pragma HLS PIPELINE II=1
@@ -374,6 +395,7 @@ static u16 clmul8_partial4(u8 a, u8 b) {
         acc ^= part;
     }
     return acc;
+#endif
 }
 
 static u16 clmul8_karatsuba4(u8 a, u8 b) {
@@ -547,11 +569,11 @@ static u128 ghash_mul_pipe_kara4(u128 x, u128 y) {
 
 ////////////////////
 
-static void write_axis128(hls::stream<axis128_t>& s, u128 x) {
+static bool write_axis128_nb(hls::stream<axis128_t>& s, u128 x) {
 #pragma HLS INLINE
     axis128_t v;
     v.data = (ap_uint<128>)x;
-    s.write(v);
+    return s.write_nb(v);
 }
 
 
@@ -564,22 +586,44 @@ static u128 read_axis128(hls::stream<axis128_t>& s) {
 
 
 // ============================================================
-// Top function
+// Performance counters, read back through the control bundle
+// The two DATAFLOW processes poll their ports instead of blocking, so they
+// keep counting while a port stalls. The multiply loop counts the cycles
+// an input was empty; the writer, which issues the output writes after
+// the multiplier latency, counts the cycles a result waited on a full
+// output, and the cycles from its start to the last result written.
 // ============================================================
-extern "C" {
-void gf_mul_benchmark_top(
+
+static const int BENCH_II = 4;   // loop II below, cycles per iteration
+
+struct GfMulPerf {
+    ap_uint<64> cycles;
+    ap_uint<64> stall_a_in;
+    ap_uint<64> stall_b_in;
+    ap_uint<64> stall_out;
+};
+
+// N products into prod; an iteration with an empty input is skipped and
+// counted
+static void bench_multiply(
     hls::stream<axis128_t> &a_in,
     hls::stream<axis128_t> &b_in,
-    hls::stream<axis128_t> &out
+    hls::stream<u128> &prod,
+    ap_uint<64> &stall_a_out,
+    ap_uint<64> &stall_b_out
 ) {
-#pragma HLS INTERFACE ap_ctrl_hs port=return
-#pragma HLS INTERFACE axis port=a_in
-#pragma HLS INTERFACE axis port=b_in
-#pragma HLS INTERFACE axis port=out
-#pragma HLS INTERFACE s_axilite port=return bundle=control
-
-    for (int i = 0; i < N; i++) {
-#pragma HLS PIPELINE II=4
+#pragma HLS INLINE off
+    ap_uint<64> stall_a = 0, stall_b = 0;
+    int i = 0;
+    while (i < N) {
+#pragma HLS PIPELINE II=BENCH_II
+#pragma HLS LOOP_TRIPCOUNT min=N max=N
+        bool a_ok = !a_in.empty(), b_ok = !b_in.empty();
+        if (!(a_ok && b_ok)) {
+            if (!a_ok) stall_a += BENCH_II;
+            if (!b_ok) stall_b += BENCH_II;
+            continue;
+        }
 
         u128 a = read_axis128(a_in);
         u128 b = read_axis128(b_in);
@@ -593,10 +637,69 @@ void gf_mul_benchmark_top(
         // u128 c = ghash_mul_pipe_kara3(a, b); // 32790 cyc, 20K LUT ， 158MHz， 3阶段kara，面积进一步减小
         u128 c = ghash_mul_pipe_kara4(a, b); // 32790 cyc, 18.6K LUT, 154MHz  4阶段kara     // karatsuba+查找表  32792,288MHz 20.1K LUT // 32834 cyc, 20.1K LUT , 579MHz //864MHz,12K FF, 9K LUT,  
 
+        prod.write(c);
+        i++;
+    }
+    stall_a_out = stall_a;
+    stall_b_out = stall_b;
+}
+
+// N products from prod to out. A product is held until write_nb takes it,
+// so a full output is counted on the cycle it blocks the write.
+static void bench_write(
+    hls::stream<u128> &prod,
+    hls::stream<axis128_t> &out,
+    ap_uint<64> &cycles_out,
+    ap_uint<64> &stall_out_out
+) {
+#pragma HLS INLINE off
+    ap_uint<64> cycles = 0, stall_out = 0;
+    u128 c = 0;
+    bool have = false;
+    int i = 0;
+    while (i < N) {
+#pragma HLS PIPELINE II=1
+#pragma HLS LOOP_TRIPCOUNT min=N max=N
+        cycles++;
+        if (!have) have = prod.read_nb(c);
+        if (have) {
+            if (write_axis128_nb(out, c)) {
+                have = false;
+                i++;
+            } else {
+                stall_out++;
+            }
+        }
+    }
+    cycles_out    = cycles;
+    stall_out_out = stall_out;
+}
+
+// ============================================================
+// Top function
+// ============================================================
+extern "C" {
+void gf_mul_benchmark_top(
+    hls::stream<axis128_t> &a_in,
+    hls::stream<axis128_t> &b_in,
+    hls::stream<axis128_t> &out,
+    GfMulPerf &perf
+) {
+#pragma HLS INTERFACE ap_ctrl_hs port=return
+#pragma HLS INTERFACE axis port=a_in
+#pragma HLS INTERFACE axis port=b_in
+#pragma HLS INTERFACE axis port=out
+#pragma HLS INTERFACE s_axilite port=perf bundle=control
+#pragma HLS DISAGGREGATE variable=perf
+#pragma HLS INTERFACE s_axilite port=return bundle=control
 
-        write_axis128(out, c);
+#pragma HLS DATAFLOW
 
+    hls::stream<u128> prod("prod");
+#pragma HLS STREAM variable=prod depth=16
 
-    }
+    // each process owns its own counters
+    bench_multiply(a_in, b_in, prod, perf.stall_a_in, perf.stall_b_in);
+    bench_write(prod, out, perf.cycles, perf.stall_out);
 }
 }
\ No newline at end of file
@@ -0,0 +1,215 @@
+#include <stdint.h>
+
+#include <hls_stream.h>
+
+#include "additive_ntt.h"
+#include "ghash_hls.h"
+
+// ============================================================
+// One butterfly layer of the additive NTT (host/additive_ntt.hpp)
+//
+// forward:  u = a_lo + t a_hi,  v = u + a_hi
+// inverse:  a_hi = u + v,       a_lo = u + t a_hi
+//
+// for the pairs (k, k + 2^layer) of every block of 2^(layer + 1) entries
+// of a 2^log_n table. twiddles is the host's table for this layer, already
+// offset to the coset, one entry per block. lo_in / hi_in, lo_out / hi_out
+// and twiddles / twiddles_hi are the same buffer on two bundles each; the
+// host swaps in / out between layers. The product is the Karatsuba
+// clmul128_wide of ghash_hls.h plus one reduction.
+//
+// Every port reads or writes contiguous runs, so m_axi bursts infer:
+//   - low layers (block <= tile): each bundle pair streams one half of the
+//     table in order. Tiles of 2^t entries are paired on chip: while tile
+//     k + 1 streams in, the butterflies of tile k run (every other cycle)
+//     and tile k - 1 streams out. Two halves side by side give one
+//     butterfly per cycle.
+//   - high layers: block by block, both halves of a block are runs of at
+//     least 2^(t - 1) entries, one butterfly per cycle.
+// ============================================================
+
+static void butterfly(u128 a, u128 b, u128 t, ap_uint<1> inverse, u128 &u, u128 &v) {
+#pragma HLS INLINE
+    if (!inverse) {
+        u = a ^ reduce_wide(clmul128_wide(t, b));
+        v = u ^ b;
+    } else {
+        v = a ^ b;
+        u = a ^ reduce_wide(clmul128_wide(t, v));
+    }
+}
+
+// log2 of the tile for a low layer, 0 if the layer runs block by block
+static int tile_log(int log_n, int layer) {
+#pragma HLS INLINE
+    int t = (log_n - 1 < NTT_TILE_LOG) ? log_n - 1 : NTT_TILE_LOG;
+    return (t >= NTT_TILE_MIN_LOG && layer + 1 <= t) ? t : 0;
+}
+
+static const int NTT_TILE = 1 << NTT_TILE_LOG;
+static const int MAX_HALF = 1 << (NTT_MAX_LOG - 1);
+
+// Half part (0 / 1) of the table, in order
+static void read_half(const u128 *src, int log_n, int part, hls::stream<u128> &s) {
+#pragma HLS INLINE off
+    const int n = 1 << (log_n - 1);
+    for (int i = 0; i < n; i++) {
+#pragma HLS PIPELINE II=1
+#pragma HLS LOOP_TRIPCOUNT min=1 max=MAX_HALF
+        s.write(src[part * n + i]);
+    }
+}
+
+static void write_half(hls::stream<u128> &s, int log_n, int part, u128 *dst) {
+#pragma HLS INLINE off
+    const int n = 1 << (log_n - 1);
+    for (int i = 0; i < n; i++) {
+#pragma HLS PIPELINE II=1
+#pragma HLS LOOP_TRIPCOUNT min=1 max=MAX_HALF
+        dst[part * n + i] = s.read();
+    }
+}
+
+// Twiddles of the blocks in half part of the table
+static void read_twiddles(const u128 *tw, int log_n, int layer, int part, hls::stream<u128> &s) {
+#pragma HLS INLINE off
+    const int nb = 1 << (log_n - 2 - layer);
+    for (int i = 0; i < nb; i++) {
+#pragma HLS PIPELINE II=1
+#pragma HLS LOOP_TRIPCOUNT min=1 max=MAX_HALF
+        s.write(tw[part * nb + i]);
+    }
+}
+
+// One half of the table through a low layer, tile by tile. Entry e of a
+// tile is read at least 2^(t - 1) cycles after it was written, in both
+// buffers (the pair holding e is at most half a tile ahead of it), well
+// past the multiplier latency, so the dependences are declared false.
+static void tile_butterflies(hls::stream<u128> &s_in, hls::stream<u128> &s_tw,
+                             hls::stream<u128> &s_out, int log_n, int layer,
+                             ap_uint<1> inverse) {
+#pragma HLS INLINE off
+    u128 in_buf[2][NTT_TILE];
+    u128 out_buf[2][NTT_TILE];
+#pragma HLS ARRAY_PARTITION variable=in_buf dim=1 complete
+#pragma HLS ARRAY_PARTITION variable=out_buf dim=1 complete
+#pragma HLS BIND_STORAGE variable=in_buf type=ram_2p impl=bram
+#pragma HLS BIND_STORAGE variable=out_buf type=ram_2p impl=bram
+#pragma HLS DEPENDENCE variable=in_buf inter false
+#pragma HLS DEPENDENCE variable=out_buf inter false
+
+    const int t_log = tile_log(log_n, layer);
+    const int T = 1 << t_log;
+    const int n = 1 << (log_n - 1);
+    const int half = 1 << layer;
+    u128 t = 0;
+    for (int c = 0; c < n + 2 * T; c++) {
+#pragma HLS PIPELINE II=1
+#pragma HLS LOOP_TRIPCOUNT min=1 max=MAX_HALF
+        const int q = c & (T - 1);
+        const bool p = (c >> t_log) & 1;   // parity of the tile streaming in
+
+        if (c < n) {
+            u128 x = s_in.read();
+            if (p) in_buf[1][q] = x;
+            else   in_buf[0][q] = x;
+        }
+
+        // butterfly q / 2 of the previous tile
+        if (c >= T && c < n + T && (q & 1) == 0) {
+            const int j  = q >> 1;
+            const int lo = ((j >> layer) << (layer + 1)) | (j & (half - 1));
+            const int hi = lo + half;
+            if ((j & (half - 1)) == 0) t = s_tw.read();
+            u128 a = p ? in_buf[0][lo] : in_buf[1][lo];
+            u128 b = p ? in_buf[0][hi] : in_buf[1][hi];
+            u128 u, v;
+            butterfly(a, b, t, inverse, u, v);
+            if (p) { out_buf[0][lo] = u; out_buf[0][hi] = v; }
+            else   { out_buf[1][lo] = u; out_buf[1][hi] = v; }
+        }
+
+        // the tile before that, in order
+        if (c >= 2 * T) s_out.write(p ? out_buf[1][q] : out_buf[0][q]);
+    }
+}
+
+static void low_layer(const u128 *lo_in, const u128 *hi_in, u128 *lo_out, u128 *hi_out,
+                      const u128 *twiddles, const u128 *twiddles_hi, int log_n, int layer,
+                      ap_uint<1> inverse) {
+#pragma HLS INLINE off
+#pragma HLS DATAFLOW
+    hls::stream<u128> in0("in0"), in1("in1"), tw0("tw0"), tw1("tw1"), out0("out0"), out1("out1");
+#pragma HLS STREAM variable=in0 depth=64
+#pragma HLS STREAM variable=in1 depth=64
+#pragma HLS STREAM variable=out0 depth=64
+#pragma HLS STREAM variable=out1 depth=64
+
+    read_half(lo_in, log_n, 0, in0);
+    read_half(hi_in, log_n, 1, in1);
+    read_twiddles(twiddles, log_n, layer, 0, tw0);
+    read_twiddles(twiddles_hi, log_n, layer, 1, tw1);
+    tile_butterflies(in0, tw0, out0, log_n, layer, inverse);
+    tile_butterflies(in1, tw1, out1, log_n, layer, inverse);
+    write_half(out0, log_n, 0, lo_out);
+    write_half(out1, log_n, 1, hi_out);
+}
+
+// Block by block: runs of 2^layer entries on each port
+static void high_layer(const u128 *lo_in, const u128 *hi_in, u128 *lo_out, u128 *hi_out,
+                       const u128 *twiddles, int log_n, int layer, ap_uint<1> inverse) {
+#pragma HLS INLINE off
+    const int n_blocks = 1 << (log_n - 1 - layer);
+    const int half = 1 << layer;
+    for (int blk = 0; blk < n_blocks; blk++) {
+#pragma HLS LOOP_TRIPCOUNT min=1 max=NTT_TILE
+        const u128 t = twiddles[blk];
+        const int base = blk << (layer + 1);
+        for (int k = 0; k < half; k++) {
+#pragma HLS PIPELINE II=1
+#pragma HLS LOOP_TRIPCOUNT min=1 max=MAX_HALF
+            u128 u, v;
+            butterfly(lo_in[base + k], hi_in[base + half + k], t, inverse, u, v);
+            lo_out[base + k] = u;
+            hi_out[base + half + k] = v;
+        }
+    }
+}
+
+extern "C" {
+void additive_ntt_stage(
+    const u128 *lo_in,
+    const u128 *hi_in,
+    u128 *lo_out,
+    u128 *hi_out,
+    const u128 *twiddles,
+    const u128 *twiddles_hi,
+    int log_n,
+    int layer,
+    ap_uint<1> inverse
+) {
+#pragma HLS INTERFACE m_axi port=lo_in       offset=slave bundle=gmem0 max_read_burst_length=64
+#pragma HLS INTERFACE m_axi port=hi_in       offset=slave bundle=gmem1 max_read_burst_length=64
+#pragma HLS INTERFACE m_axi port=lo_out      offset=slave bundle=gmem2 max_write_burst_length=64
+#pragma HLS INTERFACE m_axi port=hi_out      offset=slave bundle=gmem3 max_write_burst_length=64
+#pragma HLS INTERFACE m_axi port=twiddles    offset=slave bundle=gmem4 max_read_burst_length=64
+#pragma HLS INTERFACE m_axi port=twiddles_hi offset=slave bundle=gmem5 max_read_burst_length=64
+#pragma HLS INTERFACE s_axilite port=lo_in bundle=control
+#pragma HLS INTERFACE s_axilite port=hi_in bundle=control
+#pragma HLS INTERFACE s_axilite port=lo_out bundle=control
+#pragma HLS INTERFACE s_axilite port=hi_out bundle=control
+#pragma HLS INTERFACE s_axilite port=twiddles bundle=control
+#pragma HLS INTERFACE s_axilite port=twiddles_hi bundle=control
+#pragma HLS INTERFACE s_axilite port=log_n bundle=control
+#pragma HLS INTERFACE s_axilite port=layer bundle=control
+#pragma HLS INTERFACE s_axilite port=inverse bundle=control
+#pragma HLS INTERFACE s_axilite port=return bundle=control
+
+    if (log_n < 1 || log_n > NTT_MAX_LOG || layer < 0 || layer >= log_n) return;
+    if (tile_log(log_n, layer)) {
+        low_layer(lo_in, hi_in, lo_out, hi_out, twiddles, twiddles_hi, log_n, layer, inverse);
+    } else {
+        high_layer(lo_in, hi_in, lo_out, hi_out, twiddles, log_n, layer, inverse);
+    }
+}
+}
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <ap_int.h>
+
+using u128 = ap_uint<128>;
+
+static const int NTT_MAX_LOG = 24;   // largest transform the stage kernel is sized for
+
+// Layers with blocks of at most 2^NTT_TILE_LOG entries run through on-chip
+// tiles of that size; tiles below 2^NTT_TILE_MIN_LOG (tiny tables) do not.
+static const int NTT_TILE_LOG     = 10;
+static const int NTT_TILE_MIN_LOG = 6;
+
+extern "C" void additive_ntt_stage(
+    const u128 *lo_in,
+    const u128 *hi_in,
+    u128 *lo_out,
+    u128 *hi_out,
+    const u128 *twiddles,
+    const u128 *twiddles_hi,
+    int log_n,
+    int layer,
+    ap_uint<1> inverse
+);
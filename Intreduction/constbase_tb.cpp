@@ -1,47 +1,25 @@
-#include <ap_int.h>
-#include <ap_axi_sdata.h>
-#include <hls_stream.h>
-
-#include <cctype>
 #include <cstdint>
-#include <fstream>
 #include <iomanip>
 #include <iostream>
 #include <sstream>
 #include <string>
+#include <thread>
 #include <unistd.h>
 #include <limits.h>
+#include <mutex>
+#include <vector>
 
-using u64  = ap_uint<64>;
-using u128 = ap_uint<128>;
-
-typedef ap_axiu<64, 0, 0, 0>  axis64_t;
-typedef ap_axiu<128, 0, 0, 0> axis128_t;
-
-static const int LOG_BITS = 6;
-static const int HEIGHT   = 1 << LOG_BITS;
-static const int N_VARS   = 4;
-// static const int N_VARS   = 15;
-
-
-// 调试时你可以先改成 16
-static const int N = 1 << N_VARS;
-
-static const int B_LEAVES_LEN = HEIGHT * N;
-
-extern "C" void intmul_witness_step(
-    hls::stream<axis64_t> &a_in,
-    hls::stream<axis64_t> &b_in,
-    // hls::stream<axis64_t> &clo_in,
-    // hls::stream<axis64_t> &chi_in,
+#include "host/b_root.hpp"
+#include "host/compressed_leaves.hpp"
+#include "host/cu_scheduler.hpp"
+#include "host/intmul_reference.hpp"
+#include "host/witness_gen.hpp"
+#include "host/witness_loader.hpp"
+#include "host/intmul_check.hpp"
+#include "host/witness_runtime.hpp"
 
-    hls::stream<axis128_t> &a_root_out,
-    // hls::stream<axis128_t> &clo_root_out,
-    // hls::stream<axis128_t> &chi_root_out,
-    hls::stream<axis128_t> &b_leaves_out
-    // hls::stream<axis128_t> &b_root_out,
-    // hls::stream<axis128_t> &c_root_out
-);
+#include "intmul_size.h"
+#include "witness_to_constbase.h"
 
 static const char* A_FILE  = "intmul_witness_a.txt";
 static const char* B_FILE  = "intmul_witness_b.txt";
@@ -55,192 +33,680 @@ static void print_cwd() {
     }
 }
 
-static std::string trim(const std::string& s) {
-    size_t l = 0;
-    while (l < s.size() && std::isspace((unsigned char)s[l])) l++;
-    size_t r = s.size();
-    while (r > l && std::isspace((unsigned char)s[r - 1])) r--;
-    return s.substr(l, r - l);
+static std::string u128_to_hex(u128 x) {
+    uint64_t hi = (uint64_t)(x >> 64);
+    uint64_t lo = (uint64_t)(x);
+    std::ostringstream oss;
+    oss << "0x"
+        << std::hex << std::setfill('0')
+        << std::setw(16) << hi
+        << std::setw(16) << lo;
+    return oss.str();
 }
 
-static bool starts_with_hex_index_line(const std::string& line) {
-    if (line.empty()) return false;
-    size_t i = 0;
-    while (i < line.size() && std::isdigit((unsigned char)line[i])) i++;
-    if (i == 0) return false;
-    while (i < line.size() && std::isspace((unsigned char)line[i])) i++;
-    return (i + 2 <= line.size() && line[i] == '0' && (line[i + 1] == 'x' || line[i + 1] == 'X'));
+static void push_axis64(hls::stream<axis64_t>& s, u64 x) {
+    axis64_t v;
+    v.data = (ap_uint<64>)x;
+    s.write(v);
 }
 
-static bool parse_index_hex_u64_line(const std::string& line, int& idx, uint64_t& value) {
-    std::stringstream ss(line);
-    std::string idx_str, hex_str;
-    if (!(ss >> idx_str >> hex_str)) return false;
-
-    try { idx = std::stoi(idx_str); } catch (...) { return false; }
+static u128 pop_axis128(hls::stream<axis128_t>& s) {
+    axis128_t v = s.read();
+    return (u128)v.data;
+}
 
-    if (!(hex_str.size() >= 3 && hex_str[0] == '0' && (hex_str[1] == 'x' || hex_str[1] == 'X')))
-        return false;
+static ghash_host::u128_t to_host_u128(u128 x) {
+    return ghash_host::make_u128((uint64_t)(x >> 64), (uint64_t)x);
+}
 
-    try { value = std::stoull(hex_str, nullptr, 16); } catch (...) { return false; }
-    return true;
+static u128 from_host_u128(ghash_host::u128_t x) {
+    return (u128((uint64_t)ghash_host::hi64(x)) << 64) | u128((uint64_t)ghash_host::lo64(x));
 }
 
-static bool load_witness_u64_file(const std::string& path, u64 out[N]) {
-    std::ifstream fin(path);
-    if (!fin) {
-        std::cerr << "ERROR: cannot open file: " << path << "\n";
-        return false;
+static void push_inputs(
+    hls::stream<axis64_t>& a_in, hls::stream<axis64_t>& b_in,
+    hls::stream<axis64_t>& clo_in, hls::stream<axis64_t>& chi_in,
+    const u64* a_raw, const u64* b_raw, const u64* clo_raw, const u64* chi_raw, int n
+) {
+    for (int i = 0; i < n; i++) {
+        push_axis64(a_in,   a_raw[i]);
+        push_axis64(b_in,   b_raw[i]);
+        push_axis64(clo_in, clo_raw[i]);
+        push_axis64(chi_in, chi_raw[i]);
     }
+}
 
-    std::string line;
-    int count = 0;
-    while (std::getline(fin, line)) {
-        line = trim(line);
-        if (!starts_with_hex_index_line(line)) continue;
+static std::vector<uint64_t> to_host_u64(const u64* x, int n) {
+    std::vector<uint64_t> out(n);
+    for (int i = 0; i < n; i++) out[i] = (uint64_t)x[i];
+    return out;
+}
 
-        int idx_dummy = -1;
-        uint64_t val = 0;
-        if (!parse_index_hex_u64_line(line, idx_dummy, val)) continue;
+// The KernelSize instantiation goes through the extern "C" top, other
+// sizes call their DATAFLOW instantiation directly.
+template <int NV, int LB>
+static void run_kernel(
+    hls::stream<axis64_t>& a_in, hls::stream<axis64_t>& b_in,
+    hls::stream<axis64_t>& clo_in, hls::stream<axis64_t>& chi_in,
+    hls::stream<axis128_t>& a_root_out, hls::stream<axis128_t>& b_leaves_out,
+    hls::stream<axis64_t>& b_mask_out,
+    int row_offset, int row_count, ap_uint<1> compress,
+    ap_uint<1>& roots_match, int& mismatch_idx, IntMulPerf& perf
+) {
+    if (NV == KernelSize::N_VARS && LB == KernelSize::LOG_BITS) {
+        intmul_witness_step(a_in, b_in, clo_in, chi_in, a_root_out, b_leaves_out, b_mask_out,
+                            row_offset, row_count, compress, roots_match, mismatch_idx, perf);
+    } else {
+        intmul_witness_dataflow<NV, LB>(a_in, b_in, clo_in, chi_in, a_root_out, b_leaves_out,
+                                        b_mask_out, row_offset, row_count, compress,
+                                        roots_match, mismatch_idx, perf);
+    }
+}
+
+// Stage counters of one run. With the inputs queued before the kernel
+// starts, C simulation runs the ideal II=1 schedule: every stage takes one
+// cycle per word it moves (b-leaf passes at least ROW_PASS_MIN) and no port
+// stalls.
+static bool check_perf(const IntMulPerf& p, int n, int height) {
+    std::cout << "\n== stage counters (cycles / stalls) ==\n"
+              << "read " << p.read_cycles << ", root " << p.root_cycles
+              << ", leaves " << p.leaves_cycles << ", drain " << p.drain_cycles << "\n"
+              << "stall a_in " << p.stall_a_in << ", b_in " << p.stall_b_in
+              << ", clo_in " << p.stall_clo_in << ", chi_in " << p.stall_chi_in
+              << ", a_root_out " << p.stall_a_root_out << ", b_leaves_out " << p.stall_b_leaves_out
+              << ", b_mask_out " << p.stall_b_mask_out << "\n";
+    bool ok = p.read_cycles == n && p.root_cycles == n && p.drain_cycles == n &&
+              p.leaves_cycles == (uint64_t)height * (n < ROW_PASS_MIN ? ROW_PASS_MIN : n);
+    ok = ok && p.stall_a_in == 0 && p.stall_b_in == 0 && p.stall_clo_in == 0 &&
+         p.stall_chi_in == 0 && p.stall_a_root_out == 0 && p.stall_b_leaves_out == 0 &&
+         p.stall_b_mask_out == 0;
+    if (!ok) std::cout << "[TB] stage counters differ from the II=1 schedule\n";
+    return ok;
+}
 
-        out[count] = (u64)val;
+// Rolling digest of a u128 stream, d <- (d + x) * H in GF(2^128): two
+// streams of the same length agree (up to a ~len / 2^128 chance) iff their
+// digests do, so outputs are compared without keeping them.
+struct StreamDigest {
+    ghash_host::u128_t d;
+    size_t count;
+
+    StreamDigest() : d(0), count(0) {}
+    void add(ghash_host::u128_t x) {
+        static const ghash_host::u128_t H =
+            ghash_host::make_u128(0x9e3779b97f4a7c15ull, 0xf39cc0605cedc834ull);
+        d = ghash_host::ghash_mul(d ^ x, H);
         count++;
+    }
+    bool operator==(const StreamDigest& o) const { return d == o.d && count == o.count; }
+    bool operator!=(const StreamDigest& o) const { return !(*this == o); }
+};
+
+// What the streaming checker keeps of one run: digests, the first values
+// for the log, and the b_root the streamed leaves multiply to.
+struct StreamCheck {
+    StreamDigest a_root;
+    StreamDigest b_leaves;
+    std::vector<u128> a_root_head;
+    std::vector<u128> leaves_head;
+};
+
+static const int HEAD_LEN = 10;
+
+// Consume b_leaves_out / a_root_out while the kernel produces them and check
+// every word against the reference computed on the fly: leaf (z, i) from a
+// running a_root[i]^(2^z) and bit z of b[i], a_root[i] from ref.a_root. The
+// streamed leaves are multiplied up per row and must give ref.b_root.
+// Holds O(N) and stops at the first mismatch. Leaves are read first: the
+// kernel's a_root writer is its last DATAFLOW stage, which C simulation
+// runs after the leaves are all out.
+static bool check_output_streams(
+    hls::stream<axis128_t>& a_root_out, hls::stream<axis128_t>& b_leaves_out,
+    const u64* b_raw, const intmul_host::ReferenceResult& ref, int n, int height, StreamCheck& out
+) {
+    std::vector<ghash_host::u128_t> pow(ref.a_root), acc(n, ghash_host::gf_one());
+    for (int z = 0; z < height; z++) {
+        for (int i = 0; i < n; i++) {
+            u128 v = pop_axis128(b_leaves_out);
+            ghash_host::u128_t want = ((uint64_t)b_raw[i] >> z) & 1 ? pow[i] : ghash_host::gf_one();
+            if (to_host_u128(v) != want) {
+                std::cout << "[TB] b_leaves != reference at k=" << (size_t)z * n + i << "\n";
+                return false;
+            }
+            out.b_leaves.add(want);
+            if (z == 0 && i < HEAD_LEN) out.leaves_head.push_back(v);
+            acc[i] = ghash_host::ghash_mul(acc[i], want);
+            pow[i] = ghash_host::gf_square(pow[i]);
+        }
+    }
+    if (acc != ref.b_root) {
+        std::cout << "[TB] streamed leaves do not multiply to the reference b_root\n";
+        return false;
+    }
 
-        if (count == N) break;
+    for (int i = 0; i < n; i++) {
+        u128 v = pop_axis128(a_root_out);
+        if (to_host_u128(v) != ref.a_root[i]) {
+            std::cout << "[TB] a_root != reference at i=" << i << "\n";
+            return false;
+        }
+        out.a_root.add(ref.a_root[i]);
+        if (i < HEAD_LEN) out.a_root_head.push_back(v);
     }
+    return true;
+}
 
-    if (count < N) {
-        std::cerr << "ERROR: file " << path
-                  << " only contains " << count
-                  << " values, expected at least " << N << "\n";
+// Re-run the kernel with compress = 1 and check the expanded result
+// against the digest of the full b_leaves stream.
+template <int NV, int LB>
+static bool check_compressed_mode(
+    const u64* a_raw, const u64* b_raw, const u64* clo_raw, const u64* chi_raw,
+    const StreamCheck& full, const intmul_host::ReferenceResult& ref
+) {
+    const int N = IntMulSize<NV, LB>::N;
+    const int HEIGHT = IntMulSize<NV, LB>::HEIGHT;
+    const int B_LEAVES_LEN = IntMulSize<NV, LB>::B_LEAVES_LEN;
+
+    hls::stream<axis64_t> a_in("a_in_c");
+    hls::stream<axis64_t> b_in("b_in_c");
+    hls::stream<axis64_t> clo_in("clo_in_c");
+    hls::stream<axis64_t> chi_in("chi_in_c");
+    hls::stream<axis128_t> a_root_out("a_root_out_c");
+    hls::stream<axis128_t> b_leaves_out("b_leaves_out_c");
+    hls::stream<axis64_t> b_mask_out("b_mask_out_c");
+    ap_uint<1> roots_match = 0;
+    int mismatch_idx = 0;
+    IntMulPerf perf;
+
+    push_inputs(a_in, b_in, clo_in, chi_in, a_raw, b_raw, clo_raw, chi_raw, N);
+    std::thread kernel([&] {
+        run_kernel<NV, LB>(a_in, b_in, clo_in, chi_in, a_root_out, b_leaves_out, b_mask_out,
+                           0, N, 1, roots_match, mismatch_idx, perf);
+    });
+
+    // values up to TLAST, then the masks (the empty case has no TLAST: no bits set)
+    std::vector<ghash_host::u128_t> values;
+    size_t expected = 0;
+    for (int i = 0; i < N; i++) expected += __builtin_popcountll((uint64_t)b_raw[i]);
+    values.reserve(expected);
+    bool last = (expected == 0);
+    while (!last) {
+        axis128_t v = b_leaves_out.read();
+        values.push_back(to_host_u128(v.data));
+        last = v.last;
+    }
+    std::vector<uint64_t> masks(N);
+    for (int i = 0; i < N; i++) masks[i] = (uint64_t)b_mask_out.read().data;
+    StreamDigest a_root;
+    for (int i = 0; i < N; i++) a_root.add(to_host_u128(pop_axis128(a_root_out)));
+    kernel.join();
+
+    if (a_root != full.a_root) {
+        std::cout << "[TB] compressed: a_root differs from the full run\n";
+        return false;
+    }
+    intmul_host::CompressedBLeaves cb;
+    if (!cb.assign(masks, values)) {
+        std::cout << "[TB] compressed: got " << values.size()
+                  << " leaves, masks expect a different count\n";
         return false;
     }
 
+    StreamDigest leaves;
+    for (int z = 0; z < HEIGHT; z++)
+        for (int i = 0; i < N; i++) leaves.add(cb.leaf(z, i));
+    if (leaves != full.b_leaves) {
+        std::cout << "[TB] compressed: expanded leaves differ from the full stream\n";
+        return false;
+    }
+
+    std::vector<ghash_host::u128_t> b_root(N);
+    intmul_host::build_b_root(cb, b_root.data());
+    if (b_root != ref.b_root) {
+        std::cout << "[TB] compressed: b_root differs from the reference\n";
+        return false;
+    }
+
+    std::cout << "[TB] compressed: " << cb.value_count() << " / " << cb.full_count()
+              << " leaves sent, " << cb.payload_bytes() << " bytes vs "
+              << (size_t)B_LEAVES_LEN * 16 << " uncompressed\n";
     return true;
 }
 
-static std::string u64_to_hex(u64 x) {
-    uint64_t lo = (uint64_t)x;
-    std::ostringstream oss;
-    oss << "0x" << std::hex << std::setfill('0') << std::setw(16) << lo;
-    return oss.str();
+// Flip one c_lo word and expect the kernel to flag exactly that row.
+template <int NV, int LB>
+static bool check_mismatch_report(
+    const u64* a_raw, const u64* b_raw, const u64* clo_raw, const u64* chi_raw
+) {
+    const int N = IntMulSize<NV, LB>::N;
+    const int B_LEAVES_LEN = IntMulSize<NV, LB>::B_LEAVES_LEN;
+
+    std::vector<u64> clo_bad(clo_raw, clo_raw + N);
+    const int bad_row = N / 2 + 1 < N ? N / 2 + 1 : N - 1;
+    clo_bad[bad_row] ^= 1;
+
+    hls::stream<axis64_t> a_in("a_in_m");
+    hls::stream<axis64_t> b_in("b_in_m");
+    hls::stream<axis64_t> clo_in("clo_in_m");
+    hls::stream<axis64_t> chi_in("chi_in_m");
+    hls::stream<axis128_t> a_root_out("a_root_out_m");
+    hls::stream<axis128_t> b_leaves_out("b_leaves_out_m");
+    hls::stream<axis64_t> b_mask_out("b_mask_out_m");
+    ap_uint<1> roots_match = 1;
+    int mismatch_idx = -1;
+    IntMulPerf perf;
+
+    push_inputs(a_in, b_in, clo_in, chi_in, a_raw, b_raw, clo_bad.data(), chi_raw, N);
+    std::thread kernel([&] {
+        run_kernel<NV, LB>(a_in, b_in, clo_in, chi_in, a_root_out, b_leaves_out, b_mask_out,
+                           0, N, 0, roots_match, mismatch_idx, perf);
+    });
+    for (int i = 0; i < B_LEAVES_LEN; i++) pop_axis128(b_leaves_out);
+    for (int i = 0; i < N; i++) pop_axis128(a_root_out);
+    kernel.join();
+
+    std::cout << "[TB] corrupted c_lo[" << bad_row << "]: roots_match=" << (int)roots_match
+              << " mismatch_idx=" << mismatch_idx << "\n";
+    if (roots_match || mismatch_idx != bad_row) return false;
+
+    // a row_count outside 1 .. N is rejected without touching the streams
+    push_inputs(a_in, b_in, clo_in, chi_in, a_raw, b_raw, clo_raw, chi_raw, 1);
+    for (int rows : { 0, N + 1, -1 }) {
+        roots_match = 1;
+        mismatch_idx = 0;
+        run_kernel<NV, LB>(a_in, b_in, clo_in, chi_in, a_root_out, b_leaves_out, b_mask_out,
+                           0, rows, 0, roots_match, mismatch_idx, perf);
+        if (roots_match || mismatch_idx != -1 || a_in.size() != 1 || !a_root_out.empty() ||
+            !b_leaves_out.empty() || perf.read_cycles != 0 || perf.leaves_cycles != 0) {
+            std::cout << "[TB] row_count " << rows << " not rejected\n";
+            return false;
+        }
+    }
+    std::cout << "[TB] row_count 0, N + 1, -1 rejected\n";
+    return true;
 }
 
-static std::string u128_to_hex(u128 x) {
-    uint64_t hi = (uint64_t)(x >> 64);
-    uint64_t lo = (uint64_t)(x);
-    std::ostringstream oss;
-    oss << "0x"
-        << std::hex << std::setfill('0')
-        << std::setw(16) << hi
-        << std::setw(16) << lo;
-    return oss.str();
+// Pops the z-major leaves of n rows and checks leaf (z, i) against bit z of
+// b[i] ? a_root[i]^(2^z) : 1. Returns the first bad one as z * n + i, -1 if
+// none.
+static long first_bad_leaf(hls::stream<axis128_t>& leaves, const uint64_t* b,
+                           const ghash_host::u128_t* a_root, size_t n, int height) {
+    std::vector<ghash_host::u128_t> pow(a_root, a_root + n);
+    for (int z = 0; z < height; z++) {
+        for (size_t i = 0; i < n; i++) {
+            ghash_host::u128_t want = (b[i] >> z) & 1 ? pow[i] : ghash_host::gf_one();
+            if (to_host_u128(pop_axis128(leaves)) != want) return (long)((size_t)z * n + i);
+            pow[i] = ghash_host::gf_square(pow[i]);
+        }
+    }
+    return -1;
 }
 
-static void push_axis64(hls::stream<axis64_t>& s, u64 x) {
-    axis64_t v;
-    v.data = (ap_uint<64>)x;
-    s.write(v);
-}
+// Split the rows over 4 CUs (threads standing in for the hardware CUs,
+// N / 8 rows per invocation), merge a_root and compare it with the single
+// run. Each launch checks its slice's leaves against the reference as it
+// pops them, so no full b_leaves table is built. One c_lo word is
+// corrupted so the global mismatch index is checked too.
+template <int NV, int LB>
+static bool check_multi_cu(
+    const u64* a_raw, const u64* b_raw, const u64* clo_raw, const u64* chi_raw,
+    const StreamCheck& full, const intmul_host::ReferenceResult& ref
+) {
+    const int N = IntMulSize<NV, LB>::N;
+    const int HEIGHT = IntMulSize<NV, LB>::HEIGHT;
+
+    std::vector<uint64_t> a = to_host_u64(a_raw, N), b = to_host_u64(b_raw, N);
+    std::vector<uint64_t> clo_bad = to_host_u64(clo_raw, N), chi = to_host_u64(chi_raw, N);
+    const int bad_row = N > 3 ? N - 3 : 0;
+    clo_bad[bad_row] ^= 1;
+
+    std::mutex bad_lock;
+    long bad_leaf = -1;   // global z * N + i
+    auto launch = [&](int, const intmul_host::IntMulInputs& in, const intmul_host::RowRange& r,
+                      intmul_host::CuSliceOutput& out) {
+        hls::stream<axis64_t> a_in, b_in, clo_in, chi_in;
+        hls::stream<axis128_t> a_root_out, b_leaves_out;
+        hls::stream<axis64_t> b_mask_out;
+        ap_uint<1> roots_match = 0;
+        int mismatch_idx = 0;
+        IntMulPerf perf;
+
+        for (size_t j = r.offset; j < r.offset + r.count; j++) {
+            push_axis64(a_in,   (u64)in.a[j]);
+            push_axis64(b_in,   (u64)in.b[j]);
+            push_axis64(clo_in, (u64)in.c_lo[j]);
+            push_axis64(chi_in, (u64)in.c_hi[j]);
+        }
+        run_kernel<NV, LB>(a_in, b_in, clo_in, chi_in, a_root_out, b_leaves_out, b_mask_out,
+                           (int)r.offset, (int)r.count, 0, roots_match, mismatch_idx, perf);
+
+        for (size_t j = 0; j < r.count; j++)
+            out.a_root.push_back(to_host_u128(pop_axis128(a_root_out)));
+        long k = first_bad_leaf(b_leaves_out, in.b + r.offset, ref.a_root.data() + r.offset,
+                                r.count, HEIGHT);
+        if (k >= 0) {
+            long g = (long)((size_t)(k / r.count) * N + r.offset + k % r.count);
+            std::lock_guard<std::mutex> l(bad_lock);
+            if (bad_leaf < 0 || g < bad_leaf) bad_leaf = g;
+        }
+        out.roots_match  = roots_match;
+        out.mismatch_idx = mismatch_idx;
+    };
+
+    const int n_cus = 4;
+    const size_t rows_per_cu = (N / 8 > 0) ? N / 8 : 1;
+    intmul_host::CuScheduler sched(n_cus, rows_per_cu, launch, false);
+    intmul_host::IntMulInputs in = { a.data(), b.data(), clo_bad.data(), chi.data(), (size_t)N };
+    intmul_host::IntMulOutputs out;
+    if (!sched.run(in, out)) {
+        std::cout << "[TB] multi-CU: run rejected\n";
+        return false;
+    }
 
-static u128 pop_axis128(hls::stream<axis128_t>& s) {
-    axis128_t v = s.read();
-    return (u128)v.data;
+    // 0 CUs runs one; no rows or 0 rows per CU never match
+    intmul_host::IntMulOutputs one_cu, none;
+    intmul_host::IntMulInputs empty = in;
+    empty.n_rows = 0;
+    if (!intmul_host::CuScheduler(0, rows_per_cu, launch, false).run(in, one_cu) ||
+        one_cu.roots_match || one_cu.mismatch_idx != bad_row ||
+        intmul_host::CuScheduler(n_cus, rows_per_cu, launch, false).run(empty, none) ||
+        none.roots_match || none.mismatch_idx != -1 ||
+        intmul_host::CuScheduler(n_cus, 0, launch, false).run(in, none) || none.roots_match) {
+        std::cout << "[TB] multi-CU: degenerate CU count / slice size / row count mishandled\n";
+        return false;
+    }
+
+    StreamDigest a_root;
+    for (const ghash_host::u128_t& x : out.a_root) a_root.add(x);
+    if (a_root != full.a_root) {
+        std::cout << "[TB] multi-CU: merged a_root differs from the single run\n";
+        return false;
+    }
+    if (bad_leaf >= 0 || !out.b_leaves.empty()) {
+        std::cout << "[TB] multi-CU: b_leaves != reference at k=" << bad_leaf << "\n";
+        return false;
+    }
+
+    std::cout << "[TB] multi-CU: " << n_cus << " CUs x " << rows_per_cu
+              << " rows, corrupted c_lo[" << bad_row << "]: roots_match=" << out.roots_match
+              << " mismatch_idx=" << out.mismatch_idx << "\n";
+    return !out.roots_match && out.mismatch_idx == bad_row;
 }
 
-int main() {
-    print_cwd();
+// The kernel C model as a runtime backend: a job is one direct call over
+// its rows, the input slot feeding the AXIS inputs.
+template <int NV, int LB>
+class CsimBackend : public intmul_host::JobBackend {
+public:
+    const char* name() const override { return "csim"; }
+    std::size_t max_rows() const override { return IntMulSize<NV, LB>::N; }
+
+    bool compute(int, const intmul_host::InputBuffers& in, int,
+                 intmul_host::OutputBuffers& out, std::string*) override {
+        hls::stream<axis64_t> a_in, b_in, clo_in, chi_in, b_mask_out;
+        hls::stream<axis128_t> a_root_out, b_leaves_out;
+        ap_uint<1> roots_match = 0;
+        int mismatch_idx = 0;
+        IntMulPerf perf;
+
+        for (size_t j = 0; j < in.n_rows; j++) {
+            push_axis64(a_in,   (u64)in.a[j]);
+            push_axis64(b_in,   (u64)in.b[j]);
+            push_axis64(clo_in, (u64)in.c_lo[j]);
+            push_axis64(chi_in, (u64)in.c_hi[j]);
+        }
+        run_kernel<NV, LB>(a_in, b_in, clo_in, chi_in, a_root_out, b_leaves_out, b_mask_out,
+                           0, (int)in.n_rows, 0, roots_match, mismatch_idx, perf);
+
+        out.a_root.resize(in.n_rows);
+        out.b_leaves.resize((size_t)IntMulSize<NV, LB>::HEIGHT * in.n_rows);
+        for (ghash_host::u128_t& x : out.a_root) x = to_host_u128(pop_axis128(a_root_out));
+        for (ghash_host::u128_t& x : out.b_leaves) x = to_host_u128(pop_axis128(b_leaves_out));
+        out.roots_match  = roots_match;
+        out.mismatch_idx = roots_match ? -1 : mismatch_idx;
+        return true;
+    }
+};
+
+// Reference backend whose compute fails on the fail_at-th call, as a
+// failed kernel run would
+class FailingBackend : public intmul_host::ReferenceBackend {
+public:
+    explicit FailingBackend(int fail_at) : calls_(0), fail_at_(fail_at) {}
+
+    bool compute(int in_slot, const intmul_host::InputBuffers& in, int out_slot,
+                 intmul_host::OutputBuffers& out, std::string* err) override {
+        if (calls_++ == fail_at_) {
+            if (err) *err = "kernel run " + std::to_string(fail_at_) + " failed";
+            return false;
+        }
+        return ReferenceBackend::compute(in_slot, in, out_slot, out, err);
+    }
 
-    static u64 a_raw[N];
-    static u64 b_raw[N];
-    // static u64 clo_raw[N];
-    // static u64 chi_raw[N];
+private:
+    int calls_;
+    int fail_at_;
+};
+
+// Quarters of the rows as separate jobs through the pipelined runtime on the
+// C model, one of them with a corrupted c_lo, against the reference backend
+// run job by job. Each job's outputs are released once compared, and the
+// reference runs one job at a time.
+template <int NV, int LB>
+static bool check_runtime(const u64* a_raw, const u64* b_raw, const u64* clo_raw, const u64* chi_raw) {
+    const int N = IntMulSize<NV, LB>::N;
+    const size_t rows = N >= 4 ? N / 4 : 1;
+    const int n_jobs = (int)(N / rows);
+
+    std::vector<uint64_t> a = to_host_u64(a_raw, N), b = to_host_u64(b_raw, N);
+    std::vector<uint64_t> clo = to_host_u64(clo_raw, N), chi = to_host_u64(chi_raw, N);
+    const size_t bad_job = n_jobs > 1 ? 1 : 0, bad_row = rows > 1 ? rows - 2 : 0;
+    clo[bad_job * rows + bad_row] ^= 1;
+
+    std::vector<intmul_host::IntMulInputs> jobs(n_jobs);
+    for (int j = 0; j < n_jobs; j++) {
+        size_t o = (size_t)j * rows;
+        jobs[j] = { a.data() + o, b.data() + o, clo.data() + o, chi.data() + o, rows };
+    }
 
-    static u128 a_root[N];
-    // static u128 clo_root[N];
-    // static u128 chi_root[N];
-    static u128 b_leaves[B_LEAVES_LEN];
-    // static u128 b_root[N];
-    // static u128 c_root[N];
+    CsimBackend<NV, LB> csim;
+    intmul_host::ReferenceBackend ref;
+    std::vector<intmul_host::IntMulOutputs> got(n_jobs);
+    intmul_host::IntMulOutputs want;
+    std::string err;
+    intmul_host::RuntimeStats st;
+    {
+        intmul_host::WitnessRuntime rt(csim);
+        for (int j = 0; j < n_jobs; j++) {
+            if (!rt.submit(jobs[j], got[j], &err)) {
+                std::cout << "[TB] runtime: " << err << "\n";
+                return false;
+            }
+        }
+        if (!rt.wait(&err)) {
+            std::cout << "[TB] runtime: " << err << "\n";
+            return false;
+        }
+        st = rt.stats();
+    }
+
+    intmul_host::IntMulInputs too_big = { a.data(), b.data(), clo.data(), chi.data(), (size_t)N + 1 };
+    intmul_host::IntMulOutputs unused;
+    if (intmul_host::run_job(csim, too_big, unused, &err)) {
+        std::cout << "[TB] runtime: oversized job accepted\n";
+        return false;
+    }
 
-    if (!load_witness_u64_file(A_FILE, a_raw))   return 1;
-    if (!load_witness_u64_file(B_FILE, b_raw))   return 1;
-    // if (!load_witness_u64_file(LO_FILE, clo_raw)) return 1;
-    // if (!load_witness_u64_file(HI_FILE, chi_raw)) return 1;
+    for (int j = 0; j < n_jobs; j++) {
+        intmul_host::run_job(ref, jobs[j], want, &err);
+        if (got[j].a_root != want.a_root || got[j].b_leaves != want.b_leaves) {
+            std::cout << "[TB] runtime: job " << j << " outputs differ from the reference backend\n";
+            return false;
+        }
+        bool bad = (size_t)j == bad_job;
+        if (got[j].roots_match == bad || want.roots_match == bad ||
+            (bad && (got[j].mismatch_idx != (long)bad_row || want.mismatch_idx != (long)bad_row))) {
+            std::cout << "[TB] runtime: job " << j << " roots_match=" << got[j].roots_match
+                      << " mismatch_idx=" << got[j].mismatch_idx << "\n";
+            return false;
+        }
+        got[j] = intmul_host::IntMulOutputs();
+    }
+    // a failed kernel run fails wait() for its batch only, and the next job still runs
+    {
+        FailingBackend flaky(1);
+        intmul_host::WitnessRuntime rt(flaky);
+        std::string wait_err;
+        // readback is one thread, so the jobs can share want
+        for (int j = 0; j < n_jobs; j++) rt.submit(jobs[j], want, &err);
+        bool first = rt.wait(&wait_err);
+        rt.submit(jobs[0], want, &err);
+        bool second = rt.wait();
+        if (first || wait_err.empty() || !second || rt.stats().failed != 1) {
+            std::cout << "[TB] runtime: failed kernel run not reported by wait()\n";
+            return false;
+        }
+    }
+    // the row check finds the corrupted row up front, and a checking runtime rejects its job
+    std::vector<size_t> bad_rows;
+    intmul_host::IntMulInputs all = { a.data(), b.data(), clo.data(), chi.data(), (size_t)N };
+    size_t n_bad = intmul_host::check_intmul_rows(all, 0, &bad_rows);
+    if (n_bad != 1 || bad_rows.size() != 1 || bad_rows[0] != bad_job * rows + bad_row) {
+        std::cout << "[TB] runtime: row check found " << n_bad << " bad rows\n";
+        return false;
+    }
+    {
+        // one job at a time, so only one job's outputs are held
+        intmul_host::WitnessRuntime rt(csim, intmul_host::RUNTIME_SLOTS, true);
+        for (int j = 0; j < n_jobs; j++) {
+            bool accepted = rt.submit(jobs[j], want, &err);
+            rt.wait();
+            if (accepted == ((size_t)j == bad_job)) {
+                std::cout << "[TB] runtime: checked submit of job " << j << " wrong\n";
+                return false;
+            }
+        }
+    }
+
+    std::cout << "[TB] runtime: " << st.jobs << " jobs x " << rows << " rows, corrupted row "
+              << bad_row << " of job " << bad_job << " reported and rejected by the row check\n";
+    return true;
+}
+
+// Full testbench for one problem size. Returns 0 on PASS.
+//
+// The kernel runs on its own thread and the outputs are checked as they
+// come out (check_output_streams); no output is held in full.
+template <int NV, int LB>
+static int run_testbench(const u64* a_raw, const u64* b_raw, const u64* clo_raw, const u64* chi_raw) {
+    static_assert(LB == intmul_host::LOG_BITS, "the host golden model has 64 leaves per row");
+    const int N = IntMulSize<NV, LB>::N;
+    const int HEIGHT = IntMulSize<NV, LB>::HEIGHT;
+
+    std::cout << "\n==== N_VARS = " << NV << ", LOG_BITS = " << LB << " ====\n";
+
+    // golden model: a_root, b_root, c_root of the host reference (O(N), no leaves)
+    std::vector<uint64_t> a64 = to_host_u64(a_raw, N), b64 = to_host_u64(b_raw, N);
+    std::vector<uint64_t> clo64 = to_host_u64(clo_raw, N), chi64 = to_host_u64(chi_raw, N);
+    intmul_host::IntMulInputs ref_in = { a64.data(), b64.data(), clo64.data(), chi64.data(), (size_t)N };
+    intmul_host::ReferenceOptions ref_opt;
+    intmul_host::ReferenceResult ref;
+    intmul_host::run_reference(ref_in, ref_opt, ref);
 
     hls::stream<axis64_t> a_in("a_in");
     hls::stream<axis64_t> b_in("b_in");
-    // hls::stream<axis64_t> clo_in("clo_in");
-    // hls::stream<axis64_t> chi_in("chi_in");
+    hls::stream<axis64_t> clo_in("clo_in");
+    hls::stream<axis64_t> chi_in("chi_in");
 
     hls::stream<axis128_t> a_root_out("a_root_out");
-    // hls::stream<axis128_t> clo_root_out("clo_root_out");
-    // hls::stream<axis128_t> chi_root_out("chi_root_out");
     hls::stream<axis128_t> b_leaves_out("b_leaves_out");
-    // hls::stream<axis128_t> b_root_out("b_root_out");
-    // hls::stream<axis128_t> c_root_out("c_root_out");
-
-    for (int i = 0; i < N; i++) {
-        push_axis64(a_in,   a_raw[i] );
-        push_axis64(b_in,   b_raw[i] );
-        // push_axis64(clo_in, clo_raw[i]);
-        // push_axis64(chi_in, chi_raw[i]);
-    }
-
-    // intmul_witness_step(
-    //     a_in, b_in, clo_in, chi_in,
-    //     a_root_out, clo_root_out, chi_root_out,
-    //     b_leaves_out, b_root_out, c_root_out
-    // );
-    intmul_witness_step(a_in, b_in, a_root_out, b_leaves_out);
-    
-    for (int i = 0; i < N; i++) a_root[i] = pop_axis128(a_root_out);
-    // for (int i = 0; i < N; i++) clo_root[i] = pop_axis128(clo_root_out);
-    // for (int i = 0; i < N; i++) chi_root[i] = pop_axis128(chi_root_out);
-    for (int i = 0; i < B_LEAVES_LEN; i++) b_leaves[i] = pop_axis128(b_leaves_out);
-    // for (int i = 0; i < N; i++) b_root[i] = pop_axis128(b_root_out);
-    // for (int i = 0; i < N; i++) c_root[i] = pop_axis128(c_root_out);
+    hls::stream<axis64_t> b_mask_out("b_mask_out");
+
+    ap_uint<1> roots_match = 0;
+    int mismatch_idx = 0;
+    IntMulPerf perf;
+
+    push_inputs(a_in, b_in, clo_in, chi_in, a_raw, b_raw, clo_raw, chi_raw, N);
+
+    std::thread kernel([&] {
+        run_kernel<NV, LB>(
+            a_in, b_in, clo_in, chi_in,
+            a_root_out, b_leaves_out, b_mask_out,
+            0, N, 0, roots_match, mismatch_idx, perf
+        );
+    });
+    StreamCheck check;
+    bool host_ok = check_output_streams(a_root_out, b_leaves_out, b_raw, ref, N, HEIGHT, check);
+    kernel.join();
+    if (!host_ok) {
+        std::cout << "\n[TB] FAIL: kernel output differs from the reference\n";
+        return 2;
+    }
+    host_ok = ref.roots_match;
+    if (!check_perf(perf, N, HEIGHT)) return 6;
 
     std::cout << "\n== a_root first 10 ==\n";
-    for (int i = 0; i < (N < 10 ? N : 10); i++)
-        std::cout << i << "\t" << u128_to_hex(a_root[i]) << "\n";
+    for (size_t i = 0; i < check.a_root_head.size(); i++)
+        std::cout << i << "\t" << u128_to_hex(check.a_root_head[i]) << "\n";
 
     std::cout << "\n== b-leaves first 10 ==\n";
-    for (int i = 0; i < (N < 10 ? N : 10); i++)
-        std::cout << i << "\t" << u128_to_hex(b_leaves[i]) << "\n";
-      
-    // std::cout << "\n== clo_root first 10 ==\n";
-    // for (int i = 0; i < (N < 10 ? N : 10); i++)
-    //     std::cout << i << "\t" << u128_to_hex(clo_root[i]) << "\n";
-
-    // std::cout << "\n== chi_root first 10 ==\n";
-    // for (int i = 0; i < (N < 10 ? N : 10); i++)
-    //     std::cout << i << "\t" << u128_to_hex(chi_root[i]) << "\n";
-
-    // std::cout << "\n== b_root first 10 ==\n";
-    // for (int i = 0; i < (N < 10 ? N : 10); i++)
-    //     std::cout << i << "\t" << u128_to_hex(b_root[i]) << "\n";
-
-    // std::cout << "\n== c_root first 10 ==\n";
-    // for (int i = 0; i < (N < 10 ? N : 10); i++)
-    //     std::cout << i << "\t" << u128_to_hex(c_root[i]) << "\n";
-
-    // bool ok = true;
-    // for (int i = 0; i < N; i++) {
-    //     if (b_root[i] != c_root[i]) {
-    //         std::cout << "[TB] mismatch at i=" << i
-    //                   << " b_root=" << u128_to_hex(b_root[i])
-    //                   << " c_root=" << u128_to_hex(c_root[i]) << "\n";
-    //         ok = false;
-    //         break;
-    //     }
-    // }
-
-    // if (ok) {
-    //     std::cout << "\n[TB] PASS: b_root == c_root for all " << N << " entries.\n";
-    //     return 0;
-    // } else {
-    //     std::cout << "\n[TB] FAIL.\n";
-    //     return 2;
-    // }
-}
\ No newline at end of file
+    for (size_t i = 0; i < check.leaves_head.size(); i++)
+        std::cout << i << "\t" << u128_to_hex(check.leaves_head[i]) << "\n";
+
+    std::cout << "\n== b_root / c_root first 10 (reference) ==\n";
+    for (int i = 0; i < (N < HEAD_LEN ? N : HEAD_LEN); i++)
+        std::cout << i << "\t" << u128_to_hex(from_host_u128(ref.b_root[i]))
+                  << "\t" << u128_to_hex(from_host_u128(ref.c_root[i])) << "\n";
+    if (!ref.roots_match)
+        std::cout << "[TB] reference b_root != c_root at i=" << ref.mismatch_idx << "\n";
+
+    if (!check_compressed_mode<NV, LB>(a_raw, b_raw, clo_raw, chi_raw, check, ref)) return 3;
+    if (!check_mismatch_report<NV, LB>(a_raw, b_raw, clo_raw, chi_raw)) return 4;
+    if (!check_multi_cu<NV, LB>(a_raw, b_raw, clo_raw, chi_raw, check, ref)) return 5;
+    if (!check_runtime<NV, LB>(a_raw, b_raw, clo_raw, chi_raw)) return 7;
+
+    if (roots_match && host_ok) {
+        std::cout << "\n[TB] PASS: b_root == c_root for all " << N << " entries.\n";
+        return 0;
+    } else {
+        std::cout << "\n[TB] FAIL: kernel mismatch_idx=" << mismatch_idx << "\n";
+        return 2;
+    }
+}
+
+// Rows from the witness generator (c_hi || c_lo = a * b), for the sizes not covered by the files.
+template <int NV, int LB>
+static int run_generated(uint64_t seed) {
+    const int N = IntMulSize<NV, LB>::N;
+    std::vector<uint64_t> a64(N), b64(N), clo64(N), chi64(N);
+    intmul_host::generate_witness_rows(seed, 0, N, a64.data(), b64.data(), clo64.data(), chi64.data(), 0);
+    std::vector<u64> a(a64.begin(), a64.end()), b(b64.begin(), b64.end());
+    std::vector<u64> clo(clo64.begin(), clo64.end()), chi(chi64.begin(), chi64.end());
+    return run_testbench<NV, LB>(a.data(), b.data(), clo.data(), chi.data());
+}
+
+int main() {
+    print_cwd();
+
+    const int N = KernelSize::N;
+    std::vector<uint64_t> a64(N), b64(N), clo64(N), chi64(N);
+    intmul_host::WitnessFile files[4] = {
+        { A_FILE, a64.data(), (size_t)N },
+        { B_FILE, b64.data(), (size_t)N },
+        { LO_FILE, clo64.data(), (size_t)N },
+        { HI_FILE, chi64.data(), (size_t)N },
+    };
+    if (!intmul_host::load_witness_files(files, 4, true)) return 1;
+
+    std::vector<u64> a_raw(a64.begin(), a64.end()), b_raw(b64.begin(), b64.end());
+    std::vector<u64> clo_raw(clo64.begin(), clo64.end()), chi_raw(chi64.begin(), chi64.end());
+
+    int rc = run_testbench<KernelSize::N_VARS, KernelSize::LOG_BITS>(
+        a_raw.data(), b_raw.data(), clo_raw.data(), chi_raw.data());
+    if (rc != 0) return rc;
+
+    // other sizes from the same build, through their DATAFLOW instantiations
+    if ((rc = run_generated<2, 6>(0x2545f4914f6cdd1dull)) != 0) return rc;
+    if ((rc = run_generated<7, 6>(0x9e3779b97f4a7c15ull)) != 0) return rc;
+    return 0;
+}
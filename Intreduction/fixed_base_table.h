@@ -0,0 +1,4165 @@
+#pragma once
+
+// Generated by gen_fixed_base_table.cpp, do not edit.
+// FB_TABLE[base][k][j] = base^(j * 2^(8k)), base 0 = g, base 1 = g_c_hi = g^(2^64)
+
+static const int FB_BASES       = 2;
+static const int FB_WINDOWS     = 8;
+static const int FB_WINDOW_SIZE = 256;
+
+#define FB(hi, lo) ((((u128)hi##ull) << 64) | (u128)lo##ull)
+
+static const u128 FB_TABLE[FB_BASES][FB_WINDOWS][FB_WINDOW_SIZE] = {
+    // g
+    {
+        // window 0: g^(j * 2^0)
+        {
+            FB(0x0000000000000000, 0x0000000000000001),
+            FB(0x494ef99794d5244f, 0x9152df59d87a9186),
+            FB(0x104e4a835b335c8b, 0x1e192ab155791f07),
+            FB(0xca8015d2dfbf53b4, 0x9e233ef17a6d4b04),
+            FB(0x865c5ae557b98792, 0xc5488cd2dfc4e34e),
+            FB(0xc757eb8a61f6d78e, 0x3e284fc31c796cf9),
+            FB(0xd2a9c4058a8a6034, 0x094c6472e5fd473f),
+            FB(0xdc1d4ae16ef4df90, 0x321f40e40085d41a),
+            FB(0x9a75cef894a7f5fb, 0xac9d2a769ecf452f),
+            FB(0x0ff6f6b2df7fb02b, 0xdd4650936fd283be),
+            FB(0xbfb7f9809f2fb3d3, 0x6dfc3404299aaab2),
+            FB(0x507360a77792cda0, 0xb747856f04462310),
+            FB(0x357eed3eac601dd2, 0xb7ecb6877c17827a),
+            FB(0x86a8afc7f5f09bb0, 0xf46d33fda62217c1),
+            FB(0x1bb4af6a43f7f89d, 0x478763484d1a521b),
+            FB(0xaa77890a4b0cc26d, 0xadf546484ba1e795),
+            FB(0x2086a28f9fc31ff5, 0x0e07869533cd1c69),
+            FB(0xc7a9ce58ae55f7ba, 0xe4946a78b765f2fe),
+            FB(0x7a513153304f1830, 0x0874910c1b077a0f),
+            FB(0xc7377ed0dce42f34, 0x5e0241ad54f5d16b),
+            FB(0x645904900f76c031, 0x6868764c1df661f6),
+            FB(0xae72272fa46c7067, 0x8b9afee4963ddef7),
+            FB(0xb21ff9842c32c2b4, 0xe1da55219d11d938),
+            FB(0xf49ce77b574deacd, 0xccab12e0f55bc6a5),
+            FB(0xd6e894d7c021f09a, 0xe0ea6d15ee1a2156),
+            FB(0x27ea589bf380fe04, 0xfc3e0901b1c72a96),
+            FB(0x9f5fe9b2f207ef91, 0x67c82f25656d1b66),
+            FB(0xab9dbded2aa778d1, 0x9037fa988bdf91f5),
+            FB(0xb46d1346e3245f94, 0x62e120841be56f72),
+            FB(0xf5ed920555672858, 0xf49c0e7f20ad5930),
+            FB(0xbb87b4dbf1533394, 0x431e6d98e603154f),
+            FB(0x3527b2caada30993, 0x7b7f0c0322833177),
+            FB(0x1c75ca5a9e29aa1b, 0x6907e2caad5036b8),
+            FB(0x30cbb378580834d0, 0x48c1ebdda8a8412c),
+            FB(0xeed8bc7e8fe0c3a3, 0xb2b1ebcd74cc39d7),
+            FB(0xe0e0a5ec06c117ae, 0xbed5d9298a8d4c9a),
+            FB(0xc894e295da8ef5c9, 0x9a4d5b3eb3869e63),
+            FB(0x4f940758f3857e80, 0xcbdfb2ed1f609c3d),
+            FB(0xabbd91e5d0847378, 0x0f8bf1636628936a),
+            FB(0xf9a2016abca6bb60, 0x23b859b71155b7f5),
+            FB(0x7038c2071d455750, 0x2a70b451a403cba5),
+            FB(0xbe18f05a785801f4, 0x3652143e98b840f0),
+            FB(0xb7e3a85a43bd6318, 0x956e40ebba5e2297),
+            FB(0xbdb67c394b7fe55a, 0x994e5b8cc6fd8da5),
+            FB(0x0d1dfd441b77cc73, 0x74e39834e37e4759),
+            FB(0xe532cd3a0e907ec5, 0x6f7f66c44de41358),
+            FB(0x73012adea7e59c53, 0xa8f24859dfe1c877),
+            FB(0xac774666ca0261e1, 0xeabcad6d46c634b3),
+            FB(0x6947d9a55b083cd3, 0xe4561de82f206197),
+            FB(0x32f0e62c34486487, 0x2f14cad876830cd7),
+            FB(0x43908a80d6a06471, 0x6cbb903e04e8486a),
+            FB(0x3b5c0d37ef7283ef, 0x532a4f3e1afc0b58),
+            FB(0x78368c4089315d26, 0x3d0d1e91864f43f4),
+            FB(0x8bf1ad25dcf9e532, 0x576af826f3f2a2fb),
+            FB(0xbe7a6b012758c475, 0x7fba87b48be873ff),
+            FB(0x692dc8733cc1bac6, 0xb49b48a5510a0bc2),
+            FB(0x477e113681933a57, 0xafdc4069c85f4b1d),
+            FB(0xbd46439be0dca7f0, 0x4668c18f1b46c060),
+            FB(0x76ccc44645481daa, 0xfbfd22b82c89c691),
+            FB(0x1532cd95e0f14461, 0xac1e5e6943cbe28a),
+            FB(0x687fcb9c47085530, 0x7f9bf59c98ab4e4c),
+            FB(0xc71ee3fb7beae60d, 0x341d8fa473eb0d26),
+            FB(0x86b0039d596593fa, 0xf1109e9e24675180),
+            FB(0x044a229e2777b5e4, 0xc049926d5a691f51),
+            FB(0xbafbe3cbc7d084b9, 0x28ff2c64fac8e11b),
+            FB(0x804037594fe93d41, 0x0fa730816a23cbff),
+            FB(0x8b69c3790dd49b99, 0x928065828358325e),
+            FB(0x0822552bd14802cc, 0x35deb2d05c8c405a),
+            FB(0xc28153e226ff90dc, 0xfe10fc79b7f99adf),
+            FB(0xee14e07560c6311a, 0x68341a7aaafa016d),
+            FB(0xe97ffd32859d81f1, 0x4a01f0d69d98a3b9),
+            FB(0x1649092496732926, 0xd2c78e32308f7d86),
+            FB(0xd0a55f0abf784a8a, 0x51f8ab93628a911d),
+            FB(0x5c17c10e1105383f, 0x71c076121a5bb0ff),
+            FB(0x0b4f1e254fe782ba, 0x28efdcfd81ddc169),
+            FB(0x4b8ad741e3a9e1cf, 0x889f50edbd5c9d23),
+            FB(0xff2d325312adb0db, 0x2335cc3aa894cfed),
+            FB(0x8c199d90c1956e07, 0x70176ade5b599b33),
+            FB(0x0e619b5c11cc0aea, 0x7392c75e3d442c40),
+            FB(0x1500f94dfbc1d075, 0x09daa9acfe7535d4),
+            FB(0xef46afe9f70c1bea, 0xea2f78faada6b627),
+            FB(0x11ce671bf356ffe1, 0xa99a0acc0e521161),
+            FB(0x75b8b7ef2a18d182, 0x8b88938010ac6719),
+            FB(0x81eb524cf617c5f1, 0x97ae6c31eefac1ea),
+            FB(0x10d1baecedc88091, 0x37fc63696a9ff6bc),
+            FB(0xff0836a6f43d9c80, 0x580c1c72c02b7453),
+            FB(0x33554132d3f7fa1f, 0x03459551e4ae81a4),
+            FB(0x78d6fa105c92b977, 0x0323ffb1070f728e),
+            FB(0x3c27fa19437f7d60, 0xf054f49689aff8da),
+            FB(0xe126d2e40e300d1d, 0x30c8059f8fb095bb),
+            FB(0xb0a08c608d21e8cc, 0x3bdc131ac180bce6),
+            FB(0xed197a4385b4f8c8, 0xebeef75122f4b618),
+            FB(0xaddb55812fb50dce, 0x8795f0d73ef8e5b8),
+            FB(0x768a15b3cd8e431d, 0x1fff391031c36018),
+            FB(0xa1fea4b33e377214, 0x83c8520269bcf8eb),
+            FB(0x95dbfdd1377045e8, 0x2e0f338a97826593),
+            FB(0x195f6bd6173580bf, 0xd00e25c2a69871b8),
+            FB(0x4cdcf1011d5c6add, 0x2e4aab5cb40a9ba9),
+            FB(0x9d622a3bf62a64f2, 0x866c11cf64019af0),
+            FB(0xd24117e7d99bf683, 0xe87e473e7ab59043),
+            FB(0x66ea0264a2fdc57d, 0x3d5f884a743afbfb),
+            FB(0x59b5981cd8d38613, 0x839e61c3b9a3c8c1),
+            FB(0xa956daf439609494, 0x8665bc6dc2f59765),
+            FB(0x5dc2bba8160bc0bc, 0xbb8cbe10323b2d87),
+            FB(0xcf93911ce8ec3120, 0xa1518bdace30464a),
+            FB(0xbdaca8c9754fd3e3, 0x813f5afc894f9682),
+            FB(0xf2653fe0a07510ca, 0x4b9e5f68e0f1dc3e),
+            FB(0x0a48beb944782fb8, 0xa6774bcee66f9e98),
+            FB(0x65f38d920f4e4595, 0x56a682a9ad7fa7cb),
+            FB(0x66f1b46459d2399b, 0xc98afd592dc31858),
+            FB(0x0855745b818aad88, 0xa398b0e078b0ef5e),
+            FB(0xfd14a5bf835c94dc, 0x78e52edd05f207a1),
+            FB(0x3eb491fc9785850c, 0x90e654cca891f882),
+            FB(0xc0757186aac1708e, 0xa234a6ac81229cc1),
+            FB(0x622b6e2422bb2425, 0xad6c0e8786c02e69),
+            FB(0x433e607f375b20c0, 0xa7fae472fc5bb956),
+            FB(0xb400ccc8bc7c3f24, 0x7caf1181fe00bbeb),
+            FB(0xbaaba59ce57f0704, 0x126a4e14dc8cb189),
+            FB(0xcba5986188425b9d, 0xbc2e7bca2c7e2cc3),
+            FB(0xe91fbfc0c5eb7e40, 0x95f11523c1973ca5),
+            FB(0x589f8147c66b2fe8, 0x3bab658defa18e66),
+            FB(0x6d2b96849f9c8137, 0x03fce521da007d78),
+            FB(0xbffbadd6eee54c41, 0xdd75dbb2a63d397c),
+            FB(0xe5fa9d1915f4c9a4, 0xfe0900134b8df27f),
+            FB(0x9f4e5a0043ee2f6b, 0xd25d70c354b158bb),
+            FB(0x64000c277dc59748, 0x9110523313d9a03f),
+            FB(0x5878439f5f3978ff, 0x07a5f5895289b571),
+            FB(0xc1ec10505af56a7f, 0x56a1e3e6b274c98a),
+            FB(0x7cb75d25aae28762, 0xef8667619c526a6b),
+            FB(0x90effa35c5ee3c45, 0x498c5cbf1a430f50),
+            FB(0xc05d341794e3964e, 0x4f448940e27a35b5),
+            FB(0x211fcc139b5b8370, 0x18a3d24283f0f745),
+            FB(0xa2550d6ea6808a43, 0x691b2e11617e6774),
+            FB(0xa715763578f99686, 0xe0fce51562398be1),
+            FB(0x24d34f40baf16e72, 0x26df1190123588f4),
+            FB(0x74ca8d3d4d11287e, 0xa32f968b97d3579e),
+            FB(0xe769c18fa0e0bb5f, 0x5352554b066d5bba),
+            FB(0xff47943dd0ce407c, 0x9706af53ce1fef76),
+            FB(0x93ec8a4bad4ef6b9, 0x286def2a9b86a5dc),
+            FB(0x389ff8036644cb85, 0xfd12c0b7b9587235),
+            FB(0x9d09c0015735c829, 0x89872f5684a97b97),
+            FB(0x9ab3431e114d55b2, 0x55610424ed4f2af1),
+            FB(0xdc60015261111155, 0x4866a9cc28145678),
+            FB(0x5a00d0ca90a977fe, 0x9b09fdb799573597),
+            FB(0x262281bf986e62fa, 0x64258a8c12fcf6d2),
+            FB(0xa7a06ecd07a8c5a0, 0x17cd2be918beff06),
+            FB(0xcbb1ddc2a5932aa8, 0x86c319b0ffc2e146),
+            FB(0x7f8c719317eac82f, 0x5d7b6218fa7c811f),
+            FB(0x27130f7efdfe41ae, 0x1b01f79b923e6c9d),
+            FB(0x19e4506e78e2d4f2, 0x49388fd0c7f5f46c),
+            FB(0x133aa2a02ce324fd, 0xebe9ec3cedff9b16),
+            FB(0x937d6619fbf58752, 0x01a6f6ae5f5757d6),
+            FB(0x042c3024c944f0df, 0xc17fb4040b7c555b),
+            FB(0xe821d32836429e71, 0xdf4d8454104917a0),
+            FB(0xfcb0a7737a52167d, 0xa1e35ebc06e91f89),
+            FB(0xa701d63a3b86d755, 0x2728a3de50895673),
+            FB(0x3ea32da23446cfe4, 0x82ff89a027a79fdc),
+            FB(0x959e3b47b6561adc, 0x345d462b260c3c0e),
+            FB(0x8fb6516f4e0e1d4c, 0x5d26a5bf321bb2e7),
+            FB(0x8f92fc92cb5a10b5, 0xae39219225da7c3c),
+            FB(0xd3677e1ae240d828, 0x65ba6da4e1649e98),
+            FB(0x24ef06443bf4464c, 0x60491c4c132cebb7),
+            FB(0xc3efdae266aff420, 0x29c7ec430101b886),
+            FB(0x23c8724d40da556c, 0x79504c27c2972f88),
+            FB(0xa3913aa310c5c729, 0x3edce2b923b3c66b),
+            FB(0x08ef0e0bd5cd7b42, 0xb68581d745091719),
+            FB(0x81b9cb07e1445c9a, 0x7538d886e8dd6fa4),
+            FB(0xc3522bebb29cd04b, 0x296d26acb4976aa8),
+            FB(0x823c62f46cf291da, 0x915ad0b4953502d7),
+            FB(0x4149d2cd3b472c05, 0xee2d10ca8a724fa6),
+            FB(0x116b2192901fc343, 0x7372b6537b81c454),
+            FB(0xc875369d285e88a2, 0xf56a90e79a339535),
+            FB(0x9996efee31948834, 0x61a0659448dde935),
+            FB(0x400a8613950d5a90, 0x5d38f48c70d50367),
+            FB(0xcaec39425d89c209, 0xde84456a6f49a489),
+            FB(0x18659ff4616f7f20, 0x045b11fdbad10717),
+            FB(0xe7b207d05dcce75b, 0x32d08474977d3c4a),
+            FB(0xe920ee565aa19c56, 0x43360d10ca7c006a),
+            FB(0xa98546053526e525, 0x6bfbde006826fe23),
+            FB(0x20c075903cadbb95, 0x0376e223300bf97f),
+            FB(0x5e668d71e8bf6d65, 0xb9345cacc8b9dccd),
+            FB(0x8192b940af6a4d87, 0x1de39d2f51706fcc),
+            FB(0xd172f2199dc163bb, 0xccd0064b4ffd85d1),
+            FB(0xe08ffb463d4e137c, 0x1aede747117ab089),
+            FB(0xb50b5542aad69190, 0x325c06b77d0fcf85),
+            FB(0xea891b8407df12d5, 0xdca513532cac566f),
+            FB(0xe018b6898a9558b2, 0x9c17bba1669baa41),
+            FB(0x63ddfd9a2f9caaed, 0x416d89ed731c1180),
+            FB(0x9ca950cfc557599d, 0xa4efd4b1bc5cca5c),
+            FB(0x53fff0b16a32548b, 0xaf928696bc60c8ed),
+            FB(0x4b8a1425071b77c1, 0xd0f4ab0c6ccddca2),
+            FB(0x0c0c8c599c04a501, 0xc04ea2559334d348),
+            FB(0xf74fdc754b636d68, 0xc9fdd296d522356b),
+            FB(0x6f35b86b1876186a, 0x65ee4c575fbe7f70),
+            FB(0x5dcd0edf6fc211d7, 0xeb2fdefe0eb05e4e),
+            FB(0x1764431ef0326d36, 0x556a87ec1fd4a42d),
+            FB(0x2e297a4e3edfe825, 0x357e3fd7251f6c7b),
+            FB(0xd9c9f6708d58c411, 0x54deba5e5d7e6a21),
+            FB(0x615465d39dd5a396, 0x03222161604dc6c1),
+            FB(0x171152702f61907a, 0x5d611534c86b8ab6),
+            FB(0x63169e8942567417, 0xcb27075aedb89244),
+            FB(0x33735ac00487dee6, 0x23a8b9574e441aec),
+            FB(0x9661128272c1fe9c, 0x53a871bf9a2cd1a2),
+            FB(0xb4db99f7f1323241, 0xc797d12af8b51543),
+            FB(0xbd5be95451a73723, 0xea4939300e444a08),
+            FB(0xfc929a16816f6a73, 0xd2aed8e19a01d19a),
+            FB(0x9b5bf26f3d2cfcc0, 0x88682637b472369d),
+            FB(0x6885c290b2d7eea4, 0x21532497b353073c),
+            FB(0xdf0b54bb07c2ffdf, 0xddbf80b28b91181b),
+            FB(0xb16dea5ac81e09fb, 0xdd4c9acb55b5e254),
+            FB(0x3215f0c6ecadc41d, 0xa3be4b5774a4fff6),
+            FB(0xb18ed43cc843e99e, 0xa486756f1fbd269a),
+            FB(0x395325a1a155b863, 0x880ab6f6d67983d9),
+            FB(0xe40f88fdab847659, 0x7b90cb54556447ca),
+            FB(0x67c044f660ca2a1b, 0x2c6ede97765c3b80),
+            FB(0x532be2bce75fc08c, 0x539f40e5603d2695),
+            FB(0x75c86daea912015d, 0x6f724ef13cc31a84),
+            FB(0x1cbd086ac908f64d, 0x8872a33b9333d5fd),
+            FB(0x36066be0062b7539, 0xd23f651bbb26702d),
+            FB(0xa8b069261ec5e2c2, 0x8773032eb2d57457),
+            FB(0x65cdbebda678807a, 0xd5e6a6ffa143f094),
+            FB(0xb66a390758df90a7, 0x45cbf0ebbff3d78b),
+            FB(0x1777db42d080215b, 0xc2828b954f4c4fe0),
+            FB(0xf13dd9d134c09fa9, 0xdd14d31aa5e1cb6c),
+            FB(0xf18f074556bc52c1, 0x098a89d79db768ba),
+            FB(0x469011277322eff8, 0xb42c46b2bdffa21d),
+            FB(0xf40ee6edafb28e1f, 0xbff4b489aa71aff2),
+            FB(0x7a646ccd8bb2586c, 0xa045aeb53d87386c),
+            FB(0x2a4f2b0147fa5467, 0x5e2b285910260580),
+            FB(0xb953074e46944bfc, 0xf392b505a65d27fc),
+            FB(0x368ce5e2381ad52d, 0xc4b3c51c5968a52c),
+            FB(0xb61785e6df329ae2, 0x37c0874559d12e57),
+            FB(0x4620447c9898d1e2, 0x27eec2b2f56c515c),
+            FB(0x05eb4fdd9fbbae4f, 0x076af46ba9c61a32),
+            FB(0x79fbeb3cc4826f8b, 0xf5ad807b4fea5958),
+            FB(0x128c55edc57caa4c, 0x317a4b664181044b),
+            FB(0xd628d082738f3ce2, 0xe5986740d02a2a6d),
+            FB(0xf41f5a1a46f5e771, 0x95667e46d98e3096),
+            FB(0xcc56f9097113b42c, 0xe8ddce44c5f42140),
+            FB(0x9a38999cad477e26, 0x16ef1daee54187bb),
+            FB(0xd3a4284fd49e3a93, 0xee330b5877549dec),
+            FB(0x0a789f10a997fc20, 0x82cbc352cd859471),
+            FB(0x45306a2a195ccc50, 0x3d4e6e91d5d4819d),
+            FB(0x196e68b25b050432, 0xaf818c1727431466),
+            FB(0x21511d69a45b7843, 0xc393a1ae5cf974be),
+            FB(0x542e4a9c571e2bf9, 0x35a35749bdc3a315),
+            FB(0xf18808bc6e37a742, 0x9f996308c460d474),
+            FB(0xba68c5938ed14fba, 0xac2acaf4982c1d4a),
+            FB(0x3d274af5c1dc500d, 0x63a0c2af26611a79),
+            FB(0x56addea7c109a32b, 0xd00ca84f3a8045b6),
+            FB(0x2571010038b613e4, 0xc31be99709e351a3),
+            FB(0x725728542646fbae, 0x1437fbfc4cc4aec9),
+            FB(0xd6df8ed927ab2c62, 0xcd2dfa0c8ffa1112),
+            FB(0x3be9ec987fa656c8, 0x5e6d6cdca3860385),
+            FB(0xa1b8c1b1d30da31c, 0x91f336ed1f979430),
+            FB(0x8e0f5867baf52b8e, 0x8433199da8e2eea8),
+        },
+        // window 1: g^(j * 2^8)
+        {
+            FB(0x0000000000000000, 0x0000000000000001),
+            FB(0x96c611f7ca2000d5, 0xbea7bf39dea57f6f),
+            FB(0x0811fe79c2f92483, 0xc28a5811157c3bc5),
+            FB(0xeba0ce1c3fe0b482, 0x4b0874dfce67db7d),
+            FB(0x71c4c7e811e6cb6f, 0xb3261f151114928a),
+            FB(0x5538be61a08285db, 0x66bfe9ac62b22d13),
+            FB(0x9f3ddc698ebcffe7, 0xe054b8360214c21c),
+            FB(0xc8cb4977868f6ece, 0x1c956c2052c4bd3e),
+            FB(0xaeabbc4dbb958cd1, 0x86ada755d2550259),
+            FB(0x5f2d83738d57c6b8, 0x06c14a5b62b77026),
+            FB(0xebe1ffb624e728f4, 0xc8258739cc8f1166),
+            FB(0x5067dad939a68692, 0xf98104b60e2a3fe2),
+            FB(0x3829a30e5bfa4872, 0xeb8b738b5004b7dc),
+            FB(0x2928180f8ae66f3a, 0x46981fef78b381ed),
+            FB(0x90b9d242451de5ca, 0xdb49bb3102d48aa7),
+            FB(0xa639058d7ecf6374, 0x727bdad536f39711),
+            FB(0xb79bbb2936ad4805, 0x297e5ec7e99d37af),
+            FB(0xfe5da4c20d369e8b, 0xdcce136e91978620),
+            FB(0xdc3d6517d2d5f8ff, 0xfd3bb8d7af4f7aec),
+            FB(0x09574360d3a5f390, 0x9abb6f7f19a2870b),
+            FB(0xdf30a8bd401d542f, 0x440be6bc3cea2235),
+            FB(0x19d84604f33ca7ee, 0xebcd363feb35fbdf),
+            FB(0xa24b26c314e55351, 0xba30d209cf181520),
+            FB(0x4a335b8ef42831a5, 0x07639ee17e719a20),
+            FB(0xee877d21cb9e6be1, 0xc57008c414dfb942),
+            FB(0x91c204b139589205, 0x6e6b25cd4d7d4ea4),
+            FB(0x2d517c80a7957f5f, 0xf6b7e3630728ed83),
+            FB(0xaab99b16710699e3, 0x348f9c4f31af2e6f),
+            FB(0x16666a2f70517715, 0x78f3ff0ce49ac7ae),
+            FB(0xe5e7b8315e0fcb0e, 0x28d470ef68cd219f),
+            FB(0xc36aaf025992b82c, 0xc591ce242f84f318),
+            FB(0x5dc17c102b37d3a2, 0xada59392a0e6f63c),
+            FB(0x558b712c690d6d50, 0xc50eb46e54d55dcb),
+            FB(0x1154a7deb855893d, 0x19744aa55b5ecd6c),
+            FB(0x51f48e40d55ca648, 0x6834d0582c99f20a),
+            FB(0x6b88ec65f20a2870, 0x67412e1b2e9894c5),
+            FB(0x4be3b77821b7dcd7, 0x71602f891faf4024),
+            FB(0x8d7ba40b079d4139, 0x989280b9918a5ddd),
+            FB(0x600bb8a666c4797c, 0x34f990d869af4745),
+            FB(0x1a243abc990fd305, 0x5df49015024e22d4),
+            FB(0x0c399b66a9f7376f, 0x7550fa7bfb762665),
+            FB(0x50ca1726359a2160, 0x9c6d246b3157e0c4),
+            FB(0xf22b46997f780d0e, 0x7ddcb7828385d6f9),
+            FB(0x7fb68d54f0f0462d, 0x36cba94dc310670f),
+            FB(0x9b5056594741b2da, 0xdf0ea5bff482e2ee),
+            FB(0xc0233b88ed8b89e2, 0x07a268766113ee57),
+            FB(0x53cb8d96952ebf86, 0x362628c3dae0d4cf),
+            FB(0xc95c33423c9020a3, 0x38491c169fe62670),
+            FB(0xd79cdfe1c2754cbe, 0x926a3df30a31a9d2),
+            FB(0xb4c33616650ce4b9, 0x6c1217c1acf3dca8),
+            FB(0x53faa6590c420bd4, 0xaa1ec3b055485c80),
+            FB(0xb155ef42c24d52a3, 0x32281ad5dd327781),
+            FB(0x602bb2989694d426, 0xd6df4bbd94729d20),
+            FB(0x3ca623f1b8c5781e, 0x13da551127c20bb9),
+            FB(0xfaef3a33250b9d33, 0xee864e186238aba7),
+            FB(0x09ad1a71163975db, 0x29cc95b108397dbe),
+            FB(0x982633631a8b3771, 0xbf18b6c9b1fecba3),
+            FB(0x6e9ceee83040dc3b, 0x28848efa259ab253),
+            FB(0xa09cf7d86fc2cfda, 0xc8ec7b53975a7fa8),
+            FB(0xa254a30a39699fdc, 0xcc0fb30a4e3be47d),
+            FB(0xe2800efea77f0604, 0xd233052f2fc720af),
+            FB(0x8bc8229d2b17e2c2, 0x7b18e25292394f94),
+            FB(0x9a4ff49c83b5c606, 0x7b59c5d660acdf74),
+            FB(0xaa7376cc05a72b5c, 0xdc697fb8453faf7a),
+            FB(0xafc7e305ae9521ee, 0x5c57782c546ea37d),
+            FB(0xb9aae600fffae9c8, 0x79b2f73419ecf161),
+            FB(0x86ceea43c686589e, 0x6b8dee82b114a667),
+            FB(0x1d3921c30496a4ae, 0x392e66fe8e13226c),
+            FB(0xe3ec2641baa46169, 0x3baf9fd2836055bc),
+            FB(0x45cd52a443f5a9e5, 0xa3c70183a868eef3),
+            FB(0x5b6ff1ea81ee6599, 0x2d48629e7cdabe27),
+            FB(0xd55ff13cb9933c80, 0x7876d1cc2c0c0b42),
+            FB(0x4671bab855b48a83, 0x1df115970e993dc3),
+            FB(0xda26e6cd1453de7c, 0xfb01c2e8f9707eb6),
+            FB(0xa87d897c9470661a, 0x4bcb2e7b61d4fb71),
+            FB(0xc447e7ff9d26abf4, 0x202fd177ff005c0b),
+            FB(0x691076393be38726, 0x7204fc2fda58d797),
+            FB(0x77385ea5df8b713a, 0xb18f6692faf30de6),
+            FB(0xb58f4162f9ff7380, 0x66433b56319f59e7),
+            FB(0x3c1a0407803e5812, 0xe0f38296842a0e50),
+            FB(0x3ca3ab663115730a, 0xa82934fd95f5533a),
+            FB(0xca561b74218bcd0c, 0x49a84adf07ed801e),
+            FB(0xb679878d89f9022b, 0x96d775cb488d3828),
+            FB(0x3f67f024724abec2, 0xfa88fcbc8e47e9cd),
+            FB(0x3c4f6e033f582649, 0x80248ad178236bbc),
+            FB(0x70e098ed80a8f727, 0x71f02dff67f14059),
+            FB(0xc51c0108ad7eef0a, 0x7b2e2a086e7b3054),
+            FB(0x405367523aaad1d8, 0xe42f1651165d2db1),
+            FB(0x3506f75cb975931a, 0x2ff330a00d3150ef),
+            FB(0xa4cb720e346f56ed, 0x207d506452bbc1bd),
+            FB(0xb0175a9dac3af4ff, 0x9117e27fb538ab56),
+            FB(0xa81b81c350bef892, 0xf21e004277e0fe75),
+            FB(0xf0a6976eed561d48, 0x1eb1638f211a9e01),
+            FB(0xe99ceee077f9e18f, 0xabbe5c51ecda8a1c),
+            FB(0x940fcef398c3730a, 0xf3c413161837dfc4),
+            FB(0xad946c77c1ff8cff, 0xd2de78e2a08ad2ab),
+            FB(0x7cce7add1951f9ab, 0xb252e6fe1dd235f7),
+            FB(0xcb5f6cb6b2741783, 0x6dd080755ddfe1c7),
+            FB(0x4709b39d9079dd67, 0x20a77c9ef5032f6e),
+            FB(0xaf88543795be10d8, 0xd871f15639cca9b7),
+            FB(0xb1f409ab86619347, 0x38a9625c32227b48),
+            FB(0x7886501c75998a28, 0x89bb278f18413e61),
+            FB(0x5e8bfb9c86672324, 0xe3455c3be02a8ff3),
+            FB(0xc67250fb15f65a08, 0x68becb63a433e613),
+            FB(0x3d166e2d497823b0, 0x0c5d5a5d7e23175a),
+            FB(0x3232fb7b9e3a534d, 0x7d6ec07ebdc71cb0),
+            FB(0xb396872a0fa12aa5, 0x7efce8f9ca85e8e3),
+            FB(0xa5cc695693a88e13, 0x763cc64f24d21efc),
+            FB(0x5ca3c73da88a98d9, 0x00f3263a2a70c8df),
+            FB(0xf0058ee0300b26ba, 0x5b6cd9300aa5400d),
+            FB(0x2525a567e5c7ae86, 0x8d2ebf0cf68f510f),
+            FB(0xc8d1eb81043b3eac, 0x1422fa3b6a1c3a07),
+            FB(0x2397172edc853eda, 0xe1fcb60dc1a4bfe5),
+            FB(0xc445d113b8ce9d7a, 0x335b6327e819cc08),
+            FB(0x43cd2e8bc7d3d886, 0x9f19316d5bb6ac68),
+            FB(0x3e87ae4ef858631d, 0x29ef910c7cacc596),
+            FB(0x8c613acb348707cf, 0x0617a3718e5741f5),
+            FB(0xc6745de1383602af, 0xa5297e208c577162),
+            FB(0x8e44ff069b9e239a, 0xaa19482338121a88),
+            FB(0x2bf3847388b8d6f8, 0x3159e824fbd6837f),
+            FB(0xff39c5052b9604da, 0xd2b4903e0e6c5974),
+            FB(0xae47e8bc426d1e11, 0xcfd4de893a0c4628),
+            FB(0xf63790824a397f31, 0x7e5f8881be60e36b),
+            FB(0xdcffee2942255d40, 0x7efefaa173b08ee5),
+            FB(0x71914a4173403f85, 0xd6b8178eeb390f1b),
+            FB(0x192c1cf4e9f3be9b, 0xe09e33eaf0f8674a),
+            FB(0xae86fdd0f410dcf0, 0x18c5d3bc7b06da9d),
+            FB(0x8c60fcbaba82f40e, 0x84424970bfeb88a0),
+            FB(0xe652abd5bbdb0c84, 0xe69d5ba158a98394),
+            FB(0xe1f1943e64f05449, 0xdba4db8ecd9154bf),
+            FB(0x6f25baf3f379053b, 0x01415ca7d86f94a8),
+            FB(0xb610e2cd0d6ab79a, 0x603bd8fbe80ae5c8),
+            FB(0xde00dbd6db8032b6, 0xff4ccb7492f568de),
+            FB(0x653a162f4abe4b4d, 0x13059c5f4b8a7c66),
+            FB(0xab74be1108bae7cf, 0x48054c4ad057e3fc),
+            FB(0x7880e3ab22946094, 0xae8fafd3c3f3bde4),
+            FB(0xabf5c1e7573121a0, 0x38fac07a7d9c1d46),
+            FB(0xc291582973a9196d, 0x03833dcd5e80709f),
+            FB(0x3cdbc92af53e947d, 0x36f03794a938f5ca),
+            FB(0xfb7aa0ea020ce57b, 0xcc32b24c55fc6ca4),
+            FB(0xd00057403fa8cea9, 0xd5fcd6e22182666a),
+            FB(0x8ebe550530415dae, 0x11580eab349669be),
+            FB(0x2abfc9147a84e2c3, 0x7e3645c9b2d4c45b),
+            FB(0xb1440e4d5a82ac37, 0xd652c3f692b80699),
+            FB(0x7b37bea579ee3bdd, 0xff801210e6ac96a6),
+            FB(0x6409567005171cd7, 0xad45153953d7ba72),
+            FB(0x419b1646f641cd77, 0xda39e0b209f293fb),
+            FB(0x621525a7a70baeb7, 0xd0c283b36d1abaac),
+            FB(0xed8f9253e519d7d4, 0x5b7bba1a3329a0b4),
+            FB(0x403e883a8d54edfa, 0x7d3701df85b78425),
+            FB(0xbc787e95f7c1151f, 0x3b60164fee20376a),
+            FB(0xbae85c9520f96e2c, 0x3941ac5a6af69397),
+            FB(0x5843871ab43ebe10, 0xe934bffa9bfc524f),
+            FB(0xf1c4910023e8e853, 0x012c9fe4493e57d9),
+            FB(0xa4e8fa9dc89b95da, 0x494eb654ebd4e9fe),
+            FB(0x109b1a38172a3db8, 0x75d45e93198abefc),
+            FB(0x47c2fb2675c87f23, 0x0f6d4174f8fb857c),
+            FB(0x272679a55adf3a93, 0x2ac8e18cf6de4c53),
+            FB(0xe6b0f1d948744bde, 0x8012b4e0d6949512),
+            FB(0x4421366aae4ef2af, 0x8aa0ebc439ce134e),
+            FB(0xf6d3daf9fa41333f, 0xda96daecf89e2796),
+            FB(0xaa4d90d3ed43b89a, 0x5813980fba142cbc),
+            FB(0x8395b92cb415b227, 0x1cb3b723d9373cbb),
+            FB(0x377434000af27d27, 0xa87e4953bfb084f2),
+            FB(0x10729b73dfdbb953, 0xf12c4a16075e2a72),
+            FB(0xe706e0435ca331ff, 0xfd1d3f1aac5a2a3a),
+            FB(0xe56526807e52512a, 0xa94043ea24c4e343),
+            FB(0xf662dbbda278bfc9, 0x021147bb287502c1),
+            FB(0xf2b85f3107e85398, 0xa563d2c702211519),
+            FB(0xaa3745fb537fcd5a, 0x8b51d1e003be4ad5),
+            FB(0xfe2af92162bad043, 0xd436a8ea31e9029c),
+            FB(0xa1c193405ac237ca, 0x46614b0c55e2c76c),
+            FB(0xadb2aae404c321a3, 0xe169d5c2822b2693),
+            FB(0xb74dc65e69d9b925, 0xce81dc7616d01287),
+            FB(0x2418f1c467f7e41f, 0xb9ebeea433ff57f9),
+            FB(0x3844a5cfd2c5458c, 0xe9cc50ee578ab90a),
+            FB(0x97a25f4224e39a93, 0x7a1ce6d7549bf187),
+            FB(0xecee50765b2bcda4, 0xbe9134ea464b35c6),
+            FB(0xd0598600f81c3fbe, 0x827e0266ad46d10f),
+            FB(0xd64447ccea1c362f, 0x319a1d44799e7163),
+            FB(0x1a018cf680f97b41, 0xb0a3bdb7671e0056),
+            FB(0xc8b4ce81a8046293, 0xad9d2392a3d9f3a9),
+            FB(0xa8c4a52ec0aea297, 0xe23624875fb54164),
+            FB(0x46a2cf6089a59cc4, 0x0c90fabd614018ff),
+            FB(0x2a77934c59e407d2, 0x813efc28ef6b4490),
+            FB(0x39e4e9abd6d5f86e, 0xbb25dffc6d0c3d64),
+            FB(0xc9232bcf96d7bd0b, 0xb5905b28ece2ff2a),
+            FB(0x8072392178d2cf30, 0x3fcd9c865541df9f),
+            FB(0x1a757b129a8228ae, 0x67a9b784b8ce63ab),
+            FB(0x26a0a21102eabb47, 0x256d27125b7da6f1),
+            FB(0xa4121e2e50fab5c6, 0xf4ac404eb89f5507),
+            FB(0xdb3db57cf175002d, 0x88647e5743d3b77b),
+            FB(0x879d8aa29ce14b63, 0xa71ea6a80f75af78),
+            FB(0xf8ebb6c250e917ed, 0xea906c938ffc3b15),
+            FB(0x87028d210593445e, 0x4847b225d9cb86d1),
+            FB(0xe93c0f8954813da4, 0x90618914c7cf1da5),
+            FB(0x7eeb65714cea2f42, 0x121bca6b1a687687),
+            FB(0x669cdb77b5955bc0, 0x694d5e5ebc011617),
+            FB(0xa64af4c9aa7380de, 0x4a9520fcc36842bc),
+            FB(0x47fc30f0b09e4bdf, 0xa50f5e7ee07d3d0b),
+            FB(0x5eec67313560ee2a, 0xcf6268a250d67bc2),
+            FB(0x88ad29bb9f6a248c, 0x9ec9872ec85a2539),
+            FB(0x8aa08f21f315eeef, 0xe2967667e68a2cf7),
+            FB(0x7a8ffbc453c37191, 0x034cc2db83cffaa3),
+            FB(0x8888f361192a6bd4, 0x9e6662ad5ecc454d),
+            FB(0x6ec18cfe147f5c2d, 0x3e0d4fab55b3b2f3),
+            FB(0xae26ac40a76e1c5e, 0xcbcc246180c8349a),
+            FB(0x8368f55226a9a924, 0x0642fc8af5abdcb4),
+            FB(0xb2679c3756ea246e, 0x4419cec71fad4b4a),
+            FB(0xdcbc9f4c4561e646, 0xc629634e95289d4b),
+            FB(0x8c4f8d635851dd2e, 0x29ffe8c1f4c31d39),
+            FB(0xe8ece1bbb21cd75e, 0x92f50f61df4d977e),
+            FB(0x4cee181d9ea96a9d, 0x7b4c9c946bbf919b),
+            FB(0xedf6c8bb3e7cee61, 0x62c479f0d13b592a),
+            FB(0xc1ca9cea1d5bed18, 0x41a8ace5eaf8c1a2),
+            FB(0x079fdd5d564d3ed8, 0xdf9ed682357cfac5),
+            FB(0xde938bb7befdb750, 0xf9a5f6fd36a9432a),
+            FB(0xeab9b72ab706fbf5, 0x5fdb6fbb538813bf),
+            FB(0x3a451c86bac6a902, 0x9b446748064f6ddc),
+            FB(0x32258ebe2b5243c5, 0x24a448560febfd5e),
+            FB(0x54a4108091a86690, 0xf1cafa9de68ccb37),
+            FB(0xee72d57828a5305a, 0xe8f5c977d037dffc),
+            FB(0x90f933a8da3ec5c2, 0x1c36b909b5cbe1fa),
+            FB(0x467d849f1d913cbc, 0x7724be85679558a9),
+            FB(0x4abb18bbc8fd37d4, 0x4e908ce5f5d041c3),
+            FB(0xbc4eedf8f7cc9f2f, 0xe8053f5ef7c51605),
+            FB(0xbd7d699b238281ad, 0x2ea99acc3e6ddcc3),
+            FB(0xe97ee2f464901b1c, 0x2eda1150ea220eac),
+            FB(0x33e79874328cf723, 0xab8770a652b1da14),
+            FB(0x6bb68a197b940f30, 0x8a6ba136b882bc88),
+            FB(0xb4cc9e9db6a55bd7, 0x1f98929a3e8aee2d),
+            FB(0x6d641edf143344a9, 0x25ce8777f5b45030),
+            FB(0xe9ae6d90fcf08658, 0xd305dbfe1ac3de5d),
+            FB(0xeffd8f1936963170, 0xa151c87445853b6a),
+            FB(0xfe77e739cb48a885, 0xfa928079173ef770),
+            FB(0x2fac0f181a729bc9, 0x286b4d89e7acaa5d),
+            FB(0xafe0791a106b0e48, 0x613a6daa1ffe34fb),
+            FB(0x4788bb1530046575, 0x776952254d8f5c97),
+            FB(0x3a7138fb9c3aedaa, 0xb4a62bfd7d421e9b),
+            FB(0x1ddf8f12fe93bef7, 0x9fc12b492665bb49),
+            FB(0x512dff7ef9f70da1, 0x3f2e593c1918149d),
+            FB(0x2249052d44434cd8, 0x8757cdfddf727f4c),
+            FB(0xa7f12bd0dcb732f9, 0x77524567bcb892ae),
+            FB(0x19c205a23d23ef86, 0x8f6c31a83ab7e101),
+            FB(0x343a809f07618215, 0x168aae4d942c9a93),
+            FB(0x0847daa65595f0fa, 0xf212052acacf2339),
+            FB(0x0bcf5554d2ea794e, 0x671b51ff9e6b304e),
+            FB(0x559b32d37770671b, 0xe47cc9deb38e7da5),
+            FB(0xbab202cf52c130d9, 0xbdd67543b05fcc84),
+            FB(0xe0e8aedcb474617e, 0x3c31c8d27b169c67),
+            FB(0xf24574e4ab9e771f, 0xd86c7cf86498741f),
+            FB(0xc5564d7c4fd5cceb, 0xa52d6c0eca08d586),
+            FB(0xf6cd9a56531b727b, 0x3635873d4fdf7b38),
+            FB(0xb4c145008bfacc6d, 0x365b0c5fb17fbe4c),
+            FB(0xa9aa7c2f12d26dff, 0x3da8967263307fcb),
+            FB(0x7854940325a9b03d, 0x6372306070f06c17),
+        },
+        // window 2: g^(j * 2^16)
+        {
+            FB(0x0000000000000000, 0x0000000000000001),
+            FB(0xf270b46eee377bd5, 0x6932501a69949c31),
+            FB(0x3d57ee27427a46c3, 0x93efd0f189222fa7),
+            FB(0xffd14c750262336b, 0xd7d58f6a70939700),
+            FB(0xf33aa995d6ae43e2, 0x3257ccd07e10f780),
+            FB(0x0d95b79e71e73e19, 0xe624b0698ee420a2),
+            FB(0x5117669e19eff7b3, 0x17162f1bd8845a0a),
+            FB(0x4a2bedb7ff9def44, 0xfb5206a022c9388d),
+            FB(0x2c9da9eaad361ede, 0x281bf6a427a5fb4d),
+            FB(0xfd12a2a5fda8ec9e, 0xe38bf8a017459774),
+            FB(0x7d024bc414ca78e7, 0xabf8f2f9b4ace243),
+            FB(0x5c4fbcb48c5833e0, 0xd0d6c5a0d5300b34),
+            FB(0xf6928cf562186de9, 0xf72cc710308c5de7),
+            FB(0x082cfb78ddcf10e6, 0x36a7bf3e426bec95),
+            FB(0x069b2e74850015c0, 0x040e3e5d82633c19),
+            FB(0xc77e41a63c17e0ee, 0xa85af2a46a7a493c),
+            FB(0x31d16f51a878cbef, 0xf120d57df9c00df3),
+            FB(0xa3c00f369c1026f5, 0x4d21a5d2b1606c4c),
+            FB(0x5632c57a8b7f90dc, 0x0301edfac4846ced),
+            FB(0x11057d8317b978f1, 0x0c3b15ca08970ddf),
+            FB(0x867257540676ed31, 0xca49d7869eefb3d8),
+            FB(0x9a54b227947120ac, 0xb682c55452d68f62),
+            FB(0x8fb80a1c22821751, 0xb8a9d3c299f5ad28),
+            FB(0x0eeaa63d5828825a, 0x5a753d71b9cae267),
+            FB(0x7458416db98e22fd, 0x6b1ce69a544dcc03),
+            FB(0x526220d60294e996, 0x47c4aa01fb99d66e),
+            FB(0x24d6718e4d04cfbd, 0x0e1a8f6ed37be77d),
+            FB(0x79c94c944a79e0a8, 0x7678d2d6a5f7b6ec),
+            FB(0x0a5d640d32f2f200, 0x88f314058a8eb141),
+            FB(0xa1382b635d2ca363, 0x40cc725a9b19f284),
+            FB(0xfea1d1e025a0927e, 0xa6f49884bc6a96a3),
+            FB(0x93ef1e1f78740e3c, 0x79b29510ad093591),
+            FB(0xceaf338d1632e2f5, 0xa88b9ae99321d320),
+            FB(0x9ae7d88e2863a1f1, 0x7f847f17f079c4b3),
+            FB(0xcee3b4016f38c049, 0x2bb19302021722ce),
+            FB(0x9c1de4324aae0662, 0x2334c96c74126496),
+            FB(0xfd6b9934ecac9db9, 0xb341801a53794ed9),
+            FB(0x13343a7bffbe5e92, 0x3466d42a87bc32f3),
+            FB(0x87d70db8c30792df, 0x8d883b58caba7ad2),
+            FB(0x0b22e4e92217e536, 0x876d6637c0907fb4),
+            FB(0x9a22f955acf6bf64, 0x4b32b512c030daa0),
+            FB(0x9742f699a463585f, 0x1de416ccf0d2bced),
+            FB(0x21c0bf57090f07da, 0x5e7eba915c76f1d3),
+            FB(0x90674a784e77bd53, 0x1ea0d47b607b6e64),
+            FB(0xae483e8172d9feb6, 0x5f7c970dc9b2e3a0),
+            FB(0x999041a330bd636a, 0x9366d3bb9df831df),
+            FB(0x3ac39aeed33fa73e, 0x93836da59610c0c9),
+            FB(0xf5aa7c3351905aba, 0x688dc5078fff460d),
+            FB(0xf73dd79824990450, 0x6b76fbff4e670704),
+            FB(0x43ac3ff175187289, 0x2abc930bab8c1861),
+            FB(0xe5033e0e586d3d6d, 0x57780e1adc725d00),
+            FB(0x36042fccbbe78593, 0x9bb55ae77514df5e),
+            FB(0x140d3c22abf3fff0, 0x08321d1ccf1d6668),
+            FB(0x797fc0ad173f038b, 0xf0e5bfc085ef6dbb),
+            FB(0xdf7a840f08951e6c, 0x17c79f79e937aca6),
+            FB(0x005f67925413102c, 0x42c138115fde6c1d),
+            FB(0x63948b3865602924, 0xd97369636c1d1001),
+            FB(0xbcfc94d554a0b38f, 0x5b4b3995ebbf1a82),
+            FB(0xcc85ea922a557fd7, 0x9f7034d28b953fe2),
+            FB(0x4434c857d698e684, 0x4683c540c671c8d0),
+            FB(0x449b89be76ecec12, 0x5184c865040291f8),
+            FB(0xae7279a45c65ee82, 0xb2c4448775906b5f),
+            FB(0x50f1c22fedbdad21, 0x8e9be3312ebfe3d6),
+            FB(0x708cc008f6d78dba, 0x3642c27f76048eae),
+            FB(0xdfcfb76cd8febd76, 0xcc6b9d36ff3233a8),
+            FB(0x4f006f5eb2af2dc2, 0x15963887ca8f4089),
+            FB(0x71a2e6d203b4eabb, 0x68ca7bf98cbc7ee5),
+            FB(0xdecfc1edc666ec9d, 0x3dc3b171d8e5d92b),
+            FB(0x9fc2ebb912750089, 0x472dbbfcb40c154c),
+            FB(0xe68efcfbdf574126, 0xc4c9be11ad392d54),
+            FB(0x6ab5ab0cf4338d44, 0x46eff6a81e763f6f),
+            FB(0xa1cfb55d00c1eaf2, 0x74224ed4e576476b),
+            FB(0x47385f7b2645921f, 0x9496e0d07e403e57),
+            FB(0x099d484a610183ad, 0xe12a402efd8e4b9f),
+            FB(0x80898766e9c6cc34, 0x401d35f4d9891019),
+            FB(0x1e8bb9cd73b1b3c2, 0xbb7c5982cf4782ee),
+            FB(0x8a937dab2c516ba9, 0xe2df4f8e50715d48),
+            FB(0x76f35db17e0e6341, 0x81152aa9950c6105),
+            FB(0x634c0a66b04f8850, 0x4e1cccc0b1a0d47c),
+            FB(0x08a96bedee64f013, 0x999582ad13cf5c89),
+            FB(0x749b1b334f5efed0, 0xa59b244f21653017),
+            FB(0x3830f0b82d282f79, 0x78543403465da292),
+            FB(0x4cb2262720593634, 0x817a3f979398981d),
+            FB(0x16e3ba1a84d00dac, 0x5b132142e4ca0ade),
+            FB(0x0dfaa5773567bcea, 0x30173e3f5fc344d7),
+            FB(0x04b1f87155b1b785, 0x4895a98867dc2427),
+            FB(0x465e22e302c6df8d, 0x4fa6f48d666bf1ec),
+            FB(0xbb1cf97886212d3b, 0x013d3609e6f0a7a1),
+            FB(0xe6f14492f198c0dc, 0xb9745368548a0405),
+            FB(0x32f16125bed66b71, 0x83d00289c86303a7),
+            FB(0x2763531c21a19bdc, 0xda72277d6b900eee),
+            FB(0xe5b1849c3e2917ea, 0x85df2c8cdb1e3483),
+            FB(0xf9f0f2bf70a6c394, 0x748db10886e9e1e3),
+            FB(0x52c516ef6596a5eb, 0x810cf939bd28b5f6),
+            FB(0x3794bf8792a39986, 0xb7f3125dc4eb6ddc),
+            FB(0x98d9679c895310d3, 0x883a551cdf9c6916),
+            FB(0x35aca70a688f3397, 0x04057252086de241),
+            FB(0x8691ae973fd5b7d7, 0x3b1605fb6132d7c7),
+            FB(0x76fcb0e2f1052bc8, 0xa7b2e69ae87df17e),
+            FB(0x395449fc909a06d9, 0xc9483e53065740bf),
+            FB(0xb5e217d9b0f82ae0, 0x879a5031a36c5066),
+            FB(0x6ccca1fd6ab1c13f, 0x5619adb4aa67b254),
+            FB(0xd0294d632646cd86, 0x6d61a7da998355c1),
+            FB(0x789faeee9d458c27, 0xd8fb478271d65890),
+            FB(0x8f302c31b3e31f6f, 0xaf2528e114143f40),
+            FB(0x2ec6b8e818195698, 0x580139ac004d2716),
+            FB(0x9f4d9413f576a537, 0xcdf8e47e16eba328),
+            FB(0x8d17e7a3e0b07310, 0x04216ca08dcbecc3),
+            FB(0x1d3498e889253e6a, 0x75a04ae2e8f615fb),
+            FB(0x66dadaa390592f3a, 0xa6710e9cf4173c8c),
+            FB(0x100c8c20638a4415, 0xee25d4cf935234e1),
+            FB(0xe536def640810f9d, 0x959ffb49c838fb58),
+            FB(0x3ffb5a54f718aecf, 0x70ad6d533c451147),
+            FB(0x77de5886fcb2aa94, 0xc55941b6a2fae300),
+            FB(0x63de12d44a187eee, 0xab16997658feba46),
+            FB(0xc9007246c8987dec, 0x84597c484029a9cc),
+            FB(0xd8c4dddc8aed141a, 0x7f91beecc5577db0),
+            FB(0xe314b39f78a47d02, 0x39aac46779c778ee),
+            FB(0x6866d35cc1d9edc2, 0x6d5973eaf60d9d48),
+            FB(0xf8d99f11a1b73bd7, 0x7595aa5a2432fe37),
+            FB(0x6950246ab12464b7, 0xe157859fc4b1d464),
+            FB(0xf6ea5251c534e6e7, 0x55d4f331f8d90203),
+            FB(0xb2a2b906da74946d, 0xcbab25dc93c8c220),
+            FB(0xec138d9faa5e9f06, 0xbd4051e34ea7db0b),
+            FB(0xb77f6aebe61b3201, 0x81403741a13049ab),
+            FB(0x2d7a58113031bc8d, 0x12a1e16799498e6f),
+            FB(0xee35f99de00434be, 0x34513ddaa94039be),
+            FB(0xb9b1cf261cfcfd4d, 0x9d58bc31a456f9a6),
+            FB(0x4c528f4d10b0408d, 0x43be058b7738b173),
+            FB(0xa81ae4f7394287df, 0x0f2faa5c3abb4a9b),
+            FB(0x5a3a411e42639c9a, 0x097bb77c251ef665),
+            FB(0xe797ce8b503ddcfe, 0xeb9e98d8c22f4575),
+            FB(0xffe48e73b300605d, 0x42e8160b9aab297c),
+            FB(0xb3c874b1d183eeb2, 0x8480c33700b044a3),
+            FB(0x19d4cb07f5ad901f, 0xeb263256d4d07e2d),
+            FB(0xb7354e502ba11234, 0xce98ef16db501a97),
+            FB(0x7c17b666ca3d2f17, 0xc006e3a70130e170),
+            FB(0xce5ca323db7472fa, 0x93f1d51277551a0b),
+            FB(0xf65dbbc647cf0973, 0x5872f8a274d4122d),
+            FB(0xab8722555e51b681, 0x0129c669c7faa8b0),
+            FB(0x5feb0781aa4f6ddb, 0x22268caeec6a6913),
+            FB(0xa2e6b319711b1f31, 0x2a6a00a2eb56e3e7),
+            FB(0xc9be9f0c43ab8f27, 0x5438a5b89fe22c30),
+            FB(0xc4fecbe03b98db4e, 0xfc6b7bc56e820ceb),
+            FB(0x3bf9fbdc88219959, 0x033068d64048b906),
+            FB(0x516cc063425f4dad, 0x03a060a2b86d300c),
+            FB(0x75676a7b41c85782, 0x39d640f2d2fdb462),
+            FB(0xe8a79c90d69953ab, 0x4f949dc11a83e219),
+            FB(0xd021e037cff03357, 0xdc2ffa0498b28256),
+            FB(0xb62c8844aef73c0c, 0x9f5836a026d3cb90),
+            FB(0xe9c8f6286b2fd939, 0xb9ed4bb119b6e648),
+            FB(0x50b3dd34ae335437, 0x52982b2911d365b9),
+            FB(0xb7f914c4d241bf0d, 0x24b8e28c5e29fd60),
+            FB(0xadb2e45179a7e4aa, 0xa114be50bdf01bbc),
+            FB(0xa1462882da501fcc, 0x81bd2bf67a9275a0),
+            FB(0xfb86c6310c68a4de, 0xd56d3853f4c00955),
+            FB(0x7ec758e07386364f, 0x1e091f0ab0d8e766),
+            FB(0x7f77248a1512f06e, 0x7969fff44fc0df15),
+            FB(0x60a2bc5c0f74c14d, 0x86a3340e3a50c5da),
+            FB(0x613109553b0f1b91, 0xeb6ca22c9c0d7779),
+            FB(0xa740251ea04989c6, 0x5f22c89605853323),
+            FB(0xafaeaac1beaab2ed, 0x9e36c76a2b7565bb),
+            FB(0xaf828a3b2e337ac7, 0x25212c9373258a4d),
+            FB(0x4fc4b557153857ff, 0x1221a76ddec8b610),
+            FB(0x19924c5a133b57fc, 0x5d0d9705d02e9619),
+            FB(0x75ae5218b610740e, 0x95ed046050e8fb52),
+            FB(0x9c02afbd7cddb4f9, 0x9c4967442950a4e4),
+            FB(0x8af006115aede343, 0x92c3187afe82276f),
+            FB(0x2c1c09ead1a9e4bc, 0x82a836cd628bdec9),
+            FB(0x51e72f154ecec23b, 0xbcdf4d333ca085f3),
+            FB(0x18131abd4e8babcf, 0xebc10af455dacce2),
+            FB(0xc1d019b483b7441d, 0x6d78fd9d27a14c21),
+            FB(0x6a3198ba4b27eeca, 0x1621ae00490bb95f),
+            FB(0x92ca1fa0a476b25a, 0x0911217498d4dac6),
+            FB(0x785aabca0f59caa0, 0x9e7a49857120ed33),
+            FB(0xa2be71165f1504cc, 0x22733bdfec3b7a10),
+            FB(0xe3063e9f69545177, 0x3ab626adb0390bf0),
+            FB(0x1270cb47455f6217, 0xf8912e3f3cc94fae),
+            FB(0xd9327a8d6c815495, 0x20c529634f54ae9c),
+            FB(0x61d459aa56d112bc, 0x316339d39be6e0c3),
+            FB(0x47a57b97f18ebbe3, 0x08e19da664264bea),
+            FB(0x84ca848ca19e9605, 0x3a7c6eb54f1f0999),
+            FB(0xe4c50af3cc012ee2, 0xe1eb3c1388d0da88),
+            FB(0x1309f2e65520cd0d, 0xf9cbb12be14e56b2),
+            FB(0x1f7c6b7a6c3e7061, 0xab378204e6bb0e24),
+            FB(0x1d71fca87fa331e9, 0x687f6c26de07a415),
+            FB(0xb534b8a7d8068260, 0x2187490f91cdde77),
+            FB(0xa08e97316de36db6, 0x14bf21256e2bb3b2),
+            FB(0xd4df1a56710edb9b, 0x152f8aff72379a32),
+            FB(0x72809ce601c10b4c, 0x09bc6c4d67393ea0),
+            FB(0x26a9130977db6fc1, 0xb01ab4cb936824e8),
+            FB(0x8616bb4b8652fc2b, 0xd14e1d20268629c8),
+            FB(0x93c4f582c3ef32d2, 0x4da1ff78cdbe5ce4),
+            FB(0x42054482716b1c2f, 0x98bf8093f63bfdf9),
+            FB(0xcf0846b0f79c18ac, 0xa4033ad000d77d99),
+            FB(0x7bdd57d5dfd2a153, 0xffffc1720901a6ab),
+            FB(0xa55247970f3fef73, 0x7fc71da46a7381a2),
+            FB(0x5fe92a71115f750b, 0x06aba10094d2e1c8),
+            FB(0xea0eef3854381394, 0x473575c91a45521c),
+            FB(0xa5206d0fcbee1c34, 0x50b139de0883d2f2),
+            FB(0x13c9ef589cc21365, 0x1f2e1e922ef7a97d),
+            FB(0x9c57e8ae7a1bdb07, 0xce453767728baa66),
+            FB(0x548d98d298fd472d, 0x0bbb4fbbf581a40d),
+            FB(0x994898208cc25b99, 0x238d0e6578f8c55c),
+            FB(0x2353294e1d283fdd, 0x57253a4088078e32),
+            FB(0x5f276c2491d6b5a5, 0x4faed978c994fcea),
+            FB(0x9ba1394de792c789, 0x7b3e29c2f8f252dd),
+            FB(0x4d0a08bba7279701, 0xee0b40c0d13fbbae),
+            FB(0xaf7c9f1331f2cfa5, 0x58a0af8ba974474c),
+            FB(0xbc1c30977ad27dd4, 0x6ea1f13f1da0d97b),
+            FB(0x26c5ba4e7faac990, 0xa6c0b61ef95866da),
+            FB(0xcdd0747d00b7172c, 0x72b20504d28c96ee),
+            FB(0x3c720c561b6090e4, 0x22e9b50a90f085cc),
+            FB(0x5f26e42cb2b3751a, 0xad040f996e201170),
+            FB(0xe92789c1b2989ab0, 0xec720b4fbdcbc762),
+            FB(0x94a27c1a4ff98c02, 0xac193408a031755b),
+            FB(0xbb24d75176afd9e5, 0xb50541e1b1b71a99),
+            FB(0x78cf4ffa8e6b89ad, 0x98dce0f79ab90154),
+            FB(0x225101f414ab9fea, 0x1218d7503279fdba),
+            FB(0x5f36f0ae591a9c74, 0xead93bab410bd358),
+            FB(0xd3542d80b8a24c5f, 0x2fbff2d07d60dbf6),
+            FB(0xabc1f2ad4f5bf4d0, 0x7b699015843b7424),
+            FB(0xe5e4d01049c23125, 0x2061c5c77e4f6a26),
+            FB(0x139b50df1f7250ff, 0x2429e7a3b91574ba),
+            FB(0xa5004c02c085ee5e, 0x24bbb6f2f6848a30),
+            FB(0x80fb33f9156bdaed, 0xd156c90fa82ec02c),
+            FB(0xb1d30de5c6e08f53, 0x46970c7babf84a46),
+            FB(0xd836f19dc68e630b, 0x67cc667146a55ae8),
+            FB(0x2af71db8c4742a6c, 0x429cf39e85c3928e),
+            FB(0x325446e7773cd810, 0xf3c8bc968fc5d86e),
+            FB(0xd157114bfc446a05, 0x81e1628b865dc1bf),
+            FB(0xd7578a56d2717285, 0xa96d82aa4e18ce2d),
+            FB(0x03bcf9585b4a4ac1, 0xb3e694229a21f583),
+            FB(0x927848bc08ecd535, 0x5e2f6de78d22d120),
+            FB(0xabdacb1709aa7834, 0xdfa2846fd7774319),
+            FB(0x67720de94a244f60, 0x466a9f5250c31e8f),
+            FB(0x599b770420968add, 0xe5ba163dc44fa76a),
+            FB(0xdddee35e85f35fac, 0x668e1fd52bb9d463),
+            FB(0x1ff85777286f96e0, 0xd8b454eded262daf),
+            FB(0x70d67544ab4dd3a9, 0x07666b30138c20a9),
+            FB(0x194ee617546b0eaa, 0x0b95517b354340cd),
+            FB(0x570d590ff191fcd9, 0xd58c90c6128fca7d),
+            FB(0x3056dec4a011f2af, 0xedb5c21aa643b3bf),
+            FB(0xbf2ba8b9a45efded, 0xe235c9ba0c2df2a7),
+            FB(0x097a9a7a7e565b15, 0x55d3b3111f7e505e),
+            FB(0xdb4aa25510c1fd74, 0x06d0298c7f531251),
+            FB(0xc0e195baf817380d, 0xef8098983d6e1f78),
+            FB(0xff0c70a114b79d11, 0x0f16dd3254c8548e),
+            FB(0x11e0d0214ae29f71, 0xe26da159895d55ab),
+            FB(0x4e0d9a60c1791b83, 0xbf2bd33c168a8575),
+            FB(0x34398cd582c19390, 0xda438be532c5fc6c),
+            FB(0x3ac13662e3c2553a, 0x459423108c5a070a),
+            FB(0x82be82dd0f373f58, 0xe8411872961220a9),
+            FB(0x2b75a1cf4ebf0dce, 0xc987bb281a1130ff),
+            FB(0x3b354aeede79136d, 0xea8b138f577e0c4a),
+            FB(0x14f2f202499beac0, 0x39fd5da1f0f797f5),
+        },
+        // window 3: g^(j * 2^24)
+        {
+            FB(0x0000000000000000, 0x0000000000000001),
+            FB(0x49bdb069eb321972, 0x92365e483520f80a),
+            FB(0x106077004a5e5d2c, 0x8a489d1cf30ded60),
+            FB(0xabd8fab152bcc187, 0xa10dd6a328e0f38a),
+            FB(0xc74e7c4aa0ba0158, 0x06d1dcf58a6421b0),
+            FB(0x8b2a76cde71356d1, 0xfe17fb82b921fec6),
+            FB(0xbb7316ba59eb1f8a, 0xf17f2699e5a39bc6),
+            FB(0x3bcdf8eb9eb03c5e, 0xfeb2346a7018339c),
+            FB(0xbaf70aa793e806ee, 0x9c676ccc048e879f),
+            FB(0xecc67b5469221433, 0xf7fe7f95fa776734),
+            FB(0xb60d3ec3b400d918, 0xe3aa8192a81177f4),
+            FB(0x0556e603e45768f7, 0x64c3e786b88c8667),
+            FB(0x2d50fcce895b3995, 0x827dcb5eed4fa2a1),
+            FB(0xc3066ead433a8ddf, 0x9bf2da83ea7c3112),
+            FB(0xed26dc180ffb9b3e, 0x798f5a42b7bd9cf2),
+            FB(0x24afb04d8f2e646d, 0x06fa5040a5777c88),
+            FB(0x39a735fe37af869a, 0x45a0cd944a52d790),
+            FB(0xb3eeafba42df0218, 0xc04094c0d082251b),
+            FB(0xd08cef32dd06be6b, 0x18010b099b6789da),
+            FB(0x9f4521b737ae8f31, 0x103bbf6dc3847798),
+            FB(0x05696d71f084f3bc, 0x173001280352e2b9),
+            FB(0x874d70ad70c7c9ed, 0x0a18974e40b46800),
+            FB(0x1cefad42f27942a4, 0xe138bdb10dff35fe),
+            FB(0xf43ca9c126b51b58, 0x5074b6a79e306284),
+            FB(0x753be27a52dc8ad9, 0xb51ec40cfe620af8),
+            FB(0x724783c41634e199, 0x660f4221a6300a34),
+            FB(0xf3de5f6216cbb53a, 0x26ddadadec1f0970),
+            FB(0x29e9d15f85e0ee62, 0x67ad63a5ad020bd1),
+            FB(0x907456100ff4b6c4, 0x6e154d2b2509f0f9),
+            FB(0x57f1a23142c886a0, 0x810479b3c2f1b2eb),
+            FB(0x1447a24c4a084916, 0xaf3822b3712a0479),
+            FB(0x51e686a494b34aa4, 0x37127c5ee3eaec3e),
+            FB(0xaa7592e9c38d41be, 0x818ce60e9b5824d2),
+            FB(0x9ad4b209cffb42b1, 0x30175ec381bcc2a4),
+            FB(0x09b0978fb61828d4, 0x23355c2f060db6ec),
+            FB(0x5a14a0eba08e773a, 0xff629e76bd6e5bd7),
+            FB(0x3661e99a876c9974, 0x5f721e5a30e70a40),
+            FB(0x3300cce76b2c0f02, 0x3b141b8a569f46f1),
+            FB(0x6d237db059f145b8, 0xc1cdb79dfe3ccaa0),
+            FB(0x6ea8720af266abb1, 0x944ce3b4f8fc57f9),
+            FB(0x09e8484d453cefec, 0x2b24d95f7dbc37f1),
+            FB(0xb7d5592ec1dc2f1b, 0x2ada36e084a8bad5),
+            FB(0xcaa7587daa36e569, 0xfb29ffd2852c9550),
+            FB(0x422dc293d10c7497, 0x844da7c5892f57fd),
+            FB(0xfa9a8248b06e3736, 0x29479f1a772e8124),
+            FB(0xe1cc97f67b46f79d, 0x5977339d2ebf3307),
+            FB(0x3272a783b87af490, 0x571b56f7b0578381),
+            FB(0xcdcb97e0190d3393, 0xf10c006c9e40cc0e),
+            FB(0xa6e4b924fe06c884, 0xa0610a95e3b14631),
+            FB(0xc0457ba9ff33c64f, 0xb9eb103bb3d7cc8b),
+            FB(0xfd007a9fd2b6bc71, 0xc97a965bace26661),
+            FB(0xddf379ea2b5dbe90, 0x5a17e74a97adcfd9),
+            FB(0x2da64df598702a4d, 0xd915922d53b4b88d),
+            FB(0x119a6396345c5e52, 0x39806dda436d9a73),
+            FB(0x2979c93f238a981b, 0x8c8dac2f87e33e13),
+            FB(0x0958d9f66bc23353, 0x8f7340edebdd8929),
+            FB(0x535ee269ed3d8345, 0x2f1123120445fd56),
+            FB(0x0a5c625a33527e9a, 0x8bd305d0ad04fb03),
+            FB(0xbdc12bb4cb5fde8a, 0x2231c4e08f4b8c7d),
+            FB(0x0d4c16fcc62ae77d, 0xca9dbe8fc9552ac6),
+            FB(0xcb2d7f88da101cbd, 0x46dd258c5157982d),
+            FB(0x05d4db59a3cf44d1, 0x7a62014b96347623),
+            FB(0xf2b9a749df1fc505, 0x1b560dd707afd51c),
+            FB(0x099018f5186a7f94, 0x098d5c3c754e4772),
+            FB(0xbfd7a38611238d3a, 0xf3fff87f74b430c1),
+            FB(0x4f27854aea955d0d, 0xcca32a7ef01a518e),
+            FB(0x61f53e464848716b, 0xdb014d03223b0ff0),
+            FB(0x15bbd124d7e9c197, 0xc964fef1ddfc0788),
+            FB(0x25615e305c9aef5d, 0x5178a69378fd6b20),
+            FB(0xe7fac9ef42a7b3ed, 0xaaad951a88c88ae6),
+            FB(0x81899b579d7f9a6c, 0x9970fff2f0acedf1),
+            FB(0x80b831c2b3d4afe3, 0x09d80d1d059c4e20),
+            FB(0x803379a88c3275b9, 0xcfe111846609f27e),
+            FB(0x820b278ff7530ded, 0x889a41d55bb3fec9),
+            FB(0x9cde013998dee6a5, 0x5e4d74e53b3f5613),
+            FB(0x6e0e358ae5c6f137, 0xf8a2871311dd867d),
+            FB(0x15344ec087011a59, 0x83382edf28903bf6),
+            FB(0xdc37ea749cb182dc, 0xeea9a8780d7315c1),
+            FB(0x069fed9abd1966e7, 0x7c56331fee6d0bf0),
+            FB(0x975484d6b5e5dcc5, 0x92df96498b289565),
+            FB(0x252989d80089486a, 0x6da4f7cb8215d0b1),
+            FB(0x8ae3318853958bb7, 0x7904eb2960bc0a04),
+            FB(0x55866ebbd3516385, 0xf0be5af2726fe423),
+            FB(0xe07d6972f32bcbb3, 0x0752b9f3ff69bc92),
+            FB(0xc6bad2a2839f9310, 0xbfcf9517e5ec4818),
+            FB(0x341d7c532366645e, 0x2b7f389c96e205c0),
+            FB(0x320e254ff62815a3, 0x77c62deff2441c82),
+            FB(0x7c271de75737ca8e, 0x6e1faaee04ea90b9),
+            FB(0x0cbc74e8834150a7, 0x4e1f43fad1e8802d),
+            FB(0x945ceb8e41eed4f3, 0x21156adea8c39ae5),
+            FB(0xbdef8c8448c56037, 0xcc073f1224cf7b73),
+            FB(0x1a682a9a068b7f6e, 0x7f3dad58bee3da1b),
+            FB(0x8803e87ac7de97ad, 0x3fcad9e26354060f),
+            FB(0xcc45e84e1b0f6a51, 0xfea585edb06c9a00),
+            FB(0xcc1f932a4dc0b850, 0xe7133935c9ea5190),
+            FB(0x67cbf5c97af78c02, 0xdb676fef17943824),
+            FB(0x9247b0527a01554a, 0x54a94f4481f5dc18),
+            FB(0x60972b3a04fe982b, 0xbe4096eaf1db2df4),
+            FB(0xf5492cb8c978f829, 0x452cc8a7ea340f31),
+            FB(0x3c30040ac9743491, 0x3b38b9fc0ccd3a77),
+            FB(0x5276154e89e97d47, 0x716f054b66aeead7),
+            FB(0xbe23f9043fd92117, 0x96a9845586ce8daf),
+            FB(0x0f5828849e799f9a, 0x7e469a4520d8021e),
+            FB(0x9e3cefc341c46fc5, 0xd7627dfc1f83fe3f),
+            FB(0x6455d77518182787, 0x77cfae127a941868),
+            FB(0xe96d458e964726ba, 0x892c14343e3f6302),
+            FB(0x82e724d67aeb1c2a, 0x837dcae99de0e019),
+            FB(0x7aa34cda03358ac3, 0x318e613856f41337),
+            FB(0x7d1d8a3fd515b47c, 0x5eafb7f86394a450),
+            FB(0xb8bd81678478848c, 0xed97edf31f316fe6),
+            FB(0x611ac3ec066c7537, 0x1b37e34fd9d2f1da),
+            FB(0x160cdcec761eb0e0, 0x39973e01cf77e67c),
+            FB(0xf1c6dd86aa134c68, 0x8525a20797c26ddb),
+            FB(0x26d0bfe11df86f44, 0xded91e45001cc883),
+            FB(0x63918fbf6e0585de, 0xddc2f50695c864d9),
+            FB(0xe50fa829e3cf0375, 0xafbf076a299a14ea),
+            FB(0x761ab5846f680759, 0xd306cc475cdde7e4),
+            FB(0xfe6fc3782e6b4f5a, 0xcbda51c70488d9a8),
+            FB(0x797b18e1c81342cc, 0xea2f2ee6a2a59223),
+            FB(0xfde71aa2e6021aec, 0xa3b92054fbe3f5f9),
+            FB(0x834d646cc41ba1b9, 0x05dd9615efd36239),
+            FB(0x745000351a47fe2a, 0x0c1df95f15872ab7),
+            FB(0x1d9a2b5d1452c621, 0x9fa69e336d4d3382),
+            FB(0x7f49c033ebc29a36, 0x816154f5aa73e5a1),
+            FB(0x287a6b70d6b2007b, 0x1c3ee857e9e61cf6),
+            FB(0x1ce4b2424f6acfd1, 0xcd7a0d3240936073),
+            FB(0x21270751b7bb26a7, 0xb3db5f82d01f5a74),
+            FB(0xd824c1113bcac8c7, 0x16aa523e85f68ead),
+            FB(0x2507689d8bfadf39, 0x92955baaec35f9b4),
+            FB(0xd4bf31047bdafa00, 0x790e9341cb717781),
+            FB(0x0b7952cfccbb46a3, 0xdafd4ebbcf366d5b),
+            FB(0x358dd6436b289d6b, 0xca4eda4e358fe5de),
+            FB(0x3de923f4a0f57a61, 0x55cc548febd81f6d),
+            FB(0x96258795e77b8c19, 0x84dccb5bae313365),
+            FB(0xdf956c6262d14158, 0x6c91d83eb0b30dab),
+            FB(0x8b82a6a55aba38c1, 0x3c15a425c5c60340),
+            FB(0x05fc79cf98bada0d, 0xcbd131a69366db39),
+            FB(0xd6735c24852f8ea6, 0x242c05c15d2836fc),
+            FB(0xe2844ca4d07d8667, 0x327f868819f4c472),
+            FB(0xcf1eb94971038a33, 0xf439d28502f15b69),
+            FB(0x81e7f4663106a8ce, 0x3b3d845a308700d6),
+            FB(0xa2280047a915547f, 0x87ab4f244a1cec1b),
+            FB(0xc0622b829bffb36e, 0x59a37e03e754bafc),
+            FB(0x2e137b924a9de065, 0x20517d0fa529e18f),
+            FB(0x9057cd90cb65bdf1, 0xfda69957b6d07f74),
+            FB(0x41b092aeb82e5209, 0xbb088683f49a36b5),
+            FB(0x825c621d06cbba11, 0x30a6b09e7c48c511),
+            FB(0xbc1f3a54a8b9f69d, 0xdeedfe21d3e5a5a1),
+            FB(0x7fcd0cfd1595ee77, 0x63ac19d2b75bc595),
+            FB(0x198f0e9a77e62e10, 0x73d6f260878acb26),
+            FB(0x12ec6faad3c3e2f2, 0xa5dfeb166b91818c),
+            FB(0x05156e31e9f196ef, 0x10fe87f70ee3c224),
+            FB(0xcff096385fd1e174, 0xceab4187a1918353),
+            FB(0xc8ea97ffd117f4c8, 0x1aa210514b3b240c),
+            FB(0x4ae6d581cb96f611, 0x6ec24ea3c3245aee),
+            FB(0x70eff7c1201d9fd8, 0x05cf5ad6a086fe20),
+            FB(0x1f1d7d14801365aa, 0x2663b21c6602f3eb),
+            FB(0x6346981fccd4cf7e, 0xf8c6e4559d84c292),
+            FB(0x0ce7ae04894d2d0e, 0x1399a09e5f88bc81),
+            FB(0x451f2d635b280496, 0xe695cbd0ea65f9d3),
+            FB(0x00a47976b47b4685, 0x4025e05e00ca0bd3),
+            FB(0x7d7a9b2bce7aedc8, 0x3e80746fe4103de5),
+            FB(0xf6b6ae89cfe3e589, 0xe1ba0a86e33c419c),
+            FB(0xade15c36b732ee53, 0xf0ea14678001c658),
+            FB(0xaad68f3256cb2d76, 0x2097e3d83aaac8ca),
+            FB(0x92c604b8266a213b, 0x9914263d05cac1c4),
+            FB(0xac1fd339080cbc32, 0x7ccc2b33d6280dce),
+            FB(0x9f6a381090400516, 0xfb3c7d64c4535959),
+            FB(0xff1a28a0742edf28, 0x96ab385a55db921f),
+            FB(0x300e14255c05efca, 0xd891cbf5fdd239c6),
+            FB(0x9735bb68c7f8b4c9, 0x5f85326264698da2),
+            FB(0x0e2ef4d3ff74e15e, 0x20f74aee48014f5a),
+            FB(0x8c097bba10ae0f55, 0x746a2dd08e849f91),
+            FB(0x24f9599030812ee4, 0x77887a5b58f240d0),
+            FB(0xd6e617beea58f2b7, 0xfdf9c586d2fdabdb),
+            FB(0x28a5e5cb9c020a6e, 0xb0a1b067b7e38692),
+            FB(0x39c773eff35ed8a5, 0x939224cfb723d2ba),
+            FB(0x95bef272c8ae2597, 0x87829d950a241455),
+            FB(0x4b79df8a9b3ebaf0, 0x34ecd7807e1f6ded),
+            FB(0xee957e9156a4d68e, 0xb3c1481dd230a922),
+            FB(0x224c871fecc4c97c, 0x55f9e8a879479587),
+            FB(0x16c2fb3346bbba0a, 0x78e952166fcf549c),
+            FB(0xb18348937bac759c, 0x4f19b754916546e9),
+            FB(0x5f3c4255faac76cb, 0x044bfbb5412be265),
+            FB(0xe49552f4dc8b9cf1, 0xaec70d9d4ddce505),
+            FB(0x658d0dda40ff3c1a, 0x85f26998f7e455af),
+            FB(0xccec3ccdcdd90ffd, 0xe15b3f710e90e3d8),
+            FB(0x3b5ad3df82a4a208, 0x466a4dcf882cac73),
+            FB(0xcda5ad0f40d83ac5, 0x095fe4676bc9a25f),
+            FB(0xa0f7811c3ee59678, 0xfffbe9c554af78b9),
+            FB(0x37878765378bc518, 0xc9e260daecf0033a),
+            FB(0x8e25c7cdffc1ddbb, 0x410168622c07172b),
+            FB(0x54043e894b5de506, 0x88dd559eaeaf42fb),
+            FB(0xf150ca7423f7549d, 0x81c2816ad10e7c5c),
+            FB(0x29755de97e4dec98, 0x5d5a51c862936f7d),
+            FB(0x46d0b16405aaf655, 0x2561689e591dec7a),
+            FB(0x33ee551565d33efc, 0xc509cffb0a972d17),
+            FB(0xf120dc1f0642fa7c, 0x0e049ee9b398046f),
+            FB(0xb7f79e404d3176a5, 0x911db3239615539c),
+            FB(0xfdeaeafeb7b02bc2, 0xaf26ee7327b2e4dc),
+            FB(0xe017f5398fee4bc8, 0xf578c919967b2fc6),
+            FB(0xc4ce4f5074413936, 0xd3b54e32bc281e26),
+            FB(0x31ba5af14a571963, 0xf01646115cd6d8d7),
+            FB(0xac7ec7b1105ee943, 0xa9cd558515e93a58),
+            FB(0x3e77c6d67ca5d840, 0x68a69b266c0e6588),
+            FB(0x46c2da20a6e21736, 0x25e5dca4f364500a),
+            FB(0x3dbba69f9253e7c3, 0x71fbf87f1256adc5),
+            FB(0xf77df6cb9346d8b1, 0x7138c2b524d0c938),
+            FB(0x716daf8b79b5e2f3, 0xb384e7d2178adb9d),
+            FB(0x5ac2f08e811cce37, 0x837e5d5efe7bd8ae),
+            FB(0xcd0c416f79c6ee9d, 0x48307fbc024a6d89),
+            FB(0xe134ca1ed7f2c0ae, 0xa914d02a52796d99),
+            FB(0x8232b3b8441d6927, 0x89a6db5bfab22efa),
+            FB(0xe5369426e4819b23, 0x07a6654d13774444),
+            FB(0xcdfe9ec74d98119c, 0x138dc6c6e2f0b2b8),
+            FB(0xb4a9004fb1137c9d, 0x96d44e443be4a2a2),
+            FB(0xd363ea43a6cbe542, 0x2bf2cec4176ad686),
+            FB(0x610628cf1807765d, 0x7ed0827b49276162),
+            FB(0x2eb2330394dc33cf, 0xc92fcfe0dc04accd),
+            FB(0x956cc4621b3a7630, 0x882d82f1980cbad8),
+            FB(0x6dc2a1e0e6b595e5, 0x5b2714beb6f4c599),
+            FB(0x25300e5f8f96fc71, 0x9f18aa92016b644e),
+            FB(0x882d688c1bcf85bb, 0xb139b99a0f3fb950),
+            FB(0x3bc2860bd8ef10d0, 0x78aea4b7df272dc4),
+            FB(0x6bbfbe545a12ca5a, 0xbec9d5974deb09d4),
+            FB(0x0343379179d1590c, 0xc040d6c5ddc18f9e),
+            FB(0x471166627154bc96, 0xae1c0b9a1763397b),
+            FB(0xbc8eb4a5456c1dd3, 0x4fe1472b7964c846),
+            FB(0x3feb17a2be197035, 0x06bd5896dcce48db),
+            FB(0x57f9aff2cc0c844d, 0x184730c84ebaeab0),
+            FB(0xe0a26e5dfdd72928, 0xaaf3da6f0381a2e2),
+            FB(0x1dcc16041f144151, 0x13a7703144c01a8c),
+            FB(0xb069a4eb0386d86f, 0x56711c915ef68761),
+            FB(0x6c83a4e27ad3c170, 0x54c477bcd0ea518a),
+            FB(0x50e31646a3909ad7, 0x37b60f130a6285cd),
+            FB(0xd12c101665c8e34c, 0x974156664133baa4),
+            FB(0x9e09cc0ea2bff8ba, 0xd5c4c18233319883),
+            FB(0xd03219d928a5190a, 0x799b57ce55fe0202),
+            FB(0x4619e3aaa0ffcf27, 0xf3295619f1e6c5a0),
+            FB(0xa31e1b4b8af477ee, 0xc43e388a7c3d4629),
+            FB(0xc282086c256e4488, 0xec25f57dc8a06f61),
+            FB(0xf982bfe0df135bd8, 0x9b5b2a49298ec429),
+            FB(0xe328f651554382a2, 0xa5c53ad504ea7fff),
+            FB(0x010be4009f4f1741, 0xe6c0fb4e7aaf1c8f),
+            FB(0xef4320ca7e07db32, 0x9b29e564bf6b5c83),
+            FB(0xda669fcb01ebc8db, 0xf0fda6e0ccf199bc),
+            FB(0x8022456fa112cca1, 0xcb36a73830cfd05b),
+            FB(0x699604c51e7e2ff1, 0x4c799916f1f681ef),
+            FB(0x3c9acd821b11fa3c, 0x690e0d08015a9c41),
+            FB(0xa84af92178392c31, 0xd3a177f3921797c9),
+            FB(0xfecab11759457710, 0x4b210ef08f022282),
+            FB(0xac8ffb4f2f9ab9cf, 0xfd05d725fd240628),
+            FB(0x598047ae1bb6b7a0, 0x00c8790c070bc2f5),
+            FB(0x6326c9c6cb776326, 0x897eab045ea2e30c),
+            FB(0x17d6501da18382d1, 0xf863c6e1d1bdeae5),
+            FB(0x010021e4a5d0c672, 0x70cbb8e63c282b77),
+        },
+        // window 4: g^(j * 2^32)
+        {
+            FB(0x0000000000000000, 0x0000000000000001),
+            FB(0x55f34bf05ca42a52, 0xb7200de44968fe59),
+            FB(0xbac92d9353217f18, 0xced2c0326a80e065),
+            FB(0x713c9b1d97010ef9, 0x99b63b96cd45b433),
+            FB(0x28a1c04165164097, 0xe1dd5c8d942ba3b8),
+            FB(0x582d5eeb32313036, 0xf52043d50ea74619),
+            FB(0xaac4f785611eef02, 0x1dba10966e970a74),
+            FB(0xf8e3dfa7e2d8fe82, 0x5c37655b797868c4),
+            FB(0x69e28dffa15830dc, 0x25e78921342409a5),
+            FB(0xf130f778a79cdefa, 0x86afd59992944f09),
+            FB(0x83d3313fcc82de48, 0x994adf908b169415),
+            FB(0xd70ddd965074ce32, 0x1b516cdd7cc06c80),
+            FB(0xfea4fd1f20ca89e9, 0x78d3ed92876f0665),
+            FB(0x484ccf93b5e57030, 0x677ca6e70b396998),
+            FB(0x1bbbaba70819c785, 0xbb7403ab14cd875d),
+            FB(0x0d2ab8b5bcc43576, 0x0187b3c9474a2973),
+            FB(0x497dfa28a95d0409, 0xd99fd2d29b685f97),
+            FB(0xc3cde586632f4ff4, 0xa8b8120ab8517da8),
+            FB(0x6b91df7e70f08ba2, 0x97ce2f890cd21dcc),
+            FB(0x51c19606fa4b43a6, 0x88cd6b690a2308d3),
+            FB(0x83f325ddcad0f102, 0xd9d4c3215db440b6),
+            FB(0x695731704946744b, 0xa0bcf07162c65c05),
+            FB(0x3cae381f0a461c35, 0xe25ab3598ffecd43),
+            FB(0x5bf7a0d822c659a0, 0xcb762ddb2d10460c),
+            FB(0x15cf855e5666ed2d, 0x5c3c87a8e1788c07),
+            FB(0x3fecc2a6e8d52a54, 0xa433bd82cbf637a5),
+            FB(0x45dd4cc9df1e11ad, 0x5399a1bcff43de78),
+            FB(0xf62602618a3b3821, 0x14916b5e792510b7),
+            FB(0xe13d6d68ff7d92ae, 0x20d0f63ffadfd9a6),
+            FB(0x6b331ea3648d0187, 0xe571e825115a7f73),
+            FB(0x29347fea3fe60395, 0x628ca83697bcf469),
+            FB(0xf6ea41cfee3a56bd, 0xdafe0d53fdc8e34c),
+            FB(0x000c834959da6ce7, 0xbc0aca771925646a),
+            FB(0xaa253d25b0399276, 0xc12ba771af9aaac6),
+            FB(0xf6f2dc5ca5d2ca22, 0x2bd926224e51736f),
+            FB(0x980b316dc602982b, 0xe99cd33c8994ec44),
+            FB(0x0e6f17fa187480e7, 0xeb7b7a25e2298b7a),
+            FB(0x89abc6c3d8f0695b, 0xbf0dce556a01c70b),
+            FB(0xb7eee0f759291e06, 0x0890575672f88351),
+            FB(0xed468f67b6436e59, 0xc0e18a9109564da6),
+            FB(0x93f1788944db1a1f, 0x82a4723b3b87576f),
+            FB(0x1443c6db0c937ffd, 0x3522246cdf92a952),
+            FB(0x094fb8b9ce8dfe09, 0x454b2a72f228567c),
+            FB(0x80d1a9e6127b3fc2, 0x9fe5d2ff2630cdd6),
+            FB(0xe697e6eaffc5bd6a, 0x63812f38fee382fc),
+            FB(0xc1f089299d5908e1, 0xc3d508d9efcea6ed),
+            FB(0x843534dcd8784787, 0x1a64bb64c670d868),
+            FB(0x95ad887f377f24a2, 0xf61091bc5d36e98f),
+            FB(0x9e8e9e5a88ea98e4, 0xa9677307c5653522),
+            FB(0x63b8d976fa2053f9, 0x9904b29bd2ee687f),
+            FB(0xf410809cf76e9643, 0xddac6ae13ac1ba6f),
+            FB(0x2747e95dd6cd16ed, 0xbff9665dcd5e78a6),
+            FB(0x69db5f7e1d98d43e, 0x497ebca9d6f0e44f),
+            FB(0xe62b2319c2ece1a7, 0xd39a9dfbf11107bf),
+            FB(0x207e576d16537df2, 0xf69fbc48bbc24cc3),
+            FB(0x403ff8b8e8a92ecc, 0x652c9d7b21b3ba45),
+            FB(0xa885e33d102948be, 0x55659343147ea6e9),
+            FB(0xac3175342929acaa, 0x999866c42b1d5ee6),
+            FB(0x1b488c9af8cfda80, 0x6550f87315f3dad8),
+            FB(0x393e28db95b2886c, 0x79d3d82d7ab9d8e3),
+            FB(0x2941d32a84408aca, 0xf115e33c57aa5ab8),
+            FB(0xafdcc431e89d4dc7, 0xc628030f85ff1b7e),
+            FB(0x7003da8070ff8a05, 0xd2ffe894a94a7736),
+            FB(0x962758977323cf92, 0xb32398459b6d5174),
+            FB(0x455029d592d7445a, 0xd72f10c7518bb2af),
+            FB(0x85be632ff4eedb3d, 0x3635670670e7302b),
+            FB(0xafdf10b0f62001d5, 0x1f57fb220152a011),
+            FB(0x25351dcfe0bddcf4, 0xa78d5d0b2dab160c),
+            FB(0x250278741aacda97, 0xc48a243486db1f18),
+            FB(0x20f78499134e2038, 0xec5f9dbf7da2da06),
+            FB(0x32816209ca88404e, 0xfa2d432d32923f2c),
+            FB(0xc03f9de868af84e7, 0x4a9b037f6727ade4),
+            FB(0x7fe3526e98840ccd, 0xf2cee710806eb3af),
+            FB(0xcf3efff0320c857f, 0xdbb81c59cd95750b),
+            FB(0xa431ff23ea11a3a3, 0x02af2b0b1d5ac479),
+            FB(0xa0963c09e7447f87, 0x1db4e9e6b0e3b605),
+            FB(0x5180c687bd3e30f7, 0xc3416807eca90a04),
+            FB(0x991919d7d77e10c9, 0x7823dcda2ea04454),
+            FB(0xd53f2e4cab6527c9, 0x5125638557f58702),
+            FB(0x4074c28f94c037cf, 0x3c8abae2fd6c8cce),
+            FB(0x05b46f9ddfe5e40a, 0x7d1c544eb5c9a819),
+            FB(0xb700ca04a984b6ba, 0x4da35aef8d732e06),
+            FB(0x8a6976b6be55000b, 0x78c4049584411333),
+            FB(0x1ac3af943b9f72d2, 0x9d00e0f73657e65a),
+            FB(0x315e4b4d7ea76f6a, 0xce89ed5c11b83417),
+            FB(0x2d6af6b9a6e9efa9, 0xcc67517b2929ba89),
+            FB(0x817c63b5ac68f339, 0x8102cd59e053f36f),
+            FB(0x0c04f2708711b096, 0x3e292cb0bcfb0250),
+            FB(0xb2480dc1a2128ab7, 0x5556ecd132390fdd),
+            FB(0x983777bef5f2a812, 0x668a0dd0e0cd020c),
+            FB(0xe0a97a30e1056c27, 0x3a6a861365ffec89),
+            FB(0xf5c46ab08d13256b, 0x0546c2f4e8600ebc),
+            FB(0xc93687e5d61c0a89, 0x46dedfc82b8acecc),
+            FB(0xb0e9cfae126836f1, 0x648fca85559528e5),
+            FB(0x1ac0f416a0cb8579, 0x80b0c53d40128e2e),
+            FB(0xe80a90a4671300c4, 0x54350b9150ee23ea),
+            FB(0x28ccff9879a1d4e8, 0xb1fa9bec63fab013),
+            FB(0xd3000b239d522aad, 0x3924ef3396c535ee),
+            FB(0x2ff97af95349a002, 0x59da485ce1f01a24),
+            FB(0xc6b72afef2d152c1, 0x3077c9682795ad68),
+            FB(0x7221c371d4653a9a, 0x24a5178c0820739f),
+            FB(0xd72b72f6ec75b9f3, 0xfca903fea7c4022a),
+            FB(0x53b62f81995bcf4f, 0x6d1488639807c02d),
+            FB(0x4cef60de6f6f6dff, 0xfcf352b6574063d3),
+            FB(0x5d2f0107997184ed, 0xff0233e96b62a5cf),
+            FB(0xf05c921ba0ce2e7b, 0x80ae7986c098ca4c),
+            FB(0xf76b7e1d5fcaf32b, 0xe736849aacb186ef),
+            FB(0x3b31ca67f882443e, 0xd34bb3365867b3b7),
+            FB(0x491e81f1b8b15577, 0xc821a595d24c7817),
+            FB(0x62ab5df7dbfb21b4, 0xaa5a8005e703cf35),
+            FB(0x6413b4504bb26fae, 0x89e2b84072c18d99),
+            FB(0x7625ffebebdf329d, 0x8e80baf697102710),
+            FB(0xecf0dccdef9ca232, 0x8612281b15f73584),
+            FB(0xccfe2e262bf909b3, 0x71b2a19bf483000a),
+            FB(0xb4f3dacdf7e1c362, 0x39003c35e4c7baa1),
+            FB(0xe55865b9a0ab17f5, 0x4645b9223668c5d5),
+            FB(0xb04240e1bcd171f2, 0x0bf8ce0745b99140),
+            FB(0x14d3593a0b7ffca3, 0x534fefc9e39fc7d1),
+            FB(0xaf04e1ab6ca9102b, 0x5a901c7cb08a10bb),
+            FB(0xacbb14094c58669d, 0xc9052ac964058151),
+            FB(0x684e71bf619c3aad, 0xd96d3465f2b1d792),
+            FB(0x55c19337c511994b, 0xb5f5039663caa1be),
+            FB(0xa7161ad9b8779bf9, 0xcdf03b6a585bbed6),
+            FB(0x16c359d7da6bbbb3, 0x6cccfad48e53947e),
+            FB(0xba0457e740bd811a, 0xaf6a104ef6c908d5),
+            FB(0xf7903715c1ee4dd3, 0xafe80014147e1f58),
+            FB(0x086b12e697a15df0, 0xa8dc0ae38a0b406b),
+            FB(0x7ee76df3bd2b48d4, 0x4b2e244c7a17caa2),
+            FB(0x29eaf3573c6e6fc3, 0x54347da63d7c94b1),
+            FB(0xb0bc3a819fb81f9f, 0xd0ba8707d646157c),
+            FB(0xcdc075b77a8c3714, 0x365bd3901159a615),
+            FB(0xcb1788c6065e79cf, 0x7191999c6ceb7fd0),
+            FB(0xf6570d3ed2665f2f, 0x216f0d0444ae2f9f),
+            FB(0x594a56d9b3c3a398, 0x048b613c86cf030b),
+            FB(0x50e0d3a6bf4f9b45, 0xa872365b1f8f222e),
+            FB(0x2da6c45e58dfe014, 0x77be28a3f439c0ae),
+            FB(0x44e74252cedae660, 0xe4eba4dc15a84da5),
+            FB(0x3097c6650bf20613, 0x458370a87f41be0a),
+            FB(0x487b309f89002312, 0x90c21faa4d46bbda),
+            FB(0x8f822d256b86e45a, 0xf326f4c585b1ffb4),
+            FB(0xcc79c4dc7e19253f, 0x96f9a0cc755d5ef2),
+            FB(0x3836834257e74eae, 0xeab5b865f0ee4e26),
+            FB(0xa046f14f6e19989f, 0x59f6f31f8c0ae6a4),
+            FB(0x4ab30f101b71087e, 0xf23c050b624ae68d),
+            FB(0x9504fec7a103468d, 0x26e1dc246c9cd854),
+            FB(0xcf1158b5d47ac437, 0xfc73d4a72a40c71a),
+            FB(0xca6cf5c701503a43, 0xc94d6880ddecd431),
+            FB(0xbde2e2251e0664af, 0x1fb34a2648835623),
+            FB(0xd476dff9046c1ef5, 0x8e8d96e08ea8dab3),
+            FB(0x78d30e5e3c7a42fa, 0xd945b46446594b0f),
+            FB(0xdd70087ee6f17578, 0xe3e32c7f851edb93),
+            FB(0x241bd931a1a08d83, 0x2565abb92ac448e5),
+            FB(0xa7a3d028ae0dcadd, 0x2665f4ef9b6f25c3),
+            FB(0xd5201e388f1976ee, 0x1085f3d9cc9bebfb),
+            FB(0x7307a242f73e6c86, 0x39b584ac97399030),
+            FB(0x5c757bb15652ba87, 0x9f3de30e56eb5852),
+            FB(0x2ef4b43823a11982, 0xee4431e456d7851c),
+            FB(0x5aa9a18720b50894, 0xcaa1a5a072b90271),
+            FB(0x755aa31df779bf0e, 0x1a08a452d192cf47),
+            FB(0x60e51ca388aff92f, 0xd2b60ba9382200ee),
+            FB(0x1d85522a561a7e4a, 0x5911f49de030229d),
+            FB(0x7d8f0741d660bfe8, 0xe9f0a33afaf19ad0),
+            FB(0x41ba442c82985c06, 0xbd37dd56551b69a1),
+            FB(0x9405008dd7869f2e, 0xcf1b788ec0641059),
+            FB(0xf6961d5de15f105e, 0x30b4eff601053639),
+            FB(0x0c31811bc7429842, 0x02483d83c6ded1ec),
+            FB(0xe5a4b2b8a30a1a67, 0xbd6e7d34bd212458),
+            FB(0x0589d73e9c7ac026, 0x36104fafe8cb15c1),
+            FB(0xcbdb9ce50702486d, 0xc18e93a142314fc7),
+            FB(0x29946c4e5ccc7c9c, 0x6864b79b528ccdea),
+            FB(0x656d5be2304e6f21, 0xd206892dc24cbc08),
+            FB(0x85a56c53a19bd7e2, 0x382adff56854f0e4),
+            FB(0x808cc2be3ee94295, 0xa1ba5cee7c9cbe75),
+            FB(0x4caf31008199ec53, 0x52b323a343b579bc),
+            FB(0x2ce40c1a2d46ae21, 0x8fbbd2e15b255c6c),
+            FB(0x1990c199b88b093d, 0x566b73046da39c4c),
+            FB(0x480540d47d4ee1a5, 0xdb18807ce3aa11d3),
+            FB(0xd8ab3506046589a7, 0xed5e14874e867ffe),
+            FB(0x72d6d1a5e1992187, 0x77dc796efdc4952b),
+            FB(0x1190546422998604, 0xc8c5e1633ac29780),
+            FB(0xa967e90988ca9a2e, 0xb8965da811e243fb),
+            FB(0x5f20edb1938412a7, 0x7fd6118f64b54999),
+            FB(0x23cfa86e1ffb0e31, 0xbd77919914a91f5a),
+            FB(0xa58038ececee1897, 0xdc1aac9d7f1f08e8),
+            FB(0x8151c0199b95f49e, 0x3929eef473a9a548),
+            FB(0x1861a0ba6f0ac65e, 0xff421afd17507b42),
+            FB(0x4f3bcd3bcb4cb7bd, 0x94070cd395076eff),
+            FB(0xc513eca560e6fd87, 0xc5df65f0822166c9),
+            FB(0xe4f5f52b7361881e, 0xcc29927e88a9ce13),
+            FB(0x521792dc7435f9e4, 0x573d2e3d9b27537f),
+            FB(0x9cd026ec4766957b, 0x77ebd1cf042cf965),
+            FB(0x008742ffed0c5042, 0x45acf3317583a79a),
+            FB(0x78e8ccdf414f329a, 0xde6189ea7a5b8dcb),
+            FB(0x33d6500a26aecb89, 0xd3fef100cad2b289),
+            FB(0x30da0410770c1bbf, 0x2f2ba50f3aeeb53c),
+            FB(0x17682f3a9790f7e6, 0x04c33610887d233d),
+            FB(0x26415b09d8b71b1f, 0xa1920464dd440702),
+            FB(0xf1943826369e467a, 0x8874161cb9f72c29),
+            FB(0xbf4f44fc6fb614c7, 0x2d20769eb164b098),
+            FB(0x6285fbfbf67afd1d, 0x87c110e9dd249da5),
+            FB(0xed0e58bfb384abfe, 0x3f3a60f5adf820bf),
+            FB(0x8582c1cab2c71848, 0x794d1f3224c010db),
+            FB(0x68b97b10e9327413, 0xc1afb3c47a683980),
+            FB(0xa14f796c0868af2c, 0xf81015874dc8ab90),
+            FB(0xe1e9507e774ad4a3, 0x270fd467cb235b42),
+            FB(0x367412c1a2d53ceb, 0x01738565e90b21a4),
+            FB(0x0ccbd2247d2d59b2, 0x5634572151195516),
+            FB(0xd2ea5f6495c9cf2d, 0x95fde06daf6ce7a0),
+            FB(0x8b60372f05825e8b, 0x7208ffa28c4ad15a),
+            FB(0xd071be24aa0be1db, 0x381bd5d1ee2203b2),
+            FB(0x6b089ac5505de46c, 0x8c29daee67e2cd5a),
+            FB(0x33a04308efecfe2d, 0x3f7bd43cc7da652d),
+            FB(0x75f44a4580bcef7b, 0x9852d6f6698d7e5f),
+            FB(0xc1f47e9d238a4d2c, 0x453e502f90dccbd1),
+            FB(0xe95c8bebd6d363d4, 0x1ba1d6013d77f4b7),
+            FB(0xb522e107a98a1a1c, 0x2d98f6d138e14813),
+            FB(0x0107a88c84bd6ab5, 0x2be74bdfeabde4c6),
+            FB(0xc3a1d1e77517d378, 0xb82cc01ebfaece62),
+            FB(0x2a7bee179e1c21d3, 0x4065085c4cf15357),
+            FB(0x337efac9d0886537, 0x44b7efd9a7e72411),
+            FB(0x2431d1bc1638e708, 0x467c09170759b3db),
+            FB(0x25d1ff0eaabcbc2c, 0x6207331f12fbef94),
+            FB(0xa13a54dc4544da64, 0xce671d299d286a01),
+            FB(0x7bc5dd2c123134a3, 0x6579db0325aaa4b8),
+            FB(0xc58f2a2d1ad99859, 0x861b3b86db0fcc5d),
+            FB(0x9cad5f5cee28ae17, 0xdbc2ea8be4b8c142),
+            FB(0x8c9a45aa73af572b, 0x6a604a4221644d80),
+            FB(0xbda2c1fad898883f, 0xc9ada3fc94e06f58),
+            FB(0x561a29b211a59c0d, 0x75d0fcbbf7d53b74),
+            FB(0xcd65e9cd73244863, 0xbc7776943325252a),
+            FB(0xb4ebc6db21957e60, 0xd937eb1bddd167b7),
+            FB(0x496878613e710ed8, 0x976bdf749a41f387),
+            FB(0x5b4d2754207facb1, 0x628872ccaaad2875),
+            FB(0x013d53580aaa9f21, 0x30b409d610fd745d),
+            FB(0x9e5c25c68210e89d, 0x7754815552868f9a),
+            FB(0x36d2b01270e1062e, 0x1e5c33a454cb2194),
+            FB(0xe66f495badf4ea01, 0x0093bd0386026b77),
+            FB(0x52e7aa64031a2171, 0x250e3387dc21d93a),
+            FB(0xa5d2784a8b34710e, 0x4da8d6db264c6e5f),
+            FB(0xf6216dc548d263bb, 0x50f5e76d936cbdcb),
+            FB(0x1c894ff7eeb46430, 0x39a22bb3e9eab105),
+            FB(0x23c5883fa1a0ea8b, 0x0218b50af0e7c0fa),
+            FB(0xbacfe5b7459cd0d6, 0xacf2d7e2224e1237),
+            FB(0xbe9e19e9c864c1a6, 0xdd9c534467f5b367),
+            FB(0x86bad86ca1b00220, 0x6b8af08f21244a3a),
+            FB(0x599207d7f943587e, 0x39d3f56e8b2d6bba),
+            FB(0x9915e2c3832a6cd2, 0x54825e7d39684ccf),
+            FB(0xabd0fa2f7df47505, 0x43b3c81f504320f5),
+            FB(0x3c891c3cfcc0b6b7, 0x25372257c0c7e4a4),
+            FB(0x7b6f880a8a0b7b6c, 0xd9c45e121e71c5a8),
+            FB(0x659f134291eb8ece, 0xb1bc92f0584b318a),
+            FB(0xddfca39efb58b417, 0xd8512125722df815),
+            FB(0x658a1e0b8573f248, 0x0d8cdccace1c3f45),
+            FB(0xb03b253c7732918d, 0x2ca764163d61b80a),
+            FB(0xd0c2a2b5410c39e8, 0x67713e4601ad7e42),
+            FB(0xf7e870551567f2c0, 0x13a383be6a008b3b),
+        },
+        // window 5: g^(j * 2^40)
+        {
+            FB(0x0000000000000000, 0x0000000000000001),
+            FB(0x2c7c8ae73cc2b9fd, 0xb7eb52f60612f694),
+            FB(0x70af96d4f2f3f3fd, 0xb28db33b2f784229),
+            FB(0x7069204f762899b9, 0x472f029854cb32d9),
+            FB(0xae27b75b08403a1e, 0x2d623cf039b40340),
+            FB(0xd32a6f3799330121, 0x6ffc057eb6e73500),
+            FB(0xfb1f49101c0c1a61, 0xf07e6da463602e30),
+            FB(0x99515eaa25f890cb, 0xae81e71471661596),
+            FB(0xf3ff02cc54b3815b, 0x24893512b8d9adc5),
+            FB(0xbc9f2fcc9f2547b9, 0x58bfcd5bf7d0ab5d),
+            FB(0x21cc6a864738849e, 0x2351cd8e059408d8),
+            FB(0x1cef26349271457a, 0xe9f8eeea44e1b009),
+            FB(0x5d5bb9774516c310, 0xbab53db0a0827cd6),
+            FB(0xcbc1b8f38a7da9a4, 0xf7b2480957525395),
+            FB(0x221bb78e889afece, 0x01dd1ef54638c228),
+            FB(0xd302b603e488e4ed, 0xac7e5f7342158260),
+            FB(0x2da0406a072498bc, 0xba1308fb84de911b),
+            FB(0x787ea2d307d68803, 0xd1ed6202f911f2e7),
+            FB(0x63d1297c675388d4, 0x393c45ff3e8d7a7f),
+            FB(0x5d62fcb516976486, 0x483b6f1a106d26d3),
+            FB(0x18ab88bb1fac8a30, 0x7af8fbf1c8113ce2),
+            FB(0xdfac1d48a2f59cf2, 0x95343ba816a64ffa),
+            FB(0xfadad269423ac715, 0x5506bf8e3dfdc89d),
+            FB(0xd8b56136f9680330, 0x83588c4789f5241b),
+            FB(0x9b7b91697f1ca4e3, 0x3cf7cd41a7cbd22c),
+            FB(0x3b1cf61ef3d8e0c1, 0xc41dcf16cb37c381),
+            FB(0xc667f5a06aab29fb, 0xf2c3d310ec61813e),
+            FB(0x8fcff6f20e7c9553, 0x65dc3f24e69d70dd),
+            FB(0x1e1df529509ebe9c, 0xf1f561b750819ee2),
+            FB(0x9cb49517eabe4e1e, 0x1c7bac4b380c916f),
+            FB(0x71cb176b403917b5, 0xb455e0fae45f8568),
+            FB(0x04a16d62ce616a50, 0x41b68ceb0e6c2d00),
+            FB(0x7050dd0d704a1a99, 0x4af9450527e272fb),
+            FB(0xb342a2e60ea5141e, 0x725db37ac4ce632b),
+            FB(0x9bcb94deca31359f, 0x5f833c4cb4c453b8),
+            FB(0xd8b410b39d3ce96a, 0xf80bb673729c1eb7),
+            FB(0x6bf332d52d5c97ef, 0x63b7b5ebf4ad2f13),
+            FB(0x5eaec0215dc5e220, 0xa4d6d30256f787de),
+            FB(0xce7d6b7216c652b3, 0x8c4d59b060459f51),
+            FB(0xc453e099cbd71e9f, 0xe7f9e9c2b8a25e55),
+            FB(0xb3a7aa3ab4a62d5a, 0xfc48f490e68ecf04),
+            FB(0xa22c62a0bb43c9f4, 0x436fce13f1d6245d),
+            FB(0x5d19f0a0ab7a15a3, 0xdf2367c27ece6807),
+            FB(0xf5a76d59141efd0b, 0x15f68856ab3f6038),
+            FB(0x19e414e170430d1b, 0x774feda4eaabdbf7),
+            FB(0xc924ef3fe2f698f6, 0x4a36c5b8ed4364df),
+            FB(0x56e642bd2cd58152, 0x4a0c18d106898e1a),
+            FB(0x12b9f61490ffefdd, 0x8d41a7714b48d5c0),
+            FB(0x61019d6f17dc5d4c, 0x843efed6855fbaac),
+            FB(0xbdb8cfdc7a2769e4, 0x7d7d95e1c784e816),
+            FB(0xe84bafca7139ad93, 0x79f713fefc2cf188),
+            FB(0x52433c1a8fab4882, 0x69c2961cd6160526),
+            FB(0xef6236c572d1dd0a, 0x1bafeb587d6d1950),
+            FB(0x18d7b007c7319e24, 0xaf6ccd96bb208720),
+            FB(0xff13ca5024122d0c, 0x7fb283c05affb4ad),
+            FB(0x053f7a1ba68408b8, 0x04df208e1ad7b6cd),
+            FB(0xf9adfb0d37f4785a, 0xe6212c8e31d93ab4),
+            FB(0x0ac99c9ca534be0f, 0x2b6e5e8256b0991c),
+            FB(0x6fc346140ba79d85, 0x8abf70f41aada89e),
+            FB(0xcf8ced647d6e5df2, 0x23d26abc56c135cf),
+            FB(0xaebe824ad9e11a17, 0x2412ab12cdd94281),
+            FB(0xaaa4ab9e420cfdd6, 0xe6329de6d5cf7861),
+            FB(0x18529999056d3a70, 0x9bf278dd4b85f700),
+            FB(0x75ef46937a3370fb, 0x0040cefbff3f80a9),
+            FB(0xfb4ca2680e26292c, 0xef1d07d8b1f93634),
+            FB(0x6fcb21b171ec7810, 0x601d548ef2973ac3),
+            FB(0x4c97636e9b32b328, 0x7b9f84a39b75b980),
+            FB(0xc7e4c955e5e3487b, 0xcda7dbc475015c1d),
+            FB(0x7527d37f4a090cd5, 0xd6cecb9582d3390c),
+            FB(0xbb42fa64944c3dff, 0x5c93ca0689d0fdd5),
+            FB(0x43a35335c2374cbf, 0x7b31f3cb8c191e96),
+            FB(0x53fca3bc0e2f3180, 0x5cb61ddf7adefd3a),
+            FB(0x5b756c8cdc246bb0, 0x602f9ac049958318),
+            FB(0xa243b7513fb8970b, 0xb6c92ae1c3e69657),
+            FB(0x989fa691e1071c8b, 0xcf0aedc9ee0b496c),
+            FB(0xedb3d1c7374c5969, 0xe9a10586ddfb1a37),
+            FB(0xdbf6d26c5e10ac1c, 0x9945aa75b46a5cc5),
+            FB(0xa0d7aaf4e868be29, 0xd8985b1e27d3f278),
+            FB(0xec6da0f1f860366a, 0xd63279efbdd96965),
+            FB(0x9f5906f12a26122c, 0xec27879cdc9d45d5),
+            FB(0x0ce8c688aacef9ff, 0x0747963a656ac5a5),
+            FB(0xaf6597f0f5ad3219, 0xe1e0b058c9786267),
+            FB(0xce1b21ef3e6bdd26, 0x2d5223a6957c2348),
+            FB(0x6be9ba36203bcce8, 0xaab0b5eab5d83e23),
+            FB(0x8f62a2693f368c27, 0xea0598889b94dab6),
+            FB(0x6997ba54929ad97d, 0x3f9f8f38abcd27e5),
+            FB(0x22c583f5057fc753, 0xcb35a9d21637334a),
+            FB(0x97d5683b5852ee29, 0x397496abc88caeae),
+            FB(0xb379b425db0ae89d, 0xbf4c36de7872f14e),
+            FB(0x331cf72c09235f46, 0x76100c22714e71a6),
+            FB(0x8101114fd738f540, 0xfa66314872fb6466),
+            FB(0x662a42b7e7ef0f81, 0x9662f59599c0cce1),
+            FB(0xed03a634737f2334, 0x358d7f9780dbf060),
+            FB(0x3a4a10b17dec7d33, 0xb6d6e536afac1d8c),
+            FB(0xc56e6a6d65799a50, 0x576e1040d6134e37),
+            FB(0xb5bc3f3644340b14, 0xfa161f3098758469),
+            FB(0x2c9705f23b69163f, 0xcdd30fed9b7b18d6),
+            FB(0x6848543951516f7c, 0x62baec423a515550),
+            FB(0x67456fb8da134abb, 0x98cb56f1192cb40d),
+            FB(0x9b15022da2780804, 0x2e3973ad3bf7916e),
+            FB(0x9889066df607c682, 0xbed5be34a017108a),
+            FB(0xd30b4b05ae661f91, 0xe9a34ef05a8dd3e9),
+            FB(0xe155229df3a4a5ad, 0xba1cfe4751f0c230),
+            FB(0xfbd78cee287e5d46, 0x975ead7cb15a576e),
+            FB(0x86642a4bc500a9bd, 0xfc6423ff1f76278d),
+            FB(0x7a54e306a32b2f2b, 0x7f77a07e47f4ccd2),
+            FB(0xe2bc29980b514bd6, 0xffac9fa62cbb1070),
+            FB(0x72c100312ebd92be, 0xb7b2cd56fd6caf03),
+            FB(0x157ec0b6d3d1a702, 0x0534d04b702778b0),
+            FB(0x666c808fab4bb0a8, 0x9d0a08ca7ff0da00),
+            FB(0x08e5e174ccdce42c, 0xd709996564f72a91),
+            FB(0x0a69f1dc23c64c7f, 0x51acf3f30a3e80c1),
+            FB(0x5e70f11d0c0b6961, 0x94c1723bcf8c849d),
+            FB(0xc1d58d1176f67ac1, 0x3ca867d8d7633b00),
+            FB(0x27b085327fc52e97, 0xc5e1d65331ed2a7b),
+            FB(0x66fbc89661090fca, 0x205c8038aff6f6b3),
+            FB(0x0746f7c66f6cda60, 0x223c929b2a568c95),
+            FB(0x317faefad5e6103f, 0xdfbe680e55c546aa),
+            FB(0x9f0fb89f9179212a, 0xd32917a5db0d6d16),
+            FB(0x1a4adaaf4f248351, 0x665767fe06ada2bc),
+            FB(0xf39f7189865152f1, 0x463dfdc6b4d8dc83),
+            FB(0x7d295b3f88a571fd, 0x92b95efb47eb76bf),
+            FB(0xabebd157be2b38b0, 0x230d79ce175e3804),
+            FB(0x673a51eee809304c, 0x715bf0089e53abb9),
+            FB(0xe78da03973263716, 0x18b80524edc3eb00),
+            FB(0x41d12863a9d5f299, 0x07c53a4301d1fbe6),
+            FB(0xe3dc97232a1910d4, 0x9d8b9cc4ab2b492c),
+            FB(0xbc4edeed81c55835, 0xecd9a86bca30f296),
+            FB(0x5c0658c2de031c80, 0x6eaf432f385125f1),
+            FB(0x4bc727638f23a2f9, 0x49b843315189f416),
+            FB(0x530292080db41bd9, 0xbea8c4afcf84d233),
+            FB(0x28257f5fabb24bf7, 0xcb1e89201b2b2114),
+            FB(0x4cd40cb42e810388, 0x251c8c2e1cd879f8),
+            FB(0x34e6b49571ec338b, 0x546a7d8a56e28269),
+            FB(0xea91e04cc00aafcc, 0xb1cdae92409add55),
+            FB(0x7dec3b9f5322d3af, 0xe9ee0c74891048cb),
+            FB(0xb2e1469665d48132, 0x13d870422cd83a91),
+            FB(0x744e36bc4fb95165, 0xbd579967ff10247a),
+            FB(0x6903333258926445, 0x0f3908b2e74d4053),
+            FB(0xf71389254f75372f, 0x466231736345506e),
+            FB(0x67fddb92a09cc39b, 0xf24e90a258c73507),
+            FB(0x7ce055c5d76070b5, 0xaf9e50a956d70e2a),
+            FB(0xe4e04787dfe923e5, 0x3eea667dcef7c17c),
+            FB(0xe036fefde6762fcb, 0x049b9e67145227e7),
+            FB(0xc051e7a804d5b999, 0x0ef3556b0f7d5e78),
+            FB(0xc3ddfde163e27b98, 0x96bf13be8db72850),
+            FB(0x9b0022f955a7a384, 0xe00d2ef50cff2327),
+            FB(0x9592b15125762a29, 0xf6881bddca09a3c1),
+            FB(0x36b46c4c821c17ed, 0xf8d30aaebed0e76c),
+            FB(0xf3aa8ab23af0670e, 0xf306ff8eff23c19c),
+            FB(0xd1551db337bffafd, 0xc0b20cfdd7095d03),
+            FB(0xeb3bd56cebdd8425, 0x7b3ec3ecd399f20a),
+            FB(0x55313154715250a9, 0x99bc9367e4e0eafe),
+            FB(0xb5793ac489e95ed9, 0x8ee7de59dcf19421),
+            FB(0x8d697c88eeb2220f, 0x89df1ce625aa396e),
+            FB(0xff1667c5d889ecaa, 0x05c48178f3dc1183),
+            FB(0xd4ae4010c96a7ff9, 0x4f9b3d4385274e9c),
+            FB(0x522ab43efd857c9c, 0x4ebe15bd17f9e365),
+            FB(0x3873d2524a526ad5, 0x6e8e573d950f74c6),
+            FB(0x9fc1ffa93d633264, 0xc959df0470f03b2a),
+            FB(0x298e9dfcfb59e4a7, 0xebe48fc35a7d443a),
+            FB(0x09aff1f009e51029, 0x3cfca72725323b0e),
+            FB(0xa32030d608c03a6b, 0x7395e0758d18a33b),
+            FB(0xa53e34a16f92a515, 0x5cd8e81e03b3655b),
+            FB(0x9ffdb55d18a9c33d, 0xf1b75a221a301273),
+            FB(0x71e1af51c63bc6fc, 0x41f28c5e921c615b),
+            FB(0x0b34c8643dcfc52a, 0x5913e9329ccf8cf3),
+            FB(0xbba71663fe2d6e2a, 0x3460a0b205f444b6),
+            FB(0xbf656e2e9f560d05, 0xf16cd05db8f64398),
+            FB(0x65a9264dfb788dbd, 0x9b21e51153ccffbf),
+            FB(0x48330c9d3881fa11, 0x017834a412589310),
+            FB(0xed0df6eb850589e7, 0x45d5448be124565d),
+            FB(0x4e70bdc786f172f3, 0x09e9c517bfe6e4d1),
+            FB(0xc76b28ef059c66d9, 0x5933e80e4a5ab2a9),
+            FB(0x48832aed0cd6fc16, 0x8688b567c3fa6974),
+            FB(0x543b0984e29a6068, 0x60b5ea089db47efa),
+            FB(0x1cc4da345666458a, 0x011b36f3d8e06f0a),
+            FB(0xc50d865e7bfece91, 0x5dc2955bcf179653),
+            FB(0x8c8faf9b21b931b4, 0x34440ec7c9223f76),
+            FB(0x6163d5891cb15611, 0xe3c0af2154b9fb9a),
+            FB(0x95c31493828e4b42, 0x28edefae37ef7473),
+            FB(0x0eda915eafb136db, 0x51d4f8dd6b76b3d5),
+            FB(0x277a2bd0272e10d1, 0xe781d72b7b5a91b0),
+            FB(0x5777a102257324e9, 0x024bcbe4f68d66f9),
+            FB(0x802642e9c33bd26f, 0xa991916c4b999221),
+            FB(0xf66bdc4d76995e74, 0x1658595a5da7ea4a),
+            FB(0xfdc002c8d3325e99, 0x8649c1eac364d8c5),
+            FB(0x4392be4f00f8c8f9, 0x0f0f758eaeff45d6),
+            FB(0xa9e853f24ed6553d, 0x35e9cb637480e64a),
+            FB(0x4a7649531f4e9514, 0x8de6c2693eb1c86e),
+            FB(0x069073a6b17c9464, 0x39328661634b8a58),
+            FB(0x55a8c6c0f189eaf5, 0x66f360e8223491e1),
+            FB(0x65c01cee08897d4f, 0xf91458028c2ee031),
+            FB(0x8c78a69e5801ab3e, 0xf06832f40f46f4ee),
+            FB(0x59cc148cab22aa4b, 0xf2cbe68c5630d686),
+            FB(0x1bcfff379de3ce44, 0xfe5463de19cb9e2a),
+            FB(0x27a328b8561c2fe8, 0x159d81c316ef7d3c),
+            FB(0xb49653295d9ea996, 0x8a41444e79835310),
+            FB(0x600f8ab6171b7145, 0xdb539fd560c10c43),
+            FB(0xb809b23b6e86597a, 0x2d93646ed92a910a),
+            FB(0x23b5b0564f32400c, 0x656c0bd7bb4d923f),
+            FB(0x6b6d1c514c1a780b, 0xd06dfad699590ad5),
+            FB(0x61da6756430f5dd4, 0xe6e2263dfd0f0799),
+            FB(0x7ed5388c21f7df8a, 0xedc61756d327da51),
+            FB(0xe9cbfea54b697e09, 0x38b9815384d0e566),
+            FB(0x1b799ffceafc4caa, 0x5af2b2ef8c3394ec),
+            FB(0x49672c9eadca92fe, 0x78cbd1e0cf2a7b69),
+            FB(0x09f965f4555aab34, 0x484f0b684c32ff9c),
+            FB(0x9f3670623bd10627, 0xb9a21537f9712201),
+            FB(0x7b656b4637cda872, 0x58ea518c33b50ea0),
+            FB(0xdd81ea4eea9b1f1b, 0xce8c6a4967796b69),
+            FB(0x064f7ceef00bddf9, 0x52352e7282ad3ff0),
+            FB(0xfb6a36e27c3322d4, 0x2703b2ca52723d3d),
+            FB(0xc52aea393522fc12, 0xbbece39c2684fad2),
+            FB(0xac20f58350538a91, 0x62de6646016a759f),
+            FB(0xdd0b84cfffbebace, 0x5dcbbbe0a7e0ac5a),
+            FB(0x8fecc595e1234100, 0x20b233b1c3ab471c),
+            FB(0x040bad3797550ea0, 0x65b0ecb3f7b148d7),
+            FB(0x273745d5c061bb4c, 0xea0606780a67f8f6),
+            FB(0x7710ce7fb328f0a2, 0x8946c45c90f3fbdb),
+            FB(0x70fea49dedccf748, 0x8d894b8ea03674b1),
+            FB(0xaf0655a15571111a, 0x18a6510789d19c61),
+            FB(0x32d7093c7eab4bb7, 0x1ef6bf3019ba902a),
+            FB(0xe4200a3c3b5676e9, 0x56f84f32082af365),
+            FB(0x9db6bb2a3e83ab72, 0x79e563010d5d29ee),
+            FB(0xb026630e7e8f1b8d, 0xaba8911259bc3948),
+            FB(0xb5fe7b96fd22d6cd, 0xb0523563cdb0a4d8),
+            FB(0x2f7079226d498e42, 0x7a6782b36359f9dd),
+            FB(0x46d90f2099e18813, 0xc503eca433c959a0),
+            FB(0x467c403c6eec43bc, 0x88f5d00e5a03b32c),
+            FB(0x62471922d1e14826, 0x28d274537e16d3ef),
+            FB(0x29c397f12096038e, 0xd966956cda793c4a),
+            FB(0x0ee77f1760c6fb23, 0x4365548d54862d11),
+            FB(0xfb34010ce3c356bc, 0x9e7db3b0b752af0c),
+            FB(0xcad8855ce3c708a1, 0x2ecdf67d9716f561),
+            FB(0x0a6c1d67e071652a, 0x4cc36c46193efb7c),
+            FB(0x3d2e2f497bf4281b, 0x16c8ca1408d42eaf),
+            FB(0x3e9f601a85c6b449, 0x9b6c327216f1702b),
+            FB(0xb0c042e000eaa277, 0x5b3d50008697b2d7),
+            FB(0x7028dc4608f606c3, 0x8fba91bc37438979),
+            FB(0x39ae6970bef7b172, 0x8f74a6cfa4677ed3),
+            FB(0xd80261881dc1e471, 0x6a5071d9052daac0),
+            FB(0x8331780ec50de54f, 0xf1f680b8feb84254),
+            FB(0x2c69ce5681e4a72e, 0xb51eceded8e457dd),
+            FB(0xfb758f2322cead9c, 0x71bb2e0dbfa34a79),
+            FB(0xbbc11f50ede57ad5, 0x4707d4c41b297d8b),
+            FB(0x73e8a991a2ac87c7, 0xcc943040df4d19c7),
+            FB(0xd7f8cfe39645c99e, 0x2e477d2cd6eed03b),
+            FB(0xa78aac54dc13be5d, 0xbdc8466bc5ae983d),
+            FB(0x6368d8e1b52a0ade, 0x716a8adf67fecb33),
+            FB(0x70bb6794388e7ebd, 0xfd6f6edd7c78366b),
+            FB(0x916e38315986803c, 0x73042dcc38b33cee),
+            FB(0xefe35ed40cb94e89, 0x7b99a20297682e71),
+            FB(0xf9e9ad21e3dd7fc3, 0x0cd50897f59fd0d6),
+            FB(0x26e80ac458c79153, 0x90eabdff83c6c38a),
+            FB(0x7d427b43509ce14e, 0x2db8195eb46928d7),
+        },
+        // window 6: g^(j * 2^48)
+        {
+            FB(0x0000000000000000, 0x0000000000000001),
+            FB(0xcae44e31c6ecb660, 0x19ec139aaa809139),
+            FB(0x92b6f0285aabdaea, 0xfe03c59310677d1e),
+            FB(0x8fa729090f968662, 0x3116112fdb8dfd9e),
+            FB(0x106b51427b137ccd, 0xd5ffeb6701a69eef),
+            FB(0x4cb44d60bc09e571, 0x58102e604b00210d),
+            FB(0xee09d7fd3c462512, 0x7a4f0d1c9f373f2f),
+            FB(0xe83fa0e9a6da93e7, 0x837c19f8e0baa6cc),
+            FB(0xd61b1a06a3ca6603, 0xc85ac18583cdcd62),
+            FB(0xa9693309d6fd17e1, 0xaa12d57293537c06),
+            FB(0x48d352785d697823, 0x62f5216ca0fcefee),
+            FB(0xe7f344f647450814, 0xb568cc53b30ba9d6),
+            FB(0x92e8313b3d910365, 0xf3ed7f7b11a29418),
+            FB(0x6d77812686c30bc0, 0x8b5ecb3ec9169bca),
+            FB(0xcdc7a558dd6ad824, 0x824551b901a4e3ea),
+            FB(0x60f4ac4a61e1f458, 0xee4a8ed385b2f7ec),
+            FB(0x6d2cb51ff4dd4a5e, 0x9eb7c387363d02c0),
+            FB(0x602e8591b2044bc6, 0x60f9061b5d463c79),
+            FB(0xb9094c41c88a346a, 0x7c4213329890bdfa),
+            FB(0xd71b1c8ec2e24322, 0x5c2eb766cc6f2ed3),
+            FB(0x45ed6082f117de98, 0x9a3d181d9e974ef7),
+            FB(0xc314233b0b3bc6e4, 0xacaa9c3bf74b984e),
+            FB(0xe3d13dd3280b3061, 0x3fe678b26581cb35),
+            FB(0xac0525d815a69933, 0x155373ec3c3b28c7),
+            FB(0x1032d9938ed0ad1c, 0xb3170383438175d0),
+            FB(0x3e748ffab49b3c86, 0xe72f0db4e2307c24),
+            FB(0x0578f09e90c01319, 0x9a04b38f6237e572),
+            FB(0x5d1feff63316f354, 0x1f7c3f619cc27f69),
+            FB(0xd91aaad9c5fe93a8, 0x1e3c0be542c7546b),
+            FB(0xa0326255101e0fe9, 0xc066f6f973417a0e),
+            FB(0x387f3317b5ec02d3, 0x2cbde9a8766d87a6),
+            FB(0x1528b91da04ea86d, 0x79d47297ea911fbc),
+            FB(0x0461708603f2ec15, 0x264d1b6e53d0899a),
+            FB(0xaf7125ab4413a929, 0x4b7f60257ae5a8f2),
+            FB(0x780262ccc8c246e1, 0x484d186c5622aa1b),
+            FB(0x6eb804136ef8c4be, 0xbaa6295e2d89ecc5),
+            FB(0x6f17314b58bd75aa, 0xd0a1a2ded62b0bf1),
+            FB(0x0205b1fe63fcffce, 0x05881d095861d03c),
+            FB(0x2cbba00feb84ff91, 0xe267ba4176cd5b46),
+            FB(0x56986ac83b35a266, 0xe01ae47218695406),
+            FB(0x3998806c6d61c366, 0x6ad3ccd70cd937ed),
+            FB(0x5ce57b11853438c1, 0x4b7a71401eac9a30),
+            FB(0xf6cbcb365fc9bd1e, 0x764ca837fb07a07b),
+            FB(0x1e3f208c2ce3b923, 0x26d85e367dc55a1e),
+            FB(0xabe76391a75e709d, 0x29d16358cb4f7cc7),
+            FB(0x8cdf902cea8b7397, 0x4b6b9e379fb59b20),
+            FB(0xf4a119f001db4290, 0x8a84d3086205d8e7),
+            FB(0xb9cf7802a4d2f458, 0xc0f3760ace2a9d3b),
+            FB(0xc2079820166305bf, 0xfb807722e026ffb0),
+            FB(0x135f1ef8adf7b506, 0x0a74d06861f871bf),
+            FB(0xe4b3e704eb514def, 0x07556159a7c1cf72),
+            FB(0x7a6f857c29150606, 0xd700640cb34be9fc),
+            FB(0x49b9cafb6e242cd8, 0x532db515d18ab343),
+            FB(0x8f2566598b7da96c, 0x704ac0d647eb7fc6),
+            FB(0xdf62b9508255356f, 0xd8cbdd433cc6ef09),
+            FB(0xeeb7c14db9c9bdf6, 0x1746ab82f0387eee),
+            FB(0x1713a1afffb0427f, 0xa8d8509854a8fdda),
+            FB(0xb1d0b88ecaad13b3, 0x66294a011ec436eb),
+            FB(0x8c028d023b00aab6, 0x9205bcad3e449c7a),
+            FB(0x54c46e4c6791c0a8, 0x261dcde067bd7edf),
+            FB(0xbe9a8578cddac988, 0x46c891e142207081),
+            FB(0x4d5a23c213f3584d, 0x7c40bb0f4cfd36ca),
+            FB(0x9ab46cf36f43ef01, 0x884c1a8efc9f0067),
+            FB(0xb3674c70d70e9b14, 0x29a7e5565cc42de9),
+            FB(0x0c6e7cdcea64de38, 0x13b57837c5f1ceb3),
+            FB(0x066f7db81ec69881, 0x29b841bf95aa702a),
+            FB(0xe764fed000d4fb42, 0x6d34d1a9b905792a),
+            FB(0xc20a6dcaeaf5c671, 0x767991c6a2b98087),
+            FB(0xda8012476f758dc9, 0x80fdb6103e03a8f4),
+            FB(0x9f8c7f22e9ad97bc, 0x59f1fedd025a85a3),
+            FB(0x02cb3ed40c3194c5, 0x43d64aa8ec03258b),
+            FB(0x895b1d39fc98558c, 0x53726835029632e6),
+            FB(0x162bc9e8df8b0207, 0x87f77678e391afeb),
+            FB(0x65923f066af1bec4, 0x45b10994162a5796),
+            FB(0x020d48945afd00e7, 0x7ff0169a51029efc),
+            FB(0x84db3a6b9f775641, 0xa70cf3d6602020b2),
+            FB(0x61976c6d99443b01, 0x9a6e980a114f569d),
+            FB(0x5f644ecc8d51e958, 0x07d7835afb257f3d),
+            FB(0xa94d678e1be584c6, 0xb9198795cf066240),
+            FB(0x5d5503bd43a25b00, 0x49b2d4b302b2c2e8),
+            FB(0xae2237e4905a14af, 0x456d3defb7843333),
+            FB(0x9e567875e8a94e43, 0xf711e1650abf3356),
+            FB(0xcedeb1b9dd5a97a6, 0xc9a1d722fbadb1bf),
+            FB(0xb0c9afe21fe90aaf, 0xf6163f61a65cd1dc),
+            FB(0x34518322d7199471, 0x894791713637acb8),
+            FB(0x18c870d419d6fccf, 0xfa7b57cc14dc407d),
+            FB(0xa8bae1690d75eca6, 0x20cafea96b011fcf),
+            FB(0x0de23ee2f769f29d, 0x6e341d6330c74050),
+            FB(0xfb31f7e07abf56e4, 0x86a6ccf3fe712f4b),
+            FB(0xb8fe9a440bef7962, 0x7af22ab69205f753),
+            FB(0xf9dc084f0656308e, 0xcea8a640a8ff598c),
+            FB(0xb4c3d96d22071c7f, 0xf4f57c45902525d2),
+            FB(0x63179c97f7692b40, 0x14aa1442237d0644),
+            FB(0x2a714308627a5f1f, 0x3a8407f85c19c677),
+            FB(0x2a6ece24dfd4027b, 0x840d31736229c2ec),
+            FB(0x169a258b1f605421, 0xfd8a953c7c9e6387),
+            FB(0xe7594aca73d71804, 0xd9666a8f5d812174),
+            FB(0xc7ca4f6b1034281d, 0x8187a869f6c81fff),
+            FB(0x85d7c93bfd871ea3, 0xe11d748846f64f39),
+            FB(0x4cc5eb9558611ed3, 0x94d87af050448e55),
+            FB(0xa44648a1b2ea191a, 0xcb46a78e0949877e),
+            FB(0x6c42bb586c500c67, 0x695fc65a306bd42a),
+            FB(0x99c3470adcedc2e2, 0x78429fb25e2d5a0a),
+            FB(0xb604fc03143d38e6, 0x162ed5078b231ae1),
+            FB(0x40617e3fd6e60940, 0x16af5436709c02fd),
+            FB(0xbd1071fa9fdce031, 0x8139c975bb6dbc3d),
+            FB(0xfe2904b936648772, 0xf3449651e81805c3),
+            FB(0xa984f8337cb2f788, 0x619fd506dc577af6),
+            FB(0x4d613e7a2b1ee724, 0xc744afe1c7a85335),
+            FB(0x1f7893754bd4203d, 0x477973a9dd6b008b),
+            FB(0x869a41d6f4ca1910, 0x2f6e942467486069),
+            FB(0xb901882a758aa8cb, 0x35e0ae9450d9ca88),
+            FB(0xc9abd4f8cda4b640, 0x11181f482747916f),
+            FB(0x5226af396d1d67ee, 0x04cd4f9cfb41218d),
+            FB(0x4fba33626aa5eb84, 0x92aba52780ac1cb7),
+            FB(0x6a71cd7f5dee19f5, 0x57e28d384215f6e0),
+            FB(0xa8b4022cac67464f, 0xbd0f1033beaf544f),
+            FB(0x14c9b5d2d9abf0fc, 0xcce9bfe94b5ab0bf),
+            FB(0xfb4db92b17f50dba, 0x72df02ffa577a8ad),
+            FB(0x539fed2c8ba831fd, 0x6a52328202156b65),
+            FB(0x609934bd89fc9ee8, 0x891a10f58466b0a8),
+            FB(0xe7ba02008d95c17e, 0x4f17b992fde7cf6d),
+            FB(0x4c6fc4de5bf7b249, 0x95e07cc2d3dc0d4b),
+            FB(0xb0ef8db3b2097595, 0x9d6762ce1b34a15b),
+            FB(0x24bf432a44df69c5, 0x127333e5872b04f5),
+            FB(0xbac6916fe71233b1, 0xefec87df3d7fba37),
+            FB(0x5dd022f60dabfa3d, 0x2cbb7b9d600aca58),
+            FB(0xe13f9091109f15fe, 0x60978089b6208c45),
+            FB(0x28bf02b7d7d91b8e, 0xdfc731584cfaffc5),
+            FB(0x3f488e0cc2312e8a, 0x1758e922aa50a5aa),
+            FB(0x0e270261d2153f95, 0xed94fe0973e1c4c3),
+            FB(0x9fffe142a8f25c3f, 0x1cfd3b2f6fc07d59),
+            FB(0xb2b0614b51847341, 0x45683f4a1d126309),
+            FB(0x3456f0506c7a046e, 0x91b81879b2d80f4b),
+            FB(0xa7083697041fc3e3, 0xcbf3669ffa66bfcd),
+            FB(0x00ef3efb1142c933, 0xb7ed37b780a430e4),
+            FB(0x54fd9551c0007be1, 0x4275e3d3ad5ed008),
+            FB(0x3d2ca553e9dbd74e, 0xe494ed9e6ab6a058),
+            FB(0x7d4bbcbb957d4f66, 0x8d60e4520dd926d2),
+            FB(0x6d980e727ea61819, 0x72edf9a9546a9529),
+            FB(0x1230c24da0c17b30, 0x7de29ba34b48f8b2),
+            FB(0x21b379ab88d1809b, 0x17b93b6964aedb21),
+            FB(0xf04ac15fba75bf7d, 0x029527dcfad2adc3),
+            FB(0x7eca854a52c76094, 0x76b4b665c7ee511a),
+            FB(0xcd7b6a67847898a9, 0x480fa25a46495eae),
+            FB(0x68c65223494ea233, 0xc8ea0188352d5033),
+            FB(0x74c7001fb06a4b76, 0x4ee32fe06190fc52),
+            FB(0xf1bb90253e474bdf, 0x588255f12a9a1a36),
+            FB(0x17497c3f50f50e3c, 0xc5f60233417ff3bb),
+            FB(0x9af8fc7ed5032336, 0x7412984f2d9e1c23),
+            FB(0x8c4c1409edd31e6e, 0x7821e5e3f96425e4),
+            FB(0xfbd5eef95b287203, 0xd4fb58744197786f),
+            FB(0x2de259b504fa4552, 0x674e6827a94f44e0),
+            FB(0x46e32a67f80b84d8, 0x5759e4e9943cd5db),
+            FB(0xdc34356d1b8088d5, 0xbc7af3bd981ad7a9),
+            FB(0xe6cedae07d59b49c, 0x3533f83d57178907),
+            FB(0xb80e587c26dfaabd, 0xf425a4c2dc5dbb05),
+            FB(0x26ce7b0b89458499, 0xaeaed86cda3805af),
+            FB(0xce7ebaf353a8373a, 0x72bc9b10845f5078),
+            FB(0x97620d31a5d44a24, 0x89d61fe76317f382),
+            FB(0xe7bf0a4f9491f004, 0x021d94cc8a56e347),
+            FB(0xea4a27b027cfce71, 0x87b4270d6c9701dc),
+            FB(0x39b1fc679ecbf7cd, 0x8da7b81a5ea173e8),
+            FB(0x1be96a71e854d083, 0x2c86e1b4fbc77df6),
+            FB(0xcbc4588e0ab17e6a, 0x4b7a90ac08c98766),
+            FB(0xd6c257071cbbc239, 0x3479351dbc63b2b2),
+            FB(0x0e3d9070f255ba1d, 0xe8149c1772feb712),
+            FB(0xd6e0f854cdca1219, 0xd1cca9ed0f2bcb77),
+            FB(0xd339e7b383980b34, 0x38ffa3730b2aafc9),
+            FB(0x8607283f8f0bc534, 0x4a0fe85db973b405),
+            FB(0xf3ad848ffa3c6f20, 0xa77e6c1712998e7a),
+            FB(0x9128b7099324db25, 0xaf14c8bf21ac959b),
+            FB(0xf9e328b3f9d90906, 0x3d78e3dd84c69750),
+            FB(0x15985f2d512ec14a, 0xbce0ba68246319fa),
+            FB(0x3d48ab0eb1d6ba32, 0x24e11d79393d7f37),
+            FB(0x50ca7b28253ec9c3, 0x18bae36194a2af71),
+            FB(0x484ddfb87190f90f, 0x9dab6522f912a164),
+            FB(0x326d4e48260832b7, 0x1c5779197e068919),
+            FB(0x6faf558960903d64, 0x627487309f586e70),
+            FB(0x86535bdafd58743e, 0x048b07460a89c939),
+            FB(0x5a3a5af065dc4b2b, 0x4e24a83b8a60bead),
+            FB(0xb530bf7176bd6b48, 0x566e0d101f80583e),
+            FB(0x0649e7a3031d5524, 0x5f1c0efaaaab8046),
+            FB(0x843572b9f36d47c0, 0xf2d14f3bf7c788ad),
+            FB(0x6f8bc98e6f815dc4, 0x25e458143f476526),
+            FB(0x6052ce5ceab90144, 0xcf17c39c7c5da5bf),
+            FB(0x3a92ab9f728e748a, 0x7f46c9958c3fb830),
+            FB(0x7abd5a3565b6940a, 0x5d94876773f592c1),
+            FB(0x7fc647d49eaf015c, 0x08063b3152129d05),
+            FB(0xf4bf764544bb1238, 0x5ce526ce91c5bc71),
+            FB(0xd81c249a55c7e60b, 0xb9712d5ceb775c92),
+            FB(0x3444cc1c16428c48, 0xad878f38cd7a3b2b),
+            FB(0xf7a2c25b47b1d383, 0xf8e37deaa2c10831),
+            FB(0xa0b48166e05394f8, 0x52734cddba70d5cf),
+            FB(0xfac3d3c11f615b1a, 0xd216c3323c95ef3d),
+            FB(0x272a9d6de6c05834, 0xa1629237c53a860d),
+            FB(0x9cdf3c938455f830, 0x12029fffbcdacbbd),
+            FB(0x1ed5b8a77f12fd1f, 0x211fd3687e9cd182),
+            FB(0x1889e99c9a3e1aff, 0xc7ca7c97ecd120b2),
+            FB(0xc9e9a6c90bd0f2ac, 0x6cb5fb4197088e98),
+            FB(0x843d6a7015f69cf0, 0x59769f9de652a0e1),
+            FB(0x7ae0dfcd917d3d6c, 0x8d03e665d8558b21),
+            FB(0x51f9636a2847c78e, 0x40b8e34578aa6799),
+            FB(0x4eb6a0185a026ba8, 0x34f5676e7b1cdf03),
+            FB(0x732ea2973bbe66f1, 0x0fcf814fa373be3f),
+            FB(0xac1639e7f160d10c, 0xdcbfeb81f99f82a9),
+            FB(0x50780c0f53a1028e, 0xcf37b630bbafe304),
+            FB(0x8baa6d8c1bdcd9da, 0xc6aeee1b3b56106f),
+            FB(0x711e28d8d1beb516, 0x2847e73c214b2169),
+            FB(0x3fe4caca5a6cfa8e, 0xcaa10c5cc5a320b2),
+            FB(0x3236824bbbed1dec, 0x29470acae9528fbf),
+            FB(0xe5856f91091770c5, 0xfed98196cf4a56e1),
+            FB(0x55ab2d5749476b44, 0xc5266511caf0ac48),
+            FB(0x67aa4f4f32ee6994, 0x40da455d0e4400a2),
+            FB(0xe967890e5bd39985, 0x93c34822348ea5bd),
+            FB(0x95ed1fa907944f10, 0x32d1f18d48c3dfe0),
+            FB(0x09287c95f4f39cdf, 0x6f4ee8c7b7ec1559),
+            FB(0x39a2ecdc301b16f9, 0x36c11ed1269d0018),
+            FB(0xbc34dfa05094a7be, 0x02232b371c02f272),
+            FB(0x8ca474e91f119301, 0x83e41e40bd943020),
+            FB(0xce18708031be3957, 0x374c839cb2478326),
+            FB(0x877ce10fe8499d1d, 0x855cbdc49ba65b05),
+            FB(0x7f5654a6a5967ec6, 0xf2d6b2beadadc272),
+            FB(0x851ade0c5201417b, 0x9ecb68aa7bc4787d),
+            FB(0x9065fe323e0e1aa9, 0x9d01c4461065700a),
+            FB(0xfc327bc023410204, 0x750fdbb57aced222),
+            FB(0xf50e461ee77cfb1d, 0x1072be3c62c1c3c5),
+            FB(0x637f6d9214ddb5a2, 0xb5505106cb8ba856),
+            FB(0x1a0c3c9bdd806a03, 0x0fff908c8e2a895d),
+            FB(0x6eebd90a57642ea8, 0x1642711b175adcba),
+            FB(0x5ec3bfaad96cc563, 0xce1886bdf37872c1),
+            FB(0x10a8cd9da2216b1e, 0xe287d0334787fd14),
+            FB(0xb8b25325031e3096, 0xb0ee22b66b745a17),
+            FB(0x932ac5e2a1b33d20, 0x4ffd2ce7878faea1),
+            FB(0xdf09c525168b6174, 0x0621ee346e2b47e5),
+            FB(0x4a8bd4c69c0d64ef, 0x4cb3a8cca0ed2a34),
+            FB(0x1d5708417a416a0e, 0xc9d136e26d5429dc),
+            FB(0xe0d18d2097a5bf44, 0x4d1f17687e597cfc),
+            FB(0xe1fe7d0480317595, 0xe37cfcd38fe9121e),
+            FB(0x9e6711629ddbff34, 0x2c16ee8bac3ab1a9),
+            FB(0x2c60670192532707, 0xa17c16852987ccb6),
+            FB(0xb19df2b353640488, 0xec9745eaa0e3d889),
+            FB(0xb69d79c9475d4125, 0xbc471bcbe0d8c1ac),
+            FB(0x6d915f090275d011, 0xcec2b889d526703f),
+            FB(0x18ab1302ad094ca0, 0x857570985945453a),
+            FB(0x554a244c4c5b18fb, 0xa46e25e86a6657e5),
+            FB(0x1a7a931ffd1009ec, 0x5859245da7d74fdb),
+            FB(0x5900acdc33978774, 0xe1e6a19ce8c827d5),
+            FB(0x15576526779c6bc5, 0x384c18644d7eece8),
+            FB(0x668af1de3f73f91e, 0xb139fe6865bc26f9),
+            FB(0x2ca0ee1d07981655, 0xa3ba904bdcfc4ffb),
+            FB(0xe9ada352c8c09481, 0x2026afb6cb0da9d6),
+            FB(0xda4e72470b72603d, 0x3d14ff34589aa74f),
+            FB(0x7a45e8c051a7ac38, 0xe92093adebe07368),
+            FB(0xb885f11f072107c6, 0xc235682bcf8c05ec),
+            FB(0x38bfee96ab7a6652, 0x459183320bbc94f3),
+        },
+        // window 7: g^(j * 2^56)
+        {
+            FB(0x0000000000000000, 0x0000000000000001),
+            FB(0x6cb6203e073e4082, 0x2d924303f12fbab3),
+            FB(0x41c2106a0c07b0a9, 0x5fe8b4f13565822f),
+            FB(0xe605b1b1e39bdf76, 0xd3f22d929104d898),
+            FB(0x61fbe65cc21a1add, 0x2ca11ed91b27fd2a),
+            FB(0x2829932123a3eb71, 0x0cf86662b9161d22),
+            FB(0xf7695dd05ff51aa8, 0xefbb64624d61b57d),
+            FB(0x1e2560d2431151cd, 0x299628acd14413c4),
+            FB(0x68fc4c71a7308fd8, 0xb359a0c9f1a41f45),
+            FB(0x89bc8a72f2762608, 0x3d9b312db0f52b68),
+            FB(0x3d926826518d0881, 0x5bf9dfa48e00ee8d),
+            FB(0x55ebc89dca62b1da, 0x0ba4103ab13f94c1),
+            FB(0x75b4080aca0e230c, 0xcc5137f6e1eefdc0),
+            FB(0x308748e1ad0b91c6, 0x83e70618b5408b79),
+            FB(0xa8ef55e968697144, 0x239a979ff6abc927),
+            FB(0xfb684194989dc47f, 0xce6acda6242687a6),
+            FB(0x08ee13f91dbabbe5, 0x83e8df31ea5703e7),
+            FB(0x38edeaa45bd4d86c, 0x26c1ee38f33c5c40),
+            FB(0xe43533d4e6d7ed66, 0x6c16b47f122925e7),
+            FB(0x15cf262e7338643a, 0x282483d126e98cca),
+            FB(0xa35310571c975274, 0xb7f2e93775b581d8),
+            FB(0x747d96181035b645, 0xaf980b160a4b0d49),
+            FB(0xff99cb6290e16b5a, 0xd6d76b6a1abe40e5),
+            FB(0x436f396092270df1, 0x1d432fb840593a59),
+            FB(0xb384427124d576e1, 0xc7dd7ffa4bca7c86),
+            FB(0x3b54abff04954391, 0x86b2c503cb494a0c),
+            FB(0xdb249ef651ffade4, 0xb026337a07ebae23),
+            FB(0x48f0fca022bca40f, 0xeb825c6565d0c861),
+            FB(0xf9eec667bec9cc18, 0x18de0908bbce6d0c),
+            FB(0x858856f424326cdf, 0xfbae763cb45994d0),
+            FB(0x5805598c20f70b45, 0x62f16a0af86f916e),
+            FB(0x1879cb3116a3c236, 0x11425be0557c7a08),
+            FB(0x61eed3ecd4e50f46, 0xfa5069ea7875f0e2),
+            FB(0x7c7b48abbbd0f827, 0x19b3ee878f02ae81),
+            FB(0xbeffd51ddbabd138, 0x81773a09079a54be),
+            FB(0xf4b1fd03e7f6f372, 0xe69068ff8e4dc5b3),
+            FB(0xb02292e1dca22a0e, 0xa7413981812c2728),
+            FB(0xcc8c7a21394f74b4, 0x56f6ff0151ddb3be),
+            FB(0x8b9e9f39566b66a7, 0xed8dee8b2422e898),
+            FB(0xc0d3672189f81d3d, 0x5d39f6af762b1851),
+            FB(0x9b86a09fd349f8fe, 0xbb8008f2b517a359),
+            FB(0x3dff95b91784bb99, 0x54af79cc395599b2),
+            FB(0xa72f83564d29a7d4, 0x8746839151356d80),
+            FB(0x4a23522089b0bee0, 0x6d692c100922a7a7),
+            FB(0x511e377b87147a79, 0x466fe9d95f53959c),
+            FB(0x1f36004062b67d23, 0x0738cd1ba3a383b6),
+            FB(0x73c0572cbe182961, 0x551e07aa2c583efe),
+            FB(0x2bcda97b4af77741, 0x246cae8f3f715730),
+            FB(0x09af99296743bec1, 0x041c6fb9f417fdfa),
+            FB(0x3fc86e55a77776a8, 0x782b71e6fff67374),
+            FB(0xf847ba57af61002e, 0x58145fbe62fe46d9),
+            FB(0xa193f8b2c39b2f7c, 0x3971f92af50f1620),
+            FB(0x5159104569823420, 0xf7b9544db148b42a),
+            FB(0x64d30082915a7764, 0x00d9b47c22cc5665),
+            FB(0x05ae6b2f13c3c813, 0x0a2e239384303b12),
+            FB(0x5d26912c013870f2, 0xf181da7a672fe88e),
+            FB(0x0b2cd6d1ba276688, 0x35c0c13a8de1b3c1),
+            FB(0x1bd258ac6c837d80, 0x9a64f04404599a53),
+            FB(0x9d93a59ce8532622, 0x5162885704895d4c),
+            FB(0xfe38f30fc1ce8765, 0x2ebe03b43062d359),
+            FB(0xc2c45dfec222e9f6, 0x496b35be6252689b),
+            FB(0x58484e73734d3cbe, 0xe789163ee49a76f5),
+            FB(0xa7cbda6a821ccf87, 0x9c5ecbe2a75a912c),
+            FB(0xab824d27c8c5351b, 0xa97bba543ade71db),
+            FB(0x39e8968521f1d1dd, 0x2a1bb1e67e232b5e),
+            FB(0x3e858002adf1e815, 0x614a10577122cecf),
+            FB(0xc3fb8d5605b7bf6d, 0x3827372f4e9653dc),
+            FB(0x647e143bbe51128d, 0xf6ddec62fc9bcdce),
+            FB(0x308615173ab3ae5f, 0x146dbe362695eefd),
+            FB(0xe65843672f30c51d, 0xfff185ccafe933e3),
+            FB(0x77471aac167757e5, 0xe69431167980b948),
+            FB(0x22b227a44bfc27ac, 0xd450eb494ba89ec8),
+            FB(0x1f170e3c4076ecaf, 0x5e92da4e3bc93e85),
+            FB(0x457296b742cdfc57, 0x69a9d659e3323e91),
+            FB(0x8885bcae9d8b1c84, 0xab4e0a70a656027b),
+            FB(0xe8b272e3dfe7ca5d, 0xd1bf51988c96488a),
+            FB(0xb72b2cdc387dfa0a, 0xf9764b55320f87cc),
+            FB(0x1f5857604965e611, 0x74ecff8f132f3821),
+            FB(0xa17830d033fd58f3, 0xf4780e85af75b769),
+            FB(0xe2838bd4db5f959d, 0xeeb58b92e7c250ac),
+            FB(0x213f8a4fdc613906, 0x708250794eee018a),
+            FB(0xea0fcd19f068510e, 0x122ba3ecbc9f4769),
+            FB(0xa30c445f5a952a17, 0x888bd942393b224d),
+            FB(0xeda0dab3cbeaed11, 0x41b91875f9dc1c8b),
+            FB(0x96fc271e8296bc65, 0x48343875c2936e19),
+            FB(0xdbf99f6683d7f082, 0x14f7200ba13a6ec2),
+            FB(0x478f0ad2f14e1d21, 0xe1255f273492ec2d),
+            FB(0x8a802d45e1bfed07, 0x4518ac6b144a5a5a),
+            FB(0xe793b8fbc5a0993b, 0xdbbe9e7f89c78f2f),
+            FB(0x1244095a9772feb8, 0xe635559b44b7e9a9),
+            FB(0xac3c942c5059714f, 0x2a3a156382305b8f),
+            FB(0x62a2bea8bf412526, 0x0e02334b752d7ece),
+            FB(0xf8a3b15cfdfc71d7, 0x74fcb78238193ce5),
+            FB(0xd542f296365c8068, 0x98d9f5edd207ba16),
+            FB(0x3b628d44b9198806, 0x56a234e0f0f67489),
+            FB(0x0f517244f81aa60c, 0x393978dfceb20f19),
+            FB(0x2174f65a7210780c, 0x33f373ad25d4e5c3),
+            FB(0xf781f69c6952d7b4, 0xc62eaa2b2bab548f),
+            FB(0xa542958f52a5abc0, 0x83b4b4f5f44ae9de),
+            FB(0x0d0a9bf0be7b930c, 0x0b647a9eb9912ab2),
+            FB(0x1b887bd86981b89c, 0xe32539d3101673bc),
+            FB(0x5c8b66141cae6645, 0x314c241141905ca4),
+            FB(0xd9e750b15fa25d71, 0xe7ab640c3635d7d9),
+            FB(0x6dabbd69ccef1ea5, 0xc174c5f51504a63f),
+            FB(0xa29a9306961868ac, 0x0867d25ed6621c7c),
+            FB(0xc531dc14f05dd202, 0xa1a78a2db93ec1aa),
+            FB(0x645964da4531d76d, 0x438b8486f0f57557),
+            FB(0x2a702ad4726a5ef8, 0xc1f1a347d616efbb),
+            FB(0x0890f3f24b5c762e, 0xc5a2b7b29485849f),
+            FB(0xc47028759f833562, 0xd9363b0c776f5f5c),
+            FB(0x8b34564c16c120f4, 0x1490be9fbf6b6d70),
+            FB(0x56f5d21b247c06c4, 0x02ded53bec7195c1),
+            FB(0x264865996d4432e0, 0x388f42e02348b1c1),
+            FB(0xa57971d3972e9be3, 0x5c21dcdd2f47f7b8),
+            FB(0xe536210483e3e5aa, 0x4581d3d08352d105),
+            FB(0x802a35958607f925, 0x8e5c1acd5aad1ef8),
+            FB(0x7f1751bc94967f8e, 0x8dd8b5d8073f1e2b),
+            FB(0x5964b538094ab6bd, 0x45b54665f9cd9ed9),
+            FB(0x04faffbf299e6e12, 0xb5ae8f899be460e7),
+            FB(0xb5b77bd16e6edce6, 0xe420b81367dbdd6b),
+            FB(0xa274ac3ddb0d45d1, 0xa61a0f33992c7476),
+            FB(0x59fb97d0136f2f43, 0x87f319f1decae026),
+            FB(0x82dd11895ab2ecc5, 0xbd831871a7872185),
+            FB(0x1bf2ce6b05624ca7, 0x4fbb1ea57e4aa815),
+            FB(0x9792822644931bf9, 0x8609bfddda0bdfd2),
+            FB(0x50e8402fa8037248, 0x0814105b97d4a926),
+            FB(0xbb3bd7511c7107d2, 0x94ade9a186f6e477),
+            FB(0x6f7e4bba182be4de, 0x5048d339fe4bd8bd),
+            FB(0xbe288ca4084c9ce1, 0x09f82fab33eb0e6d),
+            FB(0x26926f024e083106, 0x09635a2ee0c1dcd9),
+            FB(0xa48cd892c100132a, 0xe01d2fa8dd94deac),
+            FB(0x7138acc683545b84, 0xe0d9f5316fcad916),
+            FB(0xb7f00c6fec2af939, 0x188010dc61240038),
+            FB(0xa6bdbf5cdae4ad22, 0x4f5e7a6fcc43a1be),
+            FB(0x316e91fddb22ac7c, 0x25f4b6c2d56cbc55),
+            FB(0xa666cb0800da10c3, 0x38297eba83a17d69),
+            FB(0x9a31de3dcaa388fd, 0xbceb18a9a3f08874),
+            FB(0x1c267414513d354e, 0x69ced8f7df389eae),
+            FB(0xf33183c9328036b9, 0x737ccf68bdf2ef63),
+            FB(0x09a18a0126297129, 0x3dc2697ee2e7b7e0),
+            FB(0xb5f73bfba1fef4a4, 0x9827a1e3b881b181),
+            FB(0x21ffcacac7637fe0, 0x01e114e0fd16ff9d),
+            FB(0x4f2f481e428dc439, 0x433546f2579ca4fe),
+            FB(0x3f68af30bd6fdfc6, 0x442d7cc7769693e4),
+            FB(0xbd7fccef7aeaa2ec, 0x754fb10680c7b73a),
+            FB(0x3d417ae5eb7624d2, 0xc1c2b48539923bcb),
+            FB(0x6cbcad7c1c5b40a2, 0x26309c1807ecb8d2),
+            FB(0xf5ca35c32e55438f, 0x3dca0ae321593818),
+            FB(0xa5a4d88072d7e28d, 0x2a02f24fae95cd52),
+            FB(0xaad1bd70a34647ae, 0xc0e9036a0bbb20f1),
+            FB(0xdce21c43f836eff2, 0x5c50e7d683948b22),
+            FB(0xe33abcefee8631b8, 0xc3ceb49b35e12041),
+            FB(0x04a82a4d25dc0fa3, 0xbfcec24948c962e5),
+            FB(0xe9c306be956e1e90, 0xab53b94feb1f9185),
+            FB(0xb9338298a8b42c5d, 0x50486089a32c8386),
+            FB(0xeb454e9f06ac956a, 0x6ee8df965ebecbad),
+            FB(0x899ddf829b7d7713, 0xdde5172e93fe2cb3),
+            FB(0xb1571b34c80b2ca1, 0x394149a885bd42cb),
+            FB(0xfa6987aba3377e5d, 0x40468c0e5ed63f36),
+            FB(0xe62d3882392ff1a4, 0x01d37cd0db8b4fec),
+            FB(0x0985f00ef2d44e43, 0x0eee38d1ba464b26),
+            FB(0x09dc0d89555b6828, 0x7f84c257bb1facb3),
+            FB(0x8ed82f47dd32f23c, 0x6e5a0c9de7922abc),
+            FB(0x3352a154e1ba73b5, 0x129e400a209bde70),
+            FB(0x9edb69fd2939cc27, 0xd1bc4ab03bd88cd3),
+            FB(0xeb8cd50d8b6a0370, 0xedabdc5db6f34f3c),
+            FB(0x9515996815bf4ca3, 0xc631dea78467d293),
+            FB(0xc7ce7cb5b23aa522, 0x4011c26586348de5),
+            FB(0x5d0707a213abb99c, 0x92390c4a66ee75d1),
+            FB(0xc340315c7bd525db, 0xf9c4a43a87bd5c06),
+            FB(0x15605f7368216608, 0x86b338843f758647),
+            FB(0x1fa549afbbaa88a9, 0xf3da84443500d417),
+            FB(0x2ecbef3a32a03122, 0x2e9f1aa8fa651cee),
+            FB(0x4dddc8599a91993d, 0x2fb2c63e7ced6147),
+            FB(0xf3ecc142716f6c99, 0xadb4604494730bc8),
+            FB(0xce9e6092486ca34c, 0x0d8743290c914ddb),
+            FB(0xf78f00ec3bbf1d27, 0xf8958c342610a95f),
+            FB(0x7b6f493e5a83bd5e, 0x6bb4245ffad63801),
+            FB(0xd1007d61305e95b8, 0x5df1ac2254ce3e81),
+            FB(0x875d70a512288897, 0x81a17017112c21fc),
+            FB(0xf1f6b7d54e6321bd, 0xb70cd34dfaca0a17),
+            FB(0x7ed59bab38da14f1, 0x61189fe1e3f84a9e),
+            FB(0x6e6bde3b758aeda6, 0x653274d401a1430e),
+            FB(0xc16f4d91e98a2f90, 0x54eb583e874d7951),
+            FB(0x1ff38be81e9a9e9f, 0x075c03fbeefe7cab),
+            FB(0x60e52253e31eecc6, 0x301678dd28466523),
+            FB(0x7ebf23767c2c193f, 0xc060de84854e588b),
+            FB(0x98ca48924156d7b1, 0x178e1c2e494935bb),
+            FB(0xa9452a39ec2f2c53, 0x2f47f372f4d04b23),
+            FB(0xd01bcbcf2bfd191a, 0x0c02a4e86e4139be),
+            FB(0x2e62f2ccfc54290e, 0x5a94e1fbd63928f1),
+            FB(0x11f416c36c409ad2, 0xfc55dd0d7a768964),
+            FB(0x1988b65e34619087, 0xed0dd61a9ed178bb),
+            FB(0x6f7f9f6eef07d047, 0x35ee54c2cddfcef0),
+            FB(0x71dec4f865096aff, 0x490ab1702cd80674),
+            FB(0x3b2dceb1d6ce0131, 0xee782ec6283ca756),
+            FB(0x94fa372d0ac6be32, 0xa02fc490ab33f03d),
+            FB(0x268e43c9e3b6f7dd, 0x0c4ff0888b13b1c1),
+            FB(0x297237ed71346a77, 0x35e7897b41df6cb4),
+            FB(0xc14cdf6ebbf5aac9, 0x2bd73ec4d234a732),
+            FB(0xf07fe5dbcd3347cf, 0x4c66c1b06fe42be0),
+            FB(0xc52b818f50f2945a, 0x53b27dcaeff557d8),
+            FB(0xdb90f301627c8e71, 0xbe92b6a6773438df),
+            FB(0x6b7af6b07cd9244c, 0x341fca2ed6256693),
+            FB(0x4279e2a6e3335bdf, 0xd91cdb058f28ae99),
+            FB(0x5efe7fcf7038a812, 0x085a3100e1325f67),
+            FB(0x1515ea68222c187f, 0x988a873be89bd494),
+            FB(0x20dcfb244fbb6a7b, 0x9887d0bc254612c0),
+            FB(0xde7d70e8149f1b19, 0x1c78b2ce4cb3f189),
+            FB(0xe4efc6cae09cf05e, 0x0305589889e7f1d5),
+            FB(0xfcf4dfbb5ef48b0a, 0x6e49db4a651d5207),
+            FB(0x805e571f76df6fa9, 0x96f15dcf1f18ce71),
+            FB(0x747d9608244954c0, 0x2df5cebf28f05114),
+            FB(0xe5613e78b47e3cc4, 0x256fd825c3c42e3b),
+            FB(0x6fd7be037bf02f6f, 0xb8024ec088d24e8b),
+            FB(0x0be55f5acb4733c6, 0x56984ef1b6865a7c),
+            FB(0x71f0032f6ca56c10, 0x12439eaba17e76f9),
+            FB(0x181f582fa354b817, 0x1be9b963bec80458),
+            FB(0xe93bee16388fe386, 0x791fd6cc82a86b13),
+            FB(0xd59afe4b3dfe7367, 0xec37bba32b28aea0),
+            FB(0xe249d278b83018e5, 0xc810a4c0087a2617),
+            FB(0x10f6d7b435f6ae0f, 0xc02c16fe00e4e3a6),
+            FB(0xfd43728a640da11c, 0x402ad7b14b54ec49),
+            FB(0x1efdcfe6c8f25711, 0x0ae1f9b4a2693614),
+            FB(0x1324119f74d2324d, 0x413a6832dc36fd0f),
+            FB(0x6b4825527b32c3fd, 0x63b9bf305350732b),
+            FB(0xc5adce4cbafe64eb, 0x49bc27983165fab2),
+            FB(0x4e6dbf9eb2a7da20, 0x0fba24469287df24),
+            FB(0xb4e4d16f4d825951, 0x82b5bfb4f5d5ea9c),
+            FB(0xf973e12af7f4e2b5, 0x26dfd379fd966919),
+            FB(0x80562e8e92921f87, 0xdb284e910b1151d0),
+            FB(0x1cdfce271e80c3fc, 0x9217d7f3e9c29a09),
+            FB(0x807adca3b2b523d1, 0x4f444833c15eeadf),
+            FB(0x1ddce8feb12280ac, 0xf306f81e47ef6e40),
+            FB(0xc65c214243e1aed1, 0x740e03ae101b274e),
+            FB(0x261b621eda5aab86, 0x2a3102cafc699ae1),
+            FB(0x4d4a4ca3405d3068, 0x7c2338b653acd109),
+            FB(0xbd787fb0f54fd838, 0x35d6c4122f991124),
+            FB(0x07c455e18d323688, 0x53b316c04fcaa340),
+            FB(0xbe105287bf15a577, 0x04e4e18c590e9b0a),
+            FB(0x9a02e217f5e7b71b, 0x551a2d6f6dce33fa),
+            FB(0xa0f13bc6a5381a77, 0x5bb47934b81d68e7),
+            FB(0x96795d7f4c836201, 0xd4c5176d632372b7),
+            FB(0x01c20552dc320ead, 0xff50e61f6e90b698),
+            FB(0x87645e3286e6f44e, 0x90ea19228198e881),
+            FB(0x25aea13d9c52a012, 0x8827c41764dffc0b),
+            FB(0xb4256c709af20b4a, 0x1da97e501dd3d7fa),
+            FB(0x791aacdb20b3902b, 0x35372ef012799c3a),
+            FB(0x0dde457c874b4735, 0x291545def5254b24),
+            FB(0x4ff31317e69e4d69, 0x9c9cbfe64b443828),
+            FB(0xf76b8cd87102264d, 0xbcd55381ad5551ec),
+            FB(0x88c6e6968b60aa0b, 0x3a0ab1ef70dcfbc7),
+            FB(0x3949fc2369a2b386, 0xeeaebe935ed23160),
+            FB(0x2b4a9ba5db08ed81, 0x751b19b77901e1e6),
+            FB(0x5621d0e4027d7d9d, 0xf3962f35f5195ccb),
+            FB(0x1dcfcaac199761c2, 0xd21e38522379fa3c),
+        },
+    },
+    // g_c_hi
+    {
+        // window 0: g_c_hi^(j * 2^0)
+        {
+            FB(0x0000000000000000, 0x0000000000000001),
+            FB(0x70ef68a1edc69035, 0x24cd0dd46ecfa9bf),
+            FB(0xef3bd7704db28dbc, 0x914aea180343d394),
+            FB(0x781a9594a9f51d09, 0x110eff285e49ded9),
+            FB(0xc628a83669a5ea48, 0x59114938b81126f1),
+            FB(0x25fc6bd7eda2b2ff, 0x1ea4ec1a63934009),
+            FB(0xcbc1a4a91a834b13, 0xec3833b6ff637530),
+            FB(0x22e461162359d5b3, 0xd36dc8c6449bcee7),
+            FB(0xab2f3ce2ed839426, 0x0824d5dd8bc0109e),
+            FB(0x0effa0feb5fccf2d, 0x8e9209a132df1c5f),
+            FB(0x158846aa1b223c84, 0x91119f3a49370164),
+            FB(0x644397a0866b0b9b, 0xee25367cbe96296a),
+            FB(0xc722b5e4d156b853, 0xf1a8d696464a94c4),
+            FB(0xf6dd12eadea68351, 0xe2a4615159ca6333),
+            FB(0x4f32b02b3cc7dd7a, 0x0e83972b6f800c80),
+            FB(0x7c5cd7fae3c13e1d, 0xd93cebeeb0263851),
+            FB(0xff193339e38aff66, 0xc55392ba4e724651),
+            FB(0x2d92b410e66c3cdd, 0xe67f6df04be5d74e),
+            FB(0x6bd3410cdc6a448e, 0x56d853cc9a792462),
+            FB(0x44e7f7f5149a64df, 0xbc17ed73cb5797e2),
+            FB(0xced7e0c93b1afa98, 0xb4181b0bb290dc60),
+            FB(0x615e8c296447a816, 0xc68b968c12a1cd5a),
+            FB(0x302c76ab48dcc971, 0x8f320e4f273b7529),
+            FB(0xa9874dbd2edd5009, 0x26f125144d8cd959),
+            FB(0xefe85a7f02c8e54d, 0x279bed0b3bd8b1d4),
+            FB(0x7f0b5ba8e98f0dd6, 0x95017a7bca410b76),
+            FB(0x75415a2791369ef4, 0x0dce8609d696e7d3),
+            FB(0xf75e1b5600e2243d, 0xae7eff1e09d2403f),
+            FB(0x5b7dd93a1a173b1c, 0xa6ccfac21e6d8ce4),
+            FB(0x4b3f9cd2ab33db98, 0x65f3f098ac3a7f67),
+            FB(0x93f9dbc969855ca3, 0xebb2b491b5ecba00),
+            FB(0xa3e5edca7667b9eb, 0x8c8409b77793d6f0),
+            FB(0x503ab740d89dff28, 0xbeeef6f31035623c),
+            FB(0x879c71850b2c7a77, 0xad3a2b9662b2b323),
+            FB(0x6102506a4721d22b, 0xb62311a3e38c0f6d),
+            FB(0x3b130f612cf73fca, 0x5a3a0440132a6612),
+            FB(0x5e6664d3618279c9, 0x5ffe5a957c41fa9e),
+            FB(0xf4ab0025fce5ab54, 0xadc667aead70c0e5),
+            FB(0x3d0ba7d5759136f2, 0xdf1475c3254c4c17),
+            FB(0x7f427d57589e7210, 0x3aa73c2c769481d2),
+            FB(0xde953c80ad6c9100, 0xfd5fe5f759ad669f),
+            FB(0x4594d5f895729fbe, 0x9f28d3df6ad8fa22),
+            FB(0x3c9b9cc8a8a67d1d, 0x657c3ec9ad91991e),
+            FB(0x57e69e0680092e12, 0x9bc978718b5d7bfa),
+            FB(0xdb5730bee11bef06, 0x55fc1bdc845ceec8),
+            FB(0x03d8cbb257591359, 0x204c92016897bdc5),
+            FB(0xf9729fe25d057325, 0x27d45e6fa641216f),
+            FB(0x7aa496b751b7ba7b, 0xb98bcaece4bc34e0),
+            FB(0x8315cc8d8087c06e, 0x0770c0abe1fe1d76),
+            FB(0xa16f2a7c0e092145, 0xdb9a0b760e6a4dc0),
+            FB(0x813a2352c13ce8ae, 0xdd22fb2a295b2d4e),
+            FB(0x98aa8056add1a061, 0x3a5f8f3e0a04337d),
+            FB(0xe3ae20db94ca168b, 0x1691d05938927743),
+            FB(0x00c0918b8e75ed3c, 0x5faf6bee4c20b155),
+            FB(0x65b7c9f8f106fc38, 0x006aff1a0472a233),
+            FB(0xef35ac2cb8797c53, 0xd8c14a4e5c00a8ce),
+            FB(0x9045924e4301e8d8, 0xa58899b8f80bfe98),
+            FB(0xed249deaf1cfd1d9, 0x5cc11e85287cf8fe),
+            FB(0x4748e50f3b99747f, 0xbb099cf6012f76ed),
+            FB(0x30c08bdbe9de8acc, 0xebe0fa70c8db8cf3),
+            FB(0x11f54f6a5162d04c, 0x08779caf9bd7cefc),
+            FB(0x7c5217820f82e281, 0x8d4bd40342754517),
+            FB(0x9ee0e4cc855fd6c3, 0xf47327cd2b78cb32),
+            FB(0x6c440dd1bc38af0a, 0x732558cc3c756342),
+            FB(0xb256ecab04f7252c, 0x17e16b0d142d3ca8),
+            FB(0xecab504169f8ca82, 0x298e5e60ecf3c68a),
+            FB(0x8e9b6bfeefe389e3, 0x375d70be8dd3f589),
+            FB(0x0c343fab4ff5c851, 0xe511f3a2a1ed95e3),
+            FB(0x29930611f60b0bd1, 0x2eec5cfe354b2e3c),
+            FB(0x9262f930344ec75c, 0xeb6f849c53ead82a),
+            FB(0xa91f80df2b317c85, 0x349e25ada41693d6),
+            FB(0xe14e3e56ce16da10, 0xe3ad5d2e3ead75a6),
+            FB(0xcdf33332751d7480, 0x79f6d2179f2ad42b),
+            FB(0xe782eaa5cf67950e, 0x45b26d7bb654630d),
+            FB(0x6702af4f14175088, 0x46cab1d4af53be30),
+            FB(0xd84f335f99b3b203, 0xf52172935c749d29),
+            FB(0xe3622268c3d36ff8, 0xe7c757d581172907),
+            FB(0x9c72c842dbbe6074, 0xd7ce92bdf6dc2885),
+            FB(0xc5673603c76ff9b3, 0xc3f52db6a91dd332),
+            FB(0xf7e87353c872b59f, 0xfa11bcacf1d6e72e),
+            FB(0x49dc5ea0e6809536, 0xe47c01c05393550a),
+            FB(0x44c0226ca61c97c8, 0xdff019c360a128c1),
+            FB(0x39834b196ed95bb4, 0x5bb9b87d394c7090),
+            FB(0x85cefa46e16f458d, 0x7347d45582ea4a2f),
+            FB(0xa680712a6bcdc1a2, 0xb9b297678376ae6d),
+            FB(0x185e809984a39cb2, 0xb7ece48df8c6d42a),
+            FB(0xbc85f60c79ec1f4c, 0x8045301422e9d460),
+            FB(0x29077fd43e6fe516, 0x158ac9cbf99cc592),
+            FB(0x0542a8b99a6621d7, 0xec97b520d37f4e73),
+            FB(0x36e7aae29dbc3d1f, 0xaf0880f972b3eaab),
+            FB(0x06b206b9d27c5915, 0xe9a39752c0c28656),
+            FB(0x2ee1843c27b88f4d, 0x8bd14d7a01625b23),
+            FB(0x0e58b82d7d54ba41, 0x9a2318fced9815f3),
+            FB(0x9c940b181e94519d, 0x3df6b8f5e6119eaa),
+            FB(0x8dbe94141d0b05b3, 0xa3b414987dc6996d),
+            FB(0xbd53e84bc5d20141, 0x107fdc5c5ea9acf4),
+            FB(0xc28e9adec991ad53, 0x94209f96b15b42df),
+            FB(0x70ed9d6548069f8f, 0xaea9b31d960a59ed),
+            FB(0x8dc8066d3f93d7a4, 0x2bf835010cde399e),
+            FB(0x11d37b4efa6d45af, 0xb78b90f2e6c434ee),
+            FB(0x91d4bcda4bd6f171, 0xb4c4a3de89b2f79f),
+            FB(0x1858b1865b8d7441, 0x8a05ae13335a39df),
+            FB(0x63a7eea8805df81b, 0xf55a37b4d90f69b1),
+            FB(0xcad5369dfdaa628b, 0x27a6eac773fea7e6),
+            FB(0xafacb6af4d29053b, 0x4a19d2d89858e60f),
+            FB(0xd0e0ca35eba9ef7b, 0xf2bdc5c38d06b429),
+            FB(0x117cf47453e3b72e, 0xfbf6e7dcc034a3a1),
+            FB(0x8492ec3346e885ea, 0x4cf7c7fa0a28b822),
+            FB(0x64d44586c4390baf, 0x2b971f4346b6baf3),
+            FB(0x8416ba592aee7277, 0x551bdb252fcdef28),
+            FB(0xd669c3d5e5f625c7, 0x6b9aca4d86f8b09e),
+            FB(0x888a4a83f30a6272, 0x875fd3b481527294),
+            FB(0x0319389604551ee4, 0x27db00e9d8bd47e7),
+            FB(0xc9496fa95f2e134a, 0xb2f3bfdfb6f85307),
+            FB(0x946544506f48cfe6, 0x2fee8e5262ee5642),
+            FB(0x47c7a87ac7f9463a, 0x4e0042c24233f9e9),
+            FB(0x3fa651aae5a77e3d, 0xb87b6218f66e9042),
+            FB(0x69eb9af4d9c620a2, 0x1263b8c2d233d105),
+            FB(0xcf6ce421b6360170, 0xdd2e4dc8a3a5cdbb),
+            FB(0xa07e09436c91b5b1, 0x8893928d7ee45678),
+            FB(0x87ec36ea1a710b81, 0xb6c83f20675c0ce0),
+            FB(0x0469fc31cfc434e1, 0xd68396226549cd95),
+            FB(0x82e9e559dcdac219, 0x3b0ed726be2cc4a4),
+            FB(0xdc42d4834455d943, 0x32802d64690818e1),
+            FB(0x3997b92ea04cc9c0, 0xccbac9426d00a7f8),
+            FB(0xdb17ee7d1dbdbf21, 0xf9dacda6fa5c91e1),
+            FB(0x50bd7c61385e67f4, 0x77e2aff2e32e36ee),
+            FB(0x5af951d0bc3a4d83, 0x142c8a923f8b0e29),
+            FB(0x5801a94691d6ff0a, 0x094b25b811a56099),
+            FB(0xe1463e361e5019b9, 0xf4155530d17b7a4c),
+            FB(0x81d2bf07e65c648d, 0x193c5fecc3e99709),
+            FB(0xf3374ed03d063abc, 0x1a0717cb55eb8425),
+            FB(0xee9875005a7045d3, 0xc751ffbfb47dfebd),
+            FB(0x314bf4ffce490b4f, 0xefa381ec55d1645c),
+            FB(0x7da39273e50dbb57, 0x1f01778fd0d9a382),
+            FB(0x24a8ece8c81384d4, 0xdc391b0756ad6fcc),
+            FB(0x393211cb1b3cd2f8, 0x247d331e272633d9),
+            FB(0xe78ca2bb09d0c4c0, 0x61b6de91ffb43acc),
+            FB(0x11537a624a55da52, 0x827d0fc1eba3ca93),
+            FB(0x3cf8cef5965cd0b5, 0xc3de545c9668cc35),
+            FB(0xf857ed5ec4385878, 0x7b499a998394888a),
+            FB(0x2d5d6eb9195a6354, 0x12888793ec9c07f1),
+            FB(0xf88a1fffa1f5f911, 0x9ef8c91401cdd645),
+            FB(0x67d92150ad292964, 0x9d6efe981e7031be),
+            FB(0x8c5d7c8dc89d9803, 0xa2a2aa79b241d01a),
+            FB(0xaf782245febef1b2, 0x5e4e49abf28d0bdd),
+            FB(0xb6db87339baec19b, 0xde3577da5bf23eac),
+            FB(0xa978d2d7b24e3d16, 0x84f998ebb8dc2ffc),
+            FB(0x76ff527bb2220a3b, 0xcb259ce6b275e1f6),
+            FB(0x3d139bd9a9a8bbc3, 0x0c67ee66d32e82c4),
+            FB(0x43d95f288c979d0f, 0x77344ca8184d1285),
+            FB(0x28958ef2ec2ced82, 0xe89a782c1db1cf2d),
+            FB(0xfa843e0b0f031cf8, 0xf2b3348443411f84),
+            FB(0xb08ccaaa315e566f, 0xbecfc188d9713756),
+            FB(0x3fafb961d0cc3764, 0x416c21f6684ab306),
+            FB(0x7d2e873ae018f3c2, 0x9b02814ba53227cb),
+            FB(0xe8f833f8953d47a6, 0xfea046515b6148c0),
+            FB(0x461de4849814181d, 0x465a089ce075c2e2),
+            FB(0x74848ccbacc3b1e2, 0xc4cbb82b07c37d2e),
+            FB(0x50b9f9936f247633, 0x751029ad0a72399e),
+            FB(0x057e0be8dc8e8c2b, 0xb74881245ee49510),
+            FB(0x1c9fd1a414069be6, 0xcd1f78ba48585ce5),
+            FB(0x290ce5021f571596, 0xc26cea904982c5f9),
+            FB(0xe57451813d8d0fd9, 0x0d6baa85c4dc86e2),
+            FB(0xab2387d2161bb31c, 0x42c4061fc178137e),
+            FB(0xfe280fe79b2893f2, 0x72c08db69ebf9ae3),
+            FB(0xdddb8b9259c46b56, 0xec8913676892fd05),
+            FB(0x41fb8fffe60f6a7d, 0x9818860df36dc7ec),
+            FB(0x930c850eaa902bc3, 0x0f778c0af4f0db24),
+            FB(0xcf92dcae5273316f, 0x1a0dde79eff42538),
+            FB(0xe3dd88dd94312637, 0x9d138eae3f835d58),
+            FB(0x6eb17277a4aad477, 0xc53e7ce6320f2110),
+            FB(0x3291d8cd246c28aa, 0xce68d1f1fd335cd9),
+            FB(0x64393705d379e19b, 0x653360a3d3c5f7b4),
+            FB(0x3c564aa590436f37, 0xe5e70650f4e6cd66),
+            FB(0x00d2aace40d7c14f, 0xd21d8179fc833052),
+            FB(0x5caf332ab8f27e66, 0x35d3733b0cfa28ee),
+            FB(0x77de816c246e4bda, 0x032a1a09bce43ff8),
+            FB(0xd512a688bff7fb7c, 0x7b1037b7e673e960),
+            FB(0xa2db175540ecd512, 0x1260a1a68ff8b5ba),
+            FB(0x5e0e1d194b5a6b6a, 0x651692bc96539ee3),
+            FB(0xc44460836a8f559e, 0xdaa81ac5554e463c),
+            FB(0x77c2fda7d823a7f6, 0x16c96ee5fa665c3c),
+            FB(0x6384cecfac213726, 0xbf8d0f2827d6e8bf),
+            FB(0x6ae0d2e67b82606d, 0x966ebe1379c52582),
+            FB(0xb6e9e00e2b3ce38d, 0xfdaa510345847f05),
+            FB(0x6bc01a64661bf3d1, 0xf8994e79b6f23a14),
+            FB(0xc18d15bf4c4fa952, 0x060e0145e4ead470),
+            FB(0xad11359d4e60ce30, 0xbb66734f49955dad),
+            FB(0x6b68bcaf5b6d40e3, 0xfd2bb2caf120c660),
+            FB(0x733fe0e5dc984222, 0xa98a715d44df34fe),
+            FB(0x9b756ea4f0dbc0b3, 0x6c222336034656f1),
+            FB(0xf32def8d25a05d91, 0xd46756e1e53bb091),
+            FB(0xe58ea2a5c7a58e27, 0x2f2a6fde9b5b7047),
+            FB(0xaf7fc1572b3865ae, 0x10d40a097d4bba4c),
+            FB(0xa5c30d88e7e7a356, 0x65477c86b3a5f0f2),
+            FB(0xed5bc4800f774534, 0xb05a14e638898543),
+            FB(0x7a46d3a520194ecb, 0xaf21d789faac7a00),
+            FB(0xc2bb75d489530e83, 0x5cc2152f7dc4a37f),
+            FB(0x63996c6cf8aa2aae, 0x8a6649cc17f9be03),
+            FB(0x02be6f43369c4580, 0x133378437e98bab5),
+            FB(0x5780e2330716f80f, 0x80db0893ac400355),
+            FB(0xe68cd6f21ff2cb61, 0xd17ff879e63921d2),
+            FB(0x32cb54b59b9a124e, 0x1079501a08541c65),
+            FB(0x3ba9c784829ab8f1, 0x9149de491e81e46c),
+            FB(0xed539d2697298b88, 0xcfcabe89ab06d740),
+            FB(0x97e07be1c5093e09, 0x1711aa822a28a310),
+            FB(0xb37ffd6fe2a903f6, 0xe393e353ef23059e),
+            FB(0xe74cf4d2004ba663, 0x18752c075ce1a967),
+            FB(0xe1c1623d7c7c0114, 0xaa3eb0942c5a69df),
+            FB(0x622fe978c3cfc3d9, 0xcf29fd78c231d845),
+            FB(0x98fee9efd424c439, 0x697ebbe6852186b9),
+            FB(0xd2c8978f776fb228, 0xa5b0aba815ec73ad),
+            FB(0xe80611ff728d4d7b, 0x8962ff9f7eba04b8),
+            FB(0xd8011022d5a7ccd7, 0x7a0389a18d9c9bbf),
+            FB(0xe45e978462b8687d, 0x89fa6b2d55f83f12),
+            FB(0x601c7e6d7983da40, 0xa866ff53663ca718),
+            FB(0xba53c9e54f90840f, 0x539ae67dab25e9db),
+            FB(0xd9618c0a2991d254, 0x3ba2d7f7bd43f5cc),
+            FB(0xf4990d8ad78f8224, 0xbf1349936da884c8),
+            FB(0x29230c2ae2f62f8d, 0xe4c8742e51deefe0),
+            FB(0xaf890d336bafe90c, 0x2fd6173232190f13),
+            FB(0xa1f4f28102f887a0, 0x699a32d27b12b86b),
+            FB(0x1f6c68719f3e6242, 0x0020709b1d5e71c3),
+            FB(0x068ef700bae1192d, 0x5938baa6bc92f065),
+            FB(0x5b5aaf5f3385776f, 0xc5be618b271c10fa),
+            FB(0xd44b0448025dac1a, 0x993d62ec94964796),
+            FB(0x0a80d3999c3a5f86, 0xb6ff72d52b1931c9),
+            FB(0x4b2f30ab382ce60e, 0x532705bd8a14a60f),
+            FB(0x7bc1b58e7c5fbb1e, 0x4c868df1b3456fb3),
+            FB(0x6a96bac8edce98f1, 0xaac40f4a2f2fe8a5),
+            FB(0xbaf037dea2fccc89, 0xf50f8beec362727a),
+            FB(0xf548c321e3a0feb7, 0xf1c0c2b581aea33d),
+            FB(0x3cc105b815fe2fd3, 0xa6a4d02db65a85e9),
+            FB(0x4c689b7f21b7735d, 0x476abf6b4d22db3b),
+            FB(0x171479c7cb8a5bc8, 0x4a1d0680729c0906),
+            FB(0xca7041cfb4234ce4, 0x156bd57d50dcba1a),
+            FB(0x4273d26aaaad7df2, 0x5533e4a9935867ff),
+            FB(0x9c4a81a9604b32c0, 0x50c513b442c05fae),
+            FB(0x25ad5dae1083ddaa, 0x61ba7964a9e3d2fe),
+            FB(0x8fd4d5f294128bdc, 0xb0c3fad7232a84e0),
+            FB(0x32effb5d31d2e035, 0xb4a3539daf9d59aa),
+            FB(0x596e0d6943a69faa, 0x8f13a833c30aed96),
+            FB(0x698d75416314ac2a, 0x11d2c0bffec86e2c),
+            FB(0xc7728d38f5ead27a, 0x5bcd10a5e20cf230),
+            FB(0xd3481bbf29c6b864, 0x880fd2e55d2f5ff2),
+            FB(0x1bbc32353b00d683, 0x6c39ff9e170f32c5),
+            FB(0x1812007023e2d17c, 0x69d4d6b0b27d39bc),
+            FB(0xea36088c2a04278b, 0xc8595999d57be44e),
+            FB(0x07eb42dd133e3019, 0xbbf4106d61566258),
+            FB(0x411adc84d7f78623, 0xfb50634431285cd9),
+            FB(0x33e31c156c9878fb, 0x8f39f0dbbe5053f3),
+            FB(0xe236263986ef3981, 0xeecdd8f263d4731c),
+            FB(0xb9acc34632184b3a, 0xb530cf9b2b81f504),
+            FB(0xd5e70e1fb7ea7627, 0x77e7f8915942c2e2),
+            FB(0xcbdb60e5d13513c8, 0x06b085d60c97478f),
+        },
+        // window 1: g_c_hi^(j * 2^8)
+        {
+            FB(0x0000000000000000, 0x0000000000000001),
+            FB(0xd68110e1f95e3f0d, 0x46af7956142b66a5),
+            FB(0x2d5984d2926abdb8, 0x0b5fd8eba43f7979),
+            FB(0xdae1b1544dc63137, 0x0c29ad9b7330c753),
+            FB(0x357ac73399196178, 0x01064aaa67556e8f),
+            FB(0xd20b006f5a494ecf, 0xbd06c5c5b90e8e27),
+            FB(0x14a7a8e51fdebe3d, 0x4c1bbf6ecb9094b1),
+            FB(0xd98632c21103ee81, 0x20e22a5e49e6e04c),
+            FB(0x93fcc8e1aaadddfe, 0x7252b75c78d98b9b),
+            FB(0x9c3750f2e259ad48, 0x075ca7e012cf91af),
+            FB(0x704d234f501b1732, 0x9195511b1bd18b61),
+            FB(0x2dcbe81b7f31bddc, 0x9b08d4d7e9cefdbb),
+            FB(0x9f03d78db8beb0a3, 0xfc475d8f31bef736),
+            FB(0x748d28c7f8a5a92f, 0x693a95c900004194),
+            FB(0x12669e6a9d71a348, 0x97c656a4d38dc488),
+            FB(0xc7088c8e07940ecb, 0x26ff8322c5bf7006),
+            FB(0x50b4139dd4febdf4, 0xeabfa45f5e59518e),
+            FB(0xb34dc398a991200a, 0x6efb59b4949cddb6),
+            FB(0x6ea780b3b33e7d37, 0xaf108631b43e05f2),
+            FB(0x8f9b6168ed1782d1, 0xf614095a426502a7),
+            FB(0xaa0918240f925a66, 0xf645f55acdac882b),
+            FB(0x014835ac5ebfb9bf, 0x6d58c82843ae045f),
+            FB(0x745b9330dcd0f544, 0x9468cbf0274f5afb),
+            FB(0xe891ef8f91d0c823, 0x30bd2a176b906c0b),
+            FB(0x397b12a72c9ba941, 0x7fe235db0e36cbe8),
+            FB(0xb426c05968c2119e, 0xcd2a2e556589222e),
+            FB(0xf710ec717cf8ea81, 0x0ae3d4d4ed44730d),
+            FB(0xcb1ff2eb0286d87b, 0x6ecf29df54ed519e),
+            FB(0xc40336597db20bed, 0x3f38abf58e831180),
+            FB(0xb05b1a1b21715ded, 0xc0a0e755794ddd4b),
+            FB(0xbeff74b4a994efa8, 0x5adb0a253e858710),
+            FB(0xae24454f3a4f03c4, 0xf033eac969925d1a),
+            FB(0xa3671625c1aa7f4b, 0x2e0f11ce631d671c),
+            FB(0x14feb4ec71be822b, 0x91543aba52f02ca1),
+            FB(0x4dc70c5ba3fb23f3, 0xbc7606d54d5177a1),
+            FB(0x06873113993beafb, 0xb001db1bcd722f05),
+            FB(0x03dad7ca80375cb9, 0x1c89b5f2c224c1d9),
+            FB(0xf9b0916f3713efb2, 0x95eae5082e4d3ed6),
+            FB(0xbe1e65416ccc5caf, 0x953399dbc23163f5),
+            FB(0xf47c9d30e068653e, 0x567ddf93b157aa0d),
+            FB(0xaac83156f3d30534, 0x7b5b014494967340),
+            FB(0xfe5490be3cd8ba91, 0xe526a78abca72143),
+            FB(0x14de4082c394f1f8, 0xcc8a345c7a74617e),
+            FB(0x9c82b48a15591352, 0x402934e48dd48707),
+            FB(0xa268c03a15dcce29, 0x1a8c277e32bb2803),
+            FB(0x02c07c2803b7cedf, 0xec48e26658a6f908),
+            FB(0x88e102fd834eea1f, 0x53eb762985920b8f),
+            FB(0x6fb441e8af734f79, 0x76c8ea50688e5810),
+            FB(0xaf189c5f802e87ac, 0x35c5616cad0a25c9),
+            FB(0x98cd7145ccd8d642, 0x6c266026609298a1),
+            FB(0x03231201b45cc75c, 0x59f8f25d83a27991),
+            FB(0xcdc656577c452508, 0x42e11992923f1110),
+            FB(0x21afd32ed4aaba9d, 0x96ca1afb9af8d587),
+            FB(0xa7bfb1e0000a4ad0, 0x4602b08881548383),
+            FB(0x870ffc552d76de0e, 0x132d9e1407cb9d50),
+            FB(0x106c79530414e2cf, 0x5a940e01473b9a5b),
+            FB(0xbd2507d9d521835c, 0x824019192271d168),
+            FB(0x265a3f55ecaf2f27, 0x50ab9f3790efada9),
+            FB(0x0b08905bf0c9b548, 0x09ccfbde8f4d841b),
+            FB(0x3857fae1ca6f1f33, 0x6f283cc050bd9c7b),
+            FB(0x61c35164e3175742, 0xf8320f4ac71deda9),
+            FB(0x51c14738ac49f8a0, 0x7c27a70ab79aac79),
+            FB(0xa2ae117d2cbb0b68, 0xac951a2f13e3a85d),
+            FB(0xba507933c072f1f5, 0xad08c2571128b464),
+            FB(0xdac566be8c6f448a, 0xa4a1fe87d4364362),
+            FB(0x1b121059de77c865, 0x55b5169214ca9940),
+            FB(0xce5a119f561fc0fe, 0xfaa0258dc64e7b5a),
+            FB(0x5477411b2d4abf84, 0xb739f2a77dd02c9a),
+            FB(0x1c4eafff29ac8569, 0xcee119580ba569a2),
+            FB(0x87d254e69b3cd3c1, 0x182aa45ca65a0f3f),
+            FB(0x4f4dcae8cac284ff, 0x3614ad748ba2084a),
+            FB(0x72ce2292dbaaa7c2, 0xeeef67a88fbc8d62),
+            FB(0x03e254b478d3c6f9, 0x900695f38e922b06),
+            FB(0xc62f352e7fb20a62, 0xb70d9215ec025e67),
+            FB(0x4b750f65139c4769, 0x95bf95e1825c1d59),
+            FB(0x17a93102fe00e3d4, 0x8b9cae6c9cc2a77a),
+            FB(0x31bda9a325be21c8, 0x159d9cb9ca96b353),
+            FB(0x3e88c2f1e188d301, 0xefde47c50e9d2f64),
+            FB(0x326ed7c03f60da2e, 0xe90b5cdf20b1a5ac),
+            FB(0xf6a008a51dc1c471, 0x07ca7bfe05af4a86),
+            FB(0xeab080879b8eed57, 0x68a2748f1df09219),
+            FB(0x8a15f00283399ae1, 0xd7de98ab274e25ed),
+            FB(0x54b5fb45033630ea, 0xf7c952f67cfc42d3),
+            FB(0x901fb83a1f2288a1, 0xd434560ecc66b531),
+            FB(0xdf095ce07531d365, 0xa7fe5a4b3fad1f94),
+            FB(0x7d78487a27d24b6f, 0x50b7f2e360712520),
+            FB(0x7e91c67e5641b7cc, 0xcfae8757c586e56e),
+            FB(0xd6b3a5096fe6a50c, 0xb5cfec78e97253fd),
+            FB(0xdf520db9b417ad88, 0x8ada5bdc9fee2c2b),
+            FB(0x066eef57b8bc5c84, 0xea08d8833c450c9b),
+            FB(0x5665a04a96b629d4, 0x13f815d6cec41c6b),
+            FB(0x27128981cb28124e, 0x369830e1773abdb2),
+            FB(0xf0eef8c217230657, 0x82821a838f99fc19),
+            FB(0x4efdf3c4f315ba72, 0x11a0ee124f5aa6a2),
+            FB(0x521c033824e89ce3, 0xe361a9c74a61ce71),
+            FB(0xcc4227ae20976739, 0x91481b47c248fd95),
+            FB(0xf23af6f07ab9c85a, 0x845337c9ced9b498),
+            FB(0x70993f436eed9e4b, 0xe9a72bc0df4372b9),
+            FB(0x72b99d29ff8f7cca, 0x8d9957ed7c24267a),
+            FB(0xcb6aa30fb8f65807, 0x980087ac7d98a4bf),
+            FB(0x13d84bdbd01811f5, 0x137d9a9dafa29fb1),
+            FB(0xbff62c8fa980af7f, 0x615aaaeab0b63274),
+            FB(0x891aee65fc25bce5, 0x83bc7da015f6349f),
+            FB(0x14c8714ab70202ce, 0x6f0b93ba51aa43d7),
+            FB(0x5db0a74634dd62c0, 0x7e17aabf29ec2f2c),
+            FB(0xec5abe6de818cf2a, 0xeeffa2e7413cd8e1),
+            FB(0xc6dc700c1eacec40, 0x400132c413f0666c),
+            FB(0x7e61a6010f192207, 0x0a163d516063cfe1),
+            FB(0xcbee2f5143ecfee5, 0x3528b1005dfd2acb),
+            FB(0x62a1412dd65b9adf, 0xd1b3852a313d682d),
+            FB(0x964e04aaca1bf59a, 0x18658a1eef718a6e),
+            FB(0x4bfa9d839fb0c5dc, 0x0a28ad47b233a698),
+            FB(0x323104f70b83172f, 0x3bf109a79392db99),
+            FB(0xd576d8fc0f07c187, 0xa02f878c26bdd1e1),
+            FB(0x0764909bf176fac9, 0xc493a37c737853a4),
+            FB(0xcde21c5dfab8d7b0, 0xc0130a27f5434bf6),
+            FB(0x231a71b1124d8524, 0x6b7c813513ef5085),
+            FB(0xba528caefbc95e24, 0x51a1468a1ff17f4b),
+            FB(0xae9df9800da7fcae, 0x82d6027aed798dd0),
+            FB(0xa8ae770faa8833a9, 0x1deaa5cb39a59047),
+            FB(0x39eeb797f7d8741f, 0xfe8e8cb2a9b2336b),
+            FB(0xf2413c459b40b516, 0x70cbda4da49b1d0c),
+            FB(0xe2feb49a3efcbaa7, 0xb0ad10284eb3cd79),
+            FB(0xa147c31bb26b6ab5, 0xa23082fb5d7e0dc8),
+            FB(0x9a6fb6bd86c9c660, 0x34962c5e67114df8),
+            FB(0xbb14b2b23efb9067, 0xd480abab4a4a2918),
+            FB(0x3c85f74a9a4188a7, 0xb10bed776ebc268e),
+            FB(0xc8f705e2cc845a1b, 0x552a71ee6689ac23),
+            FB(0x50e5fcfc331b3098, 0xb8aa42376854e387),
+            FB(0xdd41e36577001ddc, 0xdf8eee5f64f956c2),
+            FB(0xb54ac00d861c976a, 0x1db6b186d08b74f7),
+            FB(0xda3566b1f2238d5d, 0x1d69402632a88e0a),
+            FB(0xcee090dc83b72c72, 0xad78bc56a56e05b7),
+            FB(0x51db5d1e1d06a4fb, 0x648d517bee6f6b16),
+            FB(0xba6fe4a22583e04c, 0x206e02ff745a8d0c),
+            FB(0x97cce94fcfabc490, 0xf23a22bafc4375c3),
+            FB(0xfeec0f8ef6411169, 0x3d21b180dcbc0943),
+            FB(0x34a0590095ef2c2b, 0x56843bb425e17841),
+            FB(0xcb823150bb4bb71d, 0x204da3dd35e7a5b5),
+            FB(0xfbf030f2faf3d346, 0x6180be74efbc4b82),
+            FB(0x5e37580ed7a698f9, 0xd3b0f639c81b1457),
+            FB(0x346c7ee3dceb4b9b, 0x53e19fc55336702c),
+            FB(0xbd61cffb0a280175, 0x542dbaaf9693a32e),
+            FB(0xb90eb79b4deb2668, 0x6d9a68168f82afb1),
+            FB(0x43b0ae00be42067f, 0x8abd74b6be020a53),
+            FB(0x1c4d6213c7fa1a7b, 0xedc1714672c19565),
+            FB(0xff7b3778d2f136b7, 0x9458591832826e56),
+            FB(0xd1e2dac1e1727cbd, 0x48f3c48cf7fd5129),
+            FB(0x1240a6a26a3030f6, 0xc5be7fe87bb0583e),
+            FB(0x105a73dcab23e233, 0x81dac2c047752830),
+            FB(0xcd8dbc15dfd31667, 0x41fc502feaa72a34),
+            FB(0xef1185ccc37ba61d, 0x2ae3a63863f6701f),
+            FB(0x9ab53345bc349bd8, 0x449031ba59ab81cb),
+            FB(0x8174c73c3b378d16, 0x1e34145c6abf5b7b),
+            FB(0xe4d8b0bda2227bbd, 0xacf2a0b831ce1599),
+            FB(0xfa6cd9de476d0ad0, 0x1d607574d311f165),
+            FB(0xcd5747c02c92e157, 0xb421292850cf72f2),
+            FB(0x7a5b8c7adca8792f, 0xd1753b6778d62f34),
+            FB(0x215a8c4434a681a3, 0xae0ff4fba83ebec2),
+            FB(0xcf0a38c62c443271, 0xc2090829d1ab671b),
+            FB(0x9bbf1f25d5318a9f, 0x652bbe87c43be9fb),
+            FB(0x09fbe16b475a829f, 0x8ee25fb8455c5028),
+            FB(0xb2c9de886a404678, 0xc68caa3260e6e8b1),
+            FB(0x843c144fd836b568, 0xf3341bf81c128b7b),
+            FB(0xaa46039d19572de3, 0x17c9c43e8b2fdae1),
+            FB(0xd6edd804b3c2f3fa, 0x239211916ff01fd0),
+            FB(0x1610a9186bd6b888, 0xfc790a29a4f2c9e1),
+            FB(0x8efbf4a4bd187eaf, 0x2b85f828b90b05e6),
+            FB(0x583e741bcfdfbc4f, 0xe6a0dfff34c431b8),
+            FB(0x5c5f92698dbd7638, 0x75b3de9460f5984f),
+            FB(0xd33d8fdd04ce9cdb, 0x02c220155740461d),
+            FB(0x5b820f89b733e901, 0x6bc2a3a00a0aa4a5),
+            FB(0x90d803fafa73d1b1, 0xad7530b005d388d2),
+            FB(0x59c7b6a3df7b501e, 0x542b21ec3a779a71),
+            FB(0x785e09ed80a7340d, 0x1341b34bc5f268be),
+            FB(0x928dad5cfa4dfa75, 0xd33b0ffbf7f567b9),
+            FB(0x5c67a45838512b34, 0x1225d99cf146f1da),
+            FB(0xf44c4087a7665726, 0x52067c6276ddc134),
+            FB(0x5e2247c7d663bdcd, 0x7fb362a9dec18935),
+            FB(0x8770bf056eb344a3, 0x1203a2f0325717f3),
+            FB(0xfc633194dd1902e9, 0x1d1b017e3c3e2f0d),
+            FB(0x1ac3deac21a9e67e, 0xca79f4d62479981c),
+            FB(0x13ffc47de46694af, 0x864c3884c0451fa6),
+            FB(0x327672cd4b2b2e3e, 0xb027ace733c8048c),
+            FB(0x6b2fc7830badf219, 0xcdbc5fda5f34e9fb),
+            FB(0x44b8e3ef70f35dc7, 0x40f1cb00b6ff81e5),
+            FB(0x5a86461c7de6b95f, 0x39ce9e903cc2a920),
+            FB(0x6f0fb0992555abf5, 0xa61f2b8bf095024c),
+            FB(0xa119bab146d8ead7, 0x041f99e03ecfbfa2),
+            FB(0x0ec9d881003f4b81, 0x67ed62d8c80cca7b),
+            FB(0xd8b9625e178de7bb, 0x4c255da133b8ef09),
+            FB(0x9bbb0a521cb3fd63, 0xe2a34e8e51e6b5df),
+            FB(0x690ea9f224527b4b, 0x98ab2b2fd4d880cd),
+            FB(0x260b8f2fe8780201, 0x27e1d6e0872d51c9),
+            FB(0xbf602250b4662291, 0x16d2951379a0132c),
+            FB(0x3306e3dbfa5fa71c, 0xddcc66b85d24d577),
+            FB(0xa96e3b277f20693d, 0x155aef31c68d83ae),
+            FB(0xb9bd31afdc0808ac, 0xcf077966efe50a43),
+            FB(0xd2114fff9e8e6f58, 0x6fba602492d05be1),
+            FB(0xe8c9079e59ce9a89, 0x0b07d5b759a0b0c7),
+            FB(0x84b7039912365523, 0x7355e2c4c6f966f6),
+            FB(0xc5f179bface4a4ea, 0x0733b8cc62c6731c),
+            FB(0x6401302a71d5bf4c, 0xb8668537f225c452),
+            FB(0x7a2ec9f8f888e6e4, 0x137dce376b786b47),
+            FB(0xa142e1a792f720dc, 0x03a341c0778bf5c5),
+            FB(0x52874829a9357e08, 0xcc15131553422e56),
+            FB(0x9b0c918faa8a16bb, 0x40ea46581230cab9),
+            FB(0x7d5fe0cc8031203a, 0xa90ad43c61fb9cbe),
+            FB(0xcb405a3692a73f3b, 0x97184a6d6a60b068),
+            FB(0xd46f2be8d0a7a8e1, 0xd27f02f782348fb3),
+            FB(0xd1ec81aa34a21109, 0x9dc1a3b9ca697e8c),
+            FB(0xcc67c3fe06bae055, 0x77fac3623a1948b8),
+            FB(0xaa451ebbee0479a0, 0xad8aa09b91ac700f),
+            FB(0x1e46e77d2f75d5e8, 0x5f1c69072afb6e02),
+            FB(0xc0e26db0d33d1186, 0x3f2bb2404e495bdc),
+            FB(0xa85ca5884a888730, 0xf812a4be20fd717d),
+            FB(0x966183ee7222f78f, 0x63e1d0ca04c3e0ed),
+            FB(0xd735dd77c33c0edb, 0xb823386c0a2f446b),
+            FB(0x3f3e998a3094315a, 0x3865d12b70b51d4c),
+            FB(0x4b903013fd9e714c, 0xdd213cc5d6ee075f),
+            FB(0x4c244fbd4817fea1, 0xc789b171639260ef),
+            FB(0x9eddac9bf536eaad, 0xb96b029ea78288b0),
+            FB(0x53340cbd2a47d2af, 0x290c5e2cfcca5bc8),
+            FB(0xf5d9f1bd6bfc9042, 0xf3463183fdf180db),
+            FB(0x9c5bce86081a65fe, 0x627f839fdcac7764),
+            FB(0x6e278f88a3fce5a0, 0xf524d9dc53fcd2c1),
+            FB(0x7bfde51056fe42e0, 0x2f3f4f93e1a78ab5),
+            FB(0xfc2933bce61b0195, 0xe1b689e3e2f71223),
+            FB(0x5af1255403247120, 0x3e88f40719f0d557),
+            FB(0x272e5449dbe68de4, 0x4b95198d4cbfffcd),
+            FB(0xc91caf19aefcda09, 0x5dee6aec2d8d1a4b),
+            FB(0xb28eedf9f1cda40e, 0x65acf4b4f61b76ee),
+            FB(0x0adeb186aba55e96, 0x84110d43d9f5556f),
+            FB(0x14b9732afd93dac5, 0x93b861b1fccc4217),
+            FB(0x69d5b13cf987b7c3, 0x0927c44ec9fb155c),
+            FB(0xb01792bf794f7868, 0x487c3e5c748252f5),
+            FB(0xb7893f080a62d544, 0x7d45c38142c2b7c5),
+            FB(0xa1fc8d795977d704, 0x1f32b71873b3a52b),
+            FB(0xfcb2a3e2a5fa7b4d, 0xfabca5d3d8b8fc3b),
+            FB(0x093ba7fa94ac6730, 0x9938ed92b9638a22),
+            FB(0xef38c7db119a08c4, 0x658353cee675b960),
+            FB(0x98e62e117ff40363, 0x684601d0006ae1a7),
+            FB(0x3c1420c0e3fc6887, 0x2043316652a6986d),
+            FB(0xc74af8742e078c9c, 0x1ff147dcee3afdd0),
+            FB(0xeb3744de5251609e, 0xa0d3479628aed6fb),
+            FB(0x8b873c0bc57e8959, 0x4d67555a850d223c),
+            FB(0x988b7fc2f29ff13d, 0x48475a054fae12de),
+            FB(0x351dad7abf849215, 0x4fa28339ac7f9f13),
+            FB(0x61c6061c551f6342, 0xde50906faa372927),
+            FB(0x6f6c1f254af12ef1, 0x930de2d986b0d183),
+            FB(0x294bcf531d7a1d5b, 0xa0c3183e434b76c2),
+            FB(0xa4ac6de6b33ab0e8, 0xd62c232390623608),
+            FB(0xf790c89975b246e8, 0x708035f6e5f797b1),
+            FB(0x0a6104c0f212449c, 0x8f08d3993ad1546e),
+            FB(0x80fa25af1dddfa61, 0x8d858839908cb401),
+            FB(0x70c0655cf3a78f0c, 0x434ad316ca41a6b0),
+        },
+        // window 2: g_c_hi^(j * 2^16)
+        {
+            FB(0x0000000000000000, 0x0000000000000001),
+            FB(0xb26be098129f07a7, 0x8ddbb549cf2422ed),
+            FB(0x19471e35e9307681, 0xd568683b0ecc93d3),
+            FB(0x39a11ea1031282e3, 0x4a052c40352b560b),
+            FB(0xf75e6eabb8ee9699, 0x8d11cb5aa0489182),
+            FB(0x5063cd6be65acac6, 0x8b5b36ecc4aed31d),
+            FB(0xaa20dc96a8dfcc87, 0x078a8178d323afd0),
+            FB(0x1e1d156cdcbb226c, 0xf054d8bea9112c23),
+            FB(0x61b2dda717caee3c, 0x3eeb97cd0c4c3312),
+            FB(0x2aa3a27d42dd18b9, 0xddb94ef5e8b6a8c4),
+            FB(0xb74f7ff79c291b20, 0xf67490a1c2f0bf05),
+            FB(0x456026b474088228, 0x829a138fca325323),
+            FB(0xffcb5c6d5e90580f, 0xacec1807ddc48a82),
+            FB(0x754218e32814126b, 0xe5c97c4f9031c8bd),
+            FB(0xf9acbf27debd00cd, 0x5ad279581a4641b5),
+            FB(0x501e9f2bcced7c33, 0xfabbbf1cf69d33a2),
+            FB(0x69f00d705f0186ba, 0x8d9283a782abb682),
+            FB(0x8ab402af3fc3e461, 0xbbe09be9f24c694f),
+            FB(0x6eae9bf9ce42972e, 0x26755b23e2a32b59),
+            FB(0xcb5c43bff6f25874, 0x1613b8dfd455915e),
+            FB(0x04f74e31810065cb, 0x3eb66847e10c0d78),
+            FB(0xb23f301ba8fb17c9, 0xbf013b0963e4430e),
+            FB(0x38f92d46174a132f, 0xb33424e5d31b3dfd),
+            FB(0x8dd8361038838ddf, 0xc46a6a78bbd9a1e3),
+            FB(0x4452c703dffa452a, 0x8ddc171896847e7e),
+            FB(0x7369eedb490eff10, 0x7f55057e9ae24816),
+            FB(0xb7ee225db3bbbecc, 0x7cc08a71d5560f3c),
+            FB(0x78fb4c05db6182b4, 0x3c30bafdd31eac0a),
+            FB(0x1b20a49765680782, 0x1dcb62231028c977),
+            FB(0x8011dbd8ffaa7267, 0xa8bdc7b3c06fa757),
+            FB(0xa244e9c8297c3e22, 0xcc8fc46cc7b7d9a7),
+            FB(0xba0552b218d645dd, 0x458ba3924fcf6212),
+            FB(0x0d3d6a046938af1d, 0x9c2f44e38f5b3dee),
+            FB(0xd7e4233325f9f1a0, 0x2f2787581123ed5c),
+            FB(0xa6ba0770437aa368, 0xe506a2e0b03b6cb5),
+            FB(0xcc7829e0d8154c3e, 0x942bbd082c733cfe),
+            FB(0x439be29c75350e6b, 0xcfa0363849ac23db),
+            FB(0x886625cebe9769f6, 0x8aa49abeb9d7ca82),
+            FB(0x9247dfbd37f82155, 0x7057380597cbe67b),
+            FB(0xece95536e97ac506, 0x49d465da66c5247f),
+            FB(0x0d0f64f74fee8bb3, 0x9486005a648f861b),
+            FB(0x5112c0a9f84256c0, 0x25c5c6cf21e2e6fa),
+            FB(0x1c4bb0289e45a439, 0xe9ee5c4b9dc7807a),
+            FB(0xe58d3936a065a4b1, 0x240e2f469c20607e),
+            FB(0xffee0f55312f2e7d, 0xdce6529980c86374),
+            FB(0xe0397ac1b81b63e7, 0xeda38905a5e9ab78),
+            FB(0xb90e028685289242, 0xffa493fbad1f5849),
+            FB(0x9c205f3f1aab0796, 0x121d358d3fab58c0),
+            FB(0x3829a465bbfe03f2, 0x5d1448c46da12eb0),
+            FB(0x33baeae533aea6c3, 0x3fa9a8357475f1a2),
+            FB(0xfcc45c7d87940107, 0x10037f83106b8322),
+            FB(0x32c8fdf56b95b79a, 0x123954e27e544a3b),
+            FB(0x4490d7ae5e50cb15, 0x08a9696c70d08d89),
+            FB(0x48d5be40072d1b93, 0xc379eb462761acee),
+            FB(0xcfbb0d531cf45d8f, 0x45546df2866f5602),
+            FB(0x34d2c920c886cbae, 0xcd53954a82f42ceb),
+            FB(0xa5084c66c05549e4, 0x65fd49805a8bd709),
+            FB(0xfcef12b68e414621, 0xedba2bb4ecfe6a9c),
+            FB(0x8440c2ff446753ee, 0x5008eb83ad036799),
+            FB(0x83a5e6f0b4beb758, 0xf92364e7f7acca31),
+            FB(0x8e44380edd7e8592, 0x6d5887a7e1ef4b60),
+            FB(0x50ae1f0111b25e9c, 0x610004fec8551089),
+            FB(0x68cd48bab13a1818, 0xb6bc6d316cda0e5a),
+            FB(0xaab08070c74aa77b, 0x6015dc804cf00fed),
+            FB(0x6865b6685fcc5c7f, 0x0d10aba6f27afa63),
+            FB(0x4335a8a2dbbb28cc, 0xe043bbff2583acea),
+            FB(0x3995a0675e8c88d9, 0x15dd0e697ff5d90f),
+            FB(0x8648ec86525f12e3, 0xc58c2336e284a17e),
+            FB(0x825e78c84ee5bf08, 0x3791cdbacac119b8),
+            FB(0xc646a6d86b722ffd, 0xc9bfab5826dd3fbe),
+            FB(0xd8aace87783dac69, 0x12909afa5ce2f1a7),
+            FB(0x1b8d76723bf9d7c8, 0x68299a1e03fe8046),
+            FB(0x22ef2070ab296bfa, 0xf3b4d7a72fa31a26),
+            FB(0x7d6af928103d3363, 0x380d1ea5d428b3c3),
+            FB(0xa18e227e559adedb, 0x35cc1cf41d28710f),
+            FB(0x7fc232dc9a18e0d0, 0xc5fd740fbcb51b7b),
+            FB(0x50146bd719487224, 0xd0d55a87489bfad5),
+            FB(0xb1fbaf6f7c2fd3a6, 0xa98e1fa638170da5),
+            FB(0x95dadc5febe4c003, 0x995998e4bce70a68),
+            FB(0x1c5d83bad071a81e, 0x9475ecb5120cd639),
+            FB(0x68276b35645b30a7, 0x4f10c7d8a36c58de),
+            FB(0x8a016e4d9bffa679, 0x6e56c20af806fd16),
+            FB(0xf396d524e037ad39, 0x0ec92610a951e17c),
+            FB(0xcca6b9489b462e9f, 0xbdf1b28eb17cfc59),
+            FB(0xfaf9072c4a522da4, 0x2df528c19472af03),
+            FB(0xfbe5644496b99e72, 0x261440b6138c978c),
+            FB(0xa0c6e961be10815b, 0x9d5a60d4c0535b82),
+            FB(0xcafdd102433f563e, 0x1804eaccd7458b39),
+            FB(0x5150d3b83a27beb4, 0xdb85676923a3c276),
+            FB(0xadeae4932a33facc, 0x45636f19b3b19300),
+            FB(0xf853fe4888b4b0b5, 0x3ed1f0102af5a6fa),
+            FB(0x7a50678b40ce5fa3, 0x505c1e67124e1b3e),
+            FB(0x2f126fbc43389f08, 0x8ca43cb454547334),
+            FB(0x53562fd9d605de16, 0xb69c5a47b71285cf),
+            FB(0x6fb61d59d938f07a, 0xa1aabb1e1b8a0d0b),
+            FB(0xc4f0e2b6bccc9ffc, 0xaa566c3c5cdc13d2),
+            FB(0xab933c74c43a34c4, 0x6c2144ad06e46d12),
+            FB(0xca9e45627d0dedb7, 0xb21124033ee0b130),
+            FB(0x9ced3cb6cbb7a1e4, 0x8ca8e29e8344f791),
+            FB(0xffa0c2a6a6cc5f32, 0x12c4172debaae17c),
+            FB(0x0399b87dcbef8213, 0xcbca5b3540821bbe),
+            FB(0xe34db329313a688e, 0xe90f6af4f2e89ec2),
+            FB(0x983194aa130c77f9, 0x5a2e5ec4418e6097),
+            FB(0x503aa1ed0df80ff3, 0x9d0434250796afad),
+            FB(0x781103682989e3f4, 0xc9a4a629d30acb8e),
+            FB(0xc54aac54bd61afc6, 0x07e2871f6937b7b1),
+            FB(0x01ec2a9524e16014, 0x0efc2136e02a15f7),
+            FB(0x1b104cc26d267b5e, 0xd078a17b0df49921),
+            FB(0x8b19694b3d6ea09f, 0xee8f372dcf02ff70),
+            FB(0x99627afbe866c065, 0x523bb7594388fb3e),
+            FB(0xc3082430d0540c6d, 0xd1e59f559728a2e7),
+            FB(0xbcae0490947ba381, 0x19dfa33c6d5dfb4f),
+            FB(0xc0e6749949fb2645, 0xa14cbfba0079b558),
+            FB(0xb812467228a04534, 0x674fa43f50018c3b),
+            FB(0x56cac26f817a145d, 0xbff425db6e2a4886),
+            FB(0x1e4c03f07779052d, 0x41b1ca07d8184e16),
+            FB(0xd9787069e6724026, 0x3c2b66e6e1a5d68a),
+            FB(0xeef62ea36bffd7a6, 0x8a96f41ef04dbd58),
+            FB(0x97f9d0d9b2577f36, 0x064634df01a7c3a6),
+            FB(0x1a2ab59bb503ddc0, 0x7941f0c06cf142cd),
+            FB(0xfff56932fad56f90, 0x4a3c94d8d893417b),
+            FB(0x6410c6af8742c89e, 0x8ba2974f37bd9ffb),
+            FB(0xe322f7acac3b55d3, 0xd7e44805dd8d2ac9),
+            FB(0x12ebec76ac0e3659, 0x2224024d9ea21cf2),
+            FB(0x08fddc6f45b27dfe, 0x4fd5e998a694b2b2),
+            FB(0x0165c2570e5dbbdc, 0x507d882f01b35f05),
+            FB(0xebff5a30915aab29, 0xaab306ffd6b48d63),
+            FB(0x67f88820454c53f8, 0xf289ee8eebbaabd0),
+            FB(0x4d9b65d4152309dc, 0x89068cfc8bfed118),
+            FB(0x13da5c40bd0c48b7, 0x148e81c9752baba0),
+            FB(0x269983d1b8a68b60, 0x1069385c79b9c9cc),
+            FB(0x5078a225a4fab948, 0x5b4950e15bcb5ad3),
+            FB(0xbb771e85dc5e72a2, 0xc9d8bc80b0a8171c),
+            FB(0xb67e49a2236d54a0, 0xc390a3e3121812e2),
+            FB(0x9a7511bb8194cf70, 0xa1109c3bc136aba8),
+            FB(0x7def5780306d6aa1, 0x26bbea0b90778b63),
+            FB(0xc7019da79ab8d48c, 0x0bc3f4d5716a74e7),
+            FB(0x70b58a9a7d1fa47d, 0x63c041cef0ce0ff2),
+            FB(0xea253f1a9200078a, 0x4b45b84f3255533c),
+            FB(0x383dce145507e2cb, 0x33ce49955c9c1a69),
+            FB(0x17e7bef5dac99fa5, 0xdb92e610a0bb1d0d),
+            FB(0x97acc73061f0fca3, 0x23812b431595e27c),
+            FB(0xb03aed7ca022e84a, 0xb8755f3a7dc281d4),
+            FB(0x224e87dbd893f581, 0xe9c624393087e0fb),
+            FB(0x4b32c2394d1faf36, 0xfb0c79484e340dc6),
+            FB(0xb6a6251a4854dfa0, 0x0a061619cb7d9e27),
+            FB(0xc77d4fa60b1179d1, 0xd612b675dc943ba8),
+            FB(0x22a8e00a7f4c1be6, 0xcfc9a4acd2d3135f),
+            FB(0xd9b7bbfe1f4695b4, 0xfe8760b509840567),
+            FB(0x1cdf2fd178250dd5, 0xa58623cc89e9e7ff),
+            FB(0x9013e74f8c251ec4, 0x218ce3faad6c2773),
+            FB(0x0d3426e4a01c84f7, 0x4cc1eaf020674908),
+            FB(0xa600de6b5e367dfe, 0xb60f108fbc5a4159),
+            FB(0xe8647cac89112744, 0x6be01c707c990dba),
+            FB(0x1fed482cf6740335, 0xc7f2361735e98314),
+            FB(0xbf13d3de138e0606, 0x84d96b12ba38c43b),
+            FB(0x0e9f05b45ff88810, 0xca20f04cb04406bc),
+            FB(0x73c6ec925a58c294, 0x06a2bc803cf3ba13),
+            FB(0xefa8cb0796e83de4, 0x360eebf4acd4a9ed),
+            FB(0x0096f3b68ecaa56e, 0xe1970a9065eb42e4),
+            FB(0x5d9717e11f4cc2bd, 0x207dc0098a638289),
+            FB(0x4cd27541d53cfd14, 0x2231da2db44eecb6),
+            FB(0xf788119917a05952, 0x3130001c8337db34),
+            FB(0x072b7c742eafe7f5, 0xbe3f3d2cca4f4c8e),
+            FB(0x29ee1d043be1155b, 0xe84380c9a134ba46),
+            FB(0x9ed2849c3f433e05, 0xc6ba84d33333b49d),
+            FB(0xdcc2834e3f4b11b5, 0x21526f3e62dd6935),
+            FB(0x280dc0d102c3c223, 0x83b5096a4907ea1d),
+            FB(0x0ca65f560ea965b9, 0x12c4e01a7141c124),
+            FB(0x10d596a7f56d576c, 0x7ed8edb1c334dee7),
+            FB(0x0c64a5ed74783d45, 0x4c4a3a362db3bc1d),
+            FB(0x85af1269045053e4, 0x0f7f05537697482f),
+            FB(0x9d78ab03994d3db4, 0x20ac9624d1ca8536),
+            FB(0x1085eca8e85d9cf9, 0x76ecc0ccd040d382),
+            FB(0x92b7020e63c35244, 0x238ca032bd2ba1b2),
+            FB(0x4465986113f01c36, 0x09e920b245e8991e),
+            FB(0xa6cab73821ad6e83, 0xbcdb52cd208b425c),
+            FB(0x6207b0688cbc064e, 0xfbdd216bcf76e018),
+            FB(0xe50d9bf2b00444d8, 0x7adbdcb149f088d9),
+            FB(0xcbc01eb451abb0c1, 0x94ae1a67afc63f87),
+            FB(0x0f9ca4b155a450e1, 0xe5a706421f3713e2),
+            FB(0x17edf9c344f7d63c, 0x54d0800d3688be52),
+            FB(0xd9d4e65a679ef746, 0x712d8bf0dd4ddef9),
+            FB(0xc8654e705b0f6bf1, 0xc830743c9c0660a2),
+            FB(0x777bc106425837a8, 0x6389abf1792e25de),
+            FB(0xf32fc28cc1e5e882, 0x89a94f7c7521d25a),
+            FB(0xb087bc3e2646067b, 0x787909da5cbdd901),
+            FB(0x77f517fb3ceba6ee, 0x61f933b4c47b8dec),
+            FB(0x03091528eb7ad73a, 0x1700faaf2b5bcdaf),
+            FB(0x26a91053c08b532a, 0x166d24dcb8329ce3),
+            FB(0xfc1f3a3fba6f541f, 0x63c9c8c16d0547eb),
+            FB(0x97ffd58e6f78062b, 0x56008e716c5d45a6),
+            FB(0xeb2a4198a2aaa708, 0xb866ecce8708a81d),
+            FB(0x3bfcec22b3dcf3c4, 0x10a767da8e7f0297),
+            FB(0xd6f96da57ced6e13, 0xc7637d1cc01540b4),
+            FB(0x33cbae90161ed627, 0x6dea0c515b0a7bdb),
+            FB(0x2ecbc175e6971011, 0xd37d41d889b9f516),
+            FB(0xe81f184a5d797792, 0x5359c8b91f55aa5b),
+            FB(0x010c8c39b32ad21e, 0x8200ddfc8828991d),
+            FB(0x7bd7666bf957d495, 0x171ad720f10431bb),
+            FB(0x52ff36206b8fc70f, 0x8370c70ec359c0cf),
+            FB(0x17d8b504b0ff64c7, 0x61c898e38359c738),
+            FB(0xfad259414ddd6855, 0xce81ec960cb5aef9),
+            FB(0x4b103bcb54c7bccf, 0x87c22a5bec931bbf),
+            FB(0x77869ff25e07afcc, 0x959a69eef5c05b35),
+            FB(0x8c2105349a5818a4, 0x9ff53d2a3ced4606),
+            FB(0xb653b8efd9bc8126, 0x29094bd46f5569f2),
+            FB(0xa398963e6d8c02f2, 0xd8a612a14b2b02cb),
+            FB(0x9a81c39746854983, 0x6c63e128fef56612),
+            FB(0x4f679a68a3e8cfbc, 0xddb8db9a04c821be),
+            FB(0xb8ea07fbb5adfe06, 0x667c69b1b217eb32),
+            FB(0x859ab626742aa54f, 0x2c959a3ec0f21156),
+            FB(0x00f8d0e23bfc4ae1, 0x405ba8c96d11da65),
+            FB(0x7ed6fca3d1d27ea0, 0x973d19354602fe65),
+            FB(0xf55b92481d98a753, 0x456443768912d8ad),
+            FB(0x62345a547ce00f3b, 0x1a315ce821aed2b9),
+            FB(0xb70fe618485a5708, 0xe268478b8974694c),
+            FB(0x24734cd83e7d0aaa, 0xb8a2b9b17df90384),
+            FB(0x77496b538de21931, 0x9dcf2605e54f71c4),
+            FB(0xdc9792a76ccb9145, 0x9952c3ddb19f3047),
+            FB(0xe39a75d355278a38, 0x761dfb306dbe057d),
+            FB(0x3ddc4e86fb970926, 0x6f73449c2a958249),
+            FB(0x73d2a6f94c544271, 0x5b2bd9298bffc1bb),
+            FB(0xe4537ff6cd7562b5, 0xb9b642e00c7a28e6),
+            FB(0xf42ab636a604230b, 0x516c1d1853757de8),
+            FB(0x03168f846f160064, 0x861828f8532056b4),
+            FB(0x6ed595413e76ec4b, 0x2ce3dc0938a5875c),
+            FB(0xddb2e79ca90196cd, 0xe3c95399dbd44109),
+            FB(0xb810c6e5b607164f, 0xd4d9cc989f389a1b),
+            FB(0x8c80e02e23339455, 0x1c7680c4b281d66d),
+            FB(0xbca51cb152f42b1f, 0xb0a1cb0718a13423),
+            FB(0x0c974d51a786a7f3, 0x2a4581c1d2bae2a7),
+            FB(0x131dce8fff1e1978, 0xf267ad0521164277),
+            FB(0x8224b81300b085e2, 0x1033492437b34948),
+            FB(0xc7c3607a629fdfc5, 0x1a7010537899d27d),
+            FB(0x3f8e2ea1abc886aa, 0xa6ea26cc1cf162c3),
+            FB(0x4dd41a7a32394731, 0x5915b9f4902cc51f),
+            FB(0xb859654feca57b9a, 0xb02a715b314c805e),
+            FB(0xb19f2ffe06d63478, 0x47a757b30e1ae051),
+            FB(0xea4e1573d006a5a1, 0xaca3a88eb8d6d715),
+            FB(0x104426ad0c55c877, 0x59b57ef8570b4714),
+            FB(0xe44bab7e9263108f, 0xe858b6fc0876c0a0),
+            FB(0x2435c32dfb5ae75f, 0xcff63764d0b43cdf),
+            FB(0x65a1bb0ce09ffa5b, 0x5354bf3b433fa393),
+            FB(0xff8c4a273188f582, 0xa4e3f802fb9a708b),
+            FB(0xcf3791dcb6180a27, 0xa0ef0fa71f8dccee),
+            FB(0x81338b6085bef11e, 0xb4e46faa90348343),
+            FB(0x8aa192d3809befc8, 0xa2e35aac852413d3),
+            FB(0x31be530f4afb0663, 0x3cc01806871845a8),
+            FB(0xd1d573ae01490d02, 0x84d597ae74e03d48),
+            FB(0x118d718ff254f9be, 0x2ba59b1169271ea1),
+            FB(0xbc4e2300f51822fa, 0xaaf16d37dc9c6d45),
+            FB(0xcb344526d4cace74, 0x169b91efbf083c13),
+            FB(0xf0b24ab10f0ee8f2, 0x57f95af9b7bd173c),
+            FB(0x33c44aa0b5965c5c, 0x2cba1cfcb1f55ef6),
+            FB(0x5d98dde1d2e7cb78, 0xa5a2c89df4de28b7),
+        },
+        // window 3: g_c_hi^(j * 2^24)
+        {
+            FB(0x0000000000000000, 0x0000000000000001),
+            FB(0x19576445248e6a20, 0xcfb04bcf706f1bc8),
+            FB(0xf61ab8e1743d28a0, 0x0151fff34e9b4c40),
+            FB(0xd288a2016a27f557, 0x555f652b945e15b4),
+            FB(0x216db5fe2fbef988, 0xf326f3702db3d951),
+            FB(0x6064e8d5235cffba, 0xef4f194fff30c4da),
+            FB(0x242cf0b6ca0d04c8, 0x0ece079422eeaca4),
+            FB(0xc45212a5561e0696, 0xa1ab3d7cabdd1632),
+            FB(0x4988410006d915ae, 0x335935825b27f1cf),
+            FB(0xb51d041079415447, 0x29e233bdcc6c895c),
+            FB(0x385f740e8ca82fa0, 0x4bc6db9b50182cae),
+            FB(0x50b8939093814250, 0xa2816fafe2a1381a),
+            FB(0x142665cf2b361055, 0x97d87d634c09d4de),
+            FB(0xe21ed78c2a1480cd, 0xd4bc3d3f8824922f),
+            FB(0xfc79b159806ec1af, 0xb929fdfd0b595c37),
+            FB(0x24bafe65efa4d34d, 0x01f2a749f31b76f5),
+            FB(0x5463f08975964004, 0x1b001252dad5a3c1),
+            FB(0xff39dbb0647489cf, 0x2d13a6766c16c96d),
+            FB(0x57b6fa330d75c25b, 0x9a1f64dfbf397ad2),
+            FB(0xc64d03edfe34caae, 0x5ff99917d336c8fc),
+            FB(0xaa8d8c35b2356ac8, 0xf893fc823358995a),
+            FB(0x00e63c32419d4df5, 0xf14e42678eb1b421),
+            FB(0xb3273ae051ef0374, 0x11be848e7754f27c),
+            FB(0x912334eee6fd7895, 0xcc087797492a7d8d),
+            FB(0xce674726718f8f2c, 0x2f09912dd618aea3),
+            FB(0xcd579d3fa8551ac7, 0xd878973df764c8c5),
+            FB(0xff0ce9d5389bece7, 0x7f9c8b41812d8833),
+            FB(0x50a8dc4aa006e54d, 0xd550e4d2dccd10cf),
+            FB(0x47fbce250ede8337, 0xc04f56c4a1f4e76f),
+            FB(0x5e22164be0587e12, 0x8e2236ffed1c3b9f),
+            FB(0x14522df344b3749d, 0xd20dd51c20870d28),
+            FB(0xd619e775624b6977, 0xc310ea77139166d8),
+            FB(0xfe3f6eb02a25f049, 0xb2921c7534055c49),
+            FB(0x6107d6b5cf101d3c, 0x898181cf4dba8c94),
+            FB(0x0478bb6b506c4e1e, 0x702ae245b12f9a2b),
+            FB(0xcd6fb8dbe0a6c6c4, 0x5a40fa6f7bb67ff5),
+            FB(0xbc8c50121ccec8ce, 0x6c68e69fa7508167),
+            FB(0xc57dd6a0582b294f, 0x3c0363d2eff95da0),
+            FB(0xab310c7643f18409, 0x51ab964dc3bfb6a3),
+            FB(0x98222a7418cebadd, 0x2da053aa30bc957c),
+            FB(0xaabda813bce2d3d0, 0x5c1b82bd0eb491ed),
+            FB(0x9628abce108e279b, 0x464ccc5d2c0c62e4),
+            FB(0x552ab63aa2b68d01, 0x30f22b3e1c0c27f6),
+            FB(0xd887f58295d4ad58, 0x63a1344ff68a8669),
+            FB(0x589853bdf8e7ec5c, 0xe2b9963b5795e749),
+            FB(0xb8c2b5ac8ef51452, 0xa42bf392f9f5d6bc),
+            FB(0x17d51ed9864ec692, 0xb6060679dfb01fc1),
+            FB(0xd5226e806b1f4672, 0x5a8d7aefaab9e060),
+            FB(0x9ff366a23be81237, 0xbab2ea4aaf7d65ea),
+            FB(0xadbe38042b6cf331, 0x7814ed2e0069bb0e),
+            FB(0xc87fe88a2f20b559, 0xa8ddebe7f4b5fea5),
+            FB(0x022729ed005f38ee, 0xa79c5fd237ce9a9c),
+            FB(0x157e68cbcd2b2ff4, 0xfae06021c5dbb6bf),
+            FB(0xc3721db17500a0fa, 0xcb4b8842b5fdc0cf),
+            FB(0xa632ece94aa802fb, 0x8d505a16a5ff0d5a),
+            FB(0xd23651cdb03bc2e4, 0xbea8aa2436318121),
+            FB(0x2ac018278aba44e7, 0x6f84499d968c8186),
+            FB(0x6751399d4b9893d8, 0x3909aa53f8405d93),
+            FB(0x9cfa1a1888700625, 0xf859d79ac5e9c071),
+            FB(0x8e179f13674b3c58, 0x6504799b039ccaeb),
+            FB(0xde7cf54f640d28c3, 0x7c531984e3006a77),
+            FB(0x68dd24f9c138643d, 0x10770ccc6dcda535),
+            FB(0x6d69a76cf2a5f6e8, 0x6f1112505959a4f4),
+            FB(0xc7d284cd70e7f69c, 0xf30080ac7d15aea9),
+            FB(0x45aaf12546df4e13, 0x3ace14cd3a585457),
+            FB(0x67a0847337e16200, 0x1b44984e23700631),
+            FB(0x2cc64ac37d4e038b, 0x8b7ac244ee65f696),
+            FB(0x65fc1cd870a24b7e, 0x8690b52f0e84e6fb),
+            FB(0x1d7acea72c555f42, 0xb20b41ed1ae8a8e9),
+            FB(0x0844b486ad57f3b5, 0xb92efb888c57338e),
+            FB(0x887957082fad0025, 0xb9669351af10f93e),
+            FB(0x13e0c58117eee1cb, 0x3446deee2ccc93af),
+            FB(0x66c1fdf8a314c449, 0xea8c8a85d1e89ed0),
+            FB(0xa79a7f4660982bbd, 0x6457df803531bb02),
+            FB(0xbdadc21b294a8d0c, 0x82976a182c1e0b74),
+            FB(0xa83a6ff01d7ec219, 0xff12bab57cd6afa3),
+            FB(0xee58dfc268aef135, 0x22b56ef38d64742b),
+            FB(0x379122b71daaa187, 0x9c941909ffd5ee2c),
+            FB(0x62935a1e2ed3a734, 0xa3e9dedf39e41b00),
+            FB(0xb33485881e325369, 0xcb74d913cdc1d3d7),
+            FB(0xeeaf7351bdc4c0e9, 0x72cfeb2574b37238),
+            FB(0x5cf3540df9874aa4, 0xdacdad5011639860),
+            FB(0x5d7a2db3af228afd, 0x8371ebfe02ce202c),
+            FB(0x0a43d050530bc2a4, 0x3d734a81fdef4bb1),
+            FB(0xfaf56afb552bbdab, 0xdf6f511ded2251ab),
+            FB(0x197b99a17bb0ad08, 0xd1696021f89326e7),
+            FB(0x02e48ec126c6d268, 0x1aca7f17b52bd6de),
+            FB(0x307c6ab83ed09e5b, 0x3d837bf4bbcbe911),
+            FB(0x82e52389b4ac7759, 0x1bfee7d1d1adcac9),
+            FB(0xb1c5a29f7cecc629, 0x8de509b0a13db5a6),
+            FB(0x3ef9b67a06d1b495, 0xbec676e6de6ca125),
+            FB(0x2b3224162a5de96a, 0x66ed57cd9a43041c),
+            FB(0xc8d63fe3ac910327, 0x9b311e85bb18151d),
+            FB(0x7fe98d1ef71fce3e, 0xdc7c127d56888199),
+            FB(0x2eb15e4752c9945f, 0x0b1fe9622e66e943),
+            FB(0x0bc5d1629cdf5e5c, 0x515090ee5b53f3db),
+            FB(0x29446c95320bce5a, 0xfc259891910fd5c8),
+            FB(0x14e06ebcc62d0562, 0x6c5f89e035c8c843),
+            FB(0xe05471beee910c26, 0x3f5151da6cdc8aba),
+            FB(0xdb5b644c604b29dd, 0xf9176547833f8497),
+            FB(0xd58a9151d9a4b7cb, 0x6239593206ab8609),
+            FB(0x9e257222b20b56c0, 0x1a6b40ecdf6b168b),
+            FB(0x460b57b92c39d433, 0x051d8c7dfbafc6fc),
+            FB(0xfec62e0dce0f2741, 0xb6b6adddf6fa6d84),
+            FB(0xdab994a659e99773, 0xc9246e1c72146625),
+            FB(0xe43617cb1f3c9185, 0xf8863cb44c0ccead),
+            FB(0xe2d4f959ee544b89, 0xa6e655728c2b4cd6),
+            FB(0xe8cbc16968b2e617, 0x805736046e4683ac),
+            FB(0x963f883794df8c5b, 0x17eea89502660876),
+            FB(0x1a7f78ac2b6e632d, 0xf610834709cb5adc),
+            FB(0x704ad524b3ea9d04, 0x5e16bd73f236b42e),
+            FB(0x76c2b3267298fd3f, 0x5f9ebf4208d2e7e5),
+            FB(0x2ba0f010b683579b, 0xa2eb3884385ae7f1),
+            FB(0x9913e8d1d8903510, 0xea8269b88c9db7b8),
+            FB(0x63a2f7c4fe227f3a, 0x063a76e154e352f3),
+            FB(0x439c55be3210af12, 0x07ac692ae4178f2d),
+            FB(0x3bdb199df5c9e7a5, 0xb1dbbf415a6e1191),
+            FB(0x64dfe544968fc89c, 0xfd624a65de26ad77),
+            FB(0xffbd8dda796ac4d4, 0x66e61209e2fc92e2),
+            FB(0xb1c3964d1c8a58a9, 0xe7314adb2751a2e3),
+            FB(0x09f6d39e22be1b31, 0x3075293529adb3d1),
+            FB(0x24806fa655a49d25, 0x37084de7c20bb02a),
+            FB(0x4ce90b20140b5a3e, 0xa4d4ea9b2063b210),
+            FB(0xacda9ceddf608823, 0x9588e6f5f21e8f82),
+            FB(0x51684c65d7e5549b, 0x387ec59d6557dde6),
+            FB(0x401a244224016cee, 0xd8c9bfc6e5ac6166),
+            FB(0xefc7353d8859dd6d, 0xfe7aa7d165193eae),
+            FB(0x8c28d88c93aabf2a, 0x0a4e576f35be7a98),
+            FB(0x7d90afa32a9544ae, 0x7f010d634abc90b6),
+            FB(0x6225420a9fb40c8b, 0xa81a1a401fe064d2),
+            FB(0x678dcc31893af9cd, 0x95c5b98d6e080037),
+            FB(0xda7ad73b19dba5bf, 0xcdc7555aee67a2b4),
+            FB(0x75dcaf2003f1a281, 0x966b4fbd57aea341),
+            FB(0x9aeb529a97008ff6, 0xec22b755ef99316d),
+            FB(0x24c843b0eb88129f, 0xeb779e04074590df),
+            FB(0x157e1766c0d6fde2, 0xa3a3c7a9025f8319),
+            FB(0xeb39c8b08b8e82b8, 0x34fcabbf9863265d),
+            FB(0x35dae785084d7846, 0x14d7091fe066d987),
+            FB(0x64897c0706148a0f, 0xb56fecd52cbd13a3),
+            FB(0x5978e3e2f9bb136c, 0x0d0c095ce6441766),
+            FB(0xa48bde5bbcee30c3, 0x735df437554301c4),
+            FB(0x180812aef0ba90ae, 0xbfe3ba55336694a5),
+            FB(0x80a0bc3de98294d3, 0x8990d7d7edabd70e),
+            FB(0x7e5200bb7f799730, 0x99156c1b292062d5),
+            FB(0x3201f0fc42584af2, 0x8f9adb19f92c0571),
+            FB(0xae900a78a9f21607, 0xff457cf1b25955d3),
+            FB(0xc2da75c391763a66, 0x693063c37a3d635a),
+            FB(0xb0e17778c04a2721, 0xa713841b2e644c43),
+            FB(0x3210b40ba658a519, 0x391f52a9e9722dc9),
+            FB(0x31c442e87c5d5ecd, 0x977ae12575a142a5),
+            FB(0xa897b9d202446e11, 0xbb6d9191f649f32b),
+            FB(0xc371c65b12bff8b3, 0x1c6bd8b82612470d),
+            FB(0x83a093f80856e713, 0x0db2e3973e9582e3),
+            FB(0x72de5c27848aae0b, 0x7e0e5ed312b5f774),
+            FB(0xd09a06951f7e51aa, 0xfb41aeee88f2cfb5),
+            FB(0xfa79642d8d805e4e, 0xaaab6d4ff951107e),
+            FB(0x2a3811d28588fdfb, 0x32c461a8d7ac9646),
+            FB(0x631527b22edd9c54, 0xf8e27d1c5d45d1a5),
+            FB(0x09dc86419997e0c5, 0xfcffc915a4940d3b),
+            FB(0xba975125d6142855, 0xaeba79f7b3f81885),
+            FB(0x928ba774bdd6f3b5, 0x670efd5ca52f9d56),
+            FB(0x8b6321ffb9e24ca6, 0xfe826a17148262e6),
+            FB(0x8fdf79c2bb21381c, 0x0b67dee612bfc448),
+            FB(0xb43120d304098d0d, 0x794887150ebfdbaa),
+            FB(0x9e38dddf61510cec, 0xf72d4e69e7f7025f),
+            FB(0xcf7dd1a4736fcfa7, 0xdb9fd474a139c6f0),
+            FB(0x268567b7274cb709, 0xa0ca7727a27a9171),
+            FB(0xa2929f1908acb0e1, 0x15ccc4d905f84139),
+            FB(0x59a237a85ef60902, 0xaba43b7c6315ae4f),
+            FB(0x9ffc5cfcbc6accb1, 0x990109d375d609b3),
+            FB(0xf74cdc3b7264d88c, 0x9d381a26f12375d5),
+            FB(0x9d9f5efc9a632bbd, 0xa2c722cef0f8ba11),
+            FB(0x0373f415fed0b190, 0x5354be0064021c94),
+            FB(0xdea95bf9716cc697, 0xcf4cf40c703caa5a),
+            FB(0x9e5b82bf5aba2fd2, 0xf5c0676438e5d454),
+            FB(0xbedc60def1778192, 0x4364ad1869147a06),
+            FB(0xc372f1a14aafb065, 0x0252b1ebb1a79661),
+            FB(0xc5cb4631807f6071, 0xf3eb335520d48617),
+            FB(0x1bffecc5de7c2921, 0x869a80c8ff7f683a),
+            FB(0xa2ac2ff8912d3513, 0x3fd327cb5bb256b2),
+            FB(0xf5d35a7044729cc8, 0x5b1123f417504ae8),
+            FB(0xc9507af2e92ddc12, 0x14c7c09b00b34088),
+            FB(0x2b4dcd4f0565dd3f, 0x7e90ce198d5d4f82),
+            FB(0x9047cbe084990fb7, 0xaf2b9e3fb6a7a7b3),
+            FB(0xd0ac386fb154eea9, 0xb0d446c7038803e5),
+            FB(0x55c9bee686d88cae, 0xe1f643811d070337),
+            FB(0x91509836e833b9d6, 0x30ffec42dbaff4db),
+            FB(0x956c73d05f1e10e5, 0x74bd1f637bc408c4),
+            FB(0x37ca5ada88e56ee7, 0xf16185721b39cd20),
+            FB(0xc88ab6abf5363fb3, 0x3319da4b6883f589),
+            FB(0x3273a9de768d3a69, 0x7fdc0d2689a18ff5),
+            FB(0x60e32ec40cd64783, 0x1c396270093f90dd),
+            FB(0x681f7c6b04d10ef4, 0xd81d2327cab58592),
+            FB(0xc5163bbcfc1a2917, 0x6814909dca33ae50),
+            FB(0x9b0bbd5f07ce2699, 0xbf7f657758bd7e19),
+            FB(0xe439525d6c76b2b2, 0x0026c1dacffc25be),
+            FB(0xa95dee7bfaa521c3, 0x93dd16d769f64679),
+            FB(0x63f2c73a450fb230, 0x2a39b8bfb30435fb),
+            FB(0x4112d544706949af, 0x2c0d560c7d7e4b7d),
+            FB(0xc4083b95b09848d0, 0xef518a25a6d6bc4f),
+            FB(0x2bd2e6bc56cef2aa, 0x1670901611d68745),
+            FB(0xd0f36a93393098ca, 0x9fae9c3ac00aa124),
+            FB(0x6dea00b8f91e4a6f, 0x08493716fc51e022),
+            FB(0x1a9e732a71b76f27, 0x056f7a7fd24faf01),
+            FB(0x7a7d2202bd986f14, 0x60f7fe3b6f66c8f3),
+            FB(0x0225c3da72216a2f, 0x1090bab9368cb638),
+            FB(0x4591ff7a73fd784f, 0xceb87e6d02b225c6),
+            FB(0xfa670fce90635110, 0xd88baf60ad2a9967),
+            FB(0x44be7e765b07d734, 0xc3688c7659f5f9d5),
+            FB(0x17b069f3e34486db, 0x7e9699396b2d8b7d),
+            FB(0xf132d1788892d64b, 0xbc79b2c117f299f7),
+            FB(0xcd5e64baa69dff1d, 0x2e0558d1824ae1f5),
+            FB(0xea216b4f1b5ec368, 0xc7f4fb3d432aa502),
+            FB(0x07f77c7ebf039097, 0x3e09dffe4e24f549),
+            FB(0xcde98267b5994d5d, 0x59b74923e669dcea),
+            FB(0xed242802106752c3, 0xec6873c4cf425376),
+            FB(0x4c7be45ea582d0db, 0x4f5d081ee9f8d128),
+            FB(0xaa04f17d22208697, 0x1e4bc46c8b61bc97),
+            FB(0xf1c2c1218ae6e5a7, 0x3f1017e37fdd6467),
+            FB(0x95c889af4497a72c, 0x7aa48338e3849bc9),
+            FB(0xfa5c52e17aa40156, 0x0cb48ae92b270912),
+            FB(0x2c44ec46ed665aeb, 0xe8e4eb8681398cda),
+            FB(0xf010f36b1ccc0662, 0xe97d37ef5620e10c),
+            FB(0x72557df14a8a2d4f, 0x2920b6ea4860fcea),
+            FB(0x7b7c886e2e40c733, 0x540dd3d7a9df3054),
+            FB(0xd05d82f1a759b14e, 0xd2f8450b9eba51ff),
+            FB(0x3203c5b499a872ee, 0x56b10653d6e2d227),
+            FB(0xb9e0eb88887827f7, 0x6749bc92bea6aa38),
+            FB(0x6eacdb7334d6ec5a, 0x11be4a13d12de8ef),
+            FB(0xa44f6fdc827cd3ea, 0xa37bf50dbbfa6b31),
+            FB(0x72af2ae8eb9574ea, 0xcd0c8636b77e8575),
+            FB(0xce486a0cb5b21a3c, 0xca08e3d518d0d2d6),
+            FB(0xfd73451ee3337e1d, 0x329a8538a7c994f8),
+            FB(0xde656121c9c652c9, 0x6107623f92bcb152),
+            FB(0x31080804b4bb6c40, 0x1c19ef16d5b07e93),
+            FB(0xe8638416c13980b2, 0x66a7825e270b339a),
+            FB(0x141c2602e81a1497, 0x9e491aa5f95d7e25),
+            FB(0x564e46276de01258, 0xb01f4fcf32a58a94),
+            FB(0x0fbbb7bb5d200872, 0xaa84f2d592e7b82b),
+            FB(0x207692ed5e8fa0ab, 0x4c7b3c2d3d41bb8e),
+            FB(0x246c345431fb69bf, 0x1a7e34fde15cca86),
+            FB(0xc415f13c61bf875c, 0x88969cac02f16fa0),
+            FB(0x1144c04a57598271, 0xafd0d4142b3511bd),
+            FB(0xa30fb6a7200775e3, 0xbe360c73beb98ddd),
+            FB(0x1d8bdc57771d5d45, 0x8b70375691dab594),
+            FB(0x74e41d2833d1606b, 0x22a6a6ff1d7f83f2),
+            FB(0xb48854bd3a8fd00f, 0x49256d75a1974ff6),
+            FB(0x280b4ec3af421c61, 0xdf2ea6ddafd104ef),
+            FB(0xf2cd589c09ab258f, 0x29d1b5eaae003477),
+            FB(0x32d559f1606a03fa, 0xe518e975fe7e0cd9),
+            FB(0x2140f49f512d220a, 0x406144dd519a9780),
+            FB(0x1247706232846de5, 0xf63c0f01a82e90d2),
+            FB(0xd256afadd7e0e317, 0xf5d9d72f1b691432),
+            FB(0xe5c1524de9d65515, 0x9b9ee7cd07a6843d),
+            FB(0xe9f62dbd07f4fdc4, 0x40a9baab656d6efb),
+            FB(0x3156a1bdf1b97367, 0x37d5d697e1e47a44),
+        },
+        // window 4: g_c_hi^(j * 2^32)
+        {
+            FB(0x0000000000000000, 0x0000000000000001),
+            FB(0xd7434722f759ca9c, 0x2fb90aaf3953b78e),
+            FB(0x39b637d27aad5a62, 0x24a2c76bd6e83abb),
+            FB(0xbfd1c172e039aa3d, 0xae0a313747464ba8),
+            FB(0xbe74156ac1d72153, 0x99eba17fd1922a57),
+            FB(0x782912c5b24164cb, 0xfa32178283451fa3),
+            FB(0x345637eab58cec22, 0xbc17aa70ef9be71e),
+            FB(0x03c7468e4406644c, 0x013f9207d0bcf88a),
+            FB(0x31e7b735cbfc5aa0, 0xe1af7ced18cbf5e7),
+            FB(0x3e28bad78c9f63cd, 0xaac779063268d3a2),
+            FB(0x9f8638438420f8d0, 0x1911609c650cd268),
+            FB(0xba113c6311624272, 0x26c8d0c288af89af),
+            FB(0xd628fc7bd5849aff, 0x0783a8ded1a71e46),
+            FB(0xda647ea8074b6c42, 0x985f9a8fbcbc469e),
+            FB(0x02b3bfb63b49ebb1, 0x29704f36313819f4),
+            FB(0x3ca8d2ed1711f4ea, 0xc88ea0d7e1925202),
+            FB(0xcfade29d44b9c78f, 0x923052fd81ee891b),
+            FB(0x82ece73a8a8a2626, 0x439404b628621141),
+            FB(0xf4ea6df66db43dde, 0xec9578613fb7dc3d),
+            FB(0x149ad9bd6ab84acc, 0x471e6447b3adeb06),
+            FB(0x6d4bcb6faec833ea, 0xdc631c7b5bed3327),
+            FB(0x09fc483050051655, 0xe13f29580349bb16),
+            FB(0x7cc8d7c5e3ba3e9f, 0xc7cd2a413257bc20),
+            FB(0x949cbd7db4ed57b7, 0x7359df0c36d109f7),
+            FB(0x3d7b7dee46fa9926, 0x6ed78c4465a30460),
+            FB(0xf04800b1336db654, 0x7866fc48462d4300),
+            FB(0x5596752f81cbbd95, 0x4fb3160155ac2717),
+            FB(0x4df160beb1e76a39, 0x9e3e4cb14b943c92),
+            FB(0x067e4cb8605d547a, 0xbd52542c8e390e97),
+            FB(0x852e064bd2064933, 0xe07e8b5a4c196f8c),
+            FB(0xe2d3bdbd7137d422, 0xd9eac6a8325f8ed6),
+            FB(0xc25ee1cf4a4156df, 0x9a012984d202b35c),
+            FB(0xda0cf01cbf393b6e, 0x38522e3afa8bfe31),
+            FB(0x8642eea79fe5e1c1, 0x3db3bbe73279cc76),
+            FB(0xd232c48ba6f9fde9, 0xe7bdf7da176f160a),
+            FB(0x996519bfdff72899, 0xc32542d3c9e7eb63),
+            FB(0x770bcec7505c3567, 0x40411667e34e0cac),
+            FB(0x23b0514ed3342d81, 0x34d600a5d3c4d558),
+            FB(0x9f4465a102746228, 0x0afa3e9907b099a4),
+            FB(0x80629b9f15276eda, 0x04af13b4ae3d9af0),
+            FB(0x146f47779201524d, 0xe6c0c5939cb58eff),
+            FB(0x5467f41c7fbf4fed, 0x0c27ecc3e0ccc390),
+            FB(0x756d07ed55838a48, 0xf70518b6c821fee3),
+            FB(0x623dc35d952b9bee, 0x6f85f9d1b850eeb3),
+            FB(0x928cc1b83986a8dd, 0xabbc69cbf5dd6d1d),
+            FB(0x5a11a68ea6bf1bea, 0x15291d7027af6384),
+            FB(0x5a547fd22368c244, 0x564fd43efd891499),
+            FB(0xecb80f4c2fc97383, 0x437282b9eda13c5a),
+            FB(0xa6699944824c97b4, 0x6e564cf866550362),
+            FB(0x3fc1cf9f180f6d8f, 0x4e6f9f6641e03200),
+            FB(0x3e4845d455734bc5, 0x898541454161ea21),
+            FB(0x0718afffd00a4d7d, 0x991dab20820ef074),
+            FB(0xef830863e2e1370b, 0xd1bfd72876034ada),
+            FB(0x964779c46814d54d, 0x560a461ac7687217),
+            FB(0x18482ed97c73358e, 0x4be9e7f14a8eff7b),
+            FB(0x9f891dd1dbb2f1ae, 0x9d365a713d10e1af),
+            FB(0x4f37d1a048837e9a, 0x2c5cdb7eff2e89c9),
+            FB(0x0beaab7d769ec088, 0x84d009a3c6ec14b7),
+            FB(0x9cf522f84a214236, 0x254c0b254510c9ac),
+            FB(0x7c9fc49b56ab2305, 0x4072c22f71b15bb6),
+            FB(0xff7461fc2200367d, 0xee8180977f265a59),
+            FB(0x0dc9cf7d2f0364c7, 0xd4a8d695c173aaae),
+            FB(0xf350dc86a8efdb33, 0x02d0708bb8401924),
+            FB(0xaacbe65f6b7737f6, 0x53009567ca5b320c),
+            FB(0x119c389f2f54abd7, 0x256dfa00ed0556f2),
+            FB(0x94d104f3d6ae8b3e, 0xb1d16891c5ea695f),
+            FB(0xcf353732c2ca82df, 0x6904b19dfcfeb5f4),
+            FB(0x8396148d21b5ed26, 0xcd397406aeaea075),
+            FB(0x610bdc64ed44b23c, 0xd7521e390308995c),
+            FB(0x14d3e1be3874cc04, 0x8870ae56085a466c),
+            FB(0x364860e6b6602107, 0x4c4175fc69a46225),
+            FB(0xf98bc0d99c067b85, 0xa31b141aa7bfae6f),
+            FB(0xf1eb33739a91aef6, 0xa30dcee693ad278d),
+            FB(0xe627142555580f9c, 0xdaf4284ff9c61cb2),
+            FB(0x1ba80a1cf78f1f94, 0x649cc3626407d0c9),
+            FB(0xa01a0d2c142f9f4c, 0x4ccc8420d9bcf32e),
+            FB(0x6c672d3e61809dc6, 0x0203a67a2f5f69b7),
+            FB(0x5e145be08be60fba, 0x81418f7640710642),
+            FB(0xc01a2a68657f293b, 0xcba113b006c151bb),
+            FB(0x68373c778bad6283, 0x9038158e2b28aee8),
+            FB(0xdb6e17232af0a0cf, 0x044c459eb5400c62),
+            FB(0x1cd354508634f9cf, 0x54513681d0026010),
+            FB(0xff2a62d57720febf, 0x940820730b05c00f),
+            FB(0x5253a168f4c3e05c, 0xf18376d1ff136539),
+            FB(0xb6e845260b80c02b, 0xaf96c6bbb68000f3),
+            FB(0x11d56516f1853bdc, 0xd028f8ffa1d9bb62),
+            FB(0x7a4bf20fe7d28f17, 0x0ab52e7a3024c79f),
+            FB(0x9ab589bbfa203d4f, 0x37bbf5032308c03e),
+            FB(0x0178acc9a4e52a87, 0xef779b1ee9b80f01),
+            FB(0x27d2cba169d68923, 0x80d68418acacc6b0),
+            FB(0xd5cd83e5d71cfe8f, 0xd25a347eb075cbf4),
+            FB(0x9d8412e6c0180b0b, 0x200e22949b0af2cb),
+            FB(0xc5c0ef2f9112304a, 0x4bc00da8b3043d09),
+            FB(0xc5b81d3cd5bf11a2, 0xa884178ef06c4a53),
+            FB(0x95966fc46b271cf3, 0x6353d54ceceac68e),
+            FB(0x89dae8a773d23d73, 0x4842ccf4010de767),
+            FB(0xc2325c72761f2d11, 0xd60048804dcd561d),
+            FB(0x9bb8af561e8fd940, 0x5fa4a6a1cae48633),
+            FB(0xa056a4fbda5f783f, 0xb6c17f214012ea25),
+            FB(0x50a1f73a7df82982, 0xa5fc05d42edb8c73),
+            FB(0xf0e511d968df2f69, 0xeffcfd920736bdf8),
+            FB(0x0d495cb0b317510c, 0x8b758518503051c5),
+            FB(0x4baaa7b2b3450402, 0x770423800c3dd727),
+            FB(0xf79d4828009c5f9a, 0xa3bb86d3a6bfd640),
+            FB(0xd60b87ce70df6af0, 0xbb23ac8081af674e),
+            FB(0x4ff4dc9a9d073086, 0x036aba6adcb56c4a),
+            FB(0x5c707aa5da7ab93e, 0x1dd59b192afb4845),
+            FB(0x6aa1a1745031695d, 0xd2085b4c6ebb5c59),
+            FB(0xb68d05836390434c, 0xd2fea9cdc683fee9),
+            FB(0xe5e38ffc63f61680, 0xa7f4bc79b2a2f563),
+            FB(0x2d5be453bf5a22af, 0x112958377fa5a39e),
+            FB(0x85a585f0e1caacc5, 0x74420afbc5fcb5ab),
+            FB(0x5f79809266e1c95c, 0x04b4c6c580cc30a5),
+            FB(0x98911680b53a548e, 0x5c0d38ca1a7348ec),
+            FB(0x6360deffff108638, 0xb15938d5b131a4d5),
+            FB(0x7bad8a2d58e9250d, 0x53860ecdb79a4021),
+            FB(0x6a8a33a51e720ed9, 0x43cf1d8f225fc55b),
+            FB(0x0455f82fb1e493d5, 0x14e52b435f117c90),
+            FB(0xd2917906e8556006, 0xe84eba580fde48d5),
+            FB(0x17d733b5b315c7ca, 0x8e453348264425ba),
+            FB(0x5475a37b2cac43a7, 0x0b4904168022c627),
+            FB(0x6d56fee61d4b42dd, 0xc6185ae42afa06f4),
+            FB(0x780ed52eca358324, 0x672a1794201dfebf),
+            FB(0x1f4cd41facb3d023, 0xdf82424e52c96b74),
+            FB(0x2997a6290b918a0a, 0xb8ab9702151888da),
+            FB(0x86aaf307a64b3fd3, 0xcf8a951498e877c2),
+            FB(0xeef09370e775c834, 0x1f15f0ac94c43055),
+            FB(0xbc10f898ea1dc708, 0xd408359e7b40cbdd),
+            FB(0x83b77ae3efa56c29, 0x6372ff42ee6668ef),
+            FB(0x23d5f7f909e7f66f, 0xb1bd762a24a5cde5),
+            FB(0x0a5866861c1b68b3, 0x6d5ea3c9f718b19e),
+            FB(0x0d1f9d2931065e87, 0x6b78a2042959d649),
+            FB(0x8f6893e5d4e8d864, 0xe765c6a987245d64),
+            FB(0x9f41be74cc8933ee, 0x492e7d205d0db082),
+            FB(0x92eb482d9a41e921, 0x58f01788c135131a),
+            FB(0x8a9784746a3749fb, 0x56942690b43c7ac6),
+            FB(0x3d9232761fee611a, 0x853a7813185fa6d6),
+            FB(0xd3b0af47833863c1, 0x2e66a884d47cda6d),
+            FB(0xcf1920b0e8f061ba, 0xba8af21d89a41c20),
+            FB(0xd6100073179a8344, 0x21e391a62ed3f0d2),
+            FB(0x813441cb793af31f, 0x4527281208830ff4),
+            FB(0x7c1875b0ff2d0bd4, 0x050df025b78fc6ae),
+            FB(0x4e63e237b1391722, 0x2aa54f338c2ec9f3),
+            FB(0x37fa0789c2f8c2c0, 0x00a252ecd14d7fba),
+            FB(0x6fa98f08c9c5bdae, 0x25f803f5f392746c),
+            FB(0x0c9e2826e17dfd56, 0x7e4fcbe721321c98),
+            FB(0xf72a43fb8b3204aa, 0xaabe86d42a5a3ee5),
+            FB(0xd0930ebfd1cd1d4f, 0x244596989596ce10),
+            FB(0xb068bc9073d9ba9f, 0x35daeb3efd0a1f31),
+            FB(0x156c63ba5add0333, 0xffb8694f237b1392),
+            FB(0xcc50f48c692531b0, 0xde33725a39264c8d),
+            FB(0xc31b68226647eed7, 0x36b11de6db577372),
+            FB(0x45be66ec7121a5e2, 0x68f3d1747a5ffa4f),
+            FB(0xf548e9e3f2d0cda3, 0xb450abaec195b3e8),
+            FB(0x9cad9f799425b935, 0xf370b36d2b1c6ce0),
+            FB(0x8a7dfe3adaf41bdb, 0xff7b0fe1e16ce665),
+            FB(0xe045e0df3ed308ca, 0x64e990282c44e941),
+            FB(0xb0246ac80fe1ff54, 0x4434e2524ab81794),
+            FB(0x0cc294a9b3aba19e, 0xe73df17d2a6993ed),
+            FB(0x9bbccdef8e2a259d, 0xfd9550bbc1c9267e),
+            FB(0x144157fc9df85fcd, 0x7ae63b23dc799b70),
+            FB(0xa377d7d3009ceb1a, 0x7f9ae092e2821fda),
+            FB(0xbf892492fa6cb720, 0x9b6e935f1e6e9a2b),
+            FB(0xd115ceeb7f18441d, 0xd4f3476aaac43c86),
+            FB(0x41393f966a352af8, 0xe1ac1c3a508f652f),
+            FB(0xb3dd2592e3b26af0, 0x0837f4414de63151),
+            FB(0xa015b5bdc9991cea, 0x760cb3b5b819dfc9),
+            FB(0x8351f44cf1f1ff42, 0xc35b3f0a99a6647d),
+            FB(0x1512ccdc28e15329, 0x666e8029b0027b37),
+            FB(0xc70383171ae01e03, 0x5f21ce8e1f89ff22),
+            FB(0xd6ae3bbd31b7d812, 0x6fa799b4fd370ab4),
+            FB(0x57b6ed0bc6b4495f, 0x9fcef15adf8b2876),
+            FB(0xc89016612d483e44, 0xa3c2312dbb3ec988),
+            FB(0x71e1217073a0c10b, 0x742773c0c2549bfc),
+            FB(0x61ea1693b4757875, 0x0cdb1c42e23f4e18),
+            FB(0x83ebaeca963779fc, 0x71e3cd2788fb5329),
+            FB(0x54d8dff6b4dc9030, 0x801ae1b53fa8caea),
+            FB(0x0288344f977419fb, 0x416a9a2f667ec576),
+            FB(0x56c26421d368ddcd, 0x093e791db1515a95),
+            FB(0xb6b0c847155585c1, 0xa13de6434eeea32d),
+            FB(0x6eda8852c7a0b18a, 0x78ebbb8a50c8aa64),
+            FB(0x0383296479cd6883, 0xf5847c2ce316b917),
+            FB(0x6a16c8248133e755, 0xf145a684765f6379),
+            FB(0x26e191fcc44a63a4, 0xd45731662688825d),
+            FB(0xa89be02b8778734a, 0x0282850e9e5947c2),
+            FB(0x15b9f5c8cca78cde, 0xfd1780bd60a4c99d),
+            FB(0xfc943ad0af20f2cd, 0x6ad4647b97e0db46),
+            FB(0xc1a93030f203031e, 0x9aa45fd232291f15),
+            FB(0x5bd35c631613a82a, 0x1b0942affe8f79a8),
+            FB(0xd9a5c8922f130c9b, 0xe013b9606ea56751),
+            FB(0xf12e04f3ddb383f1, 0xe9b3354fe628ede9),
+            FB(0xd6e3f310abdbff62, 0x966f0a02b3ee10c0),
+            FB(0xe30a9914cefaa916, 0xf13dfc7824239289),
+            FB(0xf5e3799df009b6d0, 0x37de01ce65f73fa8),
+            FB(0x752d3ef3b337b96d, 0xfcc9bf12565b6562),
+            FB(0x5a9f7f71af78f5a0, 0xa293a21bb073f64f),
+            FB(0x991cad4ec10e0c73, 0x04d4dd259e86a553),
+            FB(0x84c688b3a0db684a, 0x8445da27a7bf9134),
+            FB(0xb33289fc21f8e9c6, 0xc6485b877d36d321),
+            FB(0x62a41c1ccd1d1171, 0xd6731d9f68f9c2b6),
+            FB(0x7f7ef1a7d2ff5749, 0x4dfc193d72700d56),
+            FB(0xf59fffb8e6370e24, 0x33742535d12680e7),
+            FB(0x697a445e9e825a63, 0x489b88e3e68679a1),
+            FB(0x53efd6f0b6127ca7, 0xed020d12c631804d),
+            FB(0x466dffefd2cd193f, 0x59c37da659650231),
+            FB(0xe9ec8a52c33592bd, 0x5edd243a92cf6e3f),
+            FB(0x65cf2b7a11d66cc5, 0x44352bed8d1e618d),
+            FB(0x4590e70685284dd4, 0x022d5c0aa385ebac),
+            FB(0x7829277f8e92dba6, 0xab2858745be22f0b),
+            FB(0x5e94b694928a95b4, 0xf45fae0d43210914),
+            FB(0x5b05371d5bd570b9, 0x3f674ff88f71de10),
+            FB(0x851b0026d16a25c9, 0x98dada50b6520ab4),
+            FB(0xdfebba1b89bad59f, 0x10929dba6a05a485),
+            FB(0x9c71625741fd7c94, 0x22c194cc64963d1d),
+            FB(0x1efbdce4cdc8f328, 0xe356dec85c1fca40),
+            FB(0x431bc0f3e91fb27f, 0xf582d57d0fcd6e60),
+            FB(0x0049bc634c9792c0, 0x3eae070d27c71c98),
+            FB(0x60c3fbb778db6f3f, 0xc01850b7aca750c3),
+            FB(0xe0c9fbaaae5017fb, 0x2bb46568d85cc154),
+            FB(0x90cd18032e09c459, 0xfda539d2eb0bd47f),
+            FB(0x343ed031b538f0ad, 0x657690cf5a3ab771),
+            FB(0x208399c267875de3, 0x115e3b7404131980),
+            FB(0xddc4c4d2c8987e6e, 0xfcbfc6afb088ecd5),
+            FB(0x077dfcdb4823d1ef, 0x62dfc28fd8414cbe),
+            FB(0xdc318f7690351507, 0x2647fcfe944f9e99),
+            FB(0x533c98865811418e, 0x5ac2c6525ce9be54),
+            FB(0x77b147d6880d9067, 0x52b1add1ef11af9b),
+            FB(0xe17a59353345b1e7, 0xad1926a1dea4b0be),
+            FB(0x2b907d6819c75111, 0x452a82208e7eeee7),
+            FB(0x0777cf16069207da, 0x6b75e21fe544a4ea),
+            FB(0xd97db502e38a656e, 0x93fecc0104f72800),
+            FB(0x9e718e7ba57b78c9, 0xd28df352064dbd1f),
+            FB(0x5ff8b38b98e994a2, 0xa8a2f8497b940234),
+            FB(0x9310d8ddb41c69fc, 0x6792a42c1b881cb6),
+            FB(0x0968abcd0e87270d, 0x4af9a55050e27ef7),
+            FB(0x3fb0c0cfd7726195, 0x6aec7637a4d8f5e6),
+            FB(0x617d57d98f031b07, 0x8d9daea97c404f22),
+            FB(0x1fe3858a91a47cf6, 0x6f9c664008acb3ce),
+            FB(0xcd962df89cbd4394, 0x5d8f9fcebed3d698),
+            FB(0xb357313155587b64, 0x5ade8c128840f5ae),
+            FB(0xff3ff395de81c94d, 0x7593f1bc22acd6c6),
+            FB(0x85b6c8249cfb8851, 0x5c58ed572aab3a5e),
+            FB(0x152bfc0711c3f27c, 0xaa7b061772214e11),
+            FB(0xb7d6d497b6bba9e9, 0xc3021fe685dbde51),
+            FB(0xded52fc13ee07695, 0x97de928797cd5413),
+            FB(0x244c06358153ad24, 0x047b4a54ee881b57),
+            FB(0xfd76199d2f74bc5c, 0xe49709f323470b8b),
+            FB(0x119312926f21d1f6, 0x48934002aff25798),
+            FB(0x7826098d977b3d43, 0x226b46e6a39c7396),
+            FB(0x42a7b3928bf7e213, 0xb31c7d191609ce5e),
+            FB(0x9a1abfb3688a0bd8, 0x97240719a51775f8),
+            FB(0x89c5485a4d809986, 0x02d66c27280592f8),
+            FB(0x86d22a301091af7b, 0xe7f1b3ce94c29730),
+            FB(0xd5df0e7ec7d1c95d, 0xe55d4d8c31fc523b),
+            FB(0x23a0876b0ff027bf, 0x9a99be1eeaae61f8),
+            FB(0x7995976dcd59215a, 0xbfba03bd4c8b21a0),
+        },
+        // window 5: g_c_hi^(j * 2^40)
+        {
+            FB(0x0000000000000000, 0x0000000000000001),
+            FB(0xd6bd44e59da2beb4, 0xd35cc0e951f27975),
+            FB(0x6c4a636f285bf097, 0x7f158b3b65ce523e),
+            FB(0x492f25cb161fa0f6, 0xdccb9dcf359ca646),
+            FB(0x50ed52c72ed4426c, 0x29d984243a254d89),
+            FB(0x7ce3a6788f77fa18, 0x9fb3092305369eb5),
+            FB(0x0015676c558fc30e, 0x887ded58983f3540),
+            FB(0xd05bda7679b61565, 0xce95c626fb1172cd),
+            FB(0xf36ad47eb525bef9, 0x32c13b69624701c9),
+            FB(0x99619ffb789d6ddc, 0xcaf56646d3301a29),
+            FB(0x83ceebbdd627cee4, 0xeb30e4d44988e6e7),
+            FB(0xd65388dfe479659d, 0xf2ab409dcc81a628),
+            FB(0x40409aac32b054f8, 0xbe96ee57b78a3bac),
+            FB(0xff79b03cb4d0022e, 0x87847059e9d28fb0),
+            FB(0x675c956344c2e572, 0x9f21506d9af920f9),
+            FB(0xefb8f60f85745343, 0xeed6608744ccc775),
+            FB(0x2c951ff43a3fd4ce, 0x47f104c170864f57),
+            FB(0x68925257cdcc3b8a, 0x501cd6485e6c26dd),
+            FB(0x360939b778141845, 0x9be46b3d445a0a96),
+            FB(0x8775a919219b08a1, 0x7f1987159a713605),
+            FB(0x96f79e87db68230e, 0x2d2f5682cf93e002),
+            FB(0xa29a46dc9d81cff1, 0x19d7149317737b0b),
+            FB(0x6860b1fff1e95d51, 0xf42a8a4c20c27e28),
+            FB(0xb576c2e011d060e6, 0x9fcbc48aeb28cf76),
+            FB(0x355c313530abe4a7, 0xdc2a1b4cfa1e4aa8),
+            FB(0x1fc906038a318e81, 0x958b1bc42ce3fb49),
+            FB(0x40348a744e02a3d2, 0x07186604424b67fd),
+            FB(0x965b4b2fba55335c, 0x5df6df0c0b1d86a8),
+            FB(0x27b6da905efd7ac2, 0x391de776a0fdb96b),
+            FB(0xd031fb7c61c74558, 0x9cf2fbe62408a30b),
+            FB(0xd35c2bff356c6b1f, 0xd8edb328a58672db),
+            FB(0xdfc1e9118955a08e, 0xd10b4ac8dc060b2b),
+            FB(0x25841af6ac107373, 0xaddef0162f0c8bb7),
+            FB(0x9ea6e2cbf4a876be, 0x5f34f36547624c97),
+            FB(0x5ce14444a400ed82, 0x884a8de2bc6eb7bb),
+            FB(0x635c9a8e1a63b03f, 0x98f9bd7c3f898acc),
+            FB(0xd0297555ae2154b0, 0xdad09e34a68c38ed),
+            FB(0x4a264a7e6f2f8701, 0x502cbd2199abf799),
+            FB(0xdfb4e295bd52a754, 0x5de2715a24f7ccf1),
+            FB(0xf159327e11e25ce0, 0xfc3001d3a53389fd),
+            FB(0x4916259f7d998ac6, 0x44040cc74a9b3bcf),
+            FB(0xbbd15677116c0dcd, 0xbeb3f11e9e1feb23),
+            FB(0xdf7c35c17b555f94, 0x6f03d5ab8e453aab),
+            FB(0x5ab17cc26944b889, 0xbca5630ff2534398),
+            FB(0x18da68671be81050, 0x2facdd4bcb6bf6f1),
+            FB(0x663df0ef23840872, 0x3aa273ea318c0eb0),
+            FB(0x12a8b100e227ec44, 0xd3eb334a3c7ea211),
+            FB(0x942b562c8329e276, 0xd6077142a851f0b2),
+            FB(0xc2afdaf69ac083a5, 0xce67fe24b41793a5),
+            FB(0x94d2846c13f04936, 0xb5273d2916089b6b),
+            FB(0xed13d1020b2952aa, 0xe78ecfa3bec8d0c6),
+            FB(0x4a0b618730915a48, 0x7b60dfb1e2720a77),
+            FB(0x70179211f7c2e368, 0x4ba8127acaa76475),
+            FB(0x6427de045ab88407, 0xb28b51408c20356b),
+            FB(0x5c358147020c3758, 0x7891fea4d9878a97),
+            FB(0xb2cfd56ac1758296, 0xb70b4050fc9c27c8),
+            FB(0x1389501440e8521c, 0x9887576c8db4a757),
+            FB(0x2a11f6a3ed3a0dad, 0x6bb1b49a3f5444e8),
+            FB(0x7652cea85d1496ae, 0x68bebaa33cfac2da),
+            FB(0xb7bf6f4e9fdd4f39, 0xd2cc935ed4e9b51e),
+            FB(0x64d38ae37a750469, 0xd7ec05ae5a5fe931),
+            FB(0xc3486b5274f5be9e, 0x907c9086d189b2fb),
+            FB(0x4d03b0e99d03d7e6, 0xb01fffc0dc64fbb6),
+            FB(0x3d325414bf6db048, 0x08d12048db541daa),
+            FB(0x50879924f1f7205b, 0xf1e5875aa9d4ad80),
+            FB(0x4339a1cb1bd4324c, 0xc9e2f2e79ec811c9),
+            FB(0x7ddad357fb308761, 0x3346e9cef11f21de),
+            FB(0xb3478a97c5bf4f0f, 0x63d3e55b54459540),
+            FB(0x9edbbccb38292c57, 0x9120147fc0038361),
+            FB(0x348bdaa98cab0ce7, 0x1ac0707a84847fe3),
+            FB(0x2fd38bd021acfefc, 0xa1832ef91b46e54d),
+            FB(0x3655a7e0e3932ef3, 0x091b5b4dce7c8cac),
+            FB(0x66466c4da2abfac4, 0xb3ba5cdffa131b0e),
+            FB(0xa3f99461a788006b, 0x3cd0d6f1e3411016),
+            FB(0x42de12341687c4a7, 0x0668734f9ffe45fe),
+            FB(0x6a9d4767c81323c8, 0x3f24970aa730e38f),
+            FB(0x0d59075fbb3c5e90, 0x762fa02a86b3be2e),
+            FB(0xacb564355919776f, 0x7b60bf1911f39882),
+            FB(0x7edfd345991791a9, 0xc3bdab119edaec00),
+            FB(0xb7e111c7241ec2f1, 0xe3e9927d65ed4e41),
+            FB(0x41578d7e14863c34, 0xd2522723e6b0ee01),
+            FB(0x6924e9e1e488e186, 0x7bf321fd5ce1ef63),
+            FB(0x3d26728aa867e0bf, 0xc6d944e57d5b8c5b),
+            FB(0x88d96057f81b129e, 0xff73ee57e0a667d8),
+            FB(0x0874c2b7c2cff4c8, 0x8807efeed94e1f6a),
+            FB(0x3dfd691c346607e4, 0x4342fef930ef6304),
+            FB(0x91af1f9cd69cb243, 0x184b69566ae4a43f),
+            FB(0x04e472d0babe2b93, 0xb44e8f089e4ae79a),
+            FB(0xa2bc50861c9b76ae, 0xf4359985d21ca201),
+            FB(0x5e35c7ba471399a5, 0xdbf73cceb0f42069),
+            FB(0x632af6183e2ed36d, 0x1bbb8820219ea92a),
+            FB(0xddbb250f242a723d, 0x302fd2ef7dbc59eb),
+            FB(0xd43aa9a65e82106f, 0xab4e0394c1bc7971),
+            FB(0x5ec33594770981eb, 0x199e6eab4b20f165),
+            FB(0x1e663f46e86f2595, 0x86d92c6dfb16b40f),
+            FB(0x5310a56ffda0c00f, 0xfe697144f3d26f73),
+            FB(0xe26be31741a3255d, 0x21e5b13483bd84b9),
+            FB(0x114386520d7bc0fd, 0x11164492c71f2acd),
+            FB(0x0a483128cd2b41f1, 0x84a42b481000954e),
+            FB(0x201103ab9cf06faa, 0xacf5eaf4bfc3b042),
+            FB(0xd122c5e667d24619, 0x660d6d0fa43fba99),
+            FB(0xce6d0ecffa93c38f, 0xb3bc530220d31ea8),
+            FB(0x469937513df38fe8, 0xcf25528bd49040ed),
+            FB(0x6859c53d5f21505f, 0xa4a5592786df7a20),
+            FB(0xfb45c98a441892e8, 0x7186f622ba815de7),
+            FB(0x95d195fc5373801a, 0xb2593f1bb0b83846),
+            FB(0x217656870dad1878, 0x94af7ee1cd611b98),
+            FB(0x7afa08f0b4ce4c7b, 0x6bce68ac280f423d),
+            FB(0xcbf2d2d795db3efb, 0x535d69a7d1a793ed),
+            FB(0xc5c003f78dcf2c24, 0x35a5be37e2e7edfe),
+            FB(0x1c209b472ffd5ef5, 0xe5dda286c6280c45),
+            FB(0x80c82e2e14a46101, 0x64d993d877f97205),
+            FB(0xc4faa15ae6159b28, 0x307ac8d8b109bfa5),
+            FB(0xe9f1cf93e01f6ca8, 0x0bb1871944801efd),
+            FB(0x2b99c2ad645f9ff4, 0x8060a9cc3904a079),
+            FB(0x27850857c41d0074, 0x51555bb89998325e),
+            FB(0xf524b061decbb9cd, 0xdb67da151d4ba3de),
+            FB(0x794e9e10517be632, 0x4a04b75a0178d707),
+            FB(0x00cc207106264ad9, 0x3d124a7e1e38aa7a),
+            FB(0xb1a52b72102541ad, 0x967f64c9aac1ca56),
+            FB(0x354c61eae3e6eac5, 0xd992f2a25c3b4d70),
+            FB(0xb3d5f48eb0ba36d0, 0x6d307752b6615e68),
+            FB(0xf393449a0e53b502, 0xb25a639535892db6),
+            FB(0xc1032ab7d4fe3460, 0xadb26c486d8e85b6),
+            FB(0x1c3703ed0e7edd66, 0x3f6716a26885e740),
+            FB(0xb3da8babc36f2ee0, 0xfc2bc3ce63e59632),
+            FB(0xb275c815fb709f13, 0x216454045a59148a),
+            FB(0xe5301d085d63df41, 0x60ff16b74b43d58a),
+            FB(0xa2209edb2650051f, 0x6fed70f958599063),
+            FB(0xa9f6dfcc54177e0a, 0xf01699f8b469da84),
+            FB(0x22d8ee6089aac74e, 0xe5266f3298150dc9),
+            FB(0x04fb11b6f76c8e2b, 0xbff1609d617453f0),
+            FB(0xc71b04e161d2ad94, 0x5d589a74cee038e5),
+            FB(0x59cfa31f015fba7e, 0x6da91ad001a46d30),
+            FB(0x4d962bcfb7ec5c87, 0xa9c460321a3a2a42),
+            FB(0x756c353310b013f4, 0x6b7b83054ad42c94),
+            FB(0x2d8410787389860c, 0xeac23d4075bdf98d),
+            FB(0xbaa7abd6ad3c89f1, 0xc5da09c04545a64d),
+            FB(0x9215b37201ffe822, 0xa983bf4b3ccef3e0),
+            FB(0xaa9e6926b400e2df, 0x37914df5d47980e5),
+            FB(0x730375bfe7266243, 0x1de1e58f549613ef),
+            FB(0x6c15783116113d63, 0x1cdd06220d5d3bf9),
+            FB(0x9125fe91c785bc7a, 0xfeee50c977d76cc5),
+            FB(0xa5542f78cfa41df8, 0x1e09a3c37b68f355),
+            FB(0x23613f2254e80841, 0x8b7bfe7509b0bd12),
+            FB(0x0123e5503781c7b4, 0xf874f2be8a85bf61),
+            FB(0xdbe05b661e6e39a5, 0x82cff1c1010a5f26),
+            FB(0xe8535bf0d5042a6b, 0x78874a0ffd330716),
+            FB(0x722108ec901b8325, 0xcc189f96a8428787),
+            FB(0xa2e7cdbb9fd915a3, 0xca52e03386d2e4fc),
+            FB(0x4aa86a2f3bf46686, 0xd5d580994ab7d4a3),
+            FB(0x619950c23268d20b, 0xe42f948f42bf4163),
+            FB(0x3c2bd2124ee3d84c, 0x384df7bd99d94354),
+            FB(0x632a50de77285538, 0xc39c8ed8d83c003b),
+            FB(0xe0d647fd212792be, 0xd746f348a0a11646),
+            FB(0x9bbc8dd6ba5269d7, 0xc330af9f155aa8d3),
+            FB(0x9080595371d679d7, 0x2713dc8e13f4f871),
+            FB(0x81e2707cc05522c3, 0x53e344b708fca70b),
+            FB(0x05c5f8c6c6aaafb8, 0x0061f8d4a2632aef),
+            FB(0x9a1491f3d801c8bc, 0x1654d388219dc8a3),
+            FB(0x218becceed28c4a9, 0xdb458f6ee6e69749),
+            FB(0x39455b8a3a4296b2, 0xbf8f576bf5320e98),
+            FB(0x5800415e896df9fd, 0xb501b5eaf8f3db5f),
+            FB(0xfc3b7c6141f5fb18, 0x0db92b70b52fc459),
+            FB(0xe2214727f92db7ee, 0xe89b7785ec736060),
+            FB(0x9afdd1c8c7781259, 0x26a11bec0bfc4155),
+            FB(0xb4bc0348385cecd5, 0x5ec0e04f91282d8b),
+            FB(0x8a687fa257a6b7e4, 0x9f23b7580782ea72),
+            FB(0x618ae34ce66a0596, 0xe3748b54220c8584),
+            FB(0x93468da0af714cde, 0x857407bebf9e01f5),
+            FB(0xa21912391813fbf3, 0x967a32391ec5a56e),
+            FB(0xbc013d1e0115c5ea, 0xe74519889e96029f),
+            FB(0x46e4e76eb84b7f8d, 0x29093a831d0467a9),
+            FB(0x70370abcff8a7aed, 0xba197f696e5fd700),
+            FB(0x4d4bb42ea9603763, 0x39ab60ea6b6f04df),
+            FB(0x7d3b4a3c3f59d6ad, 0xfcaff2b2c0f479e7),
+            FB(0x8b2f77a9b6608a7d, 0xff956501a54be6c4),
+            FB(0x81e3f035fbc1a72d, 0xde4ca970399e5635),
+            FB(0x8debc6cbbf982880, 0x3febd0aa6264c48e),
+            FB(0xb2f40f300a409762, 0xb54b8790c8478d74),
+            FB(0x6fdc7ab2612ca2c2, 0xb4af76d171d04445),
+            FB(0x9d99c1315dbeae3f, 0xf33e4a2519f8bbe2),
+            FB(0x1b147c0c45f37f7c, 0x01237a86f85ff22d),
+            FB(0x1ba9f01a76c39582, 0x6b00cc13bf563db7),
+            FB(0x7b37a8abfd619774, 0x8c8c874c924b4675),
+            FB(0x0d3ded9639ef9f01, 0x4a05dcc789e324a2),
+            FB(0xddc4f3cd87820b3f, 0xf1ae256695ad9f72),
+            FB(0xfcb90f9e8adfe0ea, 0x5f2d8f255c9b13c6),
+            FB(0xecb2372fb4736e16, 0xd88f463d51c64fa2),
+            FB(0x4fb1c5f4f495fccc, 0x959d7584f2303185),
+            FB(0xa0cf9362c1fc5710, 0x57118d2da4553a16),
+            FB(0x68148bb518619fd8, 0x7a02c17292e04815),
+            FB(0xaa171b61eb9a88f3, 0x30a19bc854ef8e27),
+            FB(0x2bcffd940161f7f1, 0xe043e1615083a7a1),
+            FB(0x868e73aeda74b418, 0x7928c927b46f5266),
+            FB(0x36225e23865181e7, 0xf3bdeae2280f48de),
+            FB(0x63c415d29fc02da9, 0x98353f5331bd3bd3),
+            FB(0x42623a5b2c5a113a, 0x14e658480e3c30e5),
+            FB(0x5850d29656fcaa6a, 0x2bce7b0f0208eed6),
+            FB(0x8158b7dfda3da118, 0x334b944b492c5464),
+            FB(0x23911e64ac8da633, 0x22d230413f28f359),
+            FB(0xa4f4c2b3e6edfe64, 0xefb8ffd35d30c8cf),
+            FB(0xdea300673a809b04, 0x0cfd14b7b3eebb34),
+            FB(0x982a71867127b17b, 0x9d7890619303bc28),
+            FB(0x2a18625480e7b7c0, 0xe30c68bafb00dda9),
+            FB(0xc1ac9aaa19a18ca2, 0x4688d8a0f79dd640),
+            FB(0x09d8927fa9b4b62a, 0x9c3d4ddae24cdd1d),
+            FB(0xea7c5afd12f74b8d, 0x5525c71210e3b00c),
+            FB(0x1d5238cac472e7d0, 0x3d34e6e05466cc84),
+            FB(0x178745d2907097b2, 0xa4f4f814b44dece7),
+            FB(0x0ada26e74a8903fd, 0xb091acfac540a4af),
+            FB(0x4acaa950166a70eb, 0x721d1cb7867744cd),
+            FB(0x5d9da531e8199eea, 0x7945e136a78f8a8e),
+            FB(0x819d779042b6717a, 0x612801e12707e89b),
+            FB(0xdcb2588835ab6f73, 0x57199bf149bec83c),
+            FB(0xfd608346256a14bd, 0x80493d710adc0455),
+            FB(0x82753864217479df, 0x1edf504cf1824855),
+            FB(0x105aa2aac93ddef8, 0xb1fe18d134141e24),
+            FB(0xbdcff41147e424df, 0xbd1acf3c61e3557b),
+            FB(0x1fd1f8d7530c599c, 0x7a4095047b22a343),
+            FB(0xfaa34d7020573afd, 0x6714067fdcd733e6),
+            FB(0x3420e1352d311532, 0x2de65eef0210946c),
+            FB(0xd439c08376ab66ec, 0x9a46813b798310f1),
+            FB(0x8564292f6d82e625, 0xca573a32a3cbf9b9),
+            FB(0xbd5b1dbb8ccf85b7, 0xe36d8f97210c6d8e),
+            FB(0x84bea7c090d2f386, 0x8d1d8a07b497ae0e),
+            FB(0x8d296eafdb1f44f1, 0xbc10ec2144c7bdc0),
+            FB(0x8d1a3bd716050b49, 0x8eeb0904ec2dda2f),
+            FB(0x7f7a726ef67ea56d, 0x6139dc1a2800373f),
+            FB(0x3fe759b7e76422b3, 0xc4d4418c6169fb03),
+            FB(0x07cbd9e6308db882, 0xf931ef77050ef32a),
+            FB(0xea2ec5c3665a80c2, 0x4d1ff6464d21c358),
+            FB(0x72b000460a4e6dbf, 0x1dd4833d3e6bdd32),
+            FB(0x257744f8b8805a07, 0xc872bc559644d513),
+            FB(0xda0b5b9d29b9964c, 0xf78cdd30f77b9c3f),
+            FB(0x91c80bae312eac4a, 0x61783fd97d4aa078),
+            FB(0x057898b60c4efed3, 0x0b3a132417b10303),
+            FB(0xdc589851a57c502c, 0x5a5e025acc8e6bb7),
+            FB(0x1ab0c1a02b41b95d, 0xc34644fe20e0f54a),
+            FB(0x920774afebf8c833, 0x54e4c1b92dc967bb),
+            FB(0xc2be18be39a8cbf3, 0xbfe0a3029fa4acf9),
+            FB(0xa82353d267715504, 0x7da566ce83bb3328),
+            FB(0x4de33adc3644fa8b, 0x1e376cdf80113229),
+            FB(0x4c4a1903dea9eb67, 0xad11fd73ad84bf61),
+            FB(0x6cbe54d76c5425cd, 0x2eb5b5f957a65259),
+            FB(0x70bdb8e6f92a7297, 0xa4f978178eea87f7),
+            FB(0xf4d6479d2baf4182, 0x2b0a40fad36b3d4b),
+            FB(0x932d9760048aa215, 0xaa502ff2e1ff8fac),
+            FB(0xabe785fe03a4c133, 0x3fe680944a28766c),
+            FB(0xb9a2e91c382c6e26, 0xd249ef89f5432057),
+            FB(0x0ce210b8b37daf26, 0xa69413387693b86d),
+            FB(0x2acc4ae71dd25419, 0x6798fd04e5e8bce6),
+            FB(0x5d17f7ce80d08fcc, 0x1915fa606d3bd4b6),
+            FB(0x810714e2bd4ba38f, 0x3c5e1a82fc6ac61f),
+            FB(0xb0f5ce55af2364dd, 0xce787eb74d322592),
+            FB(0x38a7feb8f54cdb95, 0x17861ad3cb767c91),
+        },
+        // window 6: g_c_hi^(j * 2^48)
+        {
+            FB(0x0000000000000000, 0x0000000000000001),
+            FB(0xca4b487079854118, 0x0724e64149f7a947),
+            FB(0x93c1574305defb0b, 0xda279dea34c6a28a),
+            FB(0x49a10add946ccbb7, 0xe0f6ca27b7cbc4f4),
+            FB(0x14f6b49abcb226df, 0x0dce4c934c5f7378),
+            FB(0x7591ef41bfbe1b94, 0xf74b2606bf6d542e),
+            FB(0x0564899373b11a03, 0x0a6f15dcc36800c3),
+            FB(0x230ae5100f6412cc, 0x6ecb68a4982a58a2),
+            FB(0x8f0a711b430125fa, 0x62c3484b0340096b),
+            FB(0xc07b17e26a87a5b4, 0x6e73ee7cc082636e),
+            FB(0xb6c357e9833770b0, 0x355d64fdb56a4e12),
+            FB(0xab9eb9990007bb73, 0x8b68cf80fbc26044),
+            FB(0x08b97004e07714c1, 0xb9bd4fc7a4dc529e),
+            FB(0x7d5f8903fe78680c, 0xa1d0519d18b63af8),
+            FB(0x0acf73b2b0b7c310, 0x6a6160349475dcba),
+            FB(0x15685b41760bc7f4, 0xcc803fd630c2c5c6),
+            FB(0xff2f73d3fbc7b416, 0x729e1085149d0cfe),
+            FB(0x347296550685528a, 0xfbb70a9ca7baa0ce),
+            FB(0xa45edd5ed994bb46, 0x1ffd8accc0d1537b),
+            FB(0xffa43ac89aab7cb0, 0xb11d5107f5ea035d),
+            FB(0x5454a3c2e9d0d837, 0x878885a5fb774b6d),
+            FB(0xda7efe4d5ce04a80, 0xffca6c77ce73b2a7),
+            FB(0xbf3f78cf2a332647, 0x55455acc6c51e8e2),
+            FB(0xcc098e4d1d92c258, 0x1b683c7172911059),
+            FB(0x64a23f1cfb55584e, 0xe81ab0bb9e5df1d3),
+            FB(0xed1d879e941addb3, 0xd64891b040d4a5ed),
+            FB(0x863e8d0af04643e1, 0x01e68fde488479c6),
+            FB(0x8ab315164d62991c, 0x0df1a34af55233b9),
+            FB(0x37b18f20fdb85c2f, 0x1a3344d3e3cbc244),
+            FB(0xeccdb899469042c6, 0x0c885d8d6fe9b091),
+            FB(0xdfad0dc8d1062199, 0xe46c7376ead17364),
+            FB(0x9713a9a14342433f, 0x58320958b4105275),
+            FB(0x152d7675e8b275a1, 0x0962fb995320cd69),
+            FB(0x6d0817896a715284, 0x8212bac354ccd6a2),
+            FB(0xc63fac284d20bea7, 0x4e588dbbb13db286),
+            FB(0xecacdd57a542424a, 0x502372617f0de41c),
+            FB(0xd52d89d45e7b8cd5, 0x46661e5269567e40),
+            FB(0x2e3762ae6e90cf8d, 0xa45405fd314c38e6),
+            FB(0x4509d523a9f491f4, 0x31eeab15c2965f00),
+            FB(0x026a0d7b7db88405, 0xe2d2485ff3cd4610),
+            FB(0xbf6dbf139ea3f626, 0xd82b223c06878182),
+            FB(0xf7f9065cf89e620b, 0x22295c70f78b5b77),
+            FB(0x418390c314f44c2a, 0x8ecfb90d16f9904a),
+            FB(0x959e96fde0b41107, 0xb80e7a5ff5ae5af1),
+            FB(0x6138a030dbadcb79, 0x2b8e889842243f86),
+            FB(0x66d9a00a58fe0008, 0xc2fc112c44d98efc),
+            FB(0x98f53526eef44c36, 0xbb120434b314d3de),
+            FB(0xfdd8567132dda964, 0x7bba1083fbd492ee),
+            FB(0x3013df5af52bebde, 0x4907eeae83c90f9f),
+            FB(0x73d8f9fb1fd21f89, 0x9ab0aa5c6f6a2255),
+            FB(0xd423be568bcb298d, 0x5f70f5e55a05189b),
+            FB(0x9068eb1924580a8a, 0x245e6f3c4b6da711),
+            FB(0xca6fe499a96272a3, 0x3b483a7467f1ecf4),
+            FB(0x964ff6401c6514d2, 0x3d73f5751b6e2677),
+            FB(0xe3ae0c9acbf29d20, 0x0c2c7f396342fb96),
+            FB(0xb2e87cc9fe1c49d9, 0x88605a645cf14503),
+            FB(0x908c5ea3fb394d2e, 0x56112a8d8eb62635),
+            FB(0x94098d2694af64d5, 0x0840be2b6eb2d93e),
+            FB(0x85c9d9546bb0261e, 0x6e1813493735ee3c),
+            FB(0x0ccfb0e1e21d1959, 0xf19d4b74af8253ca),
+            FB(0x4818e1673c1b84fd, 0x63c35b6f09a36608),
+            FB(0x311cee61c66d4cd2, 0x42725e01a0944911),
+            FB(0x5cab80bcfd25cdcf, 0x37837314639db55d),
+            FB(0xbb89d285e76bf63a, 0x245345d6ca5efc29),
+            FB(0x8fb42139b423a29d, 0x9ce65d16b385c8c6),
+            FB(0x5bf74f65b97ab599, 0xacfdb97968505e6e),
+            FB(0x053320c4c88eb148, 0x5ec6bbdfa4298942),
+            FB(0x0d18768117f26e2b, 0x81c9e61b2eef9d25),
+            FB(0xaa3aa148b5e3788d, 0x1c341972358b82a0),
+            FB(0x48a0686f9aa18a88, 0x27d3796b8e92a21e),
+            FB(0x9493f19c0b3be9c9, 0xc1aa7245260447dd),
+            FB(0x3be210971cef5e62, 0xf31860bfb56ebdc8),
+            FB(0x2fe12102e03a2e7c, 0xc8e7d96efccd3ba8),
+            FB(0xd62c11ec12f91d7e, 0x3e6082396a9c8686),
+            FB(0x73be80f16e2ea2f7, 0x428c57799e4abc2d),
+            FB(0x8ceec5706f0e43a4, 0x34cc2090dcaad64b),
+            FB(0x7df6753a7bb01fa9, 0xad68624556f92748),
+            FB(0xf98fec4facb9ff9a, 0xcfc5c6fe31041d3e),
+            FB(0x56121ed8397dd904, 0x97112ab0d86409f7),
+            FB(0x7c36accf073eb390, 0xb6716a12c1c11b18),
+            FB(0x21614151742f80ea, 0x6c9b9ea5616f4701),
+            FB(0xfb8ba0bb74b5af4f, 0x56c7d2f3af5e7b00),
+            FB(0x25c40e061b34cb9b, 0x5ff42ce37f59231f),
+            FB(0xcd4861a5b16b3620, 0x5b51d15323d3f182),
+            FB(0x30f292ef0268b2ca, 0x8e4f763918b22ba0),
+            FB(0x87329c96cf503fee, 0xe5dcd54be2e354e3),
+            FB(0x0a966cd958031349, 0xf932172496c34f8d),
+            FB(0x9fa54e69645ddea0, 0xf955ebb23f2abbe3),
+            FB(0x68c0fab79c42da69, 0x047cf10e96048f65),
+            FB(0x5fa81843c5bcfdd7, 0x2b561aee025105aa),
+            FB(0x36414334dd012784, 0xc6fb51ed405471a6),
+            FB(0xec73be6a89752229, 0xa6e47e26335afa43),
+            FB(0x23ae22f193e51357, 0xc282226808b7d05f),
+            FB(0xf55dedbb7a50ba9d, 0xab2547ee1bb9a575),
+            FB(0x175b538cfc66ab80, 0xcc704f04bc492575),
+            FB(0x4b8fa2f280ffed5b, 0x3cd3a31061b28f75),
+            FB(0x8b4185a7487790a3, 0x63f06f318f275cf7),
+            FB(0x97b6274b523c6089, 0xb208554c7d2c435d),
+            FB(0xa8f653eb4e28190b, 0xb8572158a80ef560),
+            FB(0xdb4a11903fcc6880, 0x2a835b3fcdb203f2),
+            FB(0x2e270bb825b5a95c, 0xf23693483c26bc2d),
+            FB(0x3de54902a6f166e4, 0x54f1354931f79b7f),
+            FB(0x431a5cbf9b0ea315, 0x043dc29167e8f2ba),
+            FB(0xcf7285ec6196bf0b, 0xb118b8a817b39062),
+            FB(0x96935740a1157374, 0xe9583b17bd6f9fd4),
+            FB(0x2b942cf87b08a2ea, 0x77edb194e4dbf881),
+            FB(0x48354e0574756511, 0xafff70a38b4d306e),
+            FB(0x7332694cdb54d47d, 0xa528f4b61430e83b),
+            FB(0xaee8f3fc3cc461b4, 0x877539393b704845),
+            FB(0x729ee2ab7eaa7bd4, 0x897eea2bf2dc1b51),
+            FB(0x197799cad3dd857c, 0x11fcfbb9417f072b),
+            FB(0xd0a242d1f0d8faca, 0x4fc1db516791b76b),
+            FB(0x5635e8b9d8cb9ee1, 0x480dff5b5d2122da),
+            FB(0xb1748aeb691e99f4, 0xeab96e389dd77d1b),
+            FB(0x4f303166ac611208, 0x5b07b22535182ac4),
+            FB(0xdd6ca21237d1c847, 0xc36031f28319dc31),
+            FB(0xdc8a902e174aef3b, 0x4a6d5e134238b99b),
+            FB(0x65f9be5172b5a848, 0x8af928cb5e2c8ee3),
+            FB(0x7c98da594b6eb9bc, 0xea49ee33b74a8603),
+            FB(0x5fbdbf1604959f3a, 0xf52f066f259eb349),
+            FB(0x45c5f6eebdc872bc, 0xb2f1e07fdc4f064f),
+            FB(0x83dea99df0b7aae8, 0x6ffa86605a2cb07e),
+            FB(0x8b83bb9f96f26caf, 0xfe66042f49d83513),
+            FB(0x9c4ab9fc8ab0c322, 0x56c5f104c23a8c11),
+            FB(0xdb86bf7fd526738b, 0x1630558fdc0f8e42),
+            FB(0xe7614f1b14b0e9ac, 0xcfd8f9fa09b5b88b),
+            FB(0x7c6af06b252c99c8, 0xf6a55e24743eadf4),
+            FB(0x2bfdbb56fbf96f5a, 0x42c82d5c740afd60),
+            FB(0xaa5807660dd4bb70, 0x16775ea98e7d2e44),
+            FB(0x7366de9b0f6b532d, 0x4539ee2e0a5eea15),
+            FB(0x902074b21e607195, 0x6e0dd9ff4282762b),
+            FB(0x54b0f6a2e31b53a2, 0x3266edf8165be734),
+            FB(0x19a1c98d596ce90c, 0xd5f1efce1bce41c4),
+            FB(0x8e0cde8045c6eba5, 0xe624cff778197c2f),
+            FB(0x6936f68bb559c1c2, 0x89947d4306ff3b4a),
+            FB(0xd31c0409dacf3efd, 0xc564284826cb41a1),
+            FB(0xfe8ebdefddce44e7, 0x56cdeed48ae5bc5e),
+            FB(0x4d05d9b997410f84, 0xeef05afda66ce860),
+            FB(0x55f68d0f588b534f, 0x24ab9da2a7f9e4ac),
+            FB(0xfb3ec639c77ca392, 0x5d53796920f8ca6e),
+            FB(0x1f5001f43ea27ea1, 0x274db8609d7bd071),
+            FB(0x2cf7318071065af0, 0x7df1113d02e0be90),
+            FB(0xed75af5c932108be, 0xeb8a937799f73f52),
+            FB(0x996c937dad63d37f, 0xd7bd6892523f11ff),
+            FB(0x6740f8904dc61663, 0xf952e88f32e387fe),
+            FB(0xf2f77e4466df92ba, 0xce6b9e7b46e5fc26),
+            FB(0x383a21b0c7a880f1, 0x91734b17ee2994e7),
+            FB(0xb8ccba0ab78dae0a, 0x6f584bf12af982ae),
+            FB(0xf9bc30ddd13e3ecc, 0x06fa27cb9b67208c),
+            FB(0x5456fb288e74fa09, 0x753ce34fefbbda0c),
+            FB(0xec8bd7d5bcfdaa0a, 0x167b6fe023acd452),
+            FB(0x2090a3567bd83852, 0xb4db324dcf04a75b),
+            FB(0x864d3526f7f1a8c7, 0xd96c0e41a81de831),
+            FB(0xd828799ffc3fb62d, 0xfe44e82290bb3228),
+            FB(0x5a33bb11d5ac0e5c, 0xf0927a7c015b74d9),
+            FB(0x9ba6bd662eb44c56, 0xb73ca062458b4fdf),
+            FB(0xbc79841da8c153c2, 0xeb0dd60e1606595d),
+            FB(0x33a4489c623afe53, 0x229ab04d988f8355),
+            FB(0x87a6844ee1dd9a2f, 0x5ae8e08e58ff4376),
+            FB(0x0908d976e58f1eb6, 0x60aad52c3710a303),
+            FB(0x08dd2dca31dbb39c, 0xf773235fd03e8ed3),
+            FB(0xdb882eba1641a989, 0x955cab2eade075e9),
+            FB(0x196eb36d8d272d54, 0xa7064280e2664e7a),
+            FB(0x5e10ab99d477a846, 0xa1bf04c8b6f4cd28),
+            FB(0x058bed602ffc5e69, 0xb10c8218977f6400),
+            FB(0xee986aa73f5f24be, 0x3326a79e0258e022),
+            FB(0x887a40cb3da5c5d1, 0x5f881e5cc46f485b),
+            FB(0xc65c83555293d33c, 0x2f9b0868c481c897),
+            FB(0xdb7f39685023826a, 0x035608e75d70d6d2),
+            FB(0x933506e940da6e2b, 0x045424b2aaee6cd8),
+            FB(0x9ef8c86d3f805d00, 0xcf27a307a110c3ce),
+            FB(0xad7add5ed1158879, 0xd2dda0959f3aa156),
+            FB(0x76bc4862448c125f, 0x97d4529e95c61116),
+            FB(0xbab12b140f158680, 0x0f311d5d4d28ecab),
+            FB(0x3949c5ee0fe30849, 0x612dda5a59ca9862),
+            FB(0xb2961e843df0f5a5, 0xa89e6f2934da930d),
+            FB(0x4df9a57b5dfe519e, 0x2fac722554835c60),
+            FB(0x4376625004b9d6a6, 0x3d3838e708be7cf9),
+            FB(0xd84decd4a78c26e6, 0xb8d0639a020f7d97),
+            FB(0x9e85525781079977, 0xd947742fa23a9551),
+            FB(0xc17025ca6398c708, 0x0e37119503cb8d6a),
+            FB(0xfdbd23a37b409c9a, 0xd22da8b0bedcfefc),
+            FB(0xc1aebda865f24be9, 0xe448f2b14b5a3813),
+            FB(0x4ff5c9db097584c0, 0xccd1ae12ebf973fe),
+            FB(0x4ebcb7aa1a333fe6, 0x45f0e1e2d493edb0),
+            FB(0x707ce8f52bdd0f3e, 0x44b2474253585cf8),
+            FB(0x67bada0d95012c05, 0xc991b2623cec6e77),
+            FB(0x769c83bee51b8235, 0x472fd354ba259058),
+            FB(0xddb3c153e5efe98b, 0x47ea760efb6bd511),
+            FB(0x986f8388d6fb84d3, 0x0666dd374813fe5b),
+            FB(0x562aba0d9a32283d, 0xd42a4504c56ac572),
+            FB(0x544a776684540e1a, 0x4cc635d5d649fa2b),
+            FB(0xf75625a6dc81d3e2, 0x119fe5df56739be9),
+            FB(0xbcf507471bc6c4ce, 0x42fb0530777c7631),
+            FB(0x08cc512e07f24303, 0xe04fb6ea7c24e071),
+            FB(0x6b7097acb5a5aca2, 0xb584497a77552ade),
+            FB(0xb8ab3071f1b19e13, 0x1fee3d94f3562632),
+            FB(0xcd1b92266e579c56, 0x2ecd9b8b0bd81790),
+            FB(0x101713d996e34257, 0xe053dcbe4de4815b),
+            FB(0x4258d6fec1802c66, 0x7d87c48ae8659e76),
+            FB(0x62aa13ff627d6a82, 0x118457c0b81fdbef),
+            FB(0xe05c57690b20b61b, 0x89d8d936077148a3),
+            FB(0xa30cf1fe5456127e, 0xd3467e982702b02b),
+            FB(0x32e39edd60197f5e, 0x85ec7dbadc281836),
+            FB(0x728ba1858e97310b, 0x704e7fcf8b9fce8b),
+            FB(0xe02ee152c320a834, 0x6f0f1550aee95244),
+            FB(0xde20e87d8d9cc1fa, 0x6db3084a312b2300),
+            FB(0x2ca938701c84484e, 0xfb3ab60152fa300a),
+            FB(0x190c54d3f8a67136, 0x99d69ba8a8c4a207),
+            FB(0x80076adf430e7ff0, 0x3b588beb04d2e402),
+            FB(0x2a6f1b23709a4bda, 0x9c4b70a68b77ced3),
+            FB(0xcd0f32818f800621, 0x79ed3b5e896db3c3),
+            FB(0x1597c6aa4eac4cf8, 0xa33ff3ac61f797eb),
+            FB(0xa0d8e0162c42b6f0, 0xa67a1a36cb812f15),
+            FB(0xad889d56185f1c8d, 0x1543fa596b3ac244),
+            FB(0x0afdc3f80402fc0c, 0xf74c49abab4191fe),
+            FB(0xb79298fa2cf107f3, 0xb7dcad7a7ce45208),
+            FB(0x3ca7a8cfba7dc173, 0x15fa5d0526b7af8d),
+            FB(0xa97c79d3fa7bfb14, 0x958bae86c9372b47),
+            FB(0xd98825e497b8175a, 0xd28d342c07f8c284),
+            FB(0xa74cb49a332bd6b4, 0x25b30b43c8e8c6f5),
+            FB(0x45c7e3a90175fc6a, 0xc4e21d5fdb5d6d2a),
+            FB(0x27768e15237026ad, 0x3f3c57ea4de093c6),
+            FB(0x4bfd3be08ed3cbeb, 0xb9a99399cd0b5d21),
+            FB(0xed2e938dd8b66b2b, 0x07b8977b6883f9fb),
+            FB(0xe86c738b23da664f, 0x3852a940e333b811),
+            FB(0x0fc9a610f7a38a11, 0x0c16fd98733d335c),
+            FB(0x8c8d030638e9b64d, 0x4c5434add0ec1378),
+            FB(0x4a6c9b17de89625e, 0xf0ab6dc7815875e8),
+            FB(0x63dd53974d35b9bd, 0xbb4d936e876625df),
+            FB(0x4e385193db1dd01a, 0xd1c736efc0986bb5),
+            FB(0x3cb55a960592e7a6, 0xb311843bfba17d81),
+            FB(0x0ed5f7ac565636a9, 0x9de756b7c268ed41),
+            FB(0x9ed3a57103540592, 0x8a91032194ec3391),
+            FB(0x24985f2574e4a7c8, 0xf86b5784bd9c00f3),
+            FB(0x0a246091cc166ef0, 0x1398a823760dec72),
+            FB(0x96d576a84080d34a, 0x164457cb3a707783),
+            FB(0x02cf154dc82cce82, 0xdb442033ac356df8),
+            FB(0x89197641703f9939, 0x0c400e82292caca5),
+            FB(0x8a8369d2798c9428, 0xa864e3979fd1bd5b),
+            FB(0x3ddaeddd754792da, 0x234e819fe92b66dd),
+            FB(0x2ea2f504c3fe4354, 0xa5eb5742d9d0e44c),
+            FB(0xd6e749cbbd727a1c, 0x3a675598baf788f3),
+            FB(0x353b611f7dc3cb05, 0x9cdb837f919fadbc),
+            FB(0xb62ed6ac786a685f, 0x5d0678564082e649),
+            FB(0xbf708736116e6eb8, 0x2dfc2a946ac5ac82),
+            FB(0x7fac03ee2f6d0281, 0xb3fb5e6df2c90f7a),
+            FB(0x8b455040bb2ab1ec, 0x7b4f9c7ef20ec22f),
+            FB(0x156ecf4f61308057, 0x6ea51633a9eee700),
+            FB(0x53a044a94cfc4ce2, 0xb2c887fa420356b3),
+            FB(0xf6b43dcf0e6af11f, 0x8f121e3ac824a0a4),
+            FB(0x7f723a3a25c449b7, 0xccd6bca00a637316),
+            FB(0x97ae0be63a5e4b49, 0x01e530c5223fc1e6),
+            FB(0x1be202c0afd0f629, 0x5d90eefcf2c952ff),
+            FB(0x2f7452547c02ec17, 0x1d600a091272c1d2),
+            FB(0x30bfd1e438b224d4, 0x20fef01e4c5e5a7c),
+        },
+        // window 7: g_c_hi^(j * 2^56)
+        {
+            FB(0x0000000000000000, 0x0000000000000001),
+            FB(0xfec0c3d51bb5222d, 0x694a2a027c05ea79),
+            FB(0x14c4a06db6f63ff3, 0xb12853e44a5a3527),
+            FB(0x1c7eee2e23a3fc16, 0x6539edc79ebe865e),
+            FB(0xca58bc13cd0f1104, 0x4103302ab5112d8e),
+            FB(0x18dffc372f47a026, 0x4e01c2a12826f125),
+            FB(0xbaabc5c6d3ff67bb, 0x5fec9be442a49c38),
+            FB(0x91aa2a9a83d43b00, 0x8cd7c700b8259902),
+            FB(0x83d5d6e677b081f6, 0xdc262a2a83d65c7b),
+            FB(0x99e03d220b97333f, 0x48ee3f2e47b2b0f0),
+            FB(0xb6bd1c0152b6d5e8, 0x33637edc8903127d),
+            FB(0x710d552c67f81f4a, 0xa305602b2a483297),
+            FB(0x69aaab22f99bee55, 0x25b4443127986c72),
+            FB(0xbb6d992c00ec2f1d, 0x6f403d0e6e344417),
+            FB(0x07f4aecb6fe864fd, 0x87f23b63f91a1063),
+            FB(0xc60dac6f6c749aae, 0x99b8ebfc632d6631),
+            FB(0x93e23bca3903a222, 0xa1cd0a35d1fc244e),
+            FB(0xca590f96d85df518, 0xc3d103380e84a9df),
+            FB(0x762cf856b7601a48, 0x336f08eddc99f54c),
+            FB(0x192a7e68c6f70b71, 0x93c5194f7b9ca26a),
+            FB(0x544a6632bbe451df, 0xb57e51403ed889f8),
+            FB(0x6d580845696ddf1c, 0x83d445161023adcb),
+            FB(0xaf82292eebf531ff, 0x62841a80a92717ff),
+            FB(0xd8c63c4f2294ba29, 0x5f11f0f68f0e8a5a),
+            FB(0x4975baefef491b36, 0x0e73253093f4efc5),
+            FB(0xc565f2422a78c270, 0xcaa10439701bf2f3),
+            FB(0x6c045516631435e4, 0x147f80a2273bbe4b),
+            FB(0xae88bee8520a5162, 0x101daa2c16390e00),
+            FB(0x4ad57657f2c08754, 0x12418c8e655b1632),
+            FB(0xb017b52548454bb6, 0xe5d66a8f4fa956a4),
+            FB(0xfb2d6c54a1ff1271, 0x51bfe70070ebe6f2),
+            FB(0x21ec23a31322d519, 0x08d35d163c4d4ff1),
+            FB(0x01b1fe4fb83696cf, 0xeb4657e8da0e1e2f),
+            FB(0xf26595fee2f57968, 0xc8894e9930648d2d),
+            FB(0xc3d187462b0f4805, 0x169c9e0c67b6e3ca),
+            FB(0x4b4a7072f6ba0740, 0xbdf741d055febea3),
+            FB(0xe46b21ce0a88a91e, 0x00b12d41f1c544a6),
+            FB(0xc8fd610e9b1eeabe, 0x55b695c67af20cd2),
+            FB(0xe7406fc7c1e75dbc, 0xaf0260bb6755ffc3),
+            FB(0x5f8a00a0545475e6, 0xe72bcc8d6f966d3e),
+            FB(0xba694682776f893f, 0x7d24f538b7ef4d53),
+            FB(0x8aa85ec4ab7cabb0, 0x175e4b746e3ca654),
+            FB(0x053a87d031d979e9, 0x4c4d411b587afbc3),
+            FB(0xa18c875078544938, 0xace31443f90d732e),
+            FB(0xe30e820e3c017787, 0xcb3127e09ab94417),
+            FB(0x66d39e2a8b75271b, 0x4051ca2c0c3adf68),
+            FB(0x07bcbb6fe7b80e3d, 0x5e684f07389a385c),
+            FB(0x89697fb660d0895b, 0x74fa0613c72dc886),
+            FB(0x5119f6d17ce68200, 0xc6260457f00cc545),
+            FB(0xa82a381e2412c197, 0xca9edc8e2ead6071),
+            FB(0xe8b920dd2904775f, 0x2ad6cbace712aa5a),
+            FB(0x67642f131ff2573b, 0x9032cb19a4163bca),
+            FB(0x44a01d2dbff7c962, 0x6a8e8a37d688b103),
+            FB(0xdf872bcbdf016926, 0x168cc614a847b343),
+            FB(0xf68de0b234c38998, 0xf4082695f7d97f75),
+            FB(0xeb1514db1b238d57, 0x4fe03cb9ce7d79f8),
+            FB(0x52f12ffca134bd94, 0x3d24a164cbf7fe4c),
+            FB(0x1aaaad7e5c7cf9b2, 0x3f2e3f69818f75bb),
+            FB(0x0f11dcdc47b154aa, 0x419d3cbe426c0415),
+            FB(0x7c6d5bdbd5a4ebb2, 0x1dc485918d7444db),
+            FB(0x1958706811adff53, 0xc9ac546ed102abd2),
+            FB(0x703f84680a5bd5ea, 0xfb6c557ae34c82d5),
+            FB(0x1cecd4b70fe9df8f, 0x80c90e642fa2f248),
+            FB(0x357a82abb284d740, 0x1baf919433d11bd3),
+            FB(0x54e14bb811b10f48, 0x2b8691194c119f7e),
+            FB(0x855765ee838d4ce7, 0x4c3e4312093b6b20),
+            FB(0x795624975f8841c6, 0xab3737ed8a1c5cc0),
+            FB(0xfae5ef4d9edb7efe, 0xf5159872734f9aa7),
+            FB(0xb3a676f68bb77a3e, 0x2b4e6e3705c54cec),
+            FB(0xaeb8bb65047f4e4b, 0x1001d45ad0b7b447),
+            FB(0x160206c3fb0bb837, 0x305e2d884fb7303d),
+            FB(0x7b77a21dfdfbad61, 0x400632778092242e),
+            FB(0xa47a0a5818ff8bad, 0x76fcb1f2ed57fde9),
+            FB(0x9e8736943b8289cb, 0x39b0f1ae9552da0b),
+            FB(0x80fa47292d967b99, 0x711ff9838faf35f7),
+            FB(0x3a0c2a7560f00fea, 0x5cf2b9f4ebb6eaa6),
+            FB(0xe2b6700e5302ff87, 0xa4b9b7f28b4137e4),
+            FB(0x17339e3f4d74c4d1, 0x46aa98c3a1740ea6),
+            FB(0x881fe79950739c59, 0xeb2dbe6ef78da700),
+            FB(0x29cdf1426dc5f1c6, 0x39712cac3f3496a2),
+            FB(0x6d87495f2f5cc756, 0xa4f4135ff114b047),
+            FB(0x3cf4d287343e2d08, 0xf958b53177d28af4),
+            FB(0xe2eaec9cccc0ad43, 0xeb05c7c3bb6c5a77),
+            FB(0x122eca9e15f08857, 0x3fd8187ea40bc5e2),
+            FB(0x18a5a8acdac33647, 0x8aee03099f29dd42),
+            FB(0x5515ada934e6fcee, 0xb606852b693d5c72),
+            FB(0x98f6bd94cbf3e70f, 0x9f89ff294440affd),
+            FB(0xea07121236bcacc2, 0x30be6b6e61942e9a),
+            FB(0xfede2e8cc6097fae, 0xf3f445ccf1dadeaf),
+            FB(0xb4568ddece304294, 0x2c4b4e5baabc5700),
+            FB(0x764524bb3cea3bad, 0xe301e6b147beb52d),
+            FB(0x6f81281c3f189dc7, 0x8c2717e197ba9d74),
+            FB(0x1b9c66d368044715, 0xa3883b842eeea367),
+            FB(0x1a8b13abd5cc1a00, 0xf7e2ec2545b5f535),
+            FB(0xf45d1809c01c5063, 0x3c3c3370b10f8428),
+            FB(0x8c4b190eb1698edd, 0x28c58fbbc83069aa),
+            FB(0xa793a27821552698, 0x979ba61d920d1429),
+            FB(0xd32799cccc8de76f, 0xbe7f8d96ee8e2c31),
+            FB(0xad867e8aeb90ecfa, 0x1024c164a4a64983),
+            FB(0x7d8c7a79651ffd62, 0x4828038d27bfbf44),
+            FB(0x89a72b514c6c5a65, 0x6952097ea5a7d83e),
+            FB(0x71b192014d002d57, 0x126f7e9b9665c061),
+            FB(0x27e16176676e84da, 0xe8102800f8aced29),
+            FB(0x107fb448ea8d358e, 0x18935397a977a20f),
+            FB(0x6c179c54ee713001, 0x21146182d44c6a21),
+            FB(0x1e0468618e75d911, 0x2a4d22c60782c362),
+            FB(0x1d1e8ab96f669262, 0x586b109808401236),
+            FB(0xd08921cecd8dc18c, 0xfcffd855c17fc989),
+            FB(0x745de95ca837180f, 0xc64ce3fbf4336680),
+            FB(0xf918b61c2c1bc61f, 0x051bfc774fa87e0a),
+            FB(0x9f0edbf78a09511a, 0xf40d0bebfc7ebdfa),
+            FB(0x0b8d2412d17cca2e, 0x5eb1b83394671dee),
+            FB(0xf0662f9573011683, 0x8cc0c64627425b18),
+            FB(0xac1d97f1f6a696ee, 0xad8ae345ba2d5fc9),
+            FB(0xa1aafbabf068d4e5, 0x9ebb82ce1f751c59),
+            FB(0xb12e17e80ea983b5, 0xaeb853878a11c16d),
+            FB(0x3b2ac6ff1bc95bec, 0x6acc4fdfff43fecd),
+            FB(0xfec52dac65fc0529, 0x4db9c0282acec162),
+            FB(0xc3eb152f94635573, 0x7f85c14b9f680d6f),
+            FB(0x0be6adc9276759ce, 0x717356fa44f0de70),
+            FB(0xf60e929afa1a5994, 0xd6a5f5184466a49f),
+            FB(0xcbb76dc67ba236a7, 0xce84774d10505e6a),
+            FB(0xbe47a45ad96b5884, 0x77d1c4227fd8dbfb),
+            FB(0x0aca37af7383a166, 0xc1ccfd9a50ab05ec),
+            FB(0xee9bd5d83f0745fb, 0x2f55c96a490efb6b),
+            FB(0x9ae96ed75527cd95, 0xebaf85ff21ffe96f),
+            FB(0x92b88ca8833ebe68, 0x5c3899583ca6200b),
+            FB(0xc0b1a5889b331d4a, 0x04adc0b1edf4bc06),
+            FB(0xfb1eec9b12797b81, 0x97f45a866a7640ac),
+            FB(0x7e90065d7404232d, 0x4c8222abbe79dcdc),
+            FB(0xd8aff8b574d98689, 0xc2fbec7a4ddeb28c),
+            FB(0x350b9cc9ac1d9e36, 0x3a2a0602b14b0a07),
+            FB(0x8e0af87b114419b2, 0x9c4ee09861feef5a),
+            FB(0x60661d15d74563b6, 0xe91ad0681cda04cb),
+            FB(0x5de6a5cdc6634c12, 0x7980040481c351e8),
+            FB(0xba65f8cd6a837591, 0x2553b32f6b73b7e8),
+            FB(0x5dfdc632f5132458, 0xe36901f0d88ef595),
+            FB(0x3d30d9c21d008c09, 0xad0e7cd4905f6baf),
+            FB(0xf68f7ae2294175b3, 0x597a85361eb45227),
+            FB(0xde2b9b4be6199b32, 0xcf2dbd833d4ea81e),
+            FB(0x886c13480e14f2f0, 0x180e666d7fc294ba),
+            FB(0xcf9b592987a77871, 0xbc6eee9850402c69),
+            FB(0xd851e1dcdb18bb09, 0x421c497cf12d6de5),
+            FB(0xcdf9ef2865f658ca, 0x383bd1afd883e45d),
+            FB(0xc16e9d8c66d583c4, 0xf2ba111fb629b01f),
+            FB(0x7959fa93e178bb7e, 0x31772eadf6328cc3),
+            FB(0x69cc8fe9c44c0b26, 0xf96bd339b02a8379),
+            FB(0x363fa04321aca600, 0x63730382a4ecb0be),
+            FB(0xd52a09812fa87d40, 0x75430933cd6b2335),
+            FB(0x1d8999e7152b3201, 0xf59819c6eb5ebeb9),
+            FB(0xa98c7cb67a97b6ed, 0x386e6e147f44cac6),
+            FB(0x8ff7d5915cfc24d9, 0x53ea8c63aef4b20b),
+            FB(0xea2f1427ae157ea0, 0xb5de1236051f8baa),
+            FB(0x4b9df6eb871a5782, 0x534167f58ef6b10c),
+            FB(0x9dfdddfe2deee026, 0x1d3cf649b80d7393),
+            FB(0x318e24507af64c61, 0xd24300ce4f7af8cd),
+            FB(0xb585a851e39e721b, 0xa21fa9eb2aadc620),
+            FB(0x8c4159368b82f448, 0x81ce5ca1eb12d67f),
+            FB(0x382f8c1d2fdf3646, 0x404bbdcc6abaff66),
+            FB(0xa2032dbad5e15875, 0xdab2d0c56f8a0e8a),
+            FB(0x01069ff3504acd7c, 0x6222df89ffe3e84f),
+            FB(0x416598cc38de86a2, 0x064d1b73be65f67f),
+            FB(0xe7da3219702ccfe8, 0x8667e1aa757375de),
+            FB(0x0bd1d606af57fb84, 0x49ee33985bfaf5a0),
+            FB(0xfa728fe6d5843e9c, 0xdcdca473e47b72df),
+            FB(0xfe3bbb9d19daf520, 0x4672985aac6a7bb0),
+            FB(0x804b66c592bd79f8, 0xcbcc2b64b1d9a9ef),
+            FB(0x92ee83aed243eb65, 0xc7f6285db3a8e786),
+            FB(0xe6a78080fde6f5d8, 0x55a0b6d8c0356aef),
+            FB(0x38ea81038b40067d, 0x3df84df58170f0d8),
+            FB(0xbae38fc0b505f900, 0x871aa31613cb9690),
+            FB(0x3b3b0435f6538b82, 0x7547c3887b3d3032),
+            FB(0x27be610e27434b18, 0x836039b0e2be6e1d),
+            FB(0xb7187a28b06c62e4, 0x7de48de4a6db7fb9),
+            FB(0x8adc4fbf9159914a, 0x854e3383f1cde609),
+            FB(0x1191cf5d17c2703a, 0xdea8f9b1b170e152),
+            FB(0x558049be279cb9c9, 0xef6d7009915ca6a8),
+            FB(0x27403347ae398bc1, 0x1c100982bee3f586),
+            FB(0x5728ed08f94a0dc0, 0xdfeade5863285e19),
+            FB(0xbead416eb60cc1e2, 0x526c8145dd8f5eb2),
+            FB(0xb56178f440473d58, 0xa28eca8afd69f450),
+            FB(0xc51b64d8359edb9b, 0x06d3871cecfc2d01),
+            FB(0x075ac4903cd5fab3, 0xf13ee3a52f4faacd),
+            FB(0x0b197411b01bd80f, 0xfe322ff01c750e87),
+            FB(0xe07f2efa63007581, 0x49945c2c3eee9be2),
+            FB(0x143bd864bdfc4df8, 0xfb139180ae99a6c2),
+            FB(0xf1e8b75fd1e8fb63, 0x2fcfdca1f1cd0511),
+            FB(0x883f9e34d4db22da, 0xca6ad2bd59f0325a),
+            FB(0x2628db67a3c5346e, 0xf501aeedb71a7f8a),
+            FB(0x7f2115c9578a0a36, 0xa03a3ea1fea03f39),
+            FB(0xedf8034ae6126eca, 0x0bcd4866ffc44a14),
+            FB(0xa6f398d1aa5a4a94, 0xdce26165019d51ab),
+            FB(0x97df04fd9a02cb93, 0x5d8bffa4175d73e8),
+            FB(0xadd052e7231849f0, 0xd9ff762f99d8153e),
+            FB(0x70cd039f263fd88d, 0xcdc5a948a2b15675),
+            FB(0xb8ce4a7a448c68ee, 0xed668a5e1843ea47),
+            FB(0xf416ce76908cf7e7, 0xcb6a033f95da59b0),
+            FB(0x89e415c21c906abc, 0x53984a492e2b319e),
+            FB(0xd256edfac8d38a1c, 0x60e2e95547687b3a),
+            FB(0xec90580c9eb1c3f7, 0x448a6e7605e80fd8),
+            FB(0xf525c7ed3f12e2db, 0x1dab01ad859671c4),
+            FB(0xad4e1ba014489f0f, 0x4a226e9d98bdce63),
+            FB(0xeaa04ff3504841ca, 0x18231413653fecdc),
+            FB(0x5e3ba0383287f07c, 0xb8eba8c2f01a5200),
+            FB(0x4280ad8d68cde166, 0x33a103dd9c081193),
+            FB(0xc113cf5a83ff822f, 0x030bc799c0451849),
+            FB(0x864a810d427d10fe, 0xcbbcfc20d7d2ebf9),
+            FB(0xfa2ee4916c7eace7, 0x638e9c0f25d6a625),
+            FB(0x41b18cda7ab9bf5f, 0xd6b6fbd58f4401b0),
+            FB(0x2a492cf9fbcafefd, 0x678e951336473018),
+            FB(0xa8e8182b49ce3cb2, 0xebb3a3da46429383),
+            FB(0x4b3809e02bc51e65, 0x4e4f1b15726f5a33),
+            FB(0xbf77b8c8e2ff3b0d, 0x4761764d44126b08),
+            FB(0x63a1a3aa819cc9aa, 0x89938ad64ee5c55a),
+            FB(0x6271b4104dee8a94, 0xc917fc4be0e7bdae),
+            FB(0xccca7298c2aefd8e, 0xc36a3be818062f0e),
+            FB(0xb36cce4cd94a8bd6, 0xa8d294eeb2d46e1d),
+            FB(0x8264be44b6d4cf24, 0xe4b40f6bb2654408),
+            FB(0x0a56a7a6043cbba7, 0x25e5e032af38b93e),
+            FB(0x161dec644962d9bc, 0x061531a1e796a9bc),
+            FB(0x393b2bd41435758f, 0xb68c341bb2d6e1ff),
+            FB(0xb2eaa7bcb85b6a4d, 0x5552d0af60dbecf9),
+            FB(0x322eac3451308030, 0x769dd68c928f63f8),
+            FB(0x22218cf06337e33d, 0xf88893aaf609298c),
+            FB(0x6b5a366e671e5fe9, 0xed8e10839c08d68a),
+            FB(0x5bd6f814e930de8f, 0x9726767999a656c2),
+            FB(0xb1e1ee5219c53bbd, 0x640bd21c5c12c684),
+            FB(0x85364ad5db7a1c69, 0x848ea407096599d1),
+            FB(0x9df0bab2487caf24, 0x2a5f58f83e0ba4df),
+            FB(0x5b75cae2b2e6a257, 0x87ca31a66d97db84),
+            FB(0x1fd172ec9cc5cdd5, 0x6bcbfc6792b956cf),
+            FB(0x559af02407e16ee5, 0xff98623775eeec52),
+            FB(0xac1d6fa5aa12517e, 0xf127814a8124d4ef),
+            FB(0xc344a0ff9446eeb3, 0x7ffa9774a16e8bb9),
+            FB(0x10d4fdb46514f1fa, 0x609852e458f43c12),
+            FB(0x771de39d9337e913, 0xc5794aa8be1e94f7),
+            FB(0xa7e5cf4adff4274f, 0x0e2f7ad3fface991),
+            FB(0x22732725d6231be9, 0x05e7d472b761c72a),
+            FB(0x3671b34ae40ac401, 0x06f133e3873a8eac),
+            FB(0x2daf7a59c48bdf51, 0xe22fc1232a2658ed),
+            FB(0x70786f9c102c65b7, 0x18ccb0c092761b74),
+            FB(0x4b0b4d812785ac4d, 0x88481710be9a7d99),
+            FB(0xc32c11f1500baa37, 0xc978cf1e801bd6f0),
+            FB(0xdbbd5304c6cef58d, 0x19f2c3cc64125880),
+            FB(0x65b12bc98468d0f1, 0x03181e1387a48c5c),
+            FB(0x8b9b15b44bd72510, 0x452972a0beec1a0e),
+            FB(0x73f4c38ec499b665, 0xf8ba86fddc9c323c),
+            FB(0x70b9327aad58c623, 0x163f3d640a356408),
+            FB(0x83d875636f9f0286, 0xa06a0ab72d99094f),
+            FB(0xfd1cae4d0fda4b11, 0x0866a9965f008cac),
+            FB(0x30b2c918079468b6, 0xfbf44397cd574bc5),
+            FB(0x12cb0efdbe777aa7, 0xa50a0d96c778bc3c),
+            FB(0x546f7fa1a8d2eca1, 0xc7c9f49b74a65de2),
+            FB(0x6787687b2f5331b9, 0x625e2f7bbc3a2c61),
+            FB(0xb0331ff584d6a4e0, 0x3008cc8beb6f4797),
+            FB(0x256071b9c9d31489, 0xe61df8f218e43b11),
+        },
+    },
+};
+
+#undef FB
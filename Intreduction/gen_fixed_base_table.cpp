@@ -0,0 +1,43 @@
+#include <cstdint>
+#include <cstdio>
+
+#include "host/fixed_base.hpp"
+
+// Emits fixed_base_table.h, the ROM used by the fixed-base unit in
+// witness_to_constbase.cpp:
+//
+//   g++ -O2 -mpclmul -I. gen_fixed_base_table.cpp host/fixed_base.cpp -o gen_fixed_base_table
+//   ./gen_fixed_base_table > fixed_base_table.h
+
+using ghash_host::FixedBaseTable;
+using ghash_host::u128_t;
+
+static void emit_table(const char* tag, const FixedBaseTable& t) {
+    std::printf("    // %s\n    {\n", tag);
+    for (int k = 0; k < ghash_host::FB_WINDOWS; k++) {
+        std::printf("        // window %d: %s^(j * 2^%d)\n        {\n", k, tag, 8 * k);
+        for (int j = 0; j < ghash_host::FB_WINDOW_SIZE; j++) {
+            u128_t x = t.entry(k, j);
+            std::printf("            FB(0x%016llx, 0x%016llx),\n",
+                        (unsigned long long)ghash_host::hi64(x),
+                        (unsigned long long)ghash_host::lo64(x));
+        }
+        std::printf("        },\n");
+    }
+    std::printf("    },\n");
+}
+
+int main() {
+    std::printf("#pragma once\n\n");
+    std::printf("// Generated by gen_fixed_base_table.cpp, do not edit.\n");
+    std::printf("// FB_TABLE[base][k][j] = base^(j * 2^(8k)), base 0 = g, base 1 = g_c_hi = g^(2^64)\n\n");
+    std::printf("static const int FB_BASES       = 2;\n");
+    std::printf("static const int FB_WINDOWS     = %d;\n", ghash_host::FB_WINDOWS);
+    std::printf("static const int FB_WINDOW_SIZE = %d;\n\n", ghash_host::FB_WINDOW_SIZE);
+    std::printf("#define FB(hi, lo) ((((u128)hi##ull) << 64) | (u128)lo##ull)\n\n");
+    std::printf("static const u128 FB_TABLE[FB_BASES][FB_WINDOWS][FB_WINDOW_SIZE] = {\n");
+    emit_table("g", ghash_host::fixed_base_g());
+    emit_table("g_c_hi", ghash_host::fixed_base_g_c_hi());
+    std::printf("};\n\n#undef FB\n");
+    return 0;
+}
@@ -0,0 +1,155 @@
+#pragma once
+
+#include <ap_int.h>
+
+using u64  = ap_uint<64>;
+using u128 = ap_uint<128>;
+
+// ============================================================
+// GF(2^128) GHASH arithmetic
+// modulus: x^128 + x^7 + x^2 + x + 1
+//
+// Shared by the HLS kernels (witness_to_constbase.cpp, sumcheck_round.cpp,
+// mle_eval_stream.cpp, additive_ntt.cpp). Under the native C-sim shim
+// (HLS_NATIVE_SIM, see hls_native/) the bit reversal and carry-less
+// multiply run as host instructions.
+// ============================================================
+
+static u64 reverse_bits_64(u64 x) {
+#pragma HLS INLINE
+#if HLS_NATIVE_SIM
+    return hls_native::bit_reverse64(x.to_uint64());
+#else
+    u64 r = 0;
+    for (int i = 0; i < 64; i++) {
+#pragma HLS UNROLL
+        r[63 - i] = x[i];
+    }
+    return r;
+#endif
+}
+
+
+static u128 reverse_bits_each_64(u128 x) {
+#pragma HLS INLINE
+    u64 lo = (u64)x;
+    u64 hi = (u64)(x >> 64);
+
+    u64 lo_r = reverse_bits_64(lo);
+    u64 hi_r = reverse_bits_64(hi);
+
+    return (u128(hi_r) << 64) | u128(lo_r);
+}
+
+static u128 shr_each_64(u128 x, unsigned s) {
+#pragma HLS INLINE
+    u64 lo = (u64)x;
+    u64 hi = (u64)(x >> 64);
+
+    lo >>= s;
+    hi >>= s;
+
+    return (u128(hi) << 64) | u128(lo);
+}
+
+//multiplication in GF(2), so no carry chain
+static u128 clmul64(u64 a, u64 b) {
+#pragma HLS INLINE
+#if HLS_NATIVE_SIM
+    return hls_native::clmul64(a.to_uint64(), b.to_uint64());
+#else
+    u128 acc = 0;
+    for (int i = 0; i < 64; i++) {
+#pragma HLS UNROLL factor=1
+        if (b[i]) {
+            acc ^= (u128(a) << i);
+        }
+    }
+    return acc;
+#endif
+}
+
+static u128 reduce_ghash_256_by_64(u64 v0, u64 v1, u64 v2, u64 v3) {
+#pragma HLS INLINE
+    v1 ^= v3 ^ (v3 << 1) ^ (v3 << 2) ^ (v3 << 7);
+    v2 ^= (v3 >> 63) ^ (v3 >> 62) ^ (v3 >> 57);
+    v0 ^= v2 ^ (v2 << 1) ^ (v2 << 2) ^ (v2 << 7);
+    v1 ^= (v2 >> 63) ^ (v2 >> 62) ^ (v2 >> 57);
+    return (u128(v1) << 64) | u128(v0);
+}
+
+static u128 ghash_mul(u128 x, u128 y) {
+#pragma HLS INLINE
+    u64 x1 = (u64)(x >> 64);
+    u64 x0 = (u64)(x);
+    u64 y1 = (u64)(y >> 64);
+    u64 y0 = (u64)(y);
+
+    u64 x0r = reverse_bits_64(x0);
+    u64 x1r = reverse_bits_64(x1);
+    u64 x2  = x0 ^ x1;
+
+    u64 y0r = reverse_bits_64(y0);
+    u64 y1r = reverse_bits_64(y1);
+    u64 y2  = y0 ^ y1;
+
+    u128 z0  = clmul64(y0,  x0);
+    u128 z1  = clmul64(y1,  x1);
+    u128 z2  = clmul64(y2,  x2);
+
+    u128 z0h = clmul64(y0r, x0r);
+    u128 z1h = clmul64(y1r, x1r);
+    u128 z2h = clmul64(y0r ^ y1r, x0r ^ x1r);
+
+    z2  ^= z0 ^ z1;
+    z2h ^= z0h ^ z1h;
+
+z0h = shr_each_64(reverse_bits_each_64(z0h), 1);
+z1h = shr_each_64(reverse_bits_each_64(z1h), 1);
+z2h = shr_each_64(reverse_bits_each_64(z2h), 1);
+
+    u64 v0 = (u64)(z0);
+    u64 v1 = (u64)(z0h) ^ (u64)(z2);
+    u64 v2 = (u64)(z1)  ^ (u64)(z2h);
+    u64 v3 = (u64)(z1h);
+
+    return reduce_ghash_256_by_64(v0, v1, v2, v3);
+}
+
+// 128 x 128 -> 256 carry-less product, not reduced (Karatsuba, 3 clmul64).
+// Sums of these can be XORed and reduced once (lazy reduction).
+static inline ap_uint<256> clmul128_wide(u128 x, u128 y) {
+#pragma HLS INLINE
+    u64 x0 = (u64)x, x1 = (u64)(x >> 64);
+    u64 y0 = (u64)y, y1 = (u64)(y >> 64);
+    u128 z0 = clmul64(x0, y0);
+    u128 z1 = clmul64(x1, y1);
+    u128 z2 = clmul64(x0 ^ x1, y0 ^ y1) ^ z0 ^ z1;
+
+    ap_uint<256> w = 0;
+    w.range(127, 0)   = z0;
+    w.range(255, 128) = z1;
+    w.range(191, 64)  = (u128)w.range(191, 64) ^ z2;
+    return w;
+}
+
+static inline u128 reduce_wide(ap_uint<256> w) {
+#pragma HLS INLINE
+    return reduce_ghash_256_by_64((u64)w.range(63, 0), (u64)w.range(127, 64),
+                                  (u64)w.range(191, 128), (u64)w.range(255, 192));
+}
+
+static inline u128 gf_add(u128 a, u128 b) {
+#pragma HLS INLINE
+    return a ^ b;
+}
+
+static inline u128 gf_square(u128 a) {
+#pragma HLS INLINE
+    return ghash_mul(a, a);
+}
+
+static inline u128 gf_one() {
+#pragma HLS INLINE
+    return (u128)1;
+}
@@ -0,0 +1,16 @@
+#pragma once
+
+#include "ap_int.h"
+
+// AXI4-Stream beat for the native C simulation, fields as in Vitis
+
+template <int D, int U, int TI, int TD>
+struct ap_axiu {
+    ap_uint<D> data;
+    ap_uint<(D + 7) / 8> keep;
+    ap_uint<(D + 7) / 8> strb;
+    ap_uint<U ? U : 1> user;
+    ap_uint<1> last;
+    ap_uint<TI ? TI : 1> id;
+    ap_uint<TD ? TD : 1> dest;
+};
@@ -0,0 +1,293 @@
+#pragma once
+
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+
+#include "hls_native.h"
+
+// ============================================================
+// Host-only ap_uint / ap_int for C simulation (HLS_NATIVE_SIM)
+//
+// Put this directory first on the include path, in place of the Vitis
+// headers, to simulate the kernels natively:
+//
+//   g++ -O2 -mpclmul -pthread -Ihls_native -I. <tb>.cpp <kernel>.cpp ...
+//
+// Only the subset the kernels use: unsigned arithmetic on up to 128 bits
+// in one unsigned __int128, wider values (ap_uint<256>) in 64-bit words,
+// bit / range access, concatenation. HLS_NATIVE_SIM switches the kernel
+// helpers with bit loops to the primitives in hls_native.h; build with
+// -DHLS_NATIVE_SIM=0 to simulate the loops themselves.
+// ============================================================
+
+#ifndef HLS_NATIVE_SIM
+#define HLS_NATIVE_SIM 1
+#endif
+
+template <int W> struct ap_uint;
+
+namespace hls_native {
+
+typedef unsigned __int128 u128_t;
+
+template <int A, int B> struct max_w { static const int value = A > B ? A : B; };
+
+template <class T>
+struct is_int : std::integral_constant<bool, std::is_integral<T>::value ||
+                                             std::is_same<T, u128_t>::value> {};
+
+// x < 0, only instantiated for signed T (no compare on bool / unsigned)
+template <class T> static inline bool is_negative(T x, std::true_type) { return x < 0; }
+template <class T> static inline bool is_negative(T, std::false_type) { return false; }
+
+// W <= 128 lives in one native 128-bit register, W > 128 in little-endian words.
+template <int W, bool WIDE = (W > 128)> struct store;
+
+template <int W> struct store<W, false> {
+    u128_t v;
+    static u128_t mask_of() {
+        return W >= 128 ? ~(u128_t)0 : ((((u128_t)1) << W) - 1);
+    }
+    void clear() { v = 0; }
+    void trim() { v &= mask_of(); }
+    u128_t low() const { return v; }
+    void assign_low(u128_t x, bool) { v = x & mask_of(); }
+    uint64_t word(int i) const { return i == 0 ? (uint64_t)v : i == 1 ? (uint64_t)(v >> 64) : 0; }
+    void set_word(int i, uint64_t x) {
+        if (i == 0) v = (v & ~(u128_t)~0ull) | x;
+        else if (i == 1) v = (v & (u128_t)~0ull) | ((u128_t)x << 64);
+    }
+};
+
+template <int W> struct store<W, true> {
+    static const int NW = (W + 63) / 64;
+    uint64_t w[NW];
+    void clear() { std::memset(w, 0, sizeof(w)); }
+    void trim() { if (W % 64) w[NW - 1] &= (uint64_t(1) << (W % 64)) - 1; }
+    uint64_t word(int i) const { return i < NW ? w[i] : 0; }
+    void set_word(int i, uint64_t x) { if (i < NW) w[i] = x; }
+    u128_t low() const { return ((u128_t)w[1] << 64) | w[0]; }
+    // the low 128 bits from x, the rest all ones when neg (sign extension)
+    void assign_low(u128_t x, bool neg) {
+        w[0] = (uint64_t)x;
+        w[1] = (uint64_t)(x >> 64);
+        for (int i = 2; i < NW; i++) w[i] = neg ? ~0ull : 0;
+        trim();
+    }
+};
+
+} // namespace hls_native
+
+template <int W>
+struct ap_uint : hls_native::store<W> {
+    typedef hls_native::store<W> S;
+    typedef hls_native::u128_t u128_t;
+    static const int NW = (W + 63) / 64;
+    static const bool WIDE = W > 128;
+
+    ap_uint() { S::clear(); }
+
+    template <class T, typename std::enable_if<hls_native::is_int<T>::value, int>::type = 0>
+    ap_uint(T x) { from_u128((u128_t)x, hls_native::is_negative(x, std::is_signed<T>())); }
+
+    template <int W2>
+    ap_uint(const ap_uint<W2>& o) {
+        if (!WIDE || !ap_uint<W2>::WIDE) {
+            S::assign_low(o.low128(), false);
+            return;
+        }
+        S::clear();
+        for (int i = 0; i < NW; i++) S::set_word(i, o.word(i));
+        S::trim();
+    }
+
+    void from_u128(u128_t x, bool neg) { S::assign_low(x, neg); }
+
+    uint64_t word(int i) const { return S::word(i); }
+    u128_t low128() const { return S::low(); }
+
+    uint64_t to_uint64() const { return word(0); }
+    unsigned to_uint() const { return (unsigned)word(0); }
+    int to_int() const { return (int)word(0); }
+    operator unsigned long long() const { return word(0); }
+
+    bool get_bit(int i) const {
+        if (!WIDE) return (low128() >> i) & 1;
+        return (word(i >> 6) >> (i & 63)) & 1;
+    }
+    void set_bit(int i, bool b) {
+        if (!WIDE) {
+            u128_t m = (u128_t)1 << i;
+            S::assign_low(b ? (low128() | m) : (low128() & ~m), false);
+            return;
+        }
+        uint64_t x = word(i >> 6);
+        uint64_t m = uint64_t(1) << (i & 63);
+        S::set_word(i >> 6, b ? (x | m) : (x & ~m));
+    }
+
+    struct bit_ref {
+        ap_uint* p; int i;
+        operator bool() const { return p->get_bit(i); }
+        bit_ref& operator=(bool b) { p->set_bit(i, b); return *this; }
+        bit_ref& operator=(const bit_ref& o) { p->set_bit(i, (bool)o); return *this; }
+        bool operator~() const { return !p->get_bit(i); }
+    };
+    bit_ref operator[](int i) { return bit_ref{this, i}; }
+    bool operator[](int i) const { return get_bit(i); }
+    bool test(int i) const { return get_bit(i); }
+
+    ap_uint get_range(int hi, int lo) const {
+        ap_uint r = *this >> lo;
+        int n = hi - lo + 1;
+        if (n < W) r = r & ((ap_uint(1) << n) - ap_uint(1));
+        return r;
+    }
+    void set_range(int hi, int lo, const ap_uint& x) {
+        int n = hi - lo + 1;
+        ap_uint m = n < W ? ((ap_uint(1) << n) - ap_uint(1)) : ~ap_uint(0);
+        *this = (*this & ~(m << lo)) | ((x & m) << lo);
+    }
+
+    struct range_ref {
+        ap_uint* p; int hi, lo;
+        ap_uint get() const { return p->get_range(hi, lo); }
+        template <int W2> operator ap_uint<W2>() const { return ap_uint<W2>(get()); }
+        operator unsigned long long() const { return get().word(0); }
+        template <int W2> range_ref& operator=(const ap_uint<W2>& x) { p->set_range(hi, lo, ap_uint(x)); return *this; }
+        template <class T, typename std::enable_if<hls_native::is_int<T>::value, int>::type = 0>
+        range_ref& operator=(T x) { p->set_range(hi, lo, ap_uint(x)); return *this; }
+        range_ref& operator=(const range_ref& o) { p->set_range(hi, lo, o.get()); return *this; }
+    };
+    range_ref range(int hi, int lo) { return range_ref{this, hi, lo}; }
+    ap_uint range(int hi, int lo) const { return get_range(hi, lo); }
+    range_ref operator()(int hi, int lo) { return range(hi, lo); }
+
+    // ---- shifts / bitwise ----
+    ap_uint operator<<(int s) const {
+        ap_uint r;
+        if (s >= W) return r;
+        if (!WIDE) { r.from_u128(low128() << s, false); return r; }
+        int ws = s >> 6, bs = s & 63;
+        for (int i = NW - 1; i >= 0; i--) {
+            uint64_t x = 0;
+            if (i - ws >= 0) x = word(i - ws) << bs;
+            if (bs && i - ws - 1 >= 0) x |= word(i - ws - 1) >> (64 - bs);
+            r.S::set_word(i, x);
+        }
+        r.S::trim();
+        return r;
+    }
+    ap_uint operator>>(int s) const {
+        ap_uint r;
+        if (s >= W) return r;
+        if (!WIDE) { r.from_u128(low128() >> s, false); return r; }
+        int ws = s >> 6, bs = s & 63;
+        for (int i = 0; i < NW; i++) {
+            uint64_t x = 0;
+            if (i + ws < NW) x = word(i + ws) >> bs;
+            if (bs && i + ws + 1 < NW) x |= word(i + ws + 1) << (64 - bs);
+            r.S::set_word(i, x);
+        }
+        return r;
+    }
+    ap_uint operator~() const {
+        ap_uint r;
+        if (!WIDE) { r.from_u128(~low128(), false); return r; }
+        for (int i = 0; i < NW; i++) r.S::set_word(i, ~word(i));
+        r.S::trim();
+        return r;
+    }
+    ap_uint operator-(const ap_uint& o) const {
+        ap_uint r;
+        if (!WIDE) { r.from_u128(low128() - o.low128(), false); return r; }
+        uint64_t borrow = 0;
+        for (int i = 0; i < NW; i++) {
+            u128_t d = (u128_t)word(i) - o.word(i) - borrow;
+            r.S::set_word(i, (uint64_t)d);
+            borrow = (uint64_t)(d >> 64) ? 1 : 0;
+        }
+        r.S::trim();
+        return r;
+    }
+    ap_uint operator+(const ap_uint& o) const {
+        ap_uint r;
+        if (!WIDE) { r.from_u128(low128() + o.low128(), false); return r; }
+        uint64_t carry = 0;
+        for (int i = 0; i < NW; i++) {
+            u128_t d = (u128_t)word(i) + o.word(i) + carry;
+            r.S::set_word(i, (uint64_t)d);
+            carry = (uint64_t)(d >> 64);
+        }
+        r.S::trim();
+        return r;
+    }
+
+    ap_uint& operator+=(const ap_uint& o) { return *this = *this + o; }
+    ap_uint& operator-=(const ap_uint& o) { return *this = *this - o; }
+    ap_uint& operator<<=(int s) { return *this = *this << s; }
+    ap_uint& operator>>=(int s) { return *this = *this >> s; }
+    ap_uint& operator++() { return *this = *this + ap_uint(1); }
+    ap_uint operator++(int) { ap_uint t = *this; ++*this; return t; }
+    ap_uint& operator--() { return *this = *this - ap_uint(1); }
+
+    bool operator!() const {
+        if (!WIDE) return low128() == 0;
+        for (int i = 0; i < NW; i++) if (word(i)) return false;
+        return true;
+    }
+};
+
+#define AP_SHIM_BITWISE(OP)                                                                   \
+template <int A, int B>                                                                       \
+inline ap_uint<hls_native::max_w<A, B>::value> operator OP(const ap_uint<A>& a, const ap_uint<B>& b) { \
+    const int M = hls_native::max_w<A, B>::value;                                             \
+    ap_uint<M> r;                                                                             \
+    if (M <= 128) { r.from_u128(a.low128() OP b.low128(), false); return r; }                \
+    for (int i = 0; i < ap_uint<M>::NW; i++) r.set_word(i, a.word(i) OP b.word(i));          \
+    return r;                                                                                 \
+}                                                                                             \
+template <int A, class T, typename std::enable_if<hls_native::is_int<T>::value, int>::type = 0> \
+inline ap_uint<A> operator OP(const ap_uint<A>& a, T b) { return a OP ap_uint<A>(b); }        \
+template <int A, class T, typename std::enable_if<hls_native::is_int<T>::value, int>::type = 0> \
+inline ap_uint<A> operator OP(T b, const ap_uint<A>& a) { return ap_uint<A>(b) OP a; }        \
+template <int A, int B>                                                                       \
+inline ap_uint<A>& operator OP##=(ap_uint<A>& a, const ap_uint<B>& b) { a = ap_uint<A>(a OP b); return a; } \
+template <int A, class T, typename std::enable_if<hls_native::is_int<T>::value, int>::type = 0> \
+inline ap_uint<A>& operator OP##=(ap_uint<A>& a, T b) { a = a OP ap_uint<A>(b); return a; }
+
+AP_SHIM_BITWISE(^)
+AP_SHIM_BITWISE(|)
+AP_SHIM_BITWISE(&)
+#undef AP_SHIM_BITWISE
+
+template <int A, int B>
+inline bool operator==(const ap_uint<A>& a, const ap_uint<B>& b) {
+    const int M = hls_native::max_w<A, B>::value;
+    if (M <= 128) return a.low128() == b.low128();
+    for (int i = 0; i < (M + 63) / 64; i++) if (a.word(i) != b.word(i)) return false;
+    return true;
+}
+template <int A, int B>
+inline bool operator!=(const ap_uint<A>& a, const ap_uint<B>& b) { return !(a == b); }
+template <int A, class T, typename std::enable_if<hls_native::is_int<T>::value, int>::type = 0>
+inline bool operator==(const ap_uint<A>& a, T b) { return a == ap_uint<A>(b); }
+template <int A, class T, typename std::enable_if<hls_native::is_int<T>::value, int>::type = 0>
+inline bool operator!=(const ap_uint<A>& a, T b) { return !(a == ap_uint<A>(b)); }
+template <int A, int B>
+inline bool operator<(const ap_uint<A>& a, const ap_uint<B>& b) {
+    const int M = hls_native::max_w<A, B>::value;
+    for (int i = (M + 63) / 64 - 1; i >= 0; i--)
+        if (a.word(i) != b.word(i)) return a.word(i) < b.word(i);
+    return false;
+}
+
+template <int A, int B>
+inline ap_uint<A + B> operator,(const ap_uint<A>& a, const ap_uint<B>& b) {
+    return (ap_uint<A + B>(a) << B) | ap_uint<A + B>(b);
+}
+
+template <int W> struct ap_int : ap_uint<W> {
+    using ap_uint<W>::ap_uint;
+};
@@ -0,0 +1,24 @@
+#pragma once
+
+#include <cstdint>
+
+#include "../host/ghash128.hpp"
+
+// ============================================================
+// Native primitives behind the HLS_NATIVE_SIM fast paths
+//
+// The kernels keep their bit-level loops for synthesis; under the native
+// shim the same helpers (reverse_bits_64, clmul64, ...) return these
+// instead. They are the host GHASH code's (host/ghash128.hpp), so C
+// simulation and the host model share one copy. Build with -mpclmul for
+// the carry-less multiply instruction.
+// ============================================================
+
+namespace hls_native {
+
+typedef unsigned __int128 u128_t;
+
+using ghash_host::bit_reverse64;   // bit i -> bit 63 - i
+using ghash_host::clmul64;         // 64 x 64 -> 128 carry-less product
+
+} // namespace hls_native
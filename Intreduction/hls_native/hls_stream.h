@@ -0,0 +1,57 @@
+#pragma once
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <string>
+
+// hls::stream for the native C simulation: an unbounded FIFO, safe to share
+// between a producer and a consumer thread; read() blocks until data arrives.
+
+namespace hls {
+
+template <class T>
+class stream {
+public:
+    stream() {}
+    explicit stream(const char* name) : name_(name) {}
+    stream(const stream&) = delete;
+    stream& operator=(const stream&) = delete;
+
+    void write(const T& x) {
+        {
+            std::lock_guard<std::mutex> lk(m_);
+            q_.push_back(x);
+        }
+        cv_.notify_one();
+    }
+    T read() {
+        std::unique_lock<std::mutex> lk(m_);
+        cv_.wait(lk, [&] { return !q_.empty(); });
+        T x = q_.front();
+        q_.pop_front();
+        return x;
+    }
+    void read(T& x) { x = read(); }
+    bool read_nb(T& x) {
+        std::lock_guard<std::mutex> lk(m_);
+        if (q_.empty()) return false;
+        x = q_.front();
+        q_.pop_front();
+        return true;
+    }
+    bool write_nb(const T& x) { write(x); return true; }
+    bool empty() const { std::lock_guard<std::mutex> lk(m_); return q_.empty(); }
+    bool full() const { return false; }
+    size_t size() const { std::lock_guard<std::mutex> lk(m_); return q_.size(); }
+    stream& operator<<(const T& x) { write(x); return *this; }
+    stream& operator>>(T& x) { x = read(); return *this; }
+
+private:
+    std::string name_;
+    std::deque<T> q_;
+    mutable std::mutex m_;
+    std::condition_variable cv_;
+};
+
+} // namespace hls
@@ -0,0 +1,143 @@
+#include "additive_ntt.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+#include "intmul.hpp"
+
+namespace intmul_host {
+
+using ghash_host::ghash_mul;
+using ghash_host::gf_inv;
+
+static inline u128_t beta(int k) { return (u128_t)1 << k; }
+
+// w[i][k] = W_i(beta_k) for i < n_layers, k < n_points
+static std::vector<std::vector<u128_t>> subspace_values(int n_layers, int n_points) {
+    std::vector<std::vector<u128_t>> w(n_layers, std::vector<u128_t>(n_points, 0));
+    for (int k = 0; k < n_points; k++) w[0][k] = beta(k);
+    for (int i = 0; i + 1 < n_layers; i++) {
+        for (int k = 0; k < n_points; k++)
+            w[i + 1][k] = ghash_mul(w[i][k], w[i][k]) ^ ghash_mul(w[i][i], w[i][k]);
+    }
+    return w;
+}
+
+u128_t novel_basis_factor(int i, u128_t omega) {
+    std::vector<std::vector<u128_t>> w = subspace_values(i + 1, i + 1);
+    u128_t v = omega;
+    for (int l = 0; l < i; l++) v = ghash_mul(v, v) ^ ghash_mul(w[l][l], v);
+    return ghash_mul(v, gf_inv(w[i][i]));
+}
+
+AdditiveNtt::AdditiveNtt(int log_domain, int threads)
+    : log_domain_(log_domain), threads_(threads) {
+    const int L = log_domain;
+    std::vector<std::vector<u128_t>> w = subspace_values(L, L);
+    norm_basis_.assign(L, std::vector<u128_t>(L, 0));
+    for (int i = 0; i < L; i++) {
+        u128_t inv = gf_inv(w[i][i]);
+        for (int k = i + 1; k < L; k++) norm_basis_[i][k] = ghash_mul(w[i][k], inv);
+    }
+
+    offset_.assign(L + 1, 0);
+    for (int i = 0; i < L; i++) offset_[i + 1] = offset_[i] + ((std::size_t)1 << (L - 1 - i));
+    twiddles_.assign(offset_[L], 0);
+    for (int i = 0; i < L; i++) {
+        // bit m of the block index is beta_(i + 1 + m)
+        u128_t* t = &twiddles_[offset_[i]];
+        for (int m = 0; m + i + 1 < L; m++) {
+            std::size_t span = (std::size_t)1 << m;
+            for (std::size_t j = 0; j < span; j++) t[j + span] = t[j] ^ norm_basis_[i][i + 1 + m];
+        }
+    }
+}
+
+// Layer i over pairs [p0, p1) of a span starting at global point index base
+static void butterflies(u128_t* data, int i, std::size_t base, const u128_t* tw,
+                        std::size_t p0, std::size_t p1, bool inv) {
+    std::size_t half = (std::size_t)1 << i;
+    std::size_t p = p0;
+    while (p < p1) {
+        std::size_t blk = p >> i;
+        std::size_t k0 = p & (half - 1);
+        std::size_t run = std::min(p1 - p, half - k0);
+        u128_t t = tw[(base >> (i + 1)) + blk];
+        u128_t* lo = data + (blk << (i + 1)) + k0;
+        u128_t* hi = lo + half;
+        if (!inv) {
+            for (std::size_t k = 0; k < run; k++) {
+                lo[k] ^= ghash_mul(t, hi[k]);
+                hi[k] ^= lo[k];
+            }
+        } else {
+            for (std::size_t k = 0; k < run; k++) {
+                hi[k] ^= lo[k];
+                lo[k] ^= ghash_mul(t, hi[k]);
+            }
+        }
+        p += run;
+    }
+}
+
+bool AdditiveNtt::in_domain(int log_n, std::size_t coset) const {
+    if (log_n < 0 || log_n > log_domain_) return false;
+    const int spare = log_domain_ - log_n;   // log2 of the number of cosets
+    return spare >= 64 || (coset >> spare) == 0;
+}
+
+void AdditiveNtt::transform(u128_t* data, int log_n, std::size_t coset, bool inv) const {
+    const std::size_t n = (std::size_t)1 << log_n;
+    const std::size_t base = coset << log_n;
+    const int b = std::min(log_n, NTT_BLOCK_LOG);
+    const std::size_t chunk = (std::size_t)1 << b;
+
+    auto full_pass = [&](int i) {
+        parallel_for(n / 2, threads_, [&](std::size_t p0, std::size_t p1) {
+            butterflies(data, i, base, twiddles(i), p0, p1, inv);
+        });
+    };
+    auto chunk_passes = [&] {
+        parallel_for(n / chunk, threads_, [&](std::size_t c0, std::size_t c1) {
+            for (std::size_t c = c0; c < c1; c++) {
+                u128_t* d = data + c * chunk;
+                for (int s = 0; s < b; s++) {
+                    int i = inv ? s : b - 1 - s;
+                    butterflies(d, i, base + c * chunk, twiddles(i), 0, chunk / 2, inv);
+                }
+            }
+        });
+    };
+
+    if (!inv) {
+        for (int i = log_n - 1; i >= b; i--) full_pass(i);
+        chunk_passes();
+    } else {
+        chunk_passes();
+        for (int i = b; i < log_n; i++) full_pass(i);
+    }
+}
+
+bool AdditiveNtt::forward(u128_t* data, int log_n, std::size_t coset) const {
+    if (!in_domain(log_n, coset)) return false;
+    transform(data, log_n, coset, false);
+    return true;
+}
+
+bool AdditiveNtt::inverse(u128_t* data, int log_n, std::size_t coset) const {
+    if (!in_domain(log_n, coset)) return false;
+    transform(data, log_n, coset, true);
+    return true;
+}
+
+bool AdditiveNtt::encode(const u128_t* msg, int log_n, int log_rate, u128_t* codeword) const {
+    if (log_n < 0 || log_rate < 0 || log_n + log_rate > log_domain_) return false;
+    const std::size_t n = (std::size_t)1 << log_n;
+    for (std::size_t c = 0; c < ((std::size_t)1 << log_rate); c++) {
+        std::memcpy(codeword + c * n, msg, n * sizeof(u128_t));
+        forward(codeword + c * n, log_n, c);
+    }
+    return true;
+}
+
+} // namespace intmul_host
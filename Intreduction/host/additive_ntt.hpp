@@ -0,0 +1,75 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "ghash128.hpp"
+
+// ============================================================
+// Additive NTT over GF(2^128) in the novel polynomial basis (Lin, Chung,
+// Han 2014), as used by the Binius Reed-Solomon code
+//
+// Basis beta_k = x^k (bit k), domain point omega_u = sum_k u_k beta_k, so
+// the points of a coset of size 2^n are omega_(c 2^n + u), u < 2^n.
+// W_i(X) = prod_{u < 2^i} (X + omega_u) is F2-linear; Wh_i = W_i / W_i(beta_i)
+// and the novel basis is X_j = prod_{i : bit i of j} Wh_i.
+//
+// forward(): 2^n novel-basis coefficients -> values at the 2^n points of
+// coset c. Layer i (top first) pairs entries k and k + 2^i of every block
+// of 2^(i + 1):
+//
+//     u = a_lo + t a_hi,  v = u + a_hi,  t = Wh_i(omega of the block)
+//
+// Wh_i is linear, so t only depends on the block's index above bit i:
+// twiddle(i)[(c 2^n + k) >> (i + 1)]. Those tables are built once per
+// domain by XOR doubling (2^L entries in total for a 2^L domain).
+//
+// The layers below NTT_BLOCK_LOG run chunk by chunk (a chunk of 2^12
+// entries stays in L2 through all of them), the layers above run as full
+// passes. Both split over threads.
+// ============================================================
+
+namespace intmul_host {
+
+using ghash_host::u128_t;
+
+static const int NTT_BLOCK_LOG = 12;
+
+class AdditiveNtt {
+public:
+    // points omega_u for u < 2^log_domain (log_domain <= 64)
+    explicit AdditiveNtt(int log_domain, int threads = 0);
+
+    int log_domain() const { return log_domain_; }
+
+    // 2^(log_domain - 1 - i) twiddles of layer i
+    const u128_t* twiddles(int layer) const { return &twiddles_[offset_[layer]]; }
+
+    // In place, 2^log_n entries, coset c. False, with data untouched, unless
+    // 0 <= log_n <= log_domain and (c + 1) 2^log_n <= 2^log_domain.
+    bool forward(u128_t* data, int log_n, std::size_t coset = 0) const;
+    bool inverse(u128_t* data, int log_n, std::size_t coset = 0) const;
+
+    // Reed-Solomon: 2^log_n coefficients -> 2^(log_n + log_rate) values,
+    // coset-major (coset c at codeword + c 2^log_n). False, with codeword
+    // untouched, unless log_n, log_rate >= 0 and log_n + log_rate <= log_domain.
+    bool encode(const u128_t* msg, int log_n, int log_rate, u128_t* codeword) const;
+
+    // Wh_i(beta_k) for k > i, the generators of the layer-i twiddles
+    u128_t subspace_basis(int i, int k) const { return norm_basis_[i][k]; }
+
+private:
+    bool in_domain(int log_n, std::size_t coset) const;
+    void transform(u128_t* data, int log_n, std::size_t coset, bool inv) const;
+
+    int log_domain_;
+    int threads_;
+    std::vector<std::vector<u128_t>> norm_basis_;
+    std::vector<u128_t> twiddles_;
+    std::vector<std::size_t> offset_;
+};
+
+// Wh_i(omega) directly from W_(i+1)(X) = W_i(X)^2 + W_i(beta_i) W_i(X), for tests
+u128_t novel_basis_factor(int i, u128_t omega);
+
+} // namespace intmul_host
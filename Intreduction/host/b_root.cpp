@@ -0,0 +1,21 @@
+#include "b_root.hpp"
+
+namespace intmul_host {
+
+void build_b_root(const u128_t* b_leaves, std::size_t n_rows, u128_t* b_root) {
+    BRootReducer r(n_rows);
+    for (int z = 0; z < HEIGHT; z++) {
+        r.push_layer(b_leaves + (std::size_t)z * n_rows);
+    }
+    const std::vector<u128_t>& out = r.b_root();
+    for (std::size_t i = 0; i < n_rows; i++) b_root[i] = out[i];
+}
+
+void build_b_root(const CompressedBLeaves& leaves, u128_t* b_root) {
+    for (std::size_t i = 0; i < leaves.row_count(); i++) b_root[i] = ghash_host::gf_one();
+    leaves.for_each_nontrivial([&](int, std::size_t i, u128_t v) {
+        b_root[i] = ghash_host::ghash_mul(b_root[i], v);
+    });
+}
+
+} // namespace intmul_host
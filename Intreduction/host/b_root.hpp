@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "compressed_leaves.hpp"
+#include "ghash128.hpp"
+#include "intmul.hpp"
+
+// ============================================================
+// b_root = final products layer of ProdcheckProver::new(k=6, b_leaves)
+//
+// Host model of build_b_root() in witness_to_constbase.cpp: leaves are
+// consumed in z-major order and multiplied into one partial product per
+// row, so only N entries are ever held.
+// ============================================================
+
+namespace intmul_host {
+
+class BRootReducer {
+public:
+    explicit BRootReducer(std::size_t n_rows)
+        : n_rows_(n_rows), acc_(n_rows, ghash_host::gf_one()) {}
+
+    // All N leaves of layer z at once; layers must arrive in z order.
+    void push_layer(const u128_t* leaves) {
+        for (std::size_t i = 0; i < n_rows_; i++) {
+            acc_[i] = ghash_host::ghash_mul(acc_[i], leaves[i]);
+        }
+    }
+
+    const std::vector<u128_t>& b_root() const { return acc_; }
+
+private:
+    std::size_t n_rows_;
+    std::vector<u128_t> acc_;
+};
+
+// b_root[i] = prod_z b_leaves[z * n_rows + i]
+void build_b_root(const u128_t* b_leaves, std::size_t n_rows, u128_t* b_root);
+
+// Same product straight from the compressed form; the constant-1 leaves
+// are skipped instead of multiplied.
+void build_b_root(const CompressedBLeaves& leaves, u128_t* b_root);
+
+} // namespace intmul_host
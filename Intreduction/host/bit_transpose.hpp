@@ -0,0 +1,33 @@
+#pragma once
+
+#include <cstdint>
+
+// ============================================================
+// 64 x 64 bit-matrix transposes, shared by the compressed b_leaves
+// rank directory (compressed_leaves.cpp) and the column packing
+// (packing.cpp).
+// ============================================================
+
+namespace intmul_host {
+
+// The swap network on any word type with 64-bit lanes: uint64_t, or a
+// GCC vector of 64-bit lanes, which transposes one matrix per lane.
+template <class W>
+inline void transpose64_lanes(W m[64]) {
+    // recursive block swap, 6 rounds of 32 masked exchanges
+    uint64_t mask = 0x00000000ffffffffull;
+    for (int j = 32; j != 0; j >>= 1, mask ^= (mask << j)) {
+        for (int k = 0; k < 64; k = ((k | j) + 1) & ~j) {
+            W t = ((m[k] >> j) ^ m[k | j]) & mask;
+            m[k] ^= t << j;
+            m[k | j] ^= t;
+        }
+    }
+}
+
+// 64 x 64 bit-matrix transpose in place: bit j of m[i] <-> bit i of m[j]
+inline void transpose64(uint64_t m[64]) {
+    transpose64_lanes(m);
+}
+
+} // namespace intmul_host
@@ -0,0 +1,60 @@
+#include "compressed_leaves.hpp"
+
+#include "bit_transpose.hpp"
+
+namespace intmul_host {
+
+bool CompressedBLeaves::assign(std::vector<uint64_t> masks, std::vector<u128_t> values) {
+    std::size_t total = 0;
+    for (uint64_t m : masks) total += (std::size_t)__builtin_popcountll(m);
+    if (total != values.size()) return false;
+
+    masks_  = std::move(masks);
+    values_ = std::move(values);
+    n_rows_  = masks_.size();
+    n_words_ = (n_rows_ + 63) / 64;
+
+    col_bits_.assign((std::size_t)HEIGHT * n_words_, 0);
+    col_rank_.assign((std::size_t)HEIGHT * n_words_, 0);
+
+    for (std::size_t w = 0; w < n_words_; w++) {
+        uint64_t blk[64] = {};
+        for (int j = 0; j < 64 && w * 64 + j < n_rows_; j++) blk[j] = masks_[w * 64 + j];
+        transpose64(blk);
+        for (int z = 0; z < HEIGHT; z++) col_bits_[(std::size_t)z * n_words_ + w] = blk[z];
+    }
+
+    std::size_t off = 0;
+    for (int z = 0; z < HEIGHT; z++) {
+        layer_offset_[z] = off;
+        uint32_t rank = 0;
+        for (std::size_t w = 0; w < n_words_; w++) {
+            col_rank_[(std::size_t)z * n_words_ + w] = rank;
+            rank += (uint32_t)__builtin_popcountll(col_bits_[(std::size_t)z * n_words_ + w]);
+        }
+        off += rank;
+    }
+    layer_offset_[HEIGHT] = off;
+    return true;
+}
+
+u128_t CompressedBLeaves::leaf(int z, std::size_t i) const {
+    if (is_trivial(z, i)) return ghash_host::gf_one();
+    std::size_t w = i / 64;
+    uint64_t below = col_bits_[(std::size_t)z * n_words_ + w] & ((uint64_t(1) << (i % 64)) - 1);
+    std::size_t k = layer_offset_[z] + col_rank_[(std::size_t)z * n_words_ + w]
+                  + (std::size_t)__builtin_popcountll(below);
+    return values_[k];
+}
+
+void CompressedBLeaves::expand(u128_t* out) const {
+    std::size_t k = 0;
+    for (int z = 0; z < HEIGHT; z++) {
+        u128_t* row = out + (std::size_t)z * n_rows_;
+        for (std::size_t i = 0; i < n_rows_; i++) {
+            row[i] = ((masks_[i] >> z) & 1) ? values_[k++] : ghash_host::gf_one();
+        }
+    }
+}
+
+} // namespace intmul_host
@@ -0,0 +1,86 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "ghash128.hpp"
+
+// ============================================================
+// Compressed b_leaves, as produced by intmul_witness_step(compress = 1)
+//
+//   b_mask_out  : N x 64-bit masks, mask[i] = b[i] (bit z set <=> leaf (z, i)
+//                 is a_root[i]^(2^z), clear <=> leaf is the constant 1)
+//   b_leaves_out: only the non-trivial leaves, z-major, TLAST on the last one
+//
+// Full index of leaf (z, i) is z * N + i, the same as the uncompressed stream.
+// ============================================================
+
+namespace intmul_host {
+
+using ghash_host::u128_t;
+
+class CompressedBLeaves {
+public:
+    static const int HEIGHT = 64;
+
+    CompressedBLeaves() : n_rows_(0), n_words_(0), layer_offset_() {}
+
+    // masks has n_rows entries, values must hold exactly sum(popcount(masks)).
+    // Returns false on a length mismatch.
+    bool assign(std::vector<uint64_t> masks, std::vector<u128_t> values);
+
+    std::size_t row_count() const { return n_rows_; }
+    std::size_t value_count() const { return values_.size(); }
+    std::size_t full_count() const { return n_rows_ * HEIGHT; }
+
+    const std::vector<uint64_t>& masks() const { return masks_; }
+    const std::vector<u128_t>& values() const { return values_; }
+
+    // bytes held by masks + values, vs 16 * full_count() uncompressed
+    std::size_t payload_bytes() const {
+        return masks_.size() * sizeof(uint64_t) + values_.size() * sizeof(u128_t);
+    }
+
+    bool is_trivial(int z, std::size_t i) const { return !((masks_[i] >> z) & 1); }
+
+    // Non-trivial leaves of layer z occupy values()[layer_begin(z) .. layer_begin(z + 1))
+    std::size_t layer_begin(int z) const { return layer_offset_[z]; }
+
+    // Random access to leaf (z, i) in O(1): rank over the transposed masks.
+    u128_t leaf(int z, std::size_t i) const;
+
+    // Visit the non-trivial leaves in stream order, f(z, i, value).
+    template <class F>
+    void for_each_nontrivial(F f) const {
+        std::size_t k = 0;
+        for (int z = 0; z < HEIGHT; z++) {
+            const uint64_t* col = col_bits_.data() + (std::size_t)z * n_words_;
+            for (std::size_t w = 0; w < n_words_; w++) {
+                uint64_t bits = col[w];
+                while (bits) {
+                    int j = __builtin_ctzll(bits);
+                    bits &= bits - 1;
+                    f(z, w * 64 + j, values_[k++]);
+                }
+            }
+        }
+    }
+
+    // Full z-major b_leaves, out has full_count() entries.
+    void expand(u128_t* out) const;
+
+private:
+    std::size_t n_rows_;
+    std::size_t n_words_;                 // ceil(n_rows / 64)
+    std::vector<uint64_t> masks_;
+    std::vector<u128_t> values_;
+
+    // col_bits_[z * n_words_ + w] bit j = bit z of masks_[64 w + j]
+    std::vector<uint64_t> col_bits_;
+    // set bits of column z before word w
+    std::vector<uint32_t> col_rank_;
+    std::size_t layer_offset_[HEIGHT + 1];
+};
+
+} // namespace intmul_host
@@ -0,0 +1,262 @@
+#include "constraint_system.hpp"
+
+#include <algorithm>
+#include <atomic>
+
+#include "intmul.hpp"
+#include "keccak.hpp"
+#include "keccak_delta.hpp"
+
+namespace intmul_host {
+
+// Constraints smaller than this are checked on the calling thread
+static const std::size_t PARALLEL_MIN_CONSTRAINTS = 1 << 14;
+
+static inline uint64_t shifted(uint64_t x, int op, int n) {
+    switch (op) {
+    case SHIFT_ROTL: return n ? (x << n) | (x >> (64 - n)) : x;
+    case SHIFT_SLL:  return x << n;
+    case SHIFT_SRL:  return x >> n;
+    default:         return (uint64_t)((int64_t)x >> n);
+    }
+}
+
+static inline uint64_t operand(const ConstraintSystem& cs, std::size_t k, const uint64_t* v) {
+    uint64_t acc = 0;
+    for (uint32_t t = cs.operand_begin[k]; t < cs.operand_begin[k + 1]; t++) {
+        const ShiftedWord& s = cs.terms[t];
+        acc ^= shifted(v[s.word], s.op, s.amount);
+    }
+    return acc;
+}
+
+// Constraint c holds
+static inline bool holds(const ConstraintSystem& cs, std::size_t c, const uint64_t* v) {
+    if (c < cs.n_and)
+        return (operand(cs, 3 * c, v) & operand(cs, 3 * c + 1, v)) == operand(cs, 3 * c + 2, v);
+    return operand(cs, 2 * cs.n_and + c, v) == 0;
+}
+
+// Right length and every pinned word in place
+static bool well_formed(const ConstraintSystem& cs, const uint64_t* v, std::size_t n_values) {
+    if (n_values != cs.n_values) return false;
+    for (const PinnedWord& p : cs.pinned)
+        if (v[p.word] != p.value) return false;
+    return true;
+}
+
+long check_constraints(const ConstraintSystem& cs, const uint64_t* values, std::size_t n_values,
+                       int threads) {
+    if (!well_formed(cs, values, n_values)) return CS_BAD_VALUES;
+    const std::size_t n = cs.size();
+    if (n < PARALLEL_MIN_CONSTRAINTS) threads = 1;
+    std::atomic<long> first(-1);
+    parallel_for(n, threads, [&](std::size_t c0, std::size_t c1) {
+        for (std::size_t c = c0; c < c1; c++) {
+            if (holds(cs, c, values)) continue;
+            long cur = first.load();
+            while ((cur < 0 || (long)c < cur) && !first.compare_exchange_weak(cur, (long)c)) {}
+            return;
+        }
+    });
+    return first.load();
+}
+
+typedef uint64_t v4u64 __attribute__((vector_size(32)));
+typedef int64_t v4i64 __attribute__((vector_size(32)));
+
+static inline v4u64 shifted4(v4u64 x, int op, int n) {
+    switch (op) {
+    case SHIFT_ROTL: return n ? (x << n) | (x >> (64 - n)) : x;
+    case SHIFT_SLL:  return x << n;
+    case SHIFT_SRL:  return x >> n;
+    default:         return (v4u64)((v4i64)x >> n);
+    }
+}
+
+static inline void operand4(const ConstraintSystem& cs, std::size_t k,
+                            const uint64_t* const v[4], v4u64& acc) {
+    acc = v4u64{ 0, 0, 0, 0 };
+    for (uint32_t t = cs.operand_begin[k]; t < cs.operand_begin[k + 1]; t++) {
+        const ShiftedWord& s = cs.terms[t];
+        v4u64 x = { v[0][s.word], v[1][s.word], v[2][s.word], v[3][s.word] };
+        acc ^= shifted4(x, s.op, s.amount);
+    }
+}
+
+void check_constraints_x4(const ConstraintSystem& cs, const uint64_t* const values[4],
+                          std::size_t n_values, long first[4]) {
+    int open = 4;
+    for (int k = 0; k < 4; k++) {
+        first[k] = -1;
+        if (!well_formed(cs, values[k], n_values)) {
+            first[k] = CS_BAD_VALUES;
+            open--;
+        }
+    }
+    v4u64 a, b, c;
+    for (std::size_t i = 0; i < cs.size() && open; i++) {
+        if (i < cs.n_and) {
+            operand4(cs, 3 * i, values, a);
+            operand4(cs, 3 * i + 1, values, b);
+            operand4(cs, 3 * i + 2, values, c);
+            c ^= a & b;
+        } else {
+            operand4(cs, 2 * cs.n_and + i, values, c);
+        }
+        for (int k = 0; k < 4; k++) {
+            if (c[k] && first[k] == -1) {
+                first[k] = (long)i;
+                open--;
+            }
+        }
+    }
+}
+
+void check_constraints_batch(const ConstraintSystem& cs, const uint64_t* const* values,
+                             std::size_t n_values, std::size_t n, long* first, int threads) {
+    parallel_for((n + 3) / 4, threads, [&](std::size_t g0, std::size_t g1) {
+        for (std::size_t g = g0; g < g1; g++) {
+            std::size_t i = 4 * g;
+            if (i + 4 <= n) {
+                check_constraints_x4(cs, values + i, n_values, first + i);
+            } else {
+                for (; i < n; i++) first[i] = check_constraints(cs, values[i], n_values, 1);
+            }
+        }
+    });
+}
+
+// ------------------------------------------------------------
+// Keccak
+// ------------------------------------------------------------
+
+using keccak_host::KECCAK_LANES;
+using keccak_host::KECCAK_ROUNDS;
+using keccak_host::KECCAK256_RATE_LANES;
+using keccak_host::WITNESS_ROUND_WORDS;
+using keccak_host::WITNESS_BLOCK_WORDS;
+
+// rho offsets, indexed x + 5 y
+static const int RHO[KECCAK_LANES] = {
+     0,  1, 62, 28, 27,
+    36, 44,  6, 55, 20,
+     3, 10, 43, 25, 39,
+    41, 45, 15, 21,  8,
+    18,  2, 61, 56, 14,
+};
+
+// A state lane as the XOR of value-vector words (at most three here)
+struct LaneWords {
+    uint32_t w[3];
+    int n = 0;
+    void add(uint32_t x) { w[n++] = x; }
+};
+
+ConstraintSystem keccak_constraint_system(std::size_t n_blocks) {
+    ConstraintSystem cs;
+    const uint32_t stream = KECCAK_CS_MSG + (uint32_t)(KECCAK256_RATE_LANES * n_blocks);
+    cs.n_values = stream + keccak_host::witness_stream_words(n_blocks);
+    cs.pinned.push_back(PinnedWord{ KECCAK_CS_ONE, ~0ull });
+    for (int r = 0; r < KECCAK_ROUNDS; r++)
+        cs.pinned.push_back(PinnedWord{ KECCAK_CS_RC + (uint32_t)r, keccak_host::keccak_rc(r) });
+
+    auto round_word = [&](std::size_t b, int r, int k) {
+        return stream + (uint32_t)(b * (WITNESS_BLOCK_WORDS + 1) + r * WITNESS_ROUND_WORDS + k);
+    };
+    auto between_word = [&](std::size_t b) {   // lane 0 after block b
+        return stream + (uint32_t)(b * (WITNESS_BLOCK_WORDS + 1) + WITNESS_BLOCK_WORDS);
+    };
+
+    // linear operands are appended after all AND constraints
+    std::vector<std::vector<ShiftedWord>> linear;
+    auto term = [](uint32_t w, int rot) { return ShiftedWord{ w, SHIFT_ROTL, (uint8_t)rot }; };
+
+    LaneWords A[KECCAK_LANES];   // state entering the round
+    for (std::size_t b = 0; b < n_blocks; b++) {
+        for (int r = 0; r < KECCAK_ROUNDS; r++) {
+            if (r == 0) {
+                // previous permutation output ^ message block
+                for (int i = 0; i < KECCAK_LANES; i++) {
+                    LaneWords in;
+                    if (b > 0) in.add(i == 0 ? between_word(b - 1) : round_word(b - 1, KECCAK_ROUNDS - 1, 5 + i));
+                    if (i < KECCAK256_RATE_LANES)
+                        in.add(KECCAK_CS_MSG + (uint32_t)(b * KECCAK256_RATE_LANES + i));
+                    A[i] = in;
+                }
+                if (b > 0) {
+                    // lane 0 between blocks = chi lane 0 of round 23 ^ RC[23]
+                    linear.push_back({ term(between_word(b - 1), 0),
+                                       term(round_word(b - 1, KECCAK_ROUNDS - 1, 5), 0),
+                                       term(KECCAK_CS_RC + KECCAK_ROUNDS - 1, 0) });
+                }
+            }
+
+            // theta: D[x] ^ C[x - 1] ^ rotl(C[x + 1], 1) == 0
+            for (int x = 0; x < 5; x++) {
+                std::vector<ShiftedWord> op = { term(round_word(b, r, x), 0) };
+                for (int y = 0; y < 5; y++) {
+                    const LaneWords& l = A[(x + 4) % 5 + 5 * y];
+                    const LaneWords& h = A[(x + 1) % 5 + 5 * y];
+                    for (int t = 0; t < l.n; t++) op.push_back(term(l.w[t], 0));
+                    for (int t = 0; t < h.n; t++) op.push_back(term(h.w[t], 1));
+                }
+                linear.push_back(op);
+            }
+
+            // rho + pi: B[y, 2x + 3y] = rotl(A[x, y] ^ D[x], rho[x, y])
+            std::vector<ShiftedWord> B[KECCAK_LANES];
+            for (int y = 0; y < 5; y++) {
+                for (int x = 0; x < 5; x++) {
+                    std::vector<ShiftedWord>& t = B[y + 5 * ((2 * x + 3 * y) % 5)];
+                    const LaneWords& a = A[x + 5 * y];
+                    for (int k = 0; k < a.n; k++) t.push_back(term(a.w[k], RHO[x + 5 * y]));
+                    t.push_back(term(round_word(b, r, x), RHO[x + 5 * y]));
+                }
+            }
+
+            // chi: (ONE ^ B[x + 1]) & B[x + 2] == chi ^ B[x]
+            for (int y = 0; y < 25; y += 5) {
+                for (int x = 0; x < 5; x++) {
+                    cs.add_term(KECCAK_CS_ONE);
+                    cs.terms.insert(cs.terms.end(), B[y + (x + 1) % 5].begin(), B[y + (x + 1) % 5].end());
+                    cs.end_operand();
+                    cs.terms.insert(cs.terms.end(), B[y + (x + 2) % 5].begin(), B[y + (x + 2) % 5].end());
+                    cs.end_operand();
+                    cs.add_term(round_word(b, r, 5 + y + x));
+                    cs.terms.insert(cs.terms.end(), B[y + x].begin(), B[y + x].end());
+                    cs.end_operand();
+                    cs.n_and++;
+                }
+            }
+
+            // iota: the next round reads the chi lanes, lane 0 with RC[r]
+            for (int i = 0; i < KECCAK_LANES; i++) {
+                LaneWords next;
+                next.add(round_word(b, r, 5 + i));
+                if (i == 0) next.add(KECCAK_CS_RC + r);
+                A[i] = next;
+            }
+        }
+    }
+
+    for (const std::vector<ShiftedWord>& op : linear) {
+        cs.terms.insert(cs.terms.end(), op.begin(), op.end());
+        cs.end_operand();
+    }
+    cs.n_linear = linear.size();
+    return cs;
+}
+
+void keccak_value_vector(const uint64_t* padded, const uint64_t* witness, std::size_t n_blocks,
+                         std::vector<uint64_t>& values) {
+    const std::size_t n_msg = KECCAK256_RATE_LANES * n_blocks;
+    const std::size_t n_wit = keccak_host::witness_stream_words(n_blocks);
+    values.resize(KECCAK_CS_MSG + n_msg + n_wit);
+    values[KECCAK_CS_ONE] = ~0ull;
+    for (int r = 0; r < KECCAK_ROUNDS; r++) values[KECCAK_CS_RC + r] = keccak_host::keccak_rc(r);
+    std::copy(padded, padded + n_msg, values.begin() + KECCAK_CS_MSG);
+    std::copy(witness, witness + n_wit, values.begin() + KECCAK_CS_MSG + n_msg);
+}
+
+} // namespace intmul_host
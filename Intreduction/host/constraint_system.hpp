@@ -0,0 +1,101 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// ============================================================
+// Binius64-style constraint system over a u64 value vector
+//
+// An operand is the XOR of shifted value-vector words. Constraints are
+//   AND    : A & B == C          (chi's ~a & b, with ~a = ONE ^ a)
+//   linear : A == 0              (theta, rho, pi, iota, as XORs of rotations)
+// Operands sit back to back in one term array (CSR offsets): AND
+// constraint i uses operands 3i .. 3i + 2, linear constraint j operand
+// 3 n_and + j. Constraints are numbered ANDs first, then linear ones.
+// Pinned words are public constants (ONE, round constants): the checker
+// rejects a value vector that does not hold them, or is not n_values long,
+// before it looks at any constraint.
+//
+// Every constraint costs one 64-bit AND / XOR per term, so a whole word of
+// bit constraints is checked at once. The x4 path checks four value
+// vectors (instances of one circuit) in lock step on GCC vectors (build
+// with -mavx2 for 256-bit lanes); the batch check splits instances over
+// threads.
+// ============================================================
+
+namespace intmul_host {
+
+enum ShiftOp : uint8_t { SHIFT_ROTL, SHIFT_SLL, SHIFT_SRL, SHIFT_SAR };
+
+struct ShiftedWord {
+    uint32_t word;
+    uint8_t op;       // ShiftOp
+    uint8_t amount;   // 0 .. 63
+};
+
+struct PinnedWord {
+    uint32_t word;
+    uint64_t value;
+};
+
+struct ConstraintSystem {
+    std::vector<ShiftedWord> terms;
+    std::vector<uint32_t> operand_begin = { 0 };   // n_operands + 1 offsets
+    std::size_t n_and = 0;
+    std::size_t n_linear = 0;
+    std::size_t n_values = 0;                      // value-vector length
+    std::vector<PinnedWord> pinned;                // values[word] == value
+
+    std::size_t size() const { return n_and + n_linear; }
+
+    // Building: add the terms of one operand, then close it. All AND
+    // constraints are added before the first linear one.
+    void add_term(uint32_t word, ShiftOp op = SHIFT_ROTL, int amount = 0) {
+        terms.push_back(ShiftedWord{ word, (uint8_t)op, (uint8_t)amount });
+    }
+    void end_operand() { operand_begin.push_back((uint32_t)terms.size()); }
+};
+
+// Result of a value vector whose length is not cs.n_values or that does
+// not hold a pinned word
+static const long CS_BAD_VALUES = -2;
+
+// First unsatisfied constraint, -1 if all hold, CS_BAD_VALUES for a
+// malformed vector. values holds n_values words. threads splits the
+// constraints (<= 0: one per hardware thread).
+long check_constraints(const ConstraintSystem& cs, const uint64_t* values, std::size_t n_values,
+                       int threads = 1);
+
+// Four value vectors of n_values words each at once; first[k] for values[k]
+void check_constraints_x4(const ConstraintSystem& cs, const uint64_t* const values[4],
+                          std::size_t n_values, long first[4]);
+
+// n instances of n_values words, four at a time, split over threads
+void check_constraints_batch(const ConstraintSystem& cs, const uint64_t* const* values,
+                             std::size_t n_values, std::size_t n, long* first, int threads);
+
+// ------------------------------------------------------------
+// Keccak-256 permutation witness
+//
+// Value vector of n_blocks absorbed blocks:
+//   [0]                ONE = all ones
+//   [1 .. 25)          round constants RC[0..24)
+//   [25 .. 25 + 17 n)  padded message words
+//   then the witness stream of ../keccak_witness_stream.h (D[x] and chi
+//   lanes per round, lane 0 between blocks)
+// The constants belong to the verifier: keccak_value_vector writes them
+// and the system pins them.
+// ------------------------------------------------------------
+
+static const uint32_t KECCAK_CS_ONE = 0;
+static const uint32_t KECCAK_CS_RC  = 1;
+static const uint32_t KECCAK_CS_MSG = 25;
+
+ConstraintSystem keccak_constraint_system(std::size_t n_blocks);
+
+// padded: 17 n_blocks words, witness: the kernel's stream for them
+void keccak_value_vector(const uint64_t* padded, const uint64_t* witness, std::size_t n_blocks,
+                         std::vector<uint64_t>& values);
+
+} // namespace intmul_host
@@ -0,0 +1,89 @@
+#include "cu_scheduler.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <mutex>
+#include <thread>
+
+namespace intmul_host {
+
+std::vector<RowRange> split_rows(std::size_t n_rows, std::size_t max_rows, int n_cus) {
+    std::vector<RowRange> out;
+    if (n_rows == 0 || max_rows == 0) return out;
+
+    std::size_t n_slices = (n_rows + max_rows - 1) / max_rows;
+    std::size_t cus = (std::size_t)(n_cus > 0 ? n_cus : 1);
+    n_slices = ((n_slices + cus - 1) / cus) * cus;
+    if (n_slices > n_rows) n_slices = n_rows;
+
+    std::size_t base = n_rows / n_slices;
+    std::size_t rem  = n_rows % n_slices;
+    std::size_t off  = 0;
+    for (std::size_t s = 0; s < n_slices; s++) {
+        std::size_t count = base + (s < rem ? 1 : 0);
+        out.push_back(RowRange{off, count});
+        off += count;
+    }
+    return out;
+}
+
+static void merge_slice(const RowRange& r, const CuSliceOutput& s, std::size_t n_rows,
+                        bool leaves, IntMulOutputs& out) {
+    std::copy(s.a_root.begin(), s.a_root.begin() + r.count, out.a_root.begin() + r.offset);
+    if (!leaves) return;
+    for (int z = 0; z < HEIGHT; z++) {
+        std::copy(s.b_leaves.begin() + (std::size_t)z * r.count,
+                  s.b_leaves.begin() + (std::size_t)(z + 1) * r.count,
+                  out.b_leaves.begin() + (std::size_t)z * n_rows + r.offset);
+    }
+}
+
+bool CuScheduler::run(const IntMulInputs& in, IntMulOutputs& out) const {
+    if (in.n_rows == 0 || max_rows_ == 0) {
+        out.a_root.clear();
+        out.b_leaves.clear();
+        out.roots_match  = false;
+        out.mismatch_idx = -1;
+        return false;
+    }
+    std::vector<RowRange> slices = split_rows(in.n_rows, max_rows_, n_cus_);
+
+    out.a_root.assign(in.n_rows, 0);
+    if (merge_leaves_) out.b_leaves.assign((std::size_t)HEIGHT * in.n_rows, 0);
+    else out.b_leaves.clear();
+    out.roots_match  = true;
+    out.mismatch_idx = -1;
+
+    std::atomic<std::size_t> next(0);
+    std::mutex result_lock;
+
+    auto worker = [&](int cu) {
+        CuSliceOutput s;
+        for (;;) {
+            std::size_t k = next.fetch_add(1);
+            if (k >= slices.size()) break;
+
+            s.a_root.clear();
+            s.b_leaves.clear();
+            s.roots_match  = true;
+            s.mismatch_idx = -1;
+            launch_(cu, in, slices[k], s);
+
+            // slices are disjoint, only the verdict needs the lock
+            merge_slice(slices[k], s, in.n_rows, merge_leaves_, out);
+            if (!s.roots_match) {
+                std::lock_guard<std::mutex> g(result_lock);
+                out.roots_match = false;
+                if (out.mismatch_idx < 0 || s.mismatch_idx < out.mismatch_idx)
+                    out.mismatch_idx = s.mismatch_idx;
+            }
+        }
+    };
+
+    std::vector<std::thread> threads;
+    for (int cu = 0; cu < n_cus_; cu++) threads.emplace_back(worker, cu);
+    for (std::thread& t : threads) t.join();
+    return true;
+}
+
+} // namespace intmul_host
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+#include "ghash128.hpp"
+#include "intmul.hpp"
+
+// ============================================================
+// Multi-CU scheduling of intmul_witness_step
+//
+// Rows are independent, so the table is cut into slices of at most
+// max_rows_per_cu rows (the kernel's N) and each slice is run through
+// one compute unit with row_offset / row_count. Each CU hands back its
+// slice z-major; the scheduler merges it into the full z-major b_leaves
+// (leaf (z, i) at z * n_rows + i) as soon as the slice is done.
+//
+// With merge_leaves false the launcher consumes each slice's b_leaves
+// itself (checks or forwards them, leaving CuSliceOutput::b_leaves empty)
+// and the merged b_leaves stays empty: no 64 n_rows table is allocated.
+//
+// How a slice is run is up to the launcher: an XRT kernel run on
+// hardware, or a direct call of the kernel function in C simulation,
+// where the worker threads stand in for CUs.
+// ============================================================
+
+namespace intmul_host {
+
+using ghash_host::u128_t;
+
+struct RowRange {
+    std::size_t offset;
+    std::size_t count;
+};
+
+// Result of one kernel invocation over one slice
+struct CuSliceOutput {
+    std::vector<u128_t> a_root;       // count
+    std::vector<u128_t> b_leaves;     // 64 * count, z-major over the slice
+    bool roots_match;
+    long mismatch_idx;                // global row, -1 if none
+};
+
+struct IntMulOutputs {
+    std::vector<u128_t> a_root;       // n_rows
+    std::vector<u128_t> b_leaves;     // 64 * n_rows, z-major
+    bool roots_match;
+    long mismatch_idx;                // smallest mismatching row, -1 if none
+};
+
+typedef std::function<void(int cu, const IntMulInputs& in, const RowRange& rows,
+                           CuSliceOutput& out)> CuLaunch;
+
+// Slices of at most max_rows (> 0) rows, at least n_cus of them when there are
+// enough rows, in a multiple of n_cus so every CU gets the same share.
+std::vector<RowRange> split_rows(std::size_t n_rows, std::size_t max_rows, int n_cus);
+
+class CuScheduler {
+public:
+    // n_cus <= 0 runs one CU
+    CuScheduler(int n_cus, std::size_t max_rows_per_cu, CuLaunch launch, bool merge_leaves = true)
+        : n_cus_(n_cus > 0 ? n_cus : 1), max_rows_(max_rows_per_cu), launch_(launch),
+          merge_leaves_(merge_leaves) {}
+
+    int cu_count() const { return n_cus_; }
+
+    // One worker thread per CU pulls slices until none are left. False,
+    // with no slice launched, if max_rows_per_cu is 0 or there are no rows;
+    // as with the kernel, roots_match is then false and mismatch_idx -1.
+    bool run(const IntMulInputs& in, IntMulOutputs& out) const;
+
+private:
+    int n_cus_;
+    std::size_t max_rows_;
+    CuLaunch launch_;
+    bool merge_leaves_;
+};
+
+} // namespace intmul_host
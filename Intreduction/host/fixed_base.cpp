@@ -0,0 +1,45 @@
+#include "fixed_base.hpp"
+
+namespace ghash_host {
+
+FixedBaseTable::FixedBaseTable(u128_t base) {
+    // step = base^(2^(8k)) for the current window
+    u128_t step = base;
+    for (int k = 0; k < FB_WINDOWS; k++) {
+        table_[k][0] = gf_one();
+        for (int j = 1; j < FB_WINDOW_SIZE; j++) {
+            table_[k][j] = ghash_mul(table_[k][j - 1], step);
+        }
+        for (int s = 0; s < FB_WINDOW_BITS; s++) {
+            step = gf_square(step);
+        }
+    }
+}
+
+u128_t g_c_hi() {
+    // iterate(g, |g| g.square()).nth(1 << log_bits), log_bits = 6
+    u128_t g = GHASH_GENERATOR;
+    for (int i = 0; i < 64; i++) {
+        g = gf_square(g);
+    }
+    return g;
+}
+
+const FixedBaseTable& fixed_base_g() {
+    static const FixedBaseTable t(GHASH_GENERATOR);
+    return t;
+}
+
+const FixedBaseTable& fixed_base_g_c_hi() {
+    static const FixedBaseTable t(g_c_hi());
+    return t;
+}
+
+void build_constant_base_root(const uint64_t* exponents, std::size_t n,
+                              const FixedBaseTable& base, u128_t* root_out) {
+    for (std::size_t i = 0; i < n; i++) {
+        root_out[i] = base.pow(exponents[i]);
+    }
+}
+
+} // namespace ghash_host
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "ghash128.hpp"
+
+// ============================================================
+// Fixed-base windowed exponentiation in GF(2^128)
+//
+// table[k][j] = base^(j * 2^(8k)), 8 windows x 256 entries, so
+// base^e = prod_k table[k][byte k of e]: 8 lookups, 7 multiplies,
+// no squarings. Same layout as the ROM in fixed_base_table.h.
+// ============================================================
+
+namespace ghash_host {
+
+static const int FB_WINDOW_BITS = 8;
+static const int FB_WINDOWS     = 64 / FB_WINDOW_BITS;   // 8
+static const int FB_WINDOW_SIZE = 1 << FB_WINDOW_BITS;   // 256
+
+class FixedBaseTable {
+public:
+    explicit FixedBaseTable(u128_t base);
+
+    u128_t base() const { return table_[0][1]; }
+    u128_t entry(int window, int j) const { return table_[window][j]; }
+
+    // base^exp
+    u128_t pow(uint64_t exp) const {
+        u128_t r = table_[0][exp & 0xff];
+        for (int k = 1; k < FB_WINDOWS; k++) {
+            r = ghash_mul(r, table_[k][(exp >> (FB_WINDOW_BITS * k)) & 0xff]);
+        }
+        return r;
+    }
+
+private:
+    u128_t table_[FB_WINDOWS][FB_WINDOW_SIZE];
+};
+
+// g_c_hi = g^(2^64), the base of the c_hi root
+u128_t g_c_hi();
+
+// Tables are built once on first use and shared afterwards.
+const FixedBaseTable& fixed_base_g();
+const FixedBaseTable& fixed_base_g_c_hi();
+
+// root_out[i] = base^(exponents[i]) for i < n
+void build_constant_base_root(const uint64_t* exponents, std::size_t n,
+                              const FixedBaseTable& base, u128_t* root_out);
+
+} // namespace ghash_host
@@ -0,0 +1,158 @@
+#pragma once
+
+#include <cstdint>
+
+#if defined(__PCLMUL__)
+#include <wmmintrin.h>
+#endif
+
+// ============================================================
+// Host-side GF(2^128) GHASH arithmetic
+// modulus: x^128 + x^7 + x^2 + x + 1
+//
+// Bit-exact with ghash_mul() in witness_to_constbase.cpp: bit i of
+// the 128-bit word is the coefficient of x^i, hi word = bits 127..64.
+// Uses PCLMULQDQ when compiled with -mpclmul, a 4-bit window otherwise.
+// ============================================================
+
+namespace ghash_host {
+
+typedef unsigned __int128 u128_t;
+
+static inline uint64_t lo64(u128_t x) { return (uint64_t)x; }
+static inline uint64_t hi64(u128_t x) { return (uint64_t)(x >> 64); }
+
+static inline u128_t make_u128(uint64_t hi, uint64_t lo) {
+    return ((u128_t)hi << 64) | (u128_t)lo;
+}
+
+// 64 x 64 -> 128 carry-less multiply
+static inline u128_t clmul64(uint64_t a, uint64_t b) {
+#if defined(__PCLMUL__)
+    __m128i r = _mm_clmulepi64_si128(_mm_cvtsi64_si128((long long)a),
+                                     _mm_cvtsi64_si128((long long)b), 0x00);
+    uint64_t out[2];
+    _mm_storeu_si128((__m128i*)out, r);
+    return make_u128(out[1], out[0]);
+#else
+    // 4-bit window: table of a * j for j < 16, 16 lookups per product
+    u128_t tab[16];
+    tab[0] = 0;
+    tab[1] = a;
+    for (int j = 2; j < 16; j += 2) {
+        tab[j]     = tab[j / 2] << 1;
+        tab[j + 1] = tab[j] ^ (u128_t)a;
+    }
+    u128_t acc = 0;
+    for (int i = 60; i >= 0; i -= 4) {
+        acc = (acc << 4) ^ tab[(b >> i) & 0xf];
+    }
+    return acc;
+#endif
+}
+
+// bit i -> bit 63 - i (GHASH's reflected bit order)
+static inline uint64_t bit_reverse64(uint64_t x) {
+#if defined(__clang__)
+    return __builtin_bitreverse64(x);
+#else
+    x = __builtin_bswap64(x);
+    x = ((x >> 4) & 0x0f0f0f0f0f0f0f0full) | ((x & 0x0f0f0f0f0f0f0f0full) << 4);
+    x = ((x >> 2) & 0x3333333333333333ull) | ((x & 0x3333333333333333ull) << 2);
+    x = ((x >> 1) & 0x5555555555555555ull) | ((x & 0x5555555555555555ull) << 1);
+    return x;
+#endif
+}
+
+// 256-bit product held as four 64-bit words, v3 most significant
+struct wide256 {
+    uint64_t v0, v1, v2, v3;
+};
+
+static inline u128_t reduce_ghash_256_by_64(uint64_t v0, uint64_t v1, uint64_t v2, uint64_t v3) {
+    v1 ^= v3 ^ (v3 << 1) ^ (v3 << 2) ^ (v3 << 7);
+    v2 ^= (v3 >> 63) ^ (v3 >> 62) ^ (v3 >> 57);
+    v0 ^= v2 ^ (v2 << 1) ^ (v2 << 2) ^ (v2 << 7);
+    v1 ^= (v2 >> 63) ^ (v2 >> 62) ^ (v2 >> 57);
+    return make_u128(v1, v0);
+}
+
+static inline u128_t reduce(const wide256& w) {
+    return reduce_ghash_256_by_64(w.v0, w.v1, w.v2, w.v3);
+}
+
+// Karatsuba 128 x 128 -> 256 carry-less product, no reduction
+static inline wide256 clmul128(u128_t x, u128_t y) {
+    uint64_t x0 = lo64(x), x1 = hi64(x);
+    uint64_t y0 = lo64(y), y1 = hi64(y);
+
+    u128_t z0 = clmul64(x0, y0);
+    u128_t z1 = clmul64(x1, y1);
+    u128_t z2 = clmul64(x0 ^ x1, y0 ^ y1) ^ z0 ^ z1;
+
+    wide256 w;
+    w.v0 = lo64(z0);
+    w.v1 = hi64(z0) ^ lo64(z2);
+    w.v2 = lo64(z1) ^ hi64(z2);
+    w.v3 = hi64(z1);
+    return w;
+}
+
+// Lazy reduction: XOR unreduced products together, reduce() once at the end.
+static inline wide256 wide_zero() {
+    wide256 w = {0, 0, 0, 0};
+    return w;
+}
+
+static inline void wide_xor(wide256& acc, const wide256& w) {
+    acc.v0 ^= w.v0;
+    acc.v1 ^= w.v1;
+    acc.v2 ^= w.v2;
+    acc.v3 ^= w.v3;
+}
+
+static inline u128_t ghash_mul(u128_t x, u128_t y) {
+    return reduce(clmul128(x, y));
+}
+
+static inline u128_t gf_add(u128_t a, u128_t b) { return a ^ b; }
+
+static inline u128_t gf_one() { return (u128_t)1; }
+
+static inline u128_t gf_square(u128_t a) {
+    return ghash_mul(a, a);
+}
+
+static inline u128_t gf_pow_u64(u128_t base, uint64_t exp) {
+    u128_t result = gf_one();
+    u128_t cur = base;
+    for (int i = 0; i < 64; i++) {
+        if ((exp >> i) & 1) result = ghash_mul(result, cur);
+        cur = gf_square(cur);
+    }
+    return result;
+}
+
+// a * x: one shift, the carry folds back as x^7 + x^2 + x + 1
+static inline u128_t gf_mul_x(u128_t a) {
+    u128_t r = a << 1;
+    if (hi64(a) >> 63) r ^= (u128_t)0x87;
+    return r;
+}
+
+// a^(2^128 - 2) = prod_{i=1..127} a^(2^i); gf_inv(0) = 0
+static inline u128_t gf_inv(u128_t a) {
+    u128_t t = a;
+    u128_t r = gf_one();
+    for (int i = 1; i < 128; i++) {
+        t = gf_square(t);
+        r = ghash_mul(r, t);
+    }
+    return r;
+}
+
+// F::MULTIPLICATIVE_GENERATOR for BinaryField128bGhash
+static const u128_t GHASH_GENERATOR =
+    make_u128(0x494ef99794d5244full, 0x9152df59d87a9186ull);
+
+} // namespace ghash_host
@@ -0,0 +1,53 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <thread>
+#include <vector>
+
+// ============================================================
+// Shared host-side IntMul definitions
+//
+// One row i of the witness is a[i] * b[i] = c_hi[i] || c_lo[i] (64 x 64 -> 128).
+// ============================================================
+
+namespace intmul_host {
+
+static const int LOG_BITS = 6;
+static const int HEIGHT   = 1 << LOG_BITS;   // b-leaves per row
+
+struct IntMulInputs {
+    const uint64_t* a;
+    const uint64_t* b;
+    const uint64_t* c_lo;
+    const uint64_t* c_hi;
+    std::size_t n_rows;
+};
+
+// threads <= 0 means one per hardware thread
+static inline int resolve_threads(int threads) {
+    if (threads > 0) return threads;
+    unsigned hw = std::thread::hardware_concurrency();
+    return hw ? (int)hw : 1;
+}
+
+// f(begin, end) over contiguous chunks of [0, n), one chunk per thread.
+template <class F>
+void parallel_for(std::size_t n, int threads, F f) {
+    std::size_t t = (std::size_t)resolve_threads(threads);
+    if (t > n) t = n;
+    if (t <= 1) {
+        if (n) f((std::size_t)0, n);
+        return;
+    }
+    std::vector<std::thread> pool;
+    std::size_t chunk = (n + t - 1) / t;
+    for (std::size_t begin = 0; begin < n; begin += chunk) {
+        std::size_t end = std::min(n, begin + chunk);
+        pool.emplace_back([=, &f] { f(begin, end); });
+    }
+    for (std::thread& th : pool) th.join();
+}
+
+} // namespace intmul_host
@@ -0,0 +1,57 @@
+#include "intmul_check.hpp"
+
+#include <algorithm>
+#include <mutex>
+
+namespace intmul_host {
+
+// Rows smaller than this are checked on the calling thread
+static const std::size_t PARALLEL_MIN_ROWS = (std::size_t)1 << 16;
+
+static inline uint64_t row_diff(const IntMulInputs& in, std::size_t i) {
+    unsigned __int128 c = (unsigned __int128)in.a[i] * in.b[i];
+    return ((uint64_t)c ^ in.c_lo[i]) | ((uint64_t)(c >> 64) ^ in.c_hi[i]);
+}
+
+std::size_t check_intmul_rows(const IntMulInputs& in, int threads,
+                              std::vector<std::size_t>* bad_rows, std::size_t max_report) {
+    if (in.n_rows < PARALLEL_MIN_ROWS) threads = 1;
+    std::mutex lock;
+    std::size_t n_bad = 0;
+    std::vector<std::size_t> found;
+
+    parallel_for(in.n_rows, threads, [&](std::size_t begin, std::size_t end) {
+        std::size_t local_bad = 0;
+        std::vector<std::size_t> local;
+        auto scan = [&](std::size_t r0, std::size_t r1) {
+            for (std::size_t i = r0; i < r1; i++) {
+                if (!row_diff(in, i)) continue;
+                local_bad++;
+                if (bad_rows && local.size() < max_report) local.push_back(i);
+            }
+        };
+
+        std::size_t i = begin;
+        for (; i + CHECK_BLOCK_ROWS <= end; i += CHECK_BLOCK_ROWS) {
+            uint64_t d = 0;
+            for (std::size_t k = 0; k < CHECK_BLOCK_ROWS; k++) d |= row_diff(in, i + k);
+            if (d) scan(i, i + CHECK_BLOCK_ROWS);
+        }
+        scan(i, end);
+
+        if (!local_bad) return;
+        std::lock_guard<std::mutex> g(lock);
+        n_bad += local_bad;
+        found.insert(found.end(), local.begin(), local.end());
+    });
+
+    if (bad_rows) {
+        // each chunk kept its lowest rows, so the lowest max_report overall are among them
+        std::sort(found.begin(), found.end());
+        if (found.size() > max_report) found.resize(max_report);
+        bad_rows->swap(found);
+    }
+    return n_bad;
+}
+
+} // namespace intmul_host
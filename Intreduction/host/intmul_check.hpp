@@ -0,0 +1,30 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "intmul.hpp"
+
+// ============================================================
+// IntMul relation checker: c_hi[i] || c_lo[i] == a[i] * b[i] for every row
+//
+// Meant to run ahead of the kernel, so that bad inputs are rejected before
+// they take device time. Rows are checked in blocks of CHECK_BLOCK_ROWS with
+// no branch per row: the differences of a block are ORed together and only
+// a failing block is scanned again row by row. The 64 x 64 -> 128 product
+// is one mul (mulx with -mbmi2), so the check is bound by the 32 bytes it
+// reads per row. Rows are split over threads.
+// ============================================================
+
+namespace intmul_host {
+
+static const std::size_t CHECK_BLOCK_ROWS = 16;
+
+// Number of rows that do not satisfy the relation. If bad_rows is given,
+// it gets the first (lowest) max_report of them in ascending order.
+std::size_t check_intmul_rows(const IntMulInputs& in, int threads,
+                              std::vector<std::size_t>* bad_rows = nullptr,
+                              std::size_t max_report = 64);
+
+} // namespace intmul_host
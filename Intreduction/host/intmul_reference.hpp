@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "ghash128.hpp"
+#include "intmul.hpp"
+
+// ============================================================
+// Host reference of the whole intmul_witness_step pipeline
+//
+//   a_root[i]          = g^a[i]                        (fixed-base tables)
+//   b_leaves[z*N + i]  = bit z of b[i] ? a_root[i]^(2^z) : 1
+//   prodcheck layers   : layer 0 = b_leaves, layer k+1[j] = layer k[j] * layer k[j + half]
+//   b_root             = layer 6 (N entries)
+//   c_root[i]          = g^c_lo[i] * g_c_hi^c_hi[i]
+//
+// Bit-exact with the kernel and the C simulation. Rows are split over
+// threads; unless leaves or layers are requested, each row runs
+// a_root -> squarings -> b_root in registers and only O(N) is held.
+// ============================================================
+
+namespace intmul_host {
+
+using ghash_host::u128_t;
+
+struct ReferenceOptions {
+    int threads;          // <= 0: one per hardware thread
+    bool keep_leaves;     // fill ReferenceResult::b_leaves (64 N entries)
+    bool keep_layers;     // fill ReferenceResult::layers (implies keep_leaves)
+
+    ReferenceOptions() : threads(0), keep_leaves(false), keep_layers(false) {}
+};
+
+struct ReferenceResult {
+    std::vector<u128_t> a_root;                 // N
+    std::vector<u128_t> b_leaves;               // 64 N z-major, if kept
+    std::vector<std::vector<u128_t>> layers;    // layers[k], (64 >> k) N entries, if kept
+    std::vector<u128_t> b_root;                 // N
+    std::vector<u128_t> c_root;                 // N
+    bool roots_match;
+    long mismatch_idx;                          // first row with b_root != c_root, -1 if none
+};
+
+void run_reference(const IntMulInputs& in, const ReferenceOptions& opt, ReferenceResult& out);
+
+// layers[0] = leaves (64 * n_rows, z-major) .. layers[LOG_BITS] = b_root
+void build_prodcheck_layers(const u128_t* leaves, std::size_t n_rows, int threads,
+                            std::vector<std::vector<u128_t>>& layers);
+
+} // namespace intmul_host
@@ -0,0 +1,189 @@
+#include "keccak.hpp"
+
+#include <cstring>
+
+namespace keccak_host {
+
+static const uint64_t RC[KECCAK_ROUNDS] = {
+    0x0000000000000001ull, 0x0000000000008082ull, 0x800000000000808aull, 0x8000000080008000ull,
+    0x000000000000808bull, 0x0000000080000001ull, 0x8000000080008081ull, 0x8000000000008009ull,
+    0x000000000000008aull, 0x0000000000000088ull, 0x0000000080008009ull, 0x000000008000000aull,
+    0x000000008000808bull, 0x800000000000008bull, 0x8000000000008089ull, 0x8000000000008003ull,
+    0x8000000000008002ull, 0x8000000000000080ull, 0x000000000000800aull, 0x800000008000000aull,
+    0x8000000080008081ull, 0x8000000000008080ull, 0x0000000080000001ull, 0x8000000080008008ull,
+};
+
+static inline uint64_t rotl(uint64_t x, int n) {
+    return n ? (x << n) | (x >> (64 - n)) : x;
+}
+
+// rho offsets, indexed x + 5 y
+static const int RHO[KECCAK_LANES] = {
+     0,  1, 62, 28, 27,
+    36, 44,  6, 55, 20,
+     3, 10, 43, 25, 39,
+    41, 45, 15, 21,  8,
+    18,  2, 61, 56, 14,
+};
+
+void keccak_f1600(uint64_t A[KECCAK_LANES]) {
+    // every inner loop fully unrolled: the lane indices become constants
+    // and the 25 lanes stay in registers across the steps
+    for (int round = 0; round < KECCAK_ROUNDS; round++) {
+        // theta
+        uint64_t C[5], D[5];
+#pragma GCC unroll 5
+        for (int x = 0; x < 5; x++)
+            C[x] = A[x] ^ A[x + 5] ^ A[x + 10] ^ A[x + 15] ^ A[x + 20];
+#pragma GCC unroll 5
+        for (int x = 0; x < 5; x++)
+            D[x] = C[(x + 4) % 5] ^ rotl(C[(x + 1) % 5], 1);
+
+        // theta + rho + pi: lane (x, y) moves to (y, 2x + 3y)
+        uint64_t B[KECCAK_LANES];
+#pragma GCC unroll 5
+        for (int y = 0; y < 5; y++)
+#pragma GCC unroll 5
+            for (int x = 0; x < 5; x++)
+                B[y + 5 * ((2 * x + 3 * y) % 5)] = rotl(A[x + 5 * y] ^ D[x], RHO[x + 5 * y]);
+
+        // chi
+#pragma GCC unroll 5
+        for (int y = 0; y < 25; y += 5)
+#pragma GCC unroll 5
+            for (int x = 0; x < 5; x++)
+                A[y + x] = B[y + x] ^ (~B[y + (x + 1) % 5] & B[y + (x + 2) % 5]);
+
+        // iota
+        A[0] ^= RC[round];
+    }
+}
+
+uint64_t keccak_rc(int round) {
+    return RC[round];
+}
+
+void keccak_round_witness(const uint64_t A[KECCAK_LANES], uint64_t w[30]) {
+    uint64_t C[5];
+#pragma GCC unroll 5
+    for (int x = 0; x < 5; x++)
+        C[x] = A[x] ^ A[x + 5] ^ A[x + 10] ^ A[x + 15] ^ A[x + 20];
+    uint64_t* D = w;
+#pragma GCC unroll 5
+    for (int x = 0; x < 5; x++)
+        D[x] = C[(x + 4) % 5] ^ rotl(C[(x + 1) % 5], 1);
+
+    uint64_t B[KECCAK_LANES];
+#pragma GCC unroll 5
+    for (int y = 0; y < 5; y++)
+#pragma GCC unroll 5
+        for (int x = 0; x < 5; x++)
+            B[y + 5 * ((2 * x + 3 * y) % 5)] = rotl(A[x + 5 * y] ^ D[x], RHO[x + 5 * y]);
+
+    uint64_t* chi = w + 5;
+#pragma GCC unroll 5
+    for (int y = 0; y < 25; y += 5)
+#pragma GCC unroll 5
+        for (int x = 0; x < 5; x++)
+            chi[y + x] = B[y + x] ^ (~B[y + (x + 1) % 5] & B[y + (x + 2) % 5]);
+}
+
+typedef uint64_t v4u64 __attribute__((vector_size(32)));
+
+// a macro, not a function: passing 32-byte vectors by value warns about the ABI without -mavx
+#define ROTL4(x, n) ((n) ? ((x) << (n)) | ((x) >> (64 - (n))) : (x))
+
+void keccak_f1600_x4(uint64_t A_[KECCAK_LANES][4]) {
+    // same steps as keccak_f1600, one GCC vector per lane
+    v4u64 A[KECCAK_LANES];
+    std::memcpy(A, A_, sizeof(A));
+    for (int round = 0; round < KECCAK_ROUNDS; round++) {
+        v4u64 C[5], D[5];
+#pragma GCC unroll 5
+        for (int x = 0; x < 5; x++)
+            C[x] = A[x] ^ A[x + 5] ^ A[x + 10] ^ A[x + 15] ^ A[x + 20];
+#pragma GCC unroll 5
+        for (int x = 0; x < 5; x++)
+            D[x] = C[(x + 4) % 5] ^ ROTL4(C[(x + 1) % 5], 1);
+
+        v4u64 B[KECCAK_LANES];
+#pragma GCC unroll 5
+        for (int y = 0; y < 5; y++)
+#pragma GCC unroll 5
+            for (int x = 0; x < 5; x++)
+                B[y + 5 * ((2 * x + 3 * y) % 5)] = ROTL4(A[x + 5 * y] ^ D[x], RHO[x + 5 * y]);
+
+#pragma GCC unroll 5
+        for (int y = 0; y < 25; y += 5)
+#pragma GCC unroll 5
+            for (int x = 0; x < 5; x++)
+                A[y + x] = B[y + x] ^ (~B[y + (x + 1) % 5] & B[y + (x + 2) % 5]);
+
+        A[0] ^= RC[round];
+    }
+    std::memcpy(A_, A, sizeof(A));
+}
+
+#undef ROTL4
+
+static Digest squeeze_digest(const uint64_t A[KECCAK_LANES]) {
+    Digest d;
+    for (int i = 0; i < 4; i++) d.w[i] = A[i];
+    return d;
+}
+
+Digest keccak256(const void* data, std::size_t len) {
+    const unsigned char* p = (const unsigned char*)data;
+    uint64_t A[KECCAK_LANES] = {};
+    const std::size_t block = 8 * KECCAK256_RATE_LANES;
+    for (; len >= block; p += block, len -= block) {
+        for (int i = 0; i < KECCAK256_RATE_LANES; i++) {
+            uint64_t w;
+            std::memcpy(&w, p + 8 * i, 8);
+            A[i] ^= w;
+        }
+        keccak_f1600(A);
+    }
+    // last partial block, then pad10*1 (0x01 ... 0x80)
+    for (std::size_t b = 0; b < len; b++) A[b / 8] ^= (uint64_t)p[b] << (8 * (b % 8));
+    A[len / 8] ^= (uint64_t)0x01 << (8 * (len % 8));
+    A[KECCAK256_RATE_LANES - 1] ^= 0x80ull << 56;
+    keccak_f1600(A);
+    return squeeze_digest(A);
+}
+
+Digest keccak256_words(const uint64_t* words, std::size_t n_words) {
+    uint64_t A[KECCAK_LANES] = {};
+    for (; n_words >= (std::size_t)KECCAK256_RATE_LANES;
+         words += KECCAK256_RATE_LANES, n_words -= KECCAK256_RATE_LANES) {
+        for (int i = 0; i < KECCAK256_RATE_LANES; i++) A[i] ^= words[i];
+        keccak_f1600(A);
+    }
+    for (std::size_t i = 0; i < n_words; i++) A[i] ^= words[i];
+    A[n_words] ^= 0x01;
+    A[KECCAK256_RATE_LANES - 1] ^= 0x80ull << 56;
+    keccak_f1600(A);
+    return squeeze_digest(A);
+}
+
+void keccak256_words_x4(const uint64_t* const msg[4], std::size_t n_words, Digest out[4]) {
+    uint64_t A[KECCAK_LANES][4] = {};
+    std::size_t off = 0;
+    for (; n_words - off >= (std::size_t)KECCAK256_RATE_LANES; off += KECCAK256_RATE_LANES) {
+        for (int i = 0; i < KECCAK256_RATE_LANES; i++)
+            for (int k = 0; k < 4; k++) A[i][k] ^= msg[k][off + i];
+        keccak_f1600_x4(A);
+    }
+    std::size_t rem = n_words - off;
+    for (std::size_t i = 0; i < rem; i++)
+        for (int k = 0; k < 4; k++) A[i][k] ^= msg[k][off + i];
+    for (int k = 0; k < 4; k++) {
+        A[rem][k] ^= 0x01;
+        A[KECCAK256_RATE_LANES - 1][k] ^= 0x80ull << 56;
+    }
+    keccak_f1600_x4(A);
+    for (int k = 0; k < 4; k++)
+        for (int i = 0; i < 4; i++) out[k].w[i] = A[i][k];
+}
+
+} // namespace keccak_host
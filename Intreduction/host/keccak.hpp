@@ -0,0 +1,54 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// ============================================================
+// Keccak-f[1600] permutation
+//
+// State lanes A[x + 5 y], the layout of ../../keccak_ref (A[0] is
+// lane (0, 0), bytes of the message map little-endian into the lanes).
+// Round constants / rotation offsets as in FIPS 202.
+// ============================================================
+
+namespace keccak_host {
+
+static const int KECCAK_LANES  = 25;
+static const int KECCAK_ROUNDS = 24;
+
+static const int KECCAK256_RATE_LANES = 17;   // 136-byte blocks
+
+void keccak_f1600(uint64_t A[KECCAK_LANES]);
+
+// Round constant of round r (iota)
+uint64_t keccak_rc(int round);
+
+// The force-committed values of one round applied to A (A is not changed):
+// w[0..5) = theta D[x], w[5..30) = lanes after chi, before iota.
+// The next state is those lanes with keccak_rc(round) XORed into lane 0.
+void keccak_round_witness(const uint64_t A[KECCAK_LANES], uint64_t w[30]);
+
+// Four independent states, lane-major: A[lane][k] is lane `lane` of state k.
+// The four permutations run in lock step on 256-bit vectors.
+void keccak_f1600_x4(uint64_t A[KECCAK_LANES][4]);
+
+// Keccak-256 digest as four little-endian lanes, byte j of the digest is
+// byte j % 8 of w[j / 8] (the bytes Keccak256::getHash writes).
+struct Digest {
+    uint64_t w[4];
+    bool operator==(const Digest& o) const {
+        return w[0] == o.w[0] && w[1] == o.w[1] && w[2] == o.w[2] && w[3] == o.w[3];
+    }
+    bool operator!=(const Digest& o) const { return !(*this == o); }
+};
+
+// Keccak-256 of len bytes
+Digest keccak256(const void* data, std::size_t len);
+
+// Keccak-256 of n_words little-endian u64 words (8 * n_words bytes), no copy
+Digest keccak256_words(const uint64_t* words, std::size_t n_words);
+
+// Four messages of n_words words each, hashed together with keccak_f1600_x4
+void keccak256_words_x4(const uint64_t* const msg[4], std::size_t n_words, Digest out[4]);
+
+} // namespace keccak_host
@@ -0,0 +1,101 @@
+#include "keccak_delta.hpp"
+
+#include <algorithm>
+
+#include "keccak.hpp"
+
+namespace keccak_host {
+
+// Walks the stream of n_blocks blocks in order. next(p) is called once per
+// word with its prediction p and returns the actual word, which updates
+// the state the following predictions come from.
+template <class Next>
+static inline void walk_witness(std::size_t n_blocks, Next next) {
+    uint64_t A[KECCAK_LANES] = {};
+    uint64_t pred[WITNESS_ROUND_WORDS];
+    for (std::size_t b = 0; b < n_blocks; b++) {
+        // round 0 is predicted without the block's message words
+        for (int r = 0; r < KECCAK_ROUNDS; r++) {
+            keccak_round_witness(A, pred);
+            for (int k = 0; k < 5; k++) next(pred[k]);
+            for (int i = 0; i < KECCAK_LANES; i++) A[i] = next(pred[5 + i]);
+            A[0] ^= keccak_rc(r);
+        }
+        if (b + 1 < n_blocks) A[0] = next(A[0]);
+    }
+}
+
+void delta_encode(const uint64_t* witness, std::size_t n_blocks, std::vector<uint64_t>& enc) {
+    const std::size_t n = witness_stream_words(n_blocks);
+    enc.resize(2 + n + (n + DELTA_GROUP - 1) / DELTA_GROUP);
+    enc[0] = DELTA_MAGIC;
+    enc[1] = n_blocks;
+
+    uint64_t* out = enc.data() + 2;
+    uint64_t* bitmap = out;
+    std::size_t i = 0;
+    walk_witness(n_blocks, [&](uint64_t p) {
+        if (i % DELTA_GROUP == 0) {
+            bitmap = out++;
+            *bitmap = 0;
+        }
+        uint64_t w = witness[i];
+        uint64_t d = w ^ p;
+        if (d) {
+            *bitmap |= 1ull << (i % DELTA_GROUP);
+            *out++ = d;
+        }
+        i++;
+        return w;
+    });
+    enc.resize(out - enc.data());
+}
+
+bool delta_decode(const uint64_t* enc, std::size_t enc_words, std::vector<uint64_t>& witness,
+                  std::string* err) {
+    auto fail = [&](const char* msg) {
+        if (err) *err = msg;
+        return false;
+    };
+    if (enc_words < 2 || enc[0] != DELTA_MAGIC) return fail("not a delta-coded witness");
+    const std::size_t n_blocks = enc[1];
+    // every group holds at least its bitmap
+    if (n_blocks > enc_words * DELTA_GROUP) return fail("block count exceeds the encoding");
+    const std::size_t n = witness_stream_words(n_blocks);
+    if ((n + DELTA_GROUP - 1) / DELTA_GROUP > enc_words - 2)
+        return fail("block count exceeds the encoding");
+    witness.resize(n);
+
+    const uint64_t* src = enc + 2;
+    const uint64_t* end = enc + enc_words;
+    uint64_t* dst = witness.data();
+    uint64_t bits = 0;
+    std::size_t i = 0;
+    bool ok = true;
+    walk_witness(n_blocks, [&](uint64_t p) {
+        if (i % DELTA_GROUP == 0) {
+            std::size_t len = std::min<std::size_t>(DELTA_GROUP, n - i);
+            if (src == end) {
+                ok = false;
+                bits = 0;
+            } else {
+                bits = *src++;
+                std::size_t nz = (std::size_t)__builtin_popcountll(bits);
+                if ((len < 64 && (bits >> len)) || nz > (std::size_t)(end - src)) {
+                    ok = false;
+                    bits = 0;
+                }
+            }
+        }
+        uint64_t w = p;
+        if (bits & 1) w ^= *src++;
+        bits >>= 1;
+        dst[i++] = w;
+        return w;
+    });
+    if (!ok) return fail("truncated or corrupt delta encoding");
+    if (src != end) return fail("trailing words after the delta encoding");
+    return true;
+}
+
+} // namespace keccak_host
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// ============================================================
+// Delta codec for the Keccak witness stream
+//
+// The stream is the layout of ../keccak_witness_stream.h: per block, 24
+// rounds of D[0..4] and the 25 post-chi lanes, then (between blocks) the
+// permutation output lane 0. Every word is sent as its XOR with a
+// prediction from the words before it: the round applied to the state the
+// previous round's lanes give (iota included). Inside a permutation the
+// prediction is exact, so a valid witness leaves non-zero deltas only in
+// round 0 of each block, where the absorbed message enters. Any stream
+// (valid or not) round-trips; wrong words just cost their delta.
+//
+// Deltas are coded in groups of 64: a bitmap of the non-zero deltas, then
+// those deltas. Encoded stream (u64 words):
+//   DELTA_MAGIC, n_blocks, { bitmap, non-zero deltas } per group
+// Decoding is one round evaluation per 30 words, so it runs at about the
+// rate the decoded words can be written.
+// ============================================================
+
+namespace keccak_host {
+
+static const int WITNESS_ROUND_WORDS = 30;
+static const int WITNESS_BLOCK_WORDS = 24 * WITNESS_ROUND_WORDS;
+
+static const uint64_t DELTA_MAGIC = 0x31544c4544574b00ull;   // "\0KWDELT1"
+static const int DELTA_GROUP = 64;
+
+// Words of the witness stream for n_blocks absorbed blocks
+static inline std::size_t witness_stream_words(std::size_t n_blocks) {
+    return n_blocks ? n_blocks * (WITNESS_BLOCK_WORDS + 1) - 1 : 0;
+}
+
+// witness holds witness_stream_words(n_blocks) words
+void delta_encode(const uint64_t* witness, std::size_t n_blocks, std::vector<uint64_t>& enc);
+
+// Fails (err set) on a malformed or truncated encoding
+bool delta_decode(const uint64_t* enc, std::size_t enc_words, std::vector<uint64_t>& witness,
+                  std::string* err);
+
+} // namespace keccak_host
@@ -0,0 +1,126 @@
+#include "merkle.hpp"
+
+#include <algorithm>
+
+#include "intmul.hpp"
+
+namespace intmul_host {
+
+using keccak_host::keccak256_words;
+using keccak_host::keccak256_words_x4;
+
+// Levels smaller than this are hashed on the calling thread
+static const std::size_t PARALLEL_MIN_NODES = 1024;
+
+static Digest hash_pair(const Digest& l, const Digest& r) {
+    uint64_t m[8] = { l.w[0], l.w[1], l.w[2], l.w[3], r.w[0], r.w[1], r.w[2], r.w[3] };
+    return keccak256_words(m, 8);
+}
+
+// out[j] = H(msg_j), msg_j = base + j * stride, words words each, j in [begin, end)
+static void hash_range(const uint64_t* base, std::size_t stride, std::size_t words,
+                       std::size_t begin, std::size_t end, Digest* out) {
+    std::size_t j = begin;
+    for (; j + 4 <= end; j += 4) {
+        const uint64_t* msg[4] = { base + j * stride, base + (j + 1) * stride,
+                                   base + (j + 2) * stride, base + (j + 3) * stride };
+        keccak256_words_x4(msg, words, out + j);
+    }
+    for (; j < end; j++) out[j] = keccak256_words(base + j * stride, words);
+}
+
+static void hash_level(const uint64_t* base, std::size_t stride, std::size_t words,
+                       std::size_t count, Digest* out, int threads) {
+    if (count < PARALLEL_MIN_NODES) threads = 1;
+    // chunks in multiples of 4 keep every thread on the x4 path
+    std::size_t groups = (count + 3) / 4;
+    parallel_for(groups, threads, [&](std::size_t g0, std::size_t g1) {
+        hash_range(base, stride, words, 4 * g0, std::min(count, 4 * g1), out);
+    });
+}
+
+bool MerkleTree::commit(const uint64_t* words, std::size_t n_words, int threads) {
+    if (leaf_words_ == 0 || leaf_words_ == NODE_WORDS || n_words % leaf_words_) return false;
+    std::size_t n = n_words / leaf_words_;
+    if (n == 0 || (n & (n - 1))) return false;
+
+    n_leaves_ = n;
+    depth_ = 0;
+    while (((std::size_t)1 << depth_) < n) depth_++;
+    level_offset_.assign(depth_ + 2, 0);
+    for (std::size_t l = 0; l <= depth_; l++) level_offset_[l + 1] = level_offset_[l] + (n >> l);
+    nodes_.resize(level_offset_[depth_ + 1]);
+
+    hash_level(words, leaf_words_, leaf_words_, n, nodes_.data(), threads);
+    for (std::size_t l = 1; l <= depth_; l++) {
+        // a Digest is 4 words, so a pair of children is one 8-word message
+        const uint64_t* child = nodes_[level_offset_[l - 1]].w;
+        hash_level(child, NODE_WORDS, NODE_WORDS, n >> l, &nodes_[level_offset_[l]], threads);
+    }
+    return true;
+}
+
+bool MerkleTree::open(std::vector<std::size_t> indices, MerkleMultiProof& proof) const {
+    std::sort(indices.begin(), indices.end());
+    indices.erase(std::unique(indices.begin(), indices.end()), indices.end());
+    if (indices.empty() || indices.back() >= n_leaves_) return false;
+
+    proof.indices = indices;
+    proof.siblings.clear();
+    std::vector<std::size_t> known = indices;
+    for (std::size_t l = 0; l < depth_; l++) {
+        std::vector<std::size_t> parents;
+        for (std::size_t k = 0; k < known.size(); k++) {
+            std::size_t j = known[k];
+            if ((j & 1) == 0 && k + 1 < known.size() && known[k + 1] == j + 1) {
+                k++;   // both children known
+            } else {
+                proof.siblings.push_back(node(l, j ^ 1));
+            }
+            parents.push_back(j >> 1);
+        }
+        known.swap(parents);
+    }
+    return true;
+}
+
+bool merkle_verify(const Digest& root, std::size_t depth, std::size_t leaf_words,
+                   const MerkleMultiProof& proof, const uint64_t* leaves) {
+    const std::vector<std::size_t>& idx = proof.indices;
+    if (idx.empty() || leaf_words == 0 || leaf_words == MerkleTree::NODE_WORDS) return false;
+    for (std::size_t k = 0; k < idx.size(); k++) {
+        if ((idx[k] >> depth) != 0) return false;
+        if (k && idx[k] <= idx[k - 1]) return false;
+    }
+
+    std::vector<std::size_t> known = idx;
+    std::vector<Digest> hashes(idx.size());
+    hash_range(leaves, leaf_words, leaf_words, 0, idx.size(), hashes.data());
+
+    std::size_t s = 0;
+    for (std::size_t l = 0; l < depth; l++) {
+        std::vector<std::size_t> parents;
+        std::vector<Digest> up;
+        for (std::size_t k = 0; k < known.size(); k++) {
+            std::size_t j = known[k];
+            Digest left, right;
+            if ((j & 1) == 0 && k + 1 < known.size() && known[k + 1] == j + 1) {
+                left = hashes[k];
+                right = hashes[k + 1];
+                k++;
+            } else {
+                if (s == proof.siblings.size()) return false;
+                const Digest& sib = proof.siblings[s++];
+                left  = (j & 1) ? sib : hashes[k];
+                right = (j & 1) ? hashes[k] : sib;
+            }
+            parents.push_back(j >> 1);
+            up.push_back(hash_pair(left, right));
+        }
+        known.swap(parents);
+        hashes.swap(up);
+    }
+    return s == proof.siblings.size() && hashes[0] == root;
+}
+
+} // namespace intmul_host
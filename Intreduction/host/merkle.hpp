@@ -0,0 +1,79 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+#include "keccak.hpp"
+
+// ============================================================
+// Keccak-256 Merkle commitment over witness words
+//
+// The committed words are cut into leaves of leaf_words u64 words each
+// (16 words = 128 bytes, one permutation per leaf), leaf hash =
+// Keccak256(leaf bytes), node = Keccak256(left || right). The leaf count
+// must be a power of two.
+//
+// Leaves and nodes are told apart by length: a node hashes 8 words, and
+// leaf_words = 8 is rejected, so no leaf message can pass for a node
+// (Keccak's padding keeps messages of different lengths apart).
+//
+// Levels are built bottom-up, each level split over threads and hashed
+// four nodes at a time with keccak_f1600_x4.
+//
+// Multi-path openings: for a sorted set of leaf indices the proof holds,
+// level by level and in index order, only the siblings that cannot be
+// recomputed from the opened leaves themselves.
+// ============================================================
+
+namespace intmul_host {
+
+using keccak_host::Digest;
+
+struct MerkleMultiProof {
+    std::vector<std::size_t> indices;   // opened leaves, sorted, unique
+    std::vector<Digest> siblings;
+};
+
+class MerkleTree {
+public:
+    static const std::size_t DEFAULT_LEAF_WORDS = 16;
+    static const std::size_t NODE_WORDS = 8;   // left || right, never a leaf size
+
+    explicit MerkleTree(std::size_t leaf_words = DEFAULT_LEAF_WORDS)
+        : leaf_words_(leaf_words), n_leaves_(0), depth_(0) {}
+
+    // n_words / leaf_words leaves; false unless that is a power of two, or
+    // for leaf_words 0 or NODE_WORDS
+    bool commit(const uint64_t* words, std::size_t n_words, int threads);
+
+    // all-zero digest before the first successful commit
+    const Digest& root() const { return nodes_.empty() ? empty_root_ : nodes_.back(); }
+    std::size_t leaf_words() const { return leaf_words_; }
+    std::size_t n_leaves() const { return n_leaves_; }
+    std::size_t depth() const { return depth_; }
+
+    // Node j of level l (level 0 = leaf hashes, level depth() = root)
+    const Digest& node(std::size_t level, std::size_t j) const {
+        return nodes_[level_offset_[level] + j];
+    }
+
+    // indices need not be sorted; duplicates are dropped. False if none is
+    // given or one is not below n_leaves().
+    bool open(std::vector<std::size_t> indices, MerkleMultiProof& proof) const;
+
+private:
+    std::size_t leaf_words_;
+    std::size_t n_leaves_;
+    std::size_t depth_;
+    std::vector<Digest> nodes_;                // all levels, leaves first
+    std::vector<std::size_t> level_offset_;
+    Digest empty_root_ = {};
+};
+
+// leaves: the opened leaves' words, proof.indices order, leaf_words each
+// (never NODE_WORDS)
+bool merkle_verify(const Digest& root, std::size_t depth, std::size_t leaf_words,
+                   const MerkleMultiProof& proof, const uint64_t* leaves);
+
+} // namespace intmul_host
@@ -0,0 +1,121 @@
+#include "mle.hpp"
+
+#include <mutex>
+
+#include "intmul.hpp"
+
+namespace intmul_host {
+
+using ghash_host::clmul128;
+using ghash_host::ghash_mul;
+using ghash_host::gf_one;
+using ghash_host::reduce;
+using ghash_host::wide256;
+using ghash_host::wide_xor;
+using ghash_host::wide_zero;
+
+void eq_table(const u128_t* point, std::size_t n_vars, u128_t* out) {
+    out[0] = gf_one();
+    for (std::size_t i = 0; i < n_vars; i++) {
+        // entries with bit i set: * r_i, clear: * (1 + r_i)
+        std::size_t len = (std::size_t)1 << i;
+        for (std::size_t j = 0; j < len; j++) {
+            u128_t hi = ghash_mul(out[j], point[i]);
+            out[j + len] = hi;
+            out[j] ^= hi;
+        }
+    }
+}
+
+u128_t eq_eval(const u128_t* a, const u128_t* b, std::size_t n_vars) {
+    u128_t r = gf_one();
+    for (std::size_t i = 0; i < n_vars; i++) r = ghash_mul(r, gf_one() ^ a[i] ^ b[i]);
+    return r;
+}
+
+void fold_top(u128_t* table, std::size_t len, u128_t r, int threads) {
+    std::size_t half = len / 2;
+    parallel_for(half, threads, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t j = begin; j < end; j++) {
+            table[j] ^= ghash_mul(r, table[j] ^ table[j + half]);
+        }
+    });
+}
+
+void fold_top_k(u128_t* table, std::size_t n_vars, const u128_t* r, std::size_t k, int threads) {
+    std::size_t out_len = (std::size_t)1 << (n_vars - k);
+    std::vector<u128_t> w((std::size_t)1 << k);
+    eq_table(r, k, w.data());
+
+    // entry j only reads j, j + out_len, j + 2 out_len, ...; writing j back
+    // never clobbers another entry's input
+    parallel_for(out_len, threads, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t j = begin; j < end; j++) {
+            wide256 acc = wide_zero();
+            for (std::size_t h = 0; h < w.size(); h++) wide_xor(acc, clmul128(w[h], table[h * out_len + j]));
+            table[j] = reduce(acc);
+        }
+    });
+}
+
+u128_t mle_eval(const u128_t* table, std::size_t n_vars, const u128_t* point, int threads) {
+    // eq(point, x) = eq(point_lo, x_lo) * eq(point_hi, x_hi), x = x_hi * L + x_lo
+    std::size_t n_lo = n_vars / 2;
+    std::size_t L = (std::size_t)1 << n_lo;
+    std::size_t H = (std::size_t)1 << (n_vars - n_lo);
+    std::vector<u128_t> e_lo(L), e_hi(H);
+    eq_table(point, n_lo, e_lo.data());
+    eq_table(point + n_lo, n_vars - n_lo, e_hi.data());
+
+    wide256 total = wide_zero();
+    std::mutex lock;
+    parallel_for(H, threads, [&](std::size_t begin, std::size_t end) {
+        wide256 outer = wide_zero();
+        for (std::size_t h = begin; h < end; h++) {
+            const u128_t* row = table + h * L;
+            wide256 inner = wide_zero();
+            for (std::size_t l = 0; l < L; l++) wide_xor(inner, clmul128(e_lo[l], row[l]));
+            wide_xor(outer, clmul128(e_hi[h], reduce(inner)));
+        }
+        std::lock_guard<std::mutex> g(lock);
+        wide_xor(total, outer);
+    });
+    return reduce(total);
+}
+
+MleStreamEval::MleStreamEval(const u128_t* point, std::size_t n_vars)
+    : n_vars_(n_vars), n_lo_(n_vars / 2), pos_(0),
+      e_lo_((std::size_t)1 << (n_vars / 2)), e_hi_((std::size_t)1 << (n_vars - n_vars / 2)),
+      inner_(wide_zero()), outer_(wide_zero()) {
+    eq_table(point, n_lo_, e_lo_.data());
+    eq_table(point + n_lo_, n_vars - n_lo_, e_hi_.data());
+}
+
+void MleStreamEval::push(const u128_t* values, std::size_t count) {
+    std::size_t mask = e_lo_.size() - 1;
+    for (std::size_t i = 0; i < count; i++, pos_++) {
+        wide_xor(inner_, clmul128(e_lo_[pos_ & mask], values[i]));
+        if ((pos_ & mask) == mask) {
+            wide_xor(outer_, clmul128(e_hi_[pos_ >> n_lo_], reduce(inner_)));
+            inner_ = wide_zero();
+        }
+    }
+}
+
+MleStreamFolder::MleStreamFolder(const u128_t* r, std::size_t k)
+    : run_((std::size_t)1 << k), pos_(0), weights_((std::size_t)1 << k), acc_(wide_zero()) {
+    eq_table(r, k, weights_.data());
+}
+
+void MleStreamFolder::push(const u128_t* values, std::size_t count, std::vector<u128_t>& out) {
+    for (std::size_t i = 0; i < count; i++) {
+        wide_xor(acc_, clmul128(weights_[pos_], values[i]));
+        if (++pos_ == run_) {
+            out.push_back(reduce(acc_));
+            acc_ = wide_zero();
+            pos_ = 0;
+        }
+    }
+}
+
+} // namespace intmul_host
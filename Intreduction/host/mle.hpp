@@ -0,0 +1,81 @@
+#pragma once
+
+#include <cstddef>
+#include <vector>
+
+#include "ghash128.hpp"
+
+// ============================================================
+// Multilinear extensions over GF(2^128)
+//
+// A table of 2^n values is the multilinear polynomial whose value at the
+// boolean point x is table[sum_i x_i 2^i]: variable i is bit i of the
+// index, so the top variable splits the table into its two halves.
+//
+// eq(r, x) = prod_i (r_i x_i + (1 + r_i)(1 + x_i)) = prod_i (1 + r_i + x_i)
+//
+// Evaluation and multi-variable folds read the table once and spend one
+// carry-less product per entry: eq splits into a low and a high tensor
+// of ~2^(n/2) entries each (they stay in cache), and products are XORed
+// unreduced (wide256), with one reduction per block. That keeps them
+// memory-bandwidth bound instead of multiply bound.
+// ============================================================
+
+namespace intmul_host {
+
+using ghash_host::u128_t;
+
+// out[x] = eq(point, x) for the 2^n boolean x
+void eq_table(const u128_t* point, std::size_t n_vars, u128_t* out);
+
+// eq(a, b) at two arbitrary points
+u128_t eq_eval(const u128_t* a, const u128_t* b, std::size_t n_vars);
+
+// Bind the top variable to r in place: t[j] += r * (t[j] + t[j + len / 2]),
+// the table shrinks to len / 2.
+void fold_top(u128_t* table, std::size_t len, u128_t r, int threads);
+
+// Bind the top k variables in one pass, in place: r[i] binds variable
+// n_vars - k + i, the table shrinks to 2^(n_vars - k) entries.
+void fold_top_k(u128_t* table, std::size_t n_vars, const u128_t* r, std::size_t k, int threads);
+
+// Value of the MLE of table (2^n_vars entries) at point
+u128_t mle_eval(const u128_t* table, std::size_t n_vars, const u128_t* point, int threads);
+
+// Out-of-core evaluation: the table arrives in index order, in pieces of
+// any size; only the two eq tensors are held.
+class MleStreamEval {
+public:
+    MleStreamEval(const u128_t* point, std::size_t n_vars);
+
+    void push(const u128_t* values, std::size_t count);
+
+    bool done() const { return pos_ == ((std::size_t)1 << n_vars_); }
+    u128_t result() const { return ghash_host::reduce(outer_); }
+
+private:
+    std::size_t n_vars_;
+    std::size_t n_lo_;
+    std::size_t pos_;
+    std::vector<u128_t> e_lo_, e_hi_;
+    ghash_host::wide256 inner_, outer_;
+};
+
+// Out-of-core fold of the low k variables (r[i] binds variable i): every
+// run of 2^k consecutive entries becomes one output entry, so the table
+// streams from and to storage in order.
+class MleStreamFolder {
+public:
+    MleStreamFolder(const u128_t* r, std::size_t k);
+
+    // Appends one value to out per completed run of 2^k inputs.
+    void push(const u128_t* values, std::size_t count, std::vector<u128_t>& out);
+
+private:
+    std::size_t run_;
+    std::size_t pos_;
+    std::vector<u128_t> weights_;
+    ghash_host::wide256 acc_;
+};
+
+} // namespace intmul_host
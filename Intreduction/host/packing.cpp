@@ -0,0 +1,66 @@
+#include "packing.hpp"
+
+#include <cstring>
+
+#include "bit_transpose.hpp"
+#include "intmul.hpp"
+
+namespace intmul_host {
+
+// lane 0 = low word, the in-memory order of u128_t
+typedef uint64_t v2u64 __attribute__((vector_size(16)));
+
+void pack_pairs(const uint64_t* words, std::size_t n_words, u128_t* out, int threads) {
+    std::size_t n_full = n_words / 2;
+    parallel_for(n_full, threads, [&](std::size_t begin, std::size_t end) {
+        std::memcpy(out + begin, words + 2 * begin, (end - begin) * sizeof(u128_t));
+    });
+    if (n_words & 1) out[n_full] = words[n_words - 1];
+}
+
+static inline std::size_t column_index(PackLayout layout, std::size_t groups, int z, std::size_t k) {
+    return layout == PACK_COLUMN_MAJOR ? (std::size_t)z * groups + k : k * PACK_COLUMNS + z;
+}
+
+void pack_columns(const uint64_t* words, std::size_t n_words, u128_t* out, PackLayout layout,
+                  int threads) {
+    const std::size_t groups = (n_words + PACK_GROUP_ROWS - 1) / PACK_GROUP_ROWS;
+    parallel_for(groups, threads, [&](std::size_t g0, std::size_t g1) {
+        for (std::size_t k = g0; k < g1; k++) {
+            const uint64_t* w = words + k * PACK_GROUP_ROWS;
+            std::size_t rows = n_words - k * PACK_GROUP_ROWS;
+            v2u64 m[64];
+            if (rows >= (std::size_t)PACK_GROUP_ROWS) {
+                for (int i = 0; i < 64; i++) m[i] = (v2u64){ w[i], w[i + 64] };
+            } else {
+                for (int i = 0; i < 64; i++)
+                    m[i] = (v2u64){ (std::size_t)i < rows ? w[i] : 0,
+                                    (std::size_t)(i + 64) < rows ? w[i + 64] : 0 };
+            }
+            transpose64_lanes(m);
+            for (int z = 0; z < PACK_COLUMNS; z++)
+                std::memcpy(&out[column_index(layout, groups, z, k)], &m[z], sizeof(u128_t));
+        }
+    });
+}
+
+void unpack_columns(const u128_t* cols, std::size_t n_words, uint64_t* words, PackLayout layout,
+                    int threads) {
+    const std::size_t groups = (n_words + PACK_GROUP_ROWS - 1) / PACK_GROUP_ROWS;
+    parallel_for(groups, threads, [&](std::size_t g0, std::size_t g1) {
+        for (std::size_t k = g0; k < g1; k++) {
+            v2u64 m[64];
+            for (int z = 0; z < PACK_COLUMNS; z++)
+                std::memcpy(&m[z], &cols[column_index(layout, groups, z, k)], sizeof(u128_t));
+            transpose64_lanes(m);
+            uint64_t* w = words + k * PACK_GROUP_ROWS;
+            std::size_t rows = n_words - k * PACK_GROUP_ROWS;
+            for (int i = 0; i < 64; i++) {
+                if ((std::size_t)i < rows) w[i] = m[i][0];
+                if ((std::size_t)(i + 64) < rows) w[i + 64] = m[i][1];
+            }
+        }
+    });
+}
+
+} // namespace intmul_host
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "ghash128.hpp"
+
+// ============================================================
+// Packing u64 value-vector words into GF(2^128) elements
+//
+// pack_pairs: element j = words[2j] + x^64 words[2j + 1].
+//
+// pack_columns: the words as a 64-column bit matrix, one row per word,
+// cut into groups of 128 rows. Element (z, k) holds column z of group k:
+// bit i = bit z of words[128 k + i]. Column-major order (z * groups + k)
+// is the committed multilinear layout, with the same z-major split as
+// b_leaves. Group-major order (k * 64 + z) is what the streaming kernel
+// ../pack_columns_stream.cpp emits. A short last group is zero-padded.
+//
+// One group is two 64 x 64 transposes (rows 0..63 and 64..127) run side
+// by side in the two lanes of a 128-bit vector, so every transposed
+// vector already is the packed element.
+// ============================================================
+
+namespace intmul_host {
+
+using ghash_host::u128_t;
+
+static const int PACK_GROUP_ROWS = 128;
+static const int PACK_COLUMNS    = 64;
+
+enum PackLayout { PACK_COLUMN_MAJOR, PACK_GROUP_MAJOR };
+
+void pack_pairs(const uint64_t* words, std::size_t n_words, u128_t* out, int threads);
+
+// 64 elements per started group of 128 words
+static inline std::size_t packed_column_count(std::size_t n_words) {
+    return PACK_COLUMNS * ((n_words + PACK_GROUP_ROWS - 1) / PACK_GROUP_ROWS);
+}
+
+void pack_columns(const uint64_t* words, std::size_t n_words, u128_t* out, PackLayout layout,
+                  int threads);
+
+// Inverse of pack_columns, writes the n_words words back
+void unpack_columns(const u128_t* cols, std::size_t n_words, uint64_t* words, PackLayout layout,
+                    int threads);
+
+} // namespace intmul_host
@@ -0,0 +1,191 @@
+#include "sumcheck.hpp"
+
+#include <mutex>
+
+#include "intmul.hpp"
+#include "mle.hpp"
+
+namespace intmul_host {
+
+using ghash_host::clmul128;
+using ghash_host::ghash_mul;
+using ghash_host::gf_inv;
+using ghash_host::gf_mul_x;
+using ghash_host::reduce;
+using ghash_host::wide256;
+using ghash_host::wide_xor;
+using ghash_host::wide_zero;
+
+// evaluation points 0, 1, x, x + 1
+static const u128_t ROUND_POINTS[4] = { 0, 1, 2, 3 };
+
+u128_t round_poly_eval(const RoundPoly& p, u128_t r) {
+    // Lagrange basis, denominators prod_{j != i} (p_i + p_j) inverted once
+    static const struct Denoms {
+        u128_t inv[4];
+        Denoms() {
+            for (int i = 0; i < 4; i++) {
+                u128_t d = ghash_host::gf_one();
+                for (int j = 0; j < 4; j++)
+                    if (j != i) d = ghash_mul(d, ROUND_POINTS[i] ^ ROUND_POINTS[j]);
+                inv[i] = gf_inv(d);
+            }
+        }
+    } denoms;
+
+    u128_t sum = 0;
+    for (int i = 0; i < 4; i++) {
+        u128_t l = denoms.inv[i];
+        for (int j = 0; j < 4; j++)
+            if (j != i) l = ghash_mul(l, r ^ ROUND_POINTS[j]);
+        sum ^= ghash_mul(l, p.at[i]);
+    }
+    return sum;
+}
+
+ChallengeFn transcript_challenges(Transcript& t) {
+    Transcript* tp = &t;
+    return [tp](const RoundPoly& p) {
+        tp->absorb_u128s(p.at, 4);
+        return tp->challenge();
+    };
+}
+
+ProdcheckSumcheckProver::ProdcheckSumcheckProver(const u128_t* layer, std::size_t n_vars,
+                                                 const u128_t* point, u128_t claim, int threads)
+    : n_vars_(n_vars), cur_vars_(n_vars), claim_(claim), threads_(threads) {
+    std::size_t len = (std::size_t)1 << n_vars;
+    eq_.resize(len);
+    eq_table(point, n_vars, eq_.data());
+    lo_.assign(layer, layer + len);
+    hi_.assign(layer + len, layer + 2 * len);
+}
+
+RoundPoly ProdcheckSumcheckProver::round_poly() const {
+    std::size_t half = ((std::size_t)1 << cur_vars_) / 2;
+    const u128_t* eq = eq_.data();
+    const u128_t* lo = lo_.data();
+    const u128_t* hi = hi_.data();
+
+    RoundPoly p = {{0, 0, 0, 0}};
+    std::mutex lock;
+    parallel_for(half, threads_, [&](std::size_t begin, std::size_t end) {
+        // last product of each term stays unreduced until the end of the chunk
+        wide256 s0 = wide_zero(), s2 = wide_zero(), s3 = wide_zero();
+        for (std::size_t j = begin; j < end; j++) {
+            // a(t) = a[j] + t (a[j] + a[j + half]) at t = 0, x, x + 1
+            u128_t de = eq[j] ^ eq[j + half];
+            u128_t dl = lo[j] ^ lo[j + half];
+            u128_t dh = hi[j] ^ hi[j + half];
+            u128_t e2 = eq[j] ^ gf_mul_x(de), l2 = lo[j] ^ gf_mul_x(dl), h2 = hi[j] ^ gf_mul_x(dh);
+            wide_xor(s0, clmul128(ghash_mul(eq[j], lo[j]), hi[j]));
+            wide_xor(s2, clmul128(ghash_mul(e2, l2), h2));
+            wide_xor(s3, clmul128(ghash_mul(e2 ^ de, l2 ^ dl), h2 ^ dh));
+        }
+        std::lock_guard<std::mutex> g(lock);
+        p.at[0] ^= reduce(s0);
+        p.at[2] ^= reduce(s2);
+        p.at[3] ^= reduce(s3);
+    });
+    p.at[1] = claim_ ^ p.at[0];
+    return p;
+}
+
+void ProdcheckSumcheckProver::fold(u128_t r, const RoundPoly& p) {
+    std::size_t len = (std::size_t)1 << cur_vars_;
+    fold_top(eq_.data(), len, r, threads_);
+    fold_top(lo_.data(), len, r, threads_);
+    fold_top(hi_.data(), len, r, threads_);
+    claim_ = round_poly_eval(p, r);
+    cur_vars_--;
+}
+
+// challenges arrive for variables m-1, m-2, ..., 0
+static void finish_point(std::vector<u128_t>& rho) {
+    for (std::size_t i = 0, j = rho.size(); i + 1 < j; i++, j--) std::swap(rho[i], rho[j - 1]);
+}
+
+LayerProof prove_layer(const std::vector<u128_t>& layer, LayerClaim& claim,
+                       const ChallengeFn& next, int threads) {
+    std::size_t m = claim.point.size();
+    ProdcheckSumcheckProver prover(layer.data(), m, claim.point.data(), claim.value, threads);
+
+    LayerProof proof;
+    std::vector<u128_t> rho;
+    for (std::size_t k = 0; k < m; k++) {
+        RoundPoly p = prover.round_poly();
+        proof.rounds.push_back(p);
+        u128_t r = next(p);
+        rho.push_back(r);
+        prover.fold(r, p);
+    }
+    finish_point(rho);
+    proof.lo_eval = prover.lo_eval();
+    proof.hi_eval = prover.hi_eval();
+
+    // top variable of layer k: lo + t (lo + hi)
+    RoundPoly last = {{proof.lo_eval, proof.hi_eval, 0, 0}};
+    u128_t t = next(last);
+    rho.push_back(t);
+    claim.point = rho;
+    claim.value = proof.lo_eval ^ ghash_mul(t, proof.lo_eval ^ proof.hi_eval);
+    return proof;
+}
+
+bool verify_layer(const LayerProof& proof, LayerClaim& claim, const ChallengeFn& next) {
+    std::size_t m = claim.point.size();
+    if (proof.rounds.size() != m) return false;
+
+    u128_t v = claim.value;
+    std::vector<u128_t> rho;
+    for (std::size_t k = 0; k < m; k++) {
+        const RoundPoly& p = proof.rounds[k];
+        if ((p.at[0] ^ p.at[1]) != v) return false;
+        u128_t r = next(p);
+        rho.push_back(r);
+        v = round_poly_eval(p, r);
+    }
+    finish_point(rho);
+
+    u128_t eq = eq_eval(claim.point.data(), rho.data(), m);
+    if (ghash_mul(ghash_mul(eq, proof.lo_eval), proof.hi_eval) != v) return false;
+
+    RoundPoly last = {{proof.lo_eval, proof.hi_eval, 0, 0}};
+    u128_t t = next(last);
+    rho.push_back(t);
+    claim.point = rho;
+    claim.value = proof.lo_eval ^ ghash_mul(t, proof.lo_eval ^ proof.hi_eval);
+    return true;
+}
+
+bool prove_prodcheck(const std::vector<std::vector<u128_t>>& layers, LayerClaim& claim,
+                     const ChallengeFn& next, int threads, std::vector<LayerProof>& proof,
+                     std::string* err) {
+    auto fail = [&](const char* msg) {
+        if (err) *err = msg;
+        return false;
+    };
+    if (layers.empty()) return fail("prodcheck without layers");
+    if (claim.point.size() >= 64 || layers.back().size() != (std::size_t)1 << claim.point.size())
+        return fail("claim point does not match the top layer");
+    for (std::size_t k = 0; k + 1 < layers.size(); k++) {
+        if (layers[k].size() != 2 * layers[k + 1].size())
+            return fail("layer sizes do not halve towards the root");
+    }
+
+    proof.clear();
+    for (std::size_t k = layers.size() - 1; k-- > 0;) {
+        proof.push_back(prove_layer(layers[k], claim, next, threads));
+    }
+    return true;
+}
+
+bool verify_prodcheck(const std::vector<LayerProof>& proof, LayerClaim& claim,
+                      const ChallengeFn& next) {
+    for (const LayerProof& p : proof) {
+        if (!verify_layer(p, claim, next)) return false;
+    }
+    return true;
+}
+
+} // namespace intmul_host
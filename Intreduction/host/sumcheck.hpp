@@ -0,0 +1,104 @@
+#pragma once
+
+#include <cstddef>
+#include <functional>
+#include <string>
+#include <vector>
+
+#include "ghash128.hpp"
+#include "transcript.hpp"
+
+// ============================================================
+// Prodcheck sumcheck over GF(2^128)
+//
+// Layers of the product tree (intmul_reference.hpp): layer k+1 is
+// lo * hi, lo / hi the two halves of layer k. A claim v = L_{k+1}(r)
+// on the m-variate layer k+1 is the sum
+//
+//     v = sum_{x in {0,1}^m} eq(r, x) * lo(x) * hi(x)
+//
+// which the sumcheck reduces, one variable per round, to lo(rho) and
+// hi(rho) at the challenge point rho. A last challenge t on the top
+// variable gives the claim L_k(rho, t) = lo + t (lo + hi) on layer k.
+//
+// Round polynomials have degree 3 and are sent as their values at the
+// field elements 0, 1, x, x + 1. Every round binds the top remaining
+// variable, so the tables fold in place into their lower half.
+// ============================================================
+
+namespace intmul_host {
+
+using ghash_host::u128_t;
+
+// Degree-3 round polynomial by its values at 0, 1, x, x + 1
+struct RoundPoly {
+    u128_t at[4];
+};
+
+u128_t round_poly_eval(const RoundPoly& p, u128_t r);
+
+// Transcript hook: sees each round polynomial, returns the next challenge.
+// After the last round of a layer it gets {lo(rho), hi(rho), 0, 0} and
+// returns the challenge t for the top variable.
+typedef std::function<u128_t(const RoundPoly&)> ChallengeFn;
+
+// Fiat-Shamir: absorbs the four values of each round polynomial into t and
+// squeezes the challenge. Prover and verifier each run their own transcript
+// from the same label and the same absorbed claim.
+ChallengeFn transcript_challenges(Transcript& t);
+
+class ProdcheckSumcheckProver {
+public:
+    // layer: 2^(n_vars + 1) entries, point: n_vars coordinates, claim = L_{k+1}(point)
+    ProdcheckSumcheckProver(const u128_t* layer, std::size_t n_vars, const u128_t* point,
+                            u128_t claim, int threads);
+
+    std::size_t n_rounds() const { return n_vars_; }
+    std::size_t rounds_done() const { return n_vars_ - cur_vars_; }
+
+    // Round polynomial of the current round
+    RoundPoly round_poly() const;
+
+    // Ingest the challenge: binds the top remaining variable and updates the claim
+    void fold(u128_t r, const RoundPoly& p);
+
+    // lo(rho), hi(rho) once every round is done
+    u128_t lo_eval() const { return lo_[0]; }
+    u128_t hi_eval() const { return hi_[0]; }
+
+private:
+    std::size_t n_vars_;
+    std::size_t cur_vars_;
+    u128_t claim_;
+    int threads_;
+    std::vector<u128_t> eq_, lo_, hi_;
+};
+
+// Claim value = L(point) on one layer
+struct LayerClaim {
+    std::vector<u128_t> point;
+    u128_t value;
+};
+
+struct LayerProof {
+    std::vector<RoundPoly> rounds;
+    u128_t lo_eval;
+    u128_t hi_eval;
+};
+
+// Claim on layer k+1 -> claim on layer k (2^(point.size() + 1) entries)
+LayerProof prove_layer(const std::vector<u128_t>& layer, LayerClaim& claim,
+                       const ChallengeFn& next, int threads);
+bool verify_layer(const LayerProof& proof, LayerClaim& claim, const ChallengeFn& next);
+
+// Whole tree: claim on layers.back() (b_root) -> claim on layers[0] (b_leaves).
+// layers as built by build_prodcheck_layers(). Fails (err set, claim
+// untouched) without layers, or if the claim and layer sizes do not chain:
+// 2^point.size() entries in layers.back(), each layer twice the next.
+bool prove_prodcheck(const std::vector<std::vector<u128_t>>& layers, LayerClaim& claim,
+                     const ChallengeFn& next, int threads, std::vector<LayerProof>& proof,
+                     std::string* err);
+bool verify_prodcheck(const std::vector<LayerProof>& proof, LayerClaim& claim,
+                      const ChallengeFn& next);
+
+} // namespace intmul_host
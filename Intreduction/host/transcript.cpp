@@ -0,0 +1,91 @@
+#include "transcript.hpp"
+
+#include <cstring>
+
+namespace intmul_host {
+
+Transcript::Transcript(const char* label) : pos_(0), squeezing_(false) {
+    std::memset(state_, 0, sizeof(state_));
+    absorb_bytes(label, std::strlen(label));
+}
+
+void Transcript::begin_absorb() {
+    // duplexing: the next block overwrites the squeezed lanes from lane 0,
+    // nothing is squeezed again before it is padded and permuted
+    if (squeezing_) {
+        squeezing_ = false;
+        pos_ = 0;
+    }
+}
+
+void Transcript::begin_squeeze() {
+    if (!squeezing_) {
+        state_[pos_] ^= 0x01;
+        state_[RATE_LANES - 1] ^= 0x80ull << 56;
+        permute();
+        squeezing_ = true;
+    }
+}
+
+void Transcript::absorb_u64(uint64_t w) {
+    begin_absorb();
+    state_[pos_] ^= w;
+    if (++pos_ == RATE_LANES) permute();
+}
+
+void Transcript::absorb_u64s(const uint64_t* w, std::size_t n) {
+    begin_absorb();
+    while (n > 0) {
+        std::size_t take = (std::size_t)(RATE_LANES - pos_);
+        if (take > n) take = n;
+        for (std::size_t j = 0; j < take; j++) state_[pos_ + j] ^= w[j];
+        pos_ += (int)take;
+        w += take;
+        n -= take;
+        if (pos_ == RATE_LANES) permute();
+    }
+}
+
+void Transcript::absorb_u128s(const u128_t* x, std::size_t n) {
+    begin_absorb();
+    for (std::size_t i = 0; i < n; i++) {
+        state_[pos_] ^= ghash_host::lo64(x[i]);
+        if (++pos_ == RATE_LANES) permute();
+        state_[pos_] ^= ghash_host::hi64(x[i]);
+        if (++pos_ == RATE_LANES) permute();
+    }
+}
+
+void Transcript::absorb_bytes(const void* data, std::size_t len) {
+    // the length, then the bytes little-endian into lanes with the tail
+    // zero-padded to a whole lane
+    absorb_u64((uint64_t)len);
+    const unsigned char* p = (const unsigned char*)data;
+    for (; len >= 8; p += 8, len -= 8) {
+        uint64_t w;
+        std::memcpy(&w, p, 8);
+        absorb_u64(w);
+    }
+    if (len) {
+        uint64_t w = 0;
+        for (std::size_t b = 0; b < len; b++) w |= (uint64_t)p[b] << (8 * b);
+        absorb_u64(w);
+    }
+}
+
+uint64_t Transcript::squeeze_u64() {
+    begin_squeeze();
+    if (pos_ == RATE_LANES) permute();
+    return state_[pos_++];
+}
+
+u128_t Transcript::challenge() {
+    uint64_t lo = squeeze_u64();
+    return ghash_host::make_u128(squeeze_u64(), lo);
+}
+
+void Transcript::challenges(u128_t* out, std::size_t n) {
+    for (std::size_t i = 0; i < n; i++) out[i] = challenge();
+}
+
+} // namespace intmul_host
@@ -0,0 +1,57 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#include "ghash128.hpp"
+#include "keccak.hpp"
+
+// ============================================================
+// Fiat-Shamir transcript: duplex sponge over Keccak-f[1600]
+//
+// Rate 17 lanes (136 bytes, as Keccak-256), capacity 512 bits. Words
+// are XORed straight into the rate lanes: a u64 is one lane, a u128
+// field element two lanes (lo, hi). Switching from absorbing to
+// squeezing pads the current block (pad10*1 on lane boundaries) and
+// permutes; absorbing again starts a new block at lane 0 (duplex), so
+// every challenge depends on everything absorbed before it. The state
+// stays in the object: a sumcheck round (4 values in, one challenge
+// out) costs a single permutation.
+//
+// Every 128-bit string is a GF(2^128) element, so a challenge is two
+// squeezed lanes as they are, uniform without rejection.
+// ============================================================
+
+namespace intmul_host {
+
+using ghash_host::u128_t;
+
+class Transcript {
+public:
+    static const int RATE_LANES = 17;
+
+    // label is absorbed first (bytes, length-prefixed) for domain separation
+    explicit Transcript(const char* label);
+
+    void absorb_u64(uint64_t w);
+    void absorb_u64s(const uint64_t* w, std::size_t n);
+    void absorb_u128(u128_t x) { absorb_u64(ghash_host::lo64(x)); absorb_u64(ghash_host::hi64(x)); }
+    void absorb_u128s(const u128_t* x, std::size_t n);
+    // length-prefixed, so "abc" and "abc\0" absorb differently
+    void absorb_bytes(const void* data, std::size_t len);
+
+    uint64_t squeeze_u64();
+    u128_t challenge();
+    void challenges(u128_t* out, std::size_t n);
+
+private:
+    void permute() { keccak_host::keccak_f1600(state_); pos_ = 0; }
+    void begin_absorb();
+    void begin_squeeze();
+
+    uint64_t state_[keccak_host::KECCAK_LANES];
+    int pos_;             // next rate lane
+    bool squeezing_;
+};
+
+} // namespace intmul_host
@@ -0,0 +1,209 @@
+#include "witness_gen.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <vector>
+
+#include <sys/stat.h>
+
+#include "intmul.hpp"
+#include "witness_loader.hpp"
+
+namespace intmul_host {
+
+static const char* const WITNESS_NAMES[4] = { "a", "b", "clo", "chi" };
+
+static const uint64_t SPLITMIX_GAMMA = 0x9e3779b97f4a7c15ull;
+
+// splitmix64 output for state s (the state already advanced by the gamma)
+static inline uint64_t splitmix64_mix(uint64_t z) {
+    z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ull;
+    z = (z ^ (z >> 27)) * 0x94d049bb133111ebull;
+    return z ^ (z >> 31);
+}
+
+// longest "<index> 0x<hex>\n" line: 20 index digits
+static const std::size_t MAX_LINE = 20 + 1 + 2 + 16 + 1;
+
+// Text lines for values[0 .. count), numbered from first; returns the bytes written
+static std::size_t format_lines(char* out, std::size_t first, const uint64_t* values,
+                                std::size_t count) {
+    static const char HEX[] = "0123456789abcdef";
+    char* p = out;
+    for (std::size_t k = 0; k < count; k++) {
+        char digits[20];
+        int nd = 0;
+        uint64_t idx = first + k;
+        do {
+            digits[nd++] = (char)('0' + idx % 10);
+            idx /= 10;
+        } while (idx);
+        while (nd) *p++ = digits[--nd];
+        *p++ = ' ';
+        *p++ = '0';
+        *p++ = 'x';
+        uint64_t v = values[k];
+        for (int d = 15; d >= 0; d--) {
+            p[d] = HEX[v & 15];
+            v >>= 4;
+        }
+        p += 16;
+        *p++ = '\n';
+    }
+    return (std::size_t)(p - out);
+}
+
+void generate_witness_rows(uint64_t seed, std::size_t first, std::size_t count,
+                           uint64_t* a, uint64_t* b, uint64_t* c_lo, uint64_t* c_hi,
+                           int threads) {
+    parallel_for(count, threads, [&](std::size_t begin, std::size_t end) {
+        for (std::size_t k = begin; k < end; k++) {
+            uint64_t s = seed + (uint64_t)(2 * (first + k) + 1) * SPLITMIX_GAMMA;
+            uint64_t x = splitmix64_mix(s);
+            uint64_t y = splitmix64_mix(s + SPLITMIX_GAMMA);
+            unsigned __int128 c = (unsigned __int128)x * y;
+            a[k] = x;
+            b[k] = y;
+            c_lo[k] = (uint64_t)c;
+            c_hi[k] = (uint64_t)(c >> 64);
+        }
+    });
+}
+
+std::string witness_file_path(const WitnessGenOptions& opt, const char* name) {
+    std::string base = opt.dir + "/intmul_witness_" + name;
+    return base + (opt.format == WITNESS_BINARY ? ".bin" : ".txt");
+}
+
+// One output file, written to <path>.tmp and renamed into place once complete
+struct GenOutput {
+    std::string path;
+    std::string tmp;
+    FILE* f = nullptr;
+
+    bool open(const std::string& p) {
+        path = p;
+        tmp = p + ".tmp";
+        f = std::fopen(tmp.c_str(), "wb");
+        return f != nullptr;
+    }
+    bool write(const void* data, std::size_t bytes) {
+        return std::fwrite(data, 1, bytes, f) == bytes;
+    }
+    bool commit() {
+        bool ok = std::fclose(f) == 0;
+        f = nullptr;
+        return ok && std::rename(tmp.c_str(), path.c_str()) == 0;
+    }
+    void discard() {
+        if (f) std::fclose(f);
+        f = nullptr;
+        std::remove(tmp.c_str());
+    }
+};
+
+static bool write_bin_header(GenOutput& out, std::size_t n, uint64_t src_size, int64_t src_mtime_ns) {
+    WitnessCacheHeader h;
+    std::memcpy(h.magic, WITNESS_CACHE_MAGIC, 8);
+    h.count = n;
+    h.src_size = src_size;
+    h.src_mtime_ns = src_mtime_ns;
+    return std::fseek(out.f, 0, SEEK_SET) == 0 && out.write(&h, sizeof(h));
+}
+
+bool generate_witness_files(const WitnessGenOptions& opt, std::string* err) {
+    const int threads = resolve_threads(opt.threads);
+    const bool text = opt.format != WITNESS_BINARY;
+    const bool bin  = opt.format != WITNESS_TEXT;
+
+    GenOutput txt_out[4], bin_out[4];
+    auto fail = [&](const std::string& msg) {
+        for (int f = 0; f < 4; f++) {
+            if (text) txt_out[f].discard();
+            if (bin) bin_out[f].discard();
+        }
+        if (err) *err = msg;
+        return false;
+    };
+
+    for (int f = 0; f < 4; f++) {
+        std::string path = witness_file_path(opt, WITNESS_NAMES[f]);
+        if (text && !txt_out[f].open(path)) return fail("cannot create " + path + ".tmp");
+        // the cache of a text file sits next to it; the binary format is the file itself
+        std::string bin_path = text ? path + ".bin" : path;
+        if (bin && !bin_out[f].open(bin_path)) return fail("cannot create " + bin_path + ".tmp");
+        // provisional header, restamped with the text file once that is complete
+        if (bin && !write_bin_header(bin_out[f], opt.n_rows, 0, 0))
+            return fail("cannot write " + bin_out[f].tmp);
+    }
+
+    const std::size_t block = std::min(GEN_BLOCK_ROWS, opt.n_rows);
+    std::vector<uint64_t> values[4];
+    for (int f = 0; f < 4; f++) values[f].resize(block);
+
+    // a block is formatted as `pieces` independent slices per file
+    const std::size_t pieces = (std::size_t)threads;
+    const std::size_t piece_rows = (block + pieces - 1) / pieces;
+    std::vector<char> lines[4];
+    std::vector<std::size_t> piece_len[4];
+    if (text) {
+        for (int f = 0; f < 4; f++) {
+            lines[f].resize(block * MAX_LINE);
+            piece_len[f].resize(pieces);
+        }
+    }
+
+    std::vector<char> ok(4);
+    for (std::size_t first = 0; first < opt.n_rows; first += block) {
+        std::size_t count = std::min(block, opt.n_rows - first);
+        generate_witness_rows(opt.seed, first, count, values[0].data(), values[1].data(),
+                              values[2].data(), values[3].data(), threads);
+
+        if (text) {
+            parallel_for(pieces, threads, [&](std::size_t p0, std::size_t p1) {
+                for (std::size_t p = p0; p < p1; p++) {
+                    std::size_t r0 = std::min(count, p * piece_rows);
+                    std::size_t r1 = std::min(count, r0 + piece_rows);
+                    for (int f = 0; f < 4; f++)
+                        piece_len[f][p] = format_lines(lines[f].data() + r0 * MAX_LINE, first + r0,
+                                                       values[f].data() + r0, r1 - r0);
+                }
+            });
+        }
+
+        // one writer per file
+        parallel_for(4, threads, [&](std::size_t f0, std::size_t f1) {
+            for (std::size_t f = f0; f < f1; f++) {
+                bool good = true;
+                if (text) {
+                    for (std::size_t p = 0; p < pieces && good; p++) {
+                        std::size_t r0 = std::min(count, p * piece_rows);
+                        good = txt_out[f].write(lines[f].data() + r0 * MAX_LINE, piece_len[f][p]);
+                    }
+                }
+                if (bin && good) good = bin_out[f].write(values[f].data(), count * sizeof(uint64_t));
+                ok[f] = good;
+            }
+        });
+        for (int f = 0; f < 4; f++)
+            if (!ok[f]) return fail("write failed: " + (text ? txt_out[f].tmp : bin_out[f].tmp));
+    }
+
+    for (int f = 0; f < 4; f++) {
+        if (text) {
+            if (!txt_out[f].commit()) return fail("cannot finish " + txt_out[f].path);
+            if (bin) {
+                // stamp the cache with the finished text file, as the loader checks it
+                struct stat st;
+                if (stat(txt_out[f].path.c_str(), &st) != 0 ||
+                    !write_bin_header(bin_out[f], opt.n_rows, (uint64_t)st.st_size,
+                                      (int64_t)st.st_mtim.tv_sec * 1000000000 + st.st_mtim.tv_nsec))
+                    return fail("cannot stamp " + bin_out[f].tmp);
+            }
+        }
+        if (bin && !bin_out[f].commit()) return fail("cannot finish " + bin_out[f].path);
+    }
+    return true;
+}
+
+} // namespace intmul_host
@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// ============================================================
+// IntMul witness input generator (intmul_witness_{a,b,clo,chi})
+//
+// Row i is a[i], b[i] and c_hi[i] || c_lo[i] = a[i] * b[i]. a[i] / b[i] are
+// outputs 2i + 1 / 2i + 2 of splitmix64 started at the seed, so a row only
+// depends on (seed, i): any thread count or block size gives the same files,
+// and they match the rows of intmul_reference_main for the same seed.
+//
+// Rows are produced in blocks of GEN_BLOCK_ROWS and written as they are
+// formatted, so memory stays O(block) for any N.
+// ============================================================
+
+namespace intmul_host {
+
+static const std::size_t GEN_BLOCK_ROWS = (std::size_t)1 << 20;
+
+enum WitnessFormat {
+    WITNESS_TEXT,             // <name>.txt, "<index> 0x<hex>" lines
+    WITNESS_BINARY,           // <name>.bin, WitnessCacheHeader + values
+    WITNESS_TEXT_AND_CACHE    // <name>.txt and its <name>.txt.bin loader cache
+};
+
+struct WitnessGenOptions {
+    std::string dir = ".";
+    std::size_t n_rows = 0;
+    uint64_t seed = 0;
+    int threads = 0;          // <= 0: one per hardware thread
+    WitnessFormat format = WITNESS_TEXT;
+};
+
+// Rows [first, first + count) into a / b / c_lo / c_hi[0 .. count)
+void generate_witness_rows(uint64_t seed, std::size_t first, std::size_t count,
+                           uint64_t* a, uint64_t* b, uint64_t* c_lo, uint64_t* c_hi,
+                           int threads);
+
+// Writes the four files into opt.dir; err gets a message on failure.
+bool generate_witness_files(const WitnessGenOptions& opt, std::string* err);
+
+// Path of one file as written for opt.format, name is "a", "b", "clo" or "chi"
+std::string witness_file_path(const WitnessGenOptions& opt, const char* name);
+
+} // namespace intmul_host
@@ -0,0 +1,92 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+#include <vector>
+
+#include "intmul.hpp"
+#include "intmul_check.hpp"
+#include "witness_gen.hpp"
+#include "witness_loader.hpp"
+
+// Writes intmul_witness_{a,b,clo,chi} for any N_VARS, in place of the files
+// dumped by the Rust prover:
+//
+//   g++ -O2 -mbmi2 -pthread witness_gen_main.cpp witness_gen.cpp witness_loader.cpp intmul_check.cpp -o witness_gen
+//   ./witness_gen <n_vars> [text|bin|both] [seed|random] [threads] [dir]
+//
+// text writes the .txt files, bin the binary .bin files, both the .txt files
+// with a ready loader cache. The files are read back through the loader and
+// every row is checked against c_hi || c_lo = a * b (intmul_check.hpp).
+
+int main(int argc, char** argv) {
+    if (argc < 2) {
+        std::fprintf(stderr, "usage: %s <n_vars> [text|bin|both] [seed|random] [threads] [dir]\n", argv[0]);
+        return 1;
+    }
+    int n_vars = std::atoi(argv[1]);
+    if (n_vars < 0 || n_vars > 30) {
+        std::fprintf(stderr, "n_vars out of range\n");
+        return 1;
+    }
+
+    intmul_host::WitnessGenOptions opt;
+    opt.n_rows = (std::size_t)1 << n_vars;
+    if (argc > 2) {
+        if (!std::strcmp(argv[2], "text")) opt.format = intmul_host::WITNESS_TEXT;
+        else if (!std::strcmp(argv[2], "bin")) opt.format = intmul_host::WITNESS_BINARY;
+        else if (!std::strcmp(argv[2], "both")) opt.format = intmul_host::WITNESS_TEXT_AND_CACHE;
+        else {
+            std::fprintf(stderr, "unknown format %s\n", argv[2]);
+            return 1;
+        }
+    }
+    if (argc > 3 && std::strcmp(argv[3], "random") != 0) {
+        opt.seed = std::strtoull(argv[3], nullptr, 0);
+    } else {
+        std::random_device rd;
+        opt.seed = ((uint64_t)rd() << 32) ^ rd();
+    }
+    opt.threads = intmul_host::resolve_threads(argc > 4 ? std::atoi(argv[4]) : 0);
+    if (argc > 5) opt.dir = argv[5];
+
+    auto t0 = std::chrono::steady_clock::now();
+    std::string err;
+    if (!intmul_host::generate_witness_files(opt, &err)) {
+        std::fprintf(stderr, "ERROR: %s\n", err.c_str());
+        return 1;
+    }
+    auto t1 = std::chrono::steady_clock::now();
+    double tg = std::chrono::duration<double>(t1 - t0).count();
+    std::printf("n_vars=%d rows=%zu seed=0x%016llx threads=%d\n", n_vars, opt.n_rows,
+                (unsigned long long)opt.seed, opt.threads);
+    std::printf("  generate + write : %8.3f s  %10.0f rows/s\n", tg, opt.n_rows / tg);
+
+    std::vector<uint64_t> v[4];
+    const char* names[4] = { "a", "b", "clo", "chi" };
+    intmul_host::WitnessFile files[4];
+    for (int f = 0; f < 4; f++) {
+        v[f].resize(opt.n_rows);
+        files[f] = { intmul_host::witness_file_path(opt, names[f]), v[f].data(), opt.n_rows };
+    }
+    if (!intmul_host::load_witness_files(files, 4, false)) return 1;
+    auto t2 = std::chrono::steady_clock::now();
+
+    std::vector<std::size_t> bad;
+    intmul_host::IntMulInputs in = { v[0].data(), v[1].data(), v[2].data(), v[3].data(), opt.n_rows };
+    std::size_t n_bad = intmul_host::check_intmul_rows(in, opt.threads, &bad, 8);
+    auto t3 = std::chrono::steady_clock::now();
+    double tc = std::chrono::duration<double>(t3 - t2).count();
+    std::printf("  load back        : %8.3f s\n", std::chrono::duration<double>(t2 - t1).count());
+    std::printf("  check a * b = c  : %8.3f s  %10.2f GB/s\n", tc, opt.n_rows * 32.0 / tc / 1e9);
+    if (n_bad) {
+        std::printf("  FAIL: %zu rows do not satisfy a * b = c, first:", n_bad);
+        for (std::size_t r : bad) std::printf(" %zu", r);
+        std::printf("\n");
+        return 2;
+    }
+    std::printf("  all rows satisfy a * b = c_hi || c_lo\n");
+    return 0;
+}
@@ -0,0 +1,262 @@
+#include "witness_loader.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+namespace intmul_host {
+
+// Read-only mapping of a whole file
+class MappedFile {
+public:
+    MappedFile() : data_(nullptr), size_(0), mtime_ns_(0) {}
+    ~MappedFile() {
+        if (data_) munmap((void*)data_, size_);
+    }
+    MappedFile(const MappedFile&) = delete;
+    MappedFile& operator=(const MappedFile&) = delete;
+
+    bool open(const std::string& path) {
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) return false;
+        struct stat st;
+        if (fstat(fd, &st) != 0) {
+            ::close(fd);
+            return false;
+        }
+        size_ = (std::size_t)st.st_size;
+        mtime_ns_ = (int64_t)st.st_mtim.tv_sec * 1000000000 + st.st_mtim.tv_nsec;
+        if (size_ > 0) {
+            void* p = mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p == MAP_FAILED) {
+                ::close(fd);
+                return false;
+            }
+            madvise(p, size_, MADV_SEQUENTIAL);
+            data_ = (const char*)p;
+        }
+        ::close(fd);
+        return true;
+    }
+
+    const char* data() const { return data_; }
+    std::size_t size() const { return size_; }
+    int64_t mtime_ns() const { return mtime_ns_; }
+
+private:
+    const char* data_;
+    std::size_t size_;
+    int64_t mtime_ns_;
+};
+
+static inline int hex_value(char c) {
+    if (c >= '0' && c <= '9') return c - '0';
+    if (c >= 'a' && c <= 'f') return c - 'a' + 10;
+    if (c >= 'A' && c <= 'F') return c - 'A' + 10;
+    return -1;
+}
+
+// 16 hex digits, most significant first -> value; false on a non-hex digit
+static inline bool decode_hex16(const char* p, uint64_t& value) {
+#if defined(__SSE2__)
+    __m128i c = _mm_loadu_si128((const __m128i*)p);
+    __m128i lower = _mm_or_si128(c, _mm_set1_epi8(0x20));
+    __m128i is_digit = _mm_and_si128(_mm_cmpgt_epi8(c, _mm_set1_epi8('0' - 1)),
+                                     _mm_cmplt_epi8(c, _mm_set1_epi8('9' + 1)));
+    __m128i is_alpha = _mm_and_si128(_mm_cmpgt_epi8(lower, _mm_set1_epi8('a' - 1)),
+                                     _mm_cmplt_epi8(lower, _mm_set1_epi8('f' + 1)));
+    if (_mm_movemask_epi8(_mm_or_si128(is_digit, is_alpha)) != 0xffff) return false;
+    // '0'..'9' -> low nibble, 'a'..'f' / 'A'..'F' -> low nibble + 9
+    __m128i nib = _mm_add_epi8(_mm_and_si128(c, _mm_set1_epi8(0x0f)),
+                               _mm_and_si128(is_alpha, _mm_set1_epi8(9)));
+    // byte pairs (hi, lo) -> hi * 16 + lo, then 16 -> 8 bytes
+    __m128i bytes = _mm_or_si128(_mm_slli_epi16(_mm_and_si128(nib, _mm_set1_epi16(0x00ff)), 4),
+                                 _mm_srli_epi16(nib, 8));
+    uint64_t be = (uint64_t)_mm_cvtsi128_si64(_mm_packus_epi16(bytes, bytes));
+    value = __builtin_bswap64(be);
+    return true;
+#else
+    uint64_t v = 0;
+    for (int i = 0; i < 16; i++) {
+        int h = hex_value(p[i]);
+        if (h < 0) return false;
+        v = (v << 4) | (uint64_t)h;
+    }
+    value = v;
+    return true;
+#endif
+}
+
+static inline bool is_space(char c) {
+    return c == ' ' || c == '\t' || c == '\r' || c == '\v' || c == '\f';
+}
+
+// Values of the "<index> 0x<hex>" lines in [p, end), at most n; *stop gets
+// the start of the first line not parsed
+static std::size_t parse_text(const char* p, const char* end, uint64_t* out, std::size_t n,
+                              const char** stop) {
+    std::size_t count = 0;
+    while (p < end && count < n) {
+        const char* eol = (const char*)std::memchr(p, '\n', (std::size_t)(end - p));
+        if (!eol) eol = end;
+
+        const char* q = p;
+        while (q < eol && is_space(*q)) q++;
+        const char* digits = q;
+        while (q < eol && *q >= '0' && *q <= '9') q++;
+        if (q > digits) {
+            while (q < eol && is_space(*q)) q++;
+            if (eol - q >= 3 && q[0] == '0' && (q[1] == 'x' || q[1] == 'X')) {
+                const char* h = q + 2;
+                uint64_t v = 0;
+                if (eol - h >= 16 && decode_hex16(h, v) && (h + 16 == eol || hex_value(h[16]) < 0)) {
+                    out[count++] = v;   // the common full-width value, no per-digit loop
+                } else {
+                    v = 0;
+                    const char* s = h;
+                    while (s < eol && hex_value(*s) >= 0) s++;
+                    std::size_t d = (std::size_t)(s - h);
+                    if (d > 0 && d < 16) {
+                        for (const char* t = h; t < s; t++) v = (v << 4) | (uint64_t)hex_value(*t);
+                        out[count++] = v;
+                    }
+                }
+                // longer than 16 digits does not fit a u64: skipped
+            }
+        }
+        p = eol + 1;
+    }
+    *stop = p < end ? p : end;
+    return count;
+}
+
+static bool is_cache(const MappedFile& f) {
+    return f.size() >= sizeof(WitnessCacheHeader) && std::memcmp(f.data(), WITNESS_CACHE_MAGIC, 8) == 0;
+}
+
+// values from a binary file; false if it is not one or is too short
+static bool load_cache(const MappedFile& f, uint64_t* out, std::size_t n) {
+    if (!is_cache(f)) return false;
+    WitnessCacheHeader h;
+    std::memcpy(&h, f.data(), sizeof(h));
+    if (h.count < n || f.size() < sizeof(h) + h.count * sizeof(uint64_t)) return false;
+    std::memcpy(out, f.data() + sizeof(h), n * sizeof(uint64_t));
+    return true;
+}
+
+// head[0 .. n_head) then tail[0 .. n_tail) as one cache file
+static bool write_cache_parts(const std::string& path, const uint64_t* head, std::size_t n_head,
+                              const uint64_t* tail, std::size_t n_tail, uint64_t src_size,
+                              int64_t src_mtime_ns) {
+    WitnessCacheHeader h;
+    std::memcpy(h.magic, WITNESS_CACHE_MAGIC, 8);
+    h.count = n_head + n_tail;
+    h.src_size = src_size;
+    h.src_mtime_ns = src_mtime_ns;
+
+    // write aside and rename, so a concurrent reader never sees half a file
+    std::string tmp = path + ".tmp";
+    FILE* f = std::fopen(tmp.c_str(), "wb");
+    if (!f) return false;
+    bool ok = std::fwrite(&h, sizeof(h), 1, f) == 1 &&
+              std::fwrite(head, sizeof(uint64_t), n_head, f) == n_head &&
+              std::fwrite(tail, sizeof(uint64_t), n_tail, f) == n_tail;
+    ok = (std::fclose(f) == 0) && ok;
+    if (ok) ok = std::rename(tmp.c_str(), path.c_str()) == 0;
+    if (!ok) std::remove(tmp.c_str());
+    return ok;
+}
+
+bool write_witness_cache(const std::string& path, const uint64_t* values, std::size_t n,
+                         uint64_t src_size, int64_t src_mtime_ns) {
+    return write_cache_parts(path, values, n, nullptr, 0, src_size, src_mtime_ns);
+}
+
+bool load_witness_u64(const std::string& path, uint64_t* out, std::size_t n,
+                      bool write_cache, std::string* err) {
+    MappedFile src;
+    if (!src.open(path)) {
+        if (err) *err = "cannot open file: " + path;
+        return false;
+    }
+    if (is_cache(src)) {
+        if (load_cache(src, out, n)) return true;
+        if (err) *err = "binary file " + path + " holds fewer than " + std::to_string(n) + " values";
+        return false;
+    }
+
+    // cache from the same text file (size and mtime) -> no parsing
+    const std::string cache_path = path + ".bin";
+    {
+        MappedFile cache;
+        if (cache.open(cache_path) && is_cache(cache)) {
+            WitnessCacheHeader h;
+            std::memcpy(&h, cache.data(), sizeof(h));
+            if (h.src_size == src.size() && h.src_mtime_ns == src.mtime_ns() &&
+                load_cache(cache, out, n))
+                return true;
+        }
+    }
+
+    // the first n values go straight to out; with write_cache the rest of
+    // the file (the cache serves any later n) goes to a tail sized from the
+    // bytes per value seen so far, so nothing is held twice
+    const char* begin = src.data();
+    const char* end = begin + src.size();
+    const char* stop = begin;
+    std::size_t count = parse_text(begin, end, out, n, &stop);
+    if (write_cache) {
+        std::vector<uint64_t> tail;
+        const std::size_t line = count ? std::max<std::size_t>((std::size_t)(stop - begin) / count, 4) : 4;
+        while (stop < end) {
+            std::size_t have = tail.size();
+            tail.resize(have + (std::size_t)(end - stop) / line + 1);
+            have += parse_text(stop, end, tail.data() + have, tail.size() - have, &stop);
+            tail.resize(have);
+        }
+        write_cache_parts(cache_path, out, count, tail.data(), tail.size(), src.size(),
+                          src.mtime_ns());
+    }
+    if (count < n) {
+        if (err)
+            *err = "file " + path + " only contains " + std::to_string(count) +
+                   " values, expected at least " + std::to_string(n);
+        return false;
+    }
+    return true;
+}
+
+bool load_witness_files(WitnessFile* files, std::size_t count, bool write_cache) {
+    std::vector<std::string> errs(count);
+    std::vector<char> ok(count, 0);
+    std::vector<std::thread> pool;
+    for (std::size_t i = 0; i < count; i++) {
+        pool.emplace_back([&, i] {
+            ok[i] = load_witness_u64(files[i].path, files[i].out, files[i].n, write_cache, &errs[i]);
+        });
+    }
+    for (std::thread& t : pool) t.join();
+
+    bool all_ok = true;
+    for (std::size_t i = 0; i < count; i++) {
+        if (!ok[i]) {
+            std::cerr << "ERROR: " << errs[i] << "\n";
+            all_ok = false;
+        }
+    }
+    return all_ok;
+}
+
+} // namespace intmul_host
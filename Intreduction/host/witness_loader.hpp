@@ -0,0 +1,48 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// ============================================================
+// IntMul witness input loader (intmul_witness_{a,b,clo,chi}.txt)
+//
+// Text form: one "<index> 0x<hex>" line per value, as dumped by the Rust
+// reference; other lines are skipped. The file is mapped, not read, and
+// 16-digit values decode 16 characters at a time with SSE2.
+//
+// Binary form: WitnessCacheHeader followed by count little-endian u64.
+// Loading a text file writes <path>.bin next to it (best effort); later
+// loads use the cache while the text file's size and mtime still match.
+// A path whose content starts with the binary magic loads as binary.
+// ============================================================
+
+namespace intmul_host {
+
+static const char WITNESS_CACHE_MAGIC[8] = { 'I', 'M', 'W', 'I', 'T', '6', '4', '\0' };
+
+struct WitnessCacheHeader {
+    char magic[8];           // "IMWIT64\0"
+    uint64_t count;
+    uint64_t src_size;       // size / mtime of the text file it was built from
+    int64_t src_mtime_ns;
+};
+
+struct WitnessFile {
+    std::string path;
+    uint64_t* out;
+    std::size_t n;           // values wanted; fewer in the file is an error
+};
+
+// Loads the first n values. err gets a message on failure.
+bool load_witness_u64(const std::string& path, uint64_t* out, std::size_t n,
+                      bool write_cache, std::string* err);
+
+// Several files, one thread each. Prints the failing file to stderr.
+bool load_witness_files(WitnessFile* files, std::size_t count, bool write_cache);
+
+// Writes the binary form of values[0 .. n)
+bool write_witness_cache(const std::string& path, const uint64_t* values, std::size_t n,
+                         uint64_t src_size, int64_t src_mtime_ns);
+
+} // namespace intmul_host
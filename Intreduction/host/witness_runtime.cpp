@@ -0,0 +1,225 @@
+#include "witness_runtime.hpp"
+
+#include <algorithm>
+#include <utility>
+
+#include "intmul_check.hpp"
+#include "intmul_reference.hpp"
+
+namespace intmul_host {
+
+static double seconds_since(std::chrono::steady_clock::time_point t0) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+}
+
+static bool check_job_size(const JobBackend& backend, const IntMulInputs& in, std::string* err) {
+    std::size_t max = backend.max_rows();
+    if (max == 0 || in.n_rows <= max) return true;
+    if (err)
+        *err = "job of " + std::to_string(in.n_rows) + " rows exceeds the " + backend.name() +
+               " backend limit of " + std::to_string(max);
+    return false;
+}
+
+static bool check_job_rows(const IntMulInputs& in, std::string* err) {
+    std::vector<std::size_t> bad;
+    std::size_t n_bad = check_intmul_rows(in, 0, &bad, 1);
+    if (!n_bad) return true;
+    if (err)
+        *err = std::to_string(n_bad) + " rows do not satisfy a * b = c_hi || c_lo, first row " +
+               std::to_string(bad[0]);
+    return false;
+}
+
+static void pack_inputs(const IntMulInputs& in, InputBuffers& buf) {
+    buf.n_rows = in.n_rows;
+    buf.a.assign(in.a, in.a + in.n_rows);
+    buf.b.assign(in.b, in.b + in.n_rows);
+    buf.c_lo.assign(in.c_lo, in.c_lo + in.n_rows);
+    buf.c_hi.assign(in.c_hi, in.c_hi + in.n_rows);
+}
+
+static void reset_outputs(OutputBuffers& buf, std::size_t n_rows) {
+    buf.n_rows = n_rows;
+    buf.roots_match = true;
+    buf.mismatch_idx = -1;
+}
+
+// Moves the slot's vectors into out, leaving the slot empty for the next job
+static void unpack_outputs(OutputBuffers& buf, IntMulOutputs& out) {
+    out.a_root = std::move(buf.a_root);
+    out.b_leaves = std::move(buf.b_leaves);
+    buf.a_root.clear();
+    buf.b_leaves.clear();
+    out.roots_match = buf.roots_match;
+    out.mismatch_idx = buf.mismatch_idx;
+}
+
+// ------------------------------------------------------------
+// ReferenceBackend
+// ------------------------------------------------------------
+
+void ReferenceBackend::link_delay(std::size_t bytes) const {
+    if (link_rate_ <= 0) return;
+    std::this_thread::sleep_for(std::chrono::duration<double>(bytes / (link_rate_ * 1e9)));
+}
+
+bool ReferenceBackend::upload(int, const InputBuffers& in, std::string*) {
+    link_delay(4 * in.n_rows * sizeof(uint64_t));
+    return true;
+}
+
+bool ReferenceBackend::compute(int, const InputBuffers& in, int, OutputBuffers& out, std::string*) {
+    IntMulInputs view = { in.a.data(), in.b.data(), in.c_lo.data(), in.c_hi.data(), in.n_rows };
+    ReferenceOptions opt;
+    opt.threads = threads_;
+    opt.keep_leaves = true;
+    ReferenceResult r;
+    run_reference(view, opt, r);
+
+    out.a_root.swap(r.a_root);
+    out.b_leaves.swap(r.b_leaves);
+    out.roots_match = r.roots_match;
+    out.mismatch_idx = r.mismatch_idx;
+    return true;
+}
+
+bool ReferenceBackend::download(int, OutputBuffers& out, std::string*) {
+    link_delay((1 + HEIGHT) * out.n_rows * sizeof(u128_t));
+    return true;
+}
+
+// ------------------------------------------------------------
+// Serial path
+// ------------------------------------------------------------
+
+bool run_job(JobBackend& backend, const IntMulInputs& in, IntMulOutputs& out, std::string* err) {
+    if (!check_job_size(backend, in, err)) return false;
+    InputBuffers ib;
+    OutputBuffers ob;
+    pack_inputs(in, ib);
+    if (!backend.upload(0, ib, err)) return false;
+    reset_outputs(ob, in.n_rows);
+    if (!backend.compute(0, ib, 0, ob, err) || !backend.download(0, ob, err)) return false;
+    unpack_outputs(ob, out);
+    return true;
+}
+
+// ------------------------------------------------------------
+// WitnessRuntime
+// ------------------------------------------------------------
+
+WitnessRuntime::WitnessRuntime(JobBackend& backend, int slots, bool check_rows)
+    : backend_(backend), check_rows_(check_rows), in_bufs_(std::max(slots, 1)), out_bufs_(std::max(slots, 1)) {
+    for (int s = 0; s < (int)in_bufs_.size(); s++) {
+        free_in_.push(s);
+        free_out_.push(s);
+    }
+    threads_[0] = std::thread(&WitnessRuntime::upload_loop, this);
+    threads_[1] = std::thread(&WitnessRuntime::compute_loop, this);
+    threads_[2] = std::thread(&WitnessRuntime::readback_loop, this);
+}
+
+WitnessRuntime::~WitnessRuntime() {
+    // each stage closes the queue of the next one when it runs out
+    pending_.close();
+    for (std::thread& t : threads_) t.join();
+}
+
+bool WitnessRuntime::submit(const IntMulInputs& in, IntMulOutputs& out, std::string* err) {
+    if (!check_job_size(backend_, in, err)) return false;
+    if (check_rows_ && !check_job_rows(in, err)) return false;
+    {
+        std::lock_guard<std::mutex> g(stats_lock_);
+        if (submitted_ == 0) t_first_ = std::chrono::steady_clock::now();
+        submitted_++;
+    }
+    pending_.push(Job{ in, &out, -1, -1, true, std::string() });
+    return true;
+}
+
+bool WitnessRuntime::wait(std::string* err) {
+    std::unique_lock<std::mutex> g(stats_lock_);
+    done_cv_.wait(g, [&] { return done_ == submitted_; });
+    if (errors_.empty()) return true;
+    if (err) *err = errors_.front();
+    errors_.clear();
+    return false;
+}
+
+RuntimeStats WitnessRuntime::stats() const {
+    std::lock_guard<std::mutex> g(stats_lock_);
+    return stats_;
+}
+
+void WitnessRuntime::upload_loop() {
+    Job job;
+    while (pending_.pop(job)) {
+        free_in_.pop(job.in_slot);
+        auto t0 = std::chrono::steady_clock::now();
+        InputBuffers& buf = in_bufs_[job.in_slot];
+        pack_inputs(job.in, buf);
+        job.ok = backend_.upload(job.in_slot, buf, &job.err);
+        double dt = seconds_since(t0);
+        {
+            std::lock_guard<std::mutex> g(stats_lock_);
+            stats_.upload_s += dt;
+        }
+        to_compute_.push(job);
+    }
+    to_compute_.close();
+}
+
+void WitnessRuntime::compute_loop() {
+    Job job;
+    while (to_compute_.pop(job)) {
+        if (!job.ok) {
+            free_in_.push(job.in_slot);
+            to_read_.push(job);
+            continue;
+        }
+        free_out_.pop(job.out_slot);
+        auto t0 = std::chrono::steady_clock::now();
+        OutputBuffers& buf = out_bufs_[job.out_slot];
+        reset_outputs(buf, job.in.n_rows);
+        job.ok = backend_.compute(job.in_slot, in_bufs_[job.in_slot], job.out_slot, buf, &job.err);
+        double dt = seconds_since(t0);
+        {
+            std::lock_guard<std::mutex> g(stats_lock_);
+            stats_.compute_s += dt;
+        }
+        free_in_.push(job.in_slot);
+        to_read_.push(job);
+    }
+    to_read_.close();
+}
+
+void WitnessRuntime::readback_loop() {
+    Job job;
+    while (to_read_.pop(job)) {
+        auto t0 = std::chrono::steady_clock::now();
+        if (job.ok) {
+            OutputBuffers& buf = out_bufs_[job.out_slot];
+            job.ok = backend_.download(job.out_slot, buf, &job.err);
+            if (job.ok) unpack_outputs(buf, *job.out);
+        }
+        double dt = seconds_since(t0);
+        if (job.out_slot >= 0) free_out_.push(job.out_slot);
+        {
+            std::lock_guard<std::mutex> g(stats_lock_);
+            stats_.readback_s += dt;
+            stats_.jobs++;
+            stats_.rows += job.in.n_rows;
+            if (!job.ok) {
+                stats_.failed++;
+                errors_.push_back(job.err.empty() ? std::string(backend_.name()) + " backend failed"
+                                                  : job.err);
+            }
+            done_++;
+            stats_.wall_s = seconds_since(t_first_);
+        }
+        done_cv_.notify_all();
+    }
+}
+
+} // namespace intmul_host
@@ -0,0 +1,213 @@
+#pragma once
+
+#include <chrono>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "cu_scheduler.hpp"
+#include "ghash128.hpp"
+#include "intmul.hpp"
+
+// ============================================================
+// Host runtime for intmul_witness_step jobs
+//
+// A job is one witness table (IntMulInputs, at most the backend's
+// max_rows). Jobs go through three stages, each on its own thread:
+//
+//   upload   : pack the rows into the four input stream buffers, send them
+//   compute  : run the kernel from an input slot into an output slot
+//   readback : fetch the output slot into the job's IntMulOutputs
+//
+// Input and output buffers are double-buffered (RUNTIME_SLOTS each), so
+// the upload of job k+1 and the readback of job k-1 overlap the compute of
+// job k. An input slot is free again once its compute is done, an output
+// slot once it has been read back.
+//
+// The backend does the device side: XRT buffer syncs and kernel runs on
+// hardware, a direct call of the kernel in C simulation, or
+// ReferenceBackend, which runs the host reference and needs no device.
+//
+// With check_rows, submit first checks every row against a * b = c_hi || c_lo
+// (intmul_check.hpp) and rejects a job with bad rows before it is queued.
+//
+// A backend call that fails (a failed sync or kernel run) fails its job:
+// the job skips its remaining stages, its slots are freed, and the next
+// wait() returns false with the backend's message.
+// ============================================================
+
+namespace intmul_host {
+
+using ghash_host::u128_t;
+
+static const int RUNTIME_SLOTS = 2;
+
+// Host side of one input slot: the words of the a / b / clo / chi streams
+struct InputBuffers {
+    std::vector<uint64_t> a, b, c_lo, c_hi;
+    std::size_t n_rows = 0;
+};
+
+// Host side of one output slot, laid out as the kernel streams it. The
+// vectors move to the job's IntMulOutputs on readback, so compute (or
+// download) sizes them for every job.
+struct OutputBuffers {
+    std::vector<u128_t> a_root;       // n_rows
+    std::vector<u128_t> b_leaves;     // 64 * n_rows, z-major
+    bool roots_match = true;
+    long mismatch_idx = -1;           // row within the job, -1 if none
+    std::size_t n_rows = 0;
+};
+
+// Device side of the runtime. Calls for one stage come from one thread,
+// the three stages run concurrently on different slots. Each call returns
+// false, with err set, if the device side failed.
+class JobBackend {
+public:
+    virtual ~JobBackend() {}
+
+    virtual const char* name() const = 0;
+
+    // Largest job in rows, 0 for no limit
+    virtual std::size_t max_rows() const { return 0; }
+
+    // Host -> device copy of a packed input slot
+    virtual bool upload(int slot, const InputBuffers& in, std::string* err) {
+        (void)slot; (void)in; (void)err;
+        return true;
+    }
+
+    // One kernel run; out.n_rows is set, the rest is the backend's to fill
+    // (directly, or on the device until download)
+    virtual bool compute(int in_slot, const InputBuffers& in,
+                         int out_slot, OutputBuffers& out, std::string* err) = 0;
+
+    // Device -> host copy of an output slot
+    virtual bool download(int slot, OutputBuffers& out, std::string* err) {
+        (void)slot; (void)out; (void)err;
+        return true;
+    }
+};
+
+// Host reference as a backend. link_gbytes_per_s > 0 models the host link:
+// upload and download sleep for their bytes at that rate, so the overlap
+// shows in the timings on a plain host.
+class ReferenceBackend : public JobBackend {
+public:
+    explicit ReferenceBackend(int threads = 0, double link_gbytes_per_s = 0)
+        : threads_(threads), link_rate_(link_gbytes_per_s) {}
+
+    const char* name() const override { return "reference"; }
+    bool upload(int slot, const InputBuffers& in, std::string* err) override;
+    bool compute(int in_slot, const InputBuffers& in, int out_slot, OutputBuffers& out,
+                 std::string* err) override;
+    bool download(int slot, OutputBuffers& out, std::string* err) override;
+
+private:
+    void link_delay(std::size_t bytes) const;
+
+    int threads_;
+    double link_rate_;
+};
+
+// Busy time of each stage and wall time since the first submit
+struct RuntimeStats {
+    std::size_t jobs = 0;
+    std::size_t failed = 0;           // jobs a backend call failed
+    std::size_t rows = 0;
+    double upload_s = 0;
+    double compute_s = 0;
+    double readback_s = 0;
+    double wall_s = 0;
+};
+
+// One job through the three stages on the calling thread, no overlap.
+// Fails if the job is too large or a backend call fails.
+bool run_job(JobBackend& backend, const IntMulInputs& in, IntMulOutputs& out, std::string* err);
+
+class WitnessRuntime {
+public:
+    // slots input and slots output buffers
+    explicit WitnessRuntime(JobBackend& backend, int slots = RUNTIME_SLOTS, bool check_rows = false);
+    ~WitnessRuntime();
+
+    // Queues a job. in's arrays must stay valid and out untouched until
+    // wait() returns. Fails (with err set) if the job is too large or, with
+    // check_rows, has rows that are not a product.
+    bool submit(const IntMulInputs& in, IntMulOutputs& out, std::string* err);
+
+    // Blocks until every submitted job has been read back or has failed.
+    // False if a job submitted since the previous wait() failed in the
+    // backend; err gets the first such message. A failed job's outputs are
+    // unspecified.
+    bool wait(std::string* err = nullptr);
+
+    RuntimeStats stats() const;
+
+private:
+    struct Job {
+        IntMulInputs in;
+        IntMulOutputs* out;
+        int in_slot;
+        int out_slot;
+        bool ok;
+        std::string err;              // backend message once !ok
+    };
+
+    // Blocking FIFO between stages; pop returns false once closed and empty
+    template <class T>
+    class Queue {
+    public:
+        void push(const T& x) {
+            { std::lock_guard<std::mutex> g(m_); q_.push_back(x); }
+            cv_.notify_one();
+        }
+        bool pop(T& x) {
+            std::unique_lock<std::mutex> g(m_);
+            cv_.wait(g, [&] { return !q_.empty() || closed_; });
+            if (q_.empty()) return false;
+            x = q_.front();
+            q_.pop_front();
+            return true;
+        }
+        void close() {
+            { std::lock_guard<std::mutex> g(m_); closed_ = true; }
+            cv_.notify_all();
+        }
+
+    private:
+        std::mutex m_;
+        std::condition_variable cv_;
+        std::deque<T> q_;
+        bool closed_ = false;
+    };
+
+    void upload_loop();
+    void compute_loop();
+    void readback_loop();
+
+    JobBackend& backend_;
+    bool check_rows_;
+    std::vector<InputBuffers> in_bufs_;
+    std::vector<OutputBuffers> out_bufs_;
+
+    Queue<Job> pending_, to_compute_, to_read_;
+    Queue<int> free_in_, free_out_;
+
+    mutable std::mutex stats_lock_;
+    std::condition_variable done_cv_;
+    std::size_t submitted_ = 0;
+    std::size_t done_ = 0;
+    std::vector<std::string> errors_;   // failed jobs since the last wait()
+    RuntimeStats stats_;
+    std::chrono::steady_clock::time_point t_first_;
+
+    std::thread threads_[3];
+};
+
+} // namespace intmul_host
@@ -0,0 +1,100 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include "fixed_base.hpp"
+#include "witness_gen.hpp"
+#include "witness_runtime.hpp"
+
+// Runs a batch of generated witness jobs through the host runtime on the
+// reference backend, once job after job and once pipelined:
+//
+//   g++ -O2 -mpclmul -pthread -I.. witness_runtime_main.cpp witness_runtime.cpp intmul_check.cpp intmul_reference.cpp fixed_base.cpp witness_gen.cpp -o witness_runtime
+//   ./witness_runtime <n_vars> [jobs] [threads] [link_GB/s]
+//
+// link_GB/s > 0 makes upload / download take as long as they would over a
+// link of that rate. Both runs must give the same outputs, with every
+// b_root equal to its c_root.
+
+static double seconds_since(std::chrono::steady_clock::time_point t0) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+}
+
+struct JobRows {
+    std::vector<uint64_t> a, b, c_lo, c_hi;
+};
+
+int main(int argc, char** argv) {
+    int n_vars  = argc > 1 ? std::atoi(argv[1]) : 14;
+    int n_jobs  = argc > 2 ? std::atoi(argv[2]) : 8;
+    int threads = intmul_host::resolve_threads(argc > 3 ? std::atoi(argv[3]) : 0);
+    double link = argc > 4 ? std::atof(argv[4]) : 0;
+    if (n_vars < 0 || n_vars > 24 || n_jobs < 1) {
+        std::fprintf(stderr, "usage: %s <n_vars <= 24> [jobs] [threads] [link_GB/s]\n", argv[0]);
+        return 1;
+    }
+    const std::size_t n = (std::size_t)1 << n_vars;
+
+    std::vector<JobRows> rows(n_jobs);
+    std::vector<intmul_host::IntMulInputs> jobs(n_jobs);
+    for (int j = 0; j < n_jobs; j++) {
+        JobRows& r = rows[j];
+        r.a.resize(n); r.b.resize(n); r.c_lo.resize(n); r.c_hi.resize(n);
+        intmul_host::generate_witness_rows(0x1d872b41u + j, 0, n, r.a.data(), r.b.data(),
+                                           r.c_lo.data(), r.c_hi.data(), threads);
+        jobs[j] = { r.a.data(), r.b.data(), r.c_lo.data(), r.c_hi.data(), n };
+    }
+
+    ghash_host::fixed_base_g();
+    ghash_host::fixed_base_g_c_hi();
+
+    intmul_host::ReferenceBackend backend(threads, link);
+    std::string err;
+
+    std::vector<intmul_host::IntMulOutputs> serial(n_jobs);
+    auto t0 = std::chrono::steady_clock::now();
+    for (int j = 0; j < n_jobs; j++) {
+        if (!intmul_host::run_job(backend, jobs[j], serial[j], &err)) {
+            std::fprintf(stderr, "ERROR: %s\n", err.c_str());
+            return 1;
+        }
+    }
+    double ts = seconds_since(t0);
+
+    std::vector<intmul_host::IntMulOutputs> piped(n_jobs);
+    intmul_host::RuntimeStats st;
+    {
+        intmul_host::WitnessRuntime rt(backend);
+        for (int j = 0; j < n_jobs; j++) {
+            if (!rt.submit(jobs[j], piped[j], &err)) {
+                std::fprintf(stderr, "ERROR: %s\n", err.c_str());
+                return 1;
+            }
+        }
+        if (!rt.wait(&err)) {
+            std::fprintf(stderr, "ERROR: %s\n", err.c_str());
+            return 1;
+        }
+        st = rt.stats();
+    }
+
+    bool same = true, match = true;
+    for (int j = 0; j < n_jobs; j++) {
+        same = same && serial[j].a_root == piped[j].a_root && serial[j].b_leaves == piped[j].b_leaves &&
+               serial[j].roots_match == piped[j].roots_match;
+        match = match && piped[j].roots_match;
+    }
+
+    double total = (double)n * n_jobs;
+    std::printf("backend=%s n_vars=%d jobs=%d threads=%d link=%.1f GB/s\n", backend.name(), n_vars,
+                n_jobs, threads, link);
+    std::printf("  serial     : %8.3f s  %10.0f rows/s\n", ts, total / ts);
+    std::printf("  pipelined  : %8.3f s  %10.0f rows/s  (x%.2f)\n", st.wall_s, total / st.wall_s,
+                ts / st.wall_s);
+    std::printf("  stage busy : upload %.3f s, compute %.3f s, readback %.3f s\n", st.upload_s,
+                st.compute_s, st.readback_s);
+    std::printf("  runs agree: %s, roots_match: %s\n", same ? "yes" : "NO", match ? "yes" : "NO");
+    return (same && match) ? 0 : 2;
+}
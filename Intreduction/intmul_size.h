@@ -0,0 +1,35 @@
+#pragma once
+
+// ============================================================
+// Problem size of the IntMul witness kernel
+//
+//   N_VARS   : log2 of the number of rows, N = 2^N_VARS
+//   LOG_BITS : log2 of the b-leaves per row, HEIGHT = 2^LOG_BITS (6 for
+//              64-bit b; b_root == c_root only holds for LOG_BITS = 6)
+//
+// The kernel stages and the testbench are templates on both; the
+// extern "C" top is the INTMUL_N_VARS / INTMUL_LOG_BITS instantiation,
+// set with -DINTMUL_N_VARS=15 (cflags) for the full-size build.
+// ============================================================
+
+#ifndef INTMUL_N_VARS
+#define INTMUL_N_VARS 4
+#endif
+
+#ifndef INTMUL_LOG_BITS
+#define INTMUL_LOG_BITS 6
+#endif
+
+template <int N_VARS_, int LOG_BITS_ = 6>
+struct IntMulSize {
+    static_assert(N_VARS_ >= 0 && N_VARS_ <= 24, "N_VARS out of range");
+    static_assert(LOG_BITS_ >= 1 && LOG_BITS_ <= 6, "LOG_BITS out of range");
+
+    static const int N_VARS       = N_VARS_;
+    static const int LOG_BITS     = LOG_BITS_;
+    static const int HEIGHT       = 1 << LOG_BITS;
+    static const int N            = 1 << N_VARS;
+    static const int B_LEAVES_LEN = HEIGHT * N;
+};
+
+typedef IntMulSize<INTMUL_N_VARS, INTMUL_LOG_BITS> KernelSize;
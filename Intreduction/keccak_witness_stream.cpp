@@ -0,0 +1,203 @@
+#include <stdint.h>
+
+#include "keccak_witness_stream.h"
+
+// ============================================================
+// Streaming Keccak-f[1600] witness, HLS version of the force-committed
+// values of keccak_ref/keccak256_witness.cpp
+//
+//   keccak_rounds : absorbs a block (17 words, one per cycle), then runs
+//                   KECCAK_ROUNDS_PER_CYCLE rounds per pipeline iteration
+//                   and hands each iteration's 30 * R witness words on as
+//                   one wide group
+//   write_witness : serializes the groups onto witness_out, one word per
+//                   cycle, adds the inter-block lane 0 and sends the digest
+//
+// The AXIS port moves 721 words per block against 17 + 24 / R cycles in
+// the round core, so the group FIFO holds a whole block: the core absorbs
+// and permutes block b + 1 while block b drains.
+// ============================================================
+
+static const int KECCAK_ROUNDS = 24;
+static const int ROUND_GROUPS  = KECCAK_ROUNDS / KECCAK_ROUNDS_PER_CYCLE;
+static const int GROUP_WORDS   = KECCAK_ROUNDS_PER_CYCLE * KECCAK_ROUND_WORDS;
+
+static_assert(KECCAK_ROUNDS % KECCAK_ROUNDS_PER_CYCLE == 0,
+              "KECCAK_ROUNDS_PER_CYCLE must divide 24");
+
+struct RoundGroup {
+    u64 w[GROUP_WORDS];
+};
+
+static const uint64_t KECCAK_RC[KECCAK_ROUNDS] = {
+    0x0000000000000001ull, 0x0000000000008082ull, 0x800000000000808aull, 0x8000000080008000ull,
+    0x000000000000808bull, 0x0000000080000001ull, 0x8000000080008081ull, 0x8000000000008009ull,
+    0x000000000000008aull, 0x0000000000000088ull, 0x0000000080008009ull, 0x000000008000000aull,
+    0x000000008000808bull, 0x800000000000008bull, 0x8000000000008089ull, 0x8000000000008003ull,
+    0x8000000000008002ull, 0x8000000000000080ull, 0x000000000000800aull, 0x800000008000000aull,
+    0x8000000080008081ull, 0x8000000000008080ull, 0x0000000080000001ull, 0x8000000080008008ull
+};
+
+// rho offset of lane x + 5 y
+static const int KECCAK_ROT[25] = {
+     0,  1, 62, 28, 27,
+    36, 44,  6, 55, 20,
+     3, 10, 43, 25, 39,
+    41, 45, 15, 21,  8,
+    18,  2, 61, 56, 14
+};
+
+static void write_axis64(hls::stream<axis64_t>& s, u64 x, bool last = false) {
+#pragma HLS INLINE
+    axis64_t v;
+    v.data = (ap_uint<64>)x;
+    v.keep = -1;
+    v.strb = -1;
+    v.last = last;
+    s.write(v);
+}
+
+static u64 rotl64(u64 x, int n) {
+#pragma HLS INLINE
+    return n == 0 ? x : u64((x << n) | (x >> (64 - n)));
+}
+
+// One round on A; w[0..5) gets D[x], w[5..30) the post-chi lanes.
+// All indices are constants once unrolled: wiring plus two XOR levels.
+static void keccak_round(u64 A[25], int round, u64 w[KECCAK_ROUND_WORDS]) {
+#pragma HLS INLINE
+    u64 C[5], D[5], B[25];
+#pragma HLS ARRAY_PARTITION variable=C complete
+#pragma HLS ARRAY_PARTITION variable=D complete
+#pragma HLS ARRAY_PARTITION variable=B complete
+
+    for (int x = 0; x < 5; x++) {
+#pragma HLS UNROLL
+        C[x] = A[x] ^ A[x + 5] ^ A[x + 10] ^ A[x + 15] ^ A[x + 20];
+    }
+    for (int x = 0; x < 5; x++) {
+#pragma HLS UNROLL
+        D[x] = C[(x + 4) % 5] ^ rotl64(C[(x + 1) % 5], 1);
+        w[x] = D[x];
+    }
+
+    // theta + rho + pi
+    for (int y = 0; y < 5; y++) {
+#pragma HLS UNROLL
+        for (int x = 0; x < 5; x++) {
+#pragma HLS UNROLL
+            B[y + 5 * ((2 * x + 3 * y) % 5)] = rotl64(A[x + 5 * y] ^ D[x], KECCAK_ROT[x + 5 * y]);
+        }
+    }
+
+    // chi, committed before iota
+    for (int y = 0; y < 5; y++) {
+#pragma HLS UNROLL
+        for (int x = 0; x < 5; x++) {
+#pragma HLS UNROLL
+            A[x + 5 * y] = B[x + 5 * y] ^ (~B[(x + 1) % 5 + 5 * y] & B[(x + 2) % 5 + 5 * y]);
+            w[5 + x + 5 * y] = A[x + 5 * y];
+        }
+    }
+
+    A[0] ^= u64(KECCAK_RC[round]);
+}
+
+static void keccak_rounds(
+    hls::stream<axis64_t>& words_in,
+    hls::stream<RoundGroup>& group_s,
+    int n_blocks
+) {
+    u64 A[25];
+#pragma HLS ARRAY_PARTITION variable=A complete
+    for (int i = 0; i < 25; i++) {
+#pragma HLS UNROLL
+        A[i] = 0;
+    }
+
+    for (int b = 0; b < n_blocks; b++) {
+#pragma HLS LOOP_TRIPCOUNT min=1 max=64
+        for (int i = 0; i < KECCAK_RATE_WORDS; i++) {
+#pragma HLS PIPELINE II=1
+            A[i] ^= u64(words_in.read().data);
+        }
+        for (int g = 0; g < ROUND_GROUPS; g++) {
+#pragma HLS PIPELINE II=1
+            RoundGroup grp;
+#pragma HLS ARRAY_PARTITION variable=grp.w complete
+            for (int u = 0; u < KECCAK_ROUNDS_PER_CYCLE; u++) {
+#pragma HLS UNROLL
+                keccak_round(A, g * KECCAK_ROUNDS_PER_CYCLE + u, grp.w + u * KECCAK_ROUND_WORDS);
+            }
+            group_s.write(grp);
+        }
+    }
+}
+
+static void write_witness(
+    hls::stream<RoundGroup>& group_s,
+    hls::stream<axis64_t>& witness_out,
+    hls::stream<axis64_t>& digest_out,
+    int n_blocks
+) {
+    const int total = keccak_witness_words(n_blocks);
+    int emitted = 0;
+    RoundGroup grp;
+#pragma HLS ARRAY_PARTITION variable=grp.w complete
+
+    for (int b = 0; b < n_blocks; b++) {
+#pragma HLS LOOP_TRIPCOUNT min=1 max=64
+        int k = GROUP_WORDS;
+        for (int j = 0; j < KECCAK_BLOCK_WORDS; j++) {
+#pragma HLS PIPELINE II=1
+            if (k == GROUP_WORDS) {
+                grp = group_s.read();
+                k = 0;
+            }
+            write_axis64(witness_out, grp.w[k], emitted == total - 1);
+            emitted++;
+            k++;
+        }
+
+        // grp holds round 23; lanes 1.. are unchanged by iota
+        const int chi = GROUP_WORDS - 25;
+        u64 lane0 = grp.w[chi] ^ u64(KECCAK_RC[KECCAK_ROUNDS - 1]);
+        if (b < n_blocks - 1) {
+            write_axis64(witness_out, lane0, emitted == total - 1);
+            emitted++;
+        } else {
+            write_axis64(digest_out, lane0);
+            for (int i = 1; i < KECCAK_DIGEST_WORDS; i++) {
+#pragma HLS PIPELINE II=1
+                write_axis64(digest_out, grp.w[chi + i], i == KECCAK_DIGEST_WORDS - 1);
+            }
+        }
+    }
+}
+
+// ============================================================
+// Top function
+// ============================================================
+
+extern "C" {
+void keccak_witness_stream(
+    hls::stream<axis64_t> &words_in,
+    hls::stream<axis64_t> &witness_out,
+    hls::stream<axis64_t> &digest_out,
+    int n_blocks
+) {
+#pragma HLS INTERFACE ap_ctrl_hs port=return
+#pragma HLS INTERFACE axis port=words_in
+#pragma HLS INTERFACE axis port=witness_out
+#pragma HLS INTERFACE axis port=digest_out
+#pragma HLS INTERFACE s_axilite port=n_blocks bundle=control
+#pragma HLS INTERFACE s_axilite port=return bundle=control
+#pragma HLS DATAFLOW
+
+    hls::stream<RoundGroup> group_s("group_s");
+#pragma HLS STREAM variable=group_s depth=ROUND_GROUPS   // one block of groups
+
+    keccak_rounds(words_in, group_s, n_blocks);
+    write_witness(group_s, witness_out, digest_out, n_blocks);
+}
+}
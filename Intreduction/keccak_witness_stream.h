@@ -0,0 +1,47 @@
+#pragma once
+
+#include <ap_int.h>
+#include <ap_axi_sdata.h>
+#include <hls_stream.h>
+
+using u64 = ap_uint<64>;
+
+typedef ap_axiu<64, 0, 0, 0> axis64_t;
+
+// ============================================================
+// Keccak-f[1600] witness kernel
+//
+//   KECCAK_ROUNDS_PER_CYCLE : rounds per pipeline iteration of the round
+//                             core (divides 24, set with -D for the build)
+//
+// Per 136-byte block the round core commits, for each of the 24 rounds,
+// the theta D[0..4] and the 25 post-chi (pre-iota) lanes A[x + 5 y]: 30
+// words. Between blocks the permutation output lane 0 (after iota) follows,
+// as the next absorb reads it. This is the tail of the INTERNAL section of
+// ../keccak_ref/keccak_witness_dump_*.txt, from the first D[0] on; the
+// message / padding words before it are the circuit's own input wiring.
+// ============================================================
+
+#ifndef KECCAK_ROUNDS_PER_CYCLE
+#define KECCAK_ROUNDS_PER_CYCLE 1
+#endif
+
+static const int KECCAK_RATE_WORDS   = 17;                                   // padded words per block
+static const int KECCAK_ROUND_WORDS  = 30;                                   // D[0..4], chi lanes 0..24
+static const int KECCAK_BLOCK_WORDS  = 24 * KECCAK_ROUND_WORDS;              // 720
+static const int KECCAK_DIGEST_WORDS = 4;
+
+// Witness words for n_blocks blocks
+static inline int keccak_witness_words(int n_blocks) {
+    return n_blocks * (KECCAK_BLOCK_WORDS + 1) - 1;
+}
+
+// words_in  : n_blocks * 17 padded message words (pad10*1 already applied)
+// witness_out: keccak_witness_words(n_blocks) words, TLAST on the last one
+// digest_out: lanes 0..3 of the final state, TLAST on lane 3
+extern "C" void keccak_witness_stream(
+    hls::stream<axis64_t> &words_in,
+    hls::stream<axis64_t> &witness_out,
+    hls::stream<axis64_t> &digest_out,
+    int n_blocks
+);
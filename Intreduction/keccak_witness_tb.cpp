@@ -0,0 +1,379 @@
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "keccak_witness_stream.h"
+#include "host/constraint_system.hpp"
+#include "host/keccak.hpp"
+#include "host/keccak_delta.hpp"
+
+// Testbench of the keccak_witness_stream kernel:
+//   1. every ../keccak_ref/keccak_witness_dump_*.txt: the witness stream
+//      against the tail of the INTERNAL section, the digest against the
+//      expected digest wires
+//   2. random messages of 0 .. 3 blocks: digest against host/keccak.cpp,
+//      stream length and TLAST
+//   3. delta codec (host/keccak_delta.hpp): round trip of kernel streams and
+//      of random words, rejected truncations, size and decode rate
+//   4. constraint system (host/constraint_system.hpp): kernel witnesses
+//      satisfy it, corrupted D / chi / message words are caught at the
+//      right constraint, time per instance
+//
+//   g++ -O2 -mavx2 -std=c++14 -Ihls_native -I. keccak_witness_tb.cpp keccak_witness_stream.cpp host/keccak.cpp host/keccak_delta.cpp host/constraint_system.cpp -pthread -o keccak_witness_tb
+//   ./keccak_witness_tb [dump dir=../keccak_ref]
+//
+// Add -DKECCAK_ROUNDS_PER_CYCLE=2 (3, 4, ...) to check an unrolled round core.
+
+static const char* DUMPS[] = { "1byte", "8byte", "135byte", "136byte" };
+
+struct WitnessDump {
+    std::vector<uint8_t> msg;
+    uint64_t digest[KECCAK_DIGEST_WORDS];
+    long int_start = -1;                // value-vector index of the first INT entry
+    long n_internal = -1;
+    std::vector<uint64_t> internal;     // INT entries in index order
+};
+
+static bool load_dump(const std::string& path, WitnessDump& d) {
+    std::ifstream f(path);
+    if (!f) return false;
+    std::string line;
+    bool have_msg = false;
+    int n_digest = 0;
+    while (std::getline(f, line)) {
+        std::istringstream ls(line);
+        std::string key;
+        ls >> key;
+        if (key == "Hex:" && !have_msg) {
+            std::string hex;
+            ls >> hex;
+            for (size_t i = 0; i + 1 < hex.size(); i += 2)
+                d.msg.push_back((uint8_t)std::strtoul(hex.substr(i, 2).c_str(), nullptr, 16));
+            have_msg = true;
+        } else if (key.compare(0, 22, "expected_digest_wires[") == 0 && n_digest < KECCAK_DIGEST_WORDS) {
+            std::string hex;
+            ls >> hex;
+            d.digest[n_digest++] = std::strtoull(hex.c_str(), nullptr, 16);
+        } else if (key == "n_internal") {
+            std::string eq;
+            ls >> eq >> d.n_internal;
+        } else if (key.compare(0, 4, "INT[") == 0) {
+            if (d.int_start < 0) d.int_start = std::atol(key.c_str() + 4);
+            std::string eq, hex;
+            ls >> eq >> hex;
+            d.internal.push_back(std::strtoull(hex.c_str(), nullptr, 16));
+        }
+    }
+    return have_msg && n_digest == KECCAK_DIGEST_WORDS && d.n_internal > 0;
+}
+
+// Keccak-256 padding (0x01 .. 0x80) into 17-word blocks
+static std::vector<uint64_t> pad_message(const std::vector<uint8_t>& msg) {
+    const size_t rate = 8 * KECCAK_RATE_WORDS;
+    size_t n_blocks = msg.size() / rate + 1;
+    std::vector<uint64_t> w(n_blocks * KECCAK_RATE_WORDS, 0);
+    for (size_t i = 0; i < msg.size(); i++) w[i / 8] |= (uint64_t)msg[i] << (8 * (i % 8));
+    w[msg.size() / 8] ^= 0x01ull << (8 * (msg.size() % 8));
+    w.back() ^= 0x80ull << 56;
+    return w;
+}
+
+struct KernelRun {
+    std::vector<uint64_t> witness;
+    uint64_t digest[KECCAK_DIGEST_WORDS];
+    bool last_ok;
+};
+
+static void run_kernel(const std::vector<uint8_t>& msg, KernelRun& out) {
+    std::vector<uint64_t> words = pad_message(msg);
+    int n_blocks = (int)(words.size() / KECCAK_RATE_WORDS);
+
+    hls::stream<axis64_t> words_in("words_in"), witness_out("witness_out"), digest_out("digest_out");
+    for (uint64_t w : words) {
+        axis64_t v;
+        v.data = (u64)w;
+        words_in.write(v);
+    }
+    keccak_witness_stream(words_in, witness_out, digest_out, n_blocks);
+
+    const int total = keccak_witness_words(n_blocks);
+    out.witness.clear();
+    out.last_ok = true;
+    for (int j = 0; j < total && !witness_out.empty(); j++) {
+        axis64_t v = witness_out.read();
+        out.witness.push_back((uint64_t)v.data);
+        out.last_ok = out.last_ok && (bool)v.last == (j == total - 1);
+    }
+    out.last_ok = out.last_ok && witness_out.empty();
+    for (int i = 0; i < KECCAK_DIGEST_WORDS; i++) {
+        axis64_t v = digest_out.read();
+        out.digest[i] = (uint64_t)v.data;
+        out.last_ok = out.last_ok && (bool)v.last == (i == KECCAK_DIGEST_WORDS - 1);
+    }
+}
+
+static bool delta_round_trip(const std::vector<uint64_t>& witness, size_t n_blocks,
+                             std::vector<uint64_t>& enc) {
+    keccak_host::delta_encode(witness.data(), n_blocks, enc);
+    std::vector<uint64_t> dec;
+    std::string err;
+    return keccak_host::delta_decode(enc.data(), enc.size(), dec, &err) && dec == witness;
+}
+
+static bool check_dump(const std::string& dir, const char* name) {
+    std::string path = dir + "/keccak_witness_dump_" + name + ".txt";
+    WitnessDump d;
+    if (!load_dump(path, d)) {
+        std::cout << "[TB] cannot read " << path << "\n";
+        return false;
+    }
+    KernelRun k;
+    run_kernel(d.msg, k);
+
+    // the stream is the tail of the INT entries the circuit uses
+    long total = (long)k.witness.size();
+    long first = d.n_internal - total;
+    if (first < 0 || d.n_internal > (long)d.internal.size()) {
+        std::cout << "[TB] " << name << ": " << total << " witness words, only "
+                  << d.n_internal << " internal\n";
+        return false;
+    }
+    for (long j = 0; j < total; j++) {
+        if (k.witness[j] != d.internal[first + j]) {
+            std::cout << "[TB] " << name << ": witness word " << j << " (INT[" << d.int_start + first + j
+                      << "]) = 0x" << std::hex << k.witness[j] << ", dump 0x" << d.internal[first + j]
+                      << std::dec << "\n";
+            return false;
+        }
+    }
+    for (int i = 0; i < KECCAK_DIGEST_WORDS; i++) {
+        if (k.digest[i] != d.digest[i]) {
+            std::cout << "[TB] " << name << ": digest lane " << i << " differs\n";
+            return false;
+        }
+    }
+    if (!k.last_ok) {
+        std::cout << "[TB] " << name << ": TLAST misplaced\n";
+        return false;
+    }
+    std::cout << "[TB] " << name << ": " << d.msg.size() << " bytes, " << total
+              << " witness words match INT[" << d.int_start + first << " .. "
+              << d.int_start + d.n_internal - 1 << "], digest matches\n";
+    return true;
+}
+
+int main(int argc, char** argv) {
+    std::string dir = argc > 1 ? argv[1] : "../keccak_ref";
+    std::cout << "[TB] KECCAK_ROUNDS_PER_CYCLE = " << KECCAK_ROUNDS_PER_CYCLE << "\n";
+
+    // ---- 1. Rust witness dumps ----
+    for (const char* name : DUMPS)
+        if (!check_dump(dir, name)) {
+            std::cout << "[TB] FAIL\n";
+            return 1;
+        }
+
+    // ---- 2. random messages ----
+    uint64_t s = 0x9e3779b97f4a7c15ull;
+    const size_t lens[] = { 0, 7, 135, 136, 137, 271, 272, 500 };
+    for (size_t len : lens) {
+        std::vector<uint8_t> msg(len);
+        for (uint8_t& b : msg) {
+            s = s * 6364136223846793005ull + 1442695040888963407ull;
+            b = (uint8_t)(s >> 56);
+        }
+        KernelRun k;
+        run_kernel(msg, k);
+        keccak_host::Digest want = keccak_host::keccak256(msg.data(), msg.size());
+        int n_blocks = (int)(len / (8 * KECCAK_RATE_WORDS) + 1);
+        bool ok = k.last_ok && (int)k.witness.size() == keccak_witness_words(n_blocks);
+        for (int i = 0; i < KECCAK_DIGEST_WORDS; i++) ok = ok && k.digest[i] == want.w[i];
+        if (!ok) {
+            std::cout << "[TB] " << len << "-byte message: digest or stream length differs\n[TB] FAIL\n";
+            return 2;
+        }
+    }
+    std::cout << "[TB] " << sizeof(lens) / sizeof(lens[0]) << " random messages: digests match\n";
+
+    // ---- 3. delta codec ----
+    std::vector<uint64_t> enc;
+    for (size_t len : { (size_t)1, (size_t)136, (size_t)1000 }) {
+        std::vector<uint8_t> msg(len, 0x5a);
+        KernelRun k;
+        run_kernel(msg, k);
+        size_t n_blocks = len / (8 * KECCAK_RATE_WORDS) + 1;
+        if (!delta_round_trip(k.witness, n_blocks, enc)) {
+            std::cout << "[TB] delta: " << len << "-byte witness does not round-trip\n[TB] FAIL\n";
+            return 3;
+        }
+        std::cout << "[TB] delta: " << len << "-byte message, " << k.witness.size() << " words -> "
+                  << enc.size() << " (x" << (double)k.witness.size() / enc.size() << ")\n";
+    }
+
+    // not a witness: every delta is non-zero, still lossless
+    std::vector<uint64_t> noise(keccak_host::witness_stream_words(3));
+    for (uint64_t& w : noise) {
+        s = s * 6364136223846793005ull + 1442695040888963407ull;
+        w = s ^ (s >> 29);
+    }
+    bool ok = delta_round_trip(noise, 3, enc);
+    std::vector<uint64_t> dec;
+    std::string err;
+    for (size_t cut : { (size_t)1, (size_t)2, enc.size() / 2, enc.size() - 1 })
+        ok = ok && !keccak_host::delta_decode(enc.data(), cut, dec, &err);
+    enc.push_back(0);
+    ok = ok && !keccak_host::delta_decode(enc.data(), enc.size(), dec, &err);
+    if (!ok) {
+        std::cout << "[TB] delta: random words do not round-trip or a bad encoding was accepted\n[TB] FAIL\n";
+        return 3;
+    }
+
+    // decode rate on a 2^10-block witness
+    {
+        std::vector<uint8_t> msg(1024 * 8 * KECCAK_RATE_WORDS - 1, 0xa7);
+        KernelRun k;
+        run_kernel(msg, k);
+        keccak_host::delta_encode(k.witness.data(), 1024, enc);
+        keccak_host::delta_decode(enc.data(), enc.size(), dec, &err);
+        const int reps = 8;
+        auto t0 = std::chrono::steady_clock::now();
+        for (int r = 0; r < reps; r++) keccak_host::delta_decode(enc.data(), enc.size(), dec, &err);
+        double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count() / reps;
+        if (dec != k.witness) {
+            std::cout << "[TB] delta: 1024-block witness does not round-trip\n[TB] FAIL\n";
+            return 3;
+        }
+        std::cout << "[TB] delta: 1024 blocks, " << enc.size() * 8 / 1024 << " KB coded vs "
+                  << k.witness.size() * 8 / 1024 << " KB raw, decode " << secs * 1e3 << " ms, "
+                  << k.witness.size() * 8 / secs / 1e9 << " GB/s\n";
+    }
+
+    // ---- 4. constraint system ----
+    {
+        // shift ops and the linear path on a hand-made system over 4 words
+        intmul_host::ConstraintSystem t;
+        t.n_values = 4;
+        t.add_term(0, intmul_host::SHIFT_SLL, 4);                   // (v0 << 4)
+        t.end_operand();
+        t.add_term(1, intmul_host::SHIFT_SAR, 60);                  // & (v1 >>s 60)
+        t.end_operand();
+        t.add_term(2);                                              // == v2
+        t.end_operand();
+        t.n_and = 1;
+        t.add_term(3);                                              // v3 ^ rotl(v0, 9) ^ (v1 >> 3) == 0
+        t.add_term(0, intmul_host::SHIFT_ROTL, 9);
+        t.add_term(1, intmul_host::SHIFT_SRL, 3);
+        t.end_operand();
+        t.n_linear = 1;
+        uint64_t tv[4][4];
+        const uint64_t* tp[4];
+        for (int k = 0; k < 4; k++) {
+            uint64_t v0 = 0x8123456789abcdefull + k, v1 = 0xf00000000000000full << k;
+            tv[k][0] = v0;
+            tv[k][1] = v1;
+            tv[k][2] = (v0 << 4) & (uint64_t)((int64_t)v1 >> 60);
+            tv[k][3] = ((v0 << 9) | (v0 >> 55)) ^ (v1 >> 3);
+            tp[k] = tv[k];
+        }
+        tv[1][2] ^= 1;   // AND fails
+        tv[3][3] ^= 8;   // linear fails
+        long tf[4];
+        intmul_host::check_constraints_x4(t, tp, 4, tf);
+        bool t_ok = tf[0] == -1 && tf[1] == 0 && tf[2] == -1 && tf[3] == 1;
+        for (int k = 0; k < 4; k++) t_ok = t_ok && intmul_host::check_constraints(t, tv[k], 4) == tf[k];
+        if (!t_ok) {
+            std::cout << "[TB] constraints: shift / linear evaluation wrong\n[TB] FAIL\n";
+            return 4;
+        }
+
+        std::vector<uint8_t> msg(200);
+        for (uint8_t& b : msg) {
+            s = s * 6364136223846793005ull + 1442695040888963407ull;
+            b = (uint8_t)(s >> 56);
+        }
+        const size_t n_blocks = 2;
+        std::vector<uint64_t> padded = pad_message(msg);
+        KernelRun k;
+        run_kernel(msg, k);
+        intmul_host::ConstraintSystem cs = intmul_host::keccak_constraint_system(n_blocks);
+        std::vector<uint64_t> v;
+        intmul_host::keccak_value_vector(padded.data(), k.witness.data(), n_blocks, v);
+        const size_t stream = intmul_host::KECCAK_CS_MSG + padded.size();
+        bool ok = intmul_host::check_constraints(cs, v.data(), v.size()) == -1;
+
+        // (word, first constraint expected to fail): a chi lane fails its own
+        // AND; D[x] and the lane 0 between blocks feed the chi ANDs of the
+        // round that reads them, which come before every linear constraint
+        const size_t cases[][2] = {
+            { stream + 2 * 30 + 5 + 3, 2 * 25 + 3 },   // block 0, round 2, chi lane 3
+            { stream + 721 + 1, 24 * 25 },             // block 1, round 0, D[1]
+            { stream + 720, 24 * 25 },                 // lane 0 between the blocks
+        };
+        for (const auto& c : cases) {
+            v[c[0]] ^= 1ull << 17;
+            long got = intmul_host::check_constraints(cs, v.data(), v.size());
+            ok = ok && got >= (long)c[1] && got < (long)c[1] + 25 && (c[1] != 2 * 25 + 3 || got == 53);
+            v[c[0]] ^= 1ull << 17;
+        }
+        v[intmul_host::KECCAK_CS_MSG + 3] ^= 1;
+        ok = ok && intmul_host::check_constraints(cs, v.data(), v.size()) != -1;
+        v[intmul_host::KECCAK_CS_MSG + 3] ^= 1;
+
+        // ONE = 0 would turn chi into B1 & B2 == chi ^ B0: the pinned
+        // constants and the length are checked first
+        v[intmul_host::KECCAK_CS_ONE] = 0;
+        ok = ok && intmul_host::check_constraints(cs, v.data(), v.size()) == intmul_host::CS_BAD_VALUES;
+        v[intmul_host::KECCAK_CS_ONE] = ~0ull;
+        v[intmul_host::KECCAK_CS_RC + 5] ^= 2;
+        ok = ok && intmul_host::check_constraints(cs, v.data(), v.size()) == intmul_host::CS_BAD_VALUES;
+        v[intmul_host::KECCAK_CS_RC + 5] ^= 2;
+        ok = ok && intmul_host::check_constraints(cs, v.data(), v.size() - 1) == intmul_host::CS_BAD_VALUES;
+        if (!ok) {
+            std::cout << "[TB] constraints: witness rejected or corruption missed\n[TB] FAIL\n";
+            return 4;
+        }
+
+        // one-block instances: single, then 256 in batches of four
+        intmul_host::ConstraintSystem cs1 = intmul_host::keccak_constraint_system(1);
+        const int n_inst = 256;
+        std::vector<std::vector<uint64_t>> inst(n_inst);
+        std::vector<const uint64_t*> ptr(n_inst);
+        for (int i = 0; i < n_inst; i++) {
+            std::vector<uint8_t> m(32, (uint8_t)i);
+            std::vector<uint64_t> p = pad_message(m);
+            KernelRun ki;
+            run_kernel(m, ki);
+            intmul_host::keccak_value_vector(p.data(), ki.witness.data(), 1, inst[i]);
+            ptr[i] = inst[i].data();
+        }
+        inst[77][intmul_host::KECCAK_CS_MSG + 17 + 400] ^= 4;
+        inst[130][intmul_host::KECCAK_CS_ONE] = 0;
+        std::vector<long> first(n_inst);
+        auto t0 = std::chrono::steady_clock::now();
+        for (int i = 0; i < n_inst; i++) first[i] = intmul_host::check_constraints(cs1, ptr[i], cs1.n_values);
+        double t_one = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+        std::vector<long> first4(n_inst);
+        t0 = std::chrono::steady_clock::now();
+        intmul_host::check_constraints_batch(cs1, ptr.data(), cs1.n_values, n_inst, first4.data(), 0);
+        double t_batch = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+        for (int i = 0; i < n_inst; i++)
+            ok = ok && first[i] == first4[i] && (first[i] == -1) == (i != 77 && i != 130) &&
+                 (first[i] == intmul_host::CS_BAD_VALUES) == (i == 130);
+        if (!ok) {
+            std::cout << "[TB] constraints: batch check disagrees\n[TB] FAIL\n";
+            return 4;
+        }
+        std::cout << "[TB] constraints: " << cs.n_and << " AND + " << cs.n_linear << " linear ("
+                  << cs.terms.size() << " terms) for 2 blocks, corruptions caught; 1 block: "
+                  << t_one / n_inst * 1e6 << " us/instance, batched x4 "
+                  << t_batch / n_inst * 1e6 << " us/instance\n";
+    }
+
+    std::cout << "[TB] PASS\n";
+    return 0;
+}
@@ -0,0 +1,148 @@
+#include <chrono>
+#include <cstdint>
+#include <cstring>
+#include <iostream>
+#include <vector>
+
+#include "host/intmul.hpp"
+#include "host/keccak.hpp"
+#include "host/merkle.hpp"
+
+// Host test of the Keccak-256 Merkle commitment:
+//   1. Keccak-256 known answers, word / x4 hashing against the byte path
+//   2. tree root against a plain recursive build, thread counts agree
+//   3. batched multi-path openings verify, tampered leaves / siblings /
+//      indices are rejected
+//   4. commit rate on 2^22 witness words
+//
+//   g++ -O2 -mavx2 -pthread -I. merkle_tb.cpp host/merkle.cpp host/keccak.cpp -o merkle_tb
+
+using keccak_host::Digest;
+
+struct Lcg {
+    uint64_t s;
+    explicit Lcg(uint64_t seed) : s(seed) {}
+    uint64_t next() {
+        s = s * 6364136223846793005ull + 1442695040888963407ull;
+        return s ^ (s >> 29);
+    }
+};
+
+static bool check_digest(const char* msg, const char* hex) {
+    Digest d = keccak_host::keccak256(msg, std::strlen(msg));
+    char out[65];
+    const unsigned char* b = (const unsigned char*)d.w;
+    for (int i = 0; i < 32; i++) std::snprintf(out + 2 * i, 3, "%02x", b[i]);
+    return std::strcmp(out, hex) == 0;
+}
+
+static Digest plain_root(const uint64_t* words, std::size_t leaf_words, std::size_t n_leaves) {
+    if (n_leaves == 1) return keccak_host::keccak256(words, 8 * leaf_words);
+    Digest l = plain_root(words, leaf_words, n_leaves / 2);
+    Digest r = plain_root(words + leaf_words * (n_leaves / 2), leaf_words, n_leaves / 2);
+    unsigned char m[64];
+    std::memcpy(m, l.w, 32);
+    std::memcpy(m + 32, r.w, 32);
+    return keccak_host::keccak256(m, 64);
+}
+
+int main() {
+    // ---- 1. hashing ----
+    if (!check_digest("", "c5d2460186f7233c927e7db2dcc703c0e500b653ca82273b7bfad8045d85a470") ||
+        !check_digest("abc", "4e03657aea45a94fc7d47ba826c8d667c0d1e6e33a64a036ec44f58fa12d6c45")) {
+        std::cout << "[TB] Keccak-256 known answer differs\n[TB] FAIL\n";
+        return 1;
+    }
+    Lcg rng(0x510e527fade682d1ull);
+    std::vector<uint64_t> msg(4 * 64);
+    for (uint64_t& w : msg) w = rng.next();
+    for (std::size_t n_words = 0; n_words <= 64; n_words++) {
+        const uint64_t* m4[4] = { &msg[0], &msg[64], &msg[128], &msg[192] };
+        Digest x4[4];
+        keccak_host::keccak256_words_x4(m4, n_words, x4);
+        for (int k = 0; k < 4; k++) {
+            if (x4[k] != keccak_host::keccak256(m4[k], 8 * n_words) ||
+                keccak_host::keccak256_words(m4[k], n_words) != x4[k]) {
+                std::cout << "[TB] word hashing differs at " << n_words << " words\n[TB] FAIL\n";
+                return 1;
+            }
+        }
+    }
+    std::cout << "[TB] Keccak-256: known answers, word and x4 paths agree\n";
+
+    // ---- 2. commitment ----
+    const std::size_t leaf_words = intmul_host::MerkleTree::DEFAULT_LEAF_WORDS;
+    const std::size_t n_leaves = 1 << 10;
+    std::vector<uint64_t> words(leaf_words * n_leaves);
+    for (uint64_t& w : words) w = rng.next();
+
+    intmul_host::MerkleTree tree, tree1, tree8(intmul_host::MerkleTree::NODE_WORDS);
+    if (tree.root() != Digest() ||
+        !tree.commit(words.data(), words.size(), 0) || !tree1.commit(words.data(), words.size(), 1) ||
+        tree.commit(words.data(), words.size() - leaf_words, 0) ||
+        tree8.commit(words.data(), words.size(), 0)) {
+        std::cout << "[TB] commit accepted / rejected the wrong sizes\n[TB] FAIL\n";
+        return 2;
+    }
+    if (tree.root() != plain_root(words.data(), leaf_words, n_leaves) || tree1.root() != tree.root()) {
+        std::cout << "[TB] root differs from the plain build\n[TB] FAIL\n";
+        return 2;
+    }
+    std::cout << "[TB] root of " << n_leaves << " leaves matches the plain build\n";
+
+    // ---- 3. openings ----
+    std::vector<std::size_t> idx = { 700, 3, 2, 1023, 511, 512, 3, 0 };
+    intmul_host::MerkleMultiProof proof, single, unused;
+    bool ok = tree.open(idx, proof) && tree.open(std::vector<std::size_t>(1, 700), single) &&
+              !tree.open(std::vector<std::size_t>(1, n_leaves), unused) &&
+              !tree.open(std::vector<std::size_t>(), unused) && !tree8.open(idx, unused);
+    std::vector<uint64_t> opened;
+    for (std::size_t i : proof.indices)
+        opened.insert(opened.end(), &words[i * leaf_words], &words[(i + 1) * leaf_words]);
+    ok = ok && intmul_host::merkle_verify(tree.root(), tree.depth(), leaf_words, proof, opened.data());
+    std::cout << "[TB] " << proof.indices.size() << "-leaf opening: " << proof.siblings.size()
+              << " siblings (" << single.siblings.size() << " for one path), verify=" << ok << "\n";
+    if (!ok || proof.indices.size() != 7) {
+        std::cout << "[TB] FAIL\n";
+        return 3;
+    }
+
+    std::vector<uint64_t> bad_leaf = opened;
+    bad_leaf[5] ^= 1;
+    intmul_host::MerkleMultiProof bad_sib = proof;
+    bad_sib.siblings[4].w[2] ^= 1;
+    intmul_host::MerkleMultiProof bad_idx = proof;
+    bad_idx.indices[3] ^= 1;
+    if (intmul_host::merkle_verify(tree.root(), tree.depth(), leaf_words, proof, bad_leaf.data()) ||
+        intmul_host::merkle_verify(tree.root(), tree.depth(), leaf_words, bad_sib, opened.data()) ||
+        intmul_host::merkle_verify(tree.root(), tree.depth(), leaf_words, bad_idx, opened.data())) {
+        std::cout << "[TB] tampered opening accepted\n[TB] FAIL\n";
+        return 3;
+    }
+    // the two level-0 hashes under node (1, 0) posing as one 8-word leaf of
+    // a tree one level lower: the same root unless 8-word leaves are refused
+    intmul_host::MerkleMultiProof forged;
+    forged.indices.push_back(0);
+    for (std::size_t l = 1; l < tree.depth(); l++) forged.siblings.push_back(tree.node(l, 1));
+    Digest n0 = tree.node(0, 0), n1 = tree.node(0, 1);
+    uint64_t pair[8] = { n0.w[0], n0.w[1], n0.w[2], n0.w[3], n1.w[0], n1.w[1], n1.w[2], n1.w[3] };
+    if (intmul_host::merkle_verify(tree.root(), tree.depth() - 1, intmul_host::MerkleTree::NODE_WORDS,
+                                   forged, pair)) {
+        std::cout << "[TB] node accepted as a leaf\n[TB] FAIL\n";
+        return 3;
+    }
+    std::cout << "[TB] tampered openings and a node posing as a leaf rejected\n";
+
+    // ---- 4. rate ----
+    std::vector<uint64_t> big((std::size_t)1 << 22);
+    for (uint64_t& w : big) w = rng.next();
+    intmul_host::MerkleTree big_tree;
+    auto t0 = std::chrono::steady_clock::now();
+    big_tree.commit(big.data(), big.size(), 0);
+    double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    std::cout << "[TB] commit 2^22 words, " << intmul_host::resolve_threads(0) << " threads: " << secs
+              << " s, " << (big.size() * 8 / secs / 1e6) << " MB/s\n";
+
+    std::cout << "[TB] PASS\n";
+    return 0;
+}
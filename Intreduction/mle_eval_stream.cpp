@@ -0,0 +1,102 @@
+#include <stdint.h>
+
+#include "ghash_hls.h"
+#include "mle_eval_stream.h"
+
+// ============================================================
+// Streaming MLE evaluation, HLS version of mle_eval() in host/mle.cpp
+//
+//   result = sum_x eq(point, x) * table[x]
+//
+// point_in carries the n_vars coordinates, table_in the 2^n_vars entries
+// in index order. eq splits into e_lo (low n_vars / 2 coordinates) and
+// e_hi (the rest), both built on chip from the point, at most 2^12
+// entries each. Per table entry one unreduced 128 x 128 product is XORed
+// into a 256-bit accumulator; it is reduced and weighted by e_hi once per
+// run of 2^(n_vars / 2) entries. II = 1 per entry, so the kernel runs at
+// the rate the table streams in.
+// ============================================================
+
+static const int MLE_HALF_MAX = 1 << ((MLE_MAX_VARS + 1) / 2);
+
+// One doubling pass: dst[j] = src[j] (1 + r), dst[j + half] = src[j] r.
+// src is only read and dst only written (one port each way per entry).
+static void eq_pass(const u128 src[MLE_HALF_MAX], u128 dst[MLE_HALF_MAX], u128 r, int half) {
+#pragma HLS INLINE
+    for (int j = 0; j < half; j++) {
+#pragma HLS PIPELINE II=1
+#pragma HLS LOOP_TRIPCOUNT min=1 max=2048
+        u128 x  = src[j];
+        u128 hi = ghash_mul(x, r);
+        dst[j] = x ^ hi;
+        dst[j + half] = hi;
+    }
+}
+
+// out[x] = eq(pt, x) for x < 2^n. Updating one table in place would need a
+// read and two writes per entry on a two-port RAM, so the passes ping-pong
+// between out and tmp, ordered so that the last one lands in out.
+static void build_eq(const u128 pt[MLE_MAX_VARS], int first, int n, u128 out[MLE_HALF_MAX]) {
+#pragma HLS INLINE off
+    u128 tmp[MLE_HALF_MAX];
+#pragma HLS BIND_STORAGE variable=tmp type=ram_2p impl=bram
+    out[0] = gf_one();
+    tmp[0] = gf_one();
+    for (int i = 0; i < n; i++) {
+#pragma HLS LOOP_TRIPCOUNT min=1 max=12
+        u128 r = pt[first + i];
+        if (((n - 1 - i) & 1) == 0) {
+            eq_pass(tmp, out, r, 1 << i);
+        } else {
+            eq_pass(out, tmp, r, 1 << i);
+        }
+    }
+}
+
+extern "C" {
+void mle_eval_stream(
+    hls::stream<axis128_t> &point_in,
+    hls::stream<axis128_t> &table_in,
+    int n_vars,
+    u128 &result
+) {
+#pragma HLS INTERFACE ap_ctrl_hs port=return
+#pragma HLS INTERFACE axis port=point_in
+#pragma HLS INTERFACE axis port=table_in
+#pragma HLS INTERFACE s_axilite port=n_vars bundle=control
+#pragma HLS INTERFACE s_axilite port=result bundle=control
+#pragma HLS INTERFACE s_axilite port=return bundle=control
+
+    u128 pt[MLE_MAX_VARS];
+    u128 e_lo[MLE_HALF_MAX];
+    u128 e_hi[MLE_HALF_MAX];
+#pragma HLS BIND_STORAGE variable=e_lo type=ram_2p impl=bram
+#pragma HLS BIND_STORAGE variable=e_hi type=ram_2p impl=bram
+
+    for (int i = 0; i < n_vars; i++) {
+#pragma HLS LOOP_TRIPCOUNT min=1 max=MLE_MAX_VARS
+        pt[i] = point_in.read().data;
+    }
+
+    const int n_lo = n_vars / 2;
+    build_eq(pt, 0, n_lo, e_lo);
+    build_eq(pt, n_lo, n_vars - n_lo, e_hi);
+
+    const int lo_mask = (1 << n_lo) - 1;
+    ap_uint<256> inner = 0;
+    ap_uint<256> outer = 0;
+    for (int i = 0; i < (1 << n_vars); i++) {
+#pragma HLS PIPELINE II=1
+#pragma HLS LOOP_TRIPCOUNT min=1 max=16777216
+        u128 v = table_in.read().data;
+        ap_uint<256> acc = inner ^ clmul128_wide(e_lo[i & lo_mask], v);
+        if ((i & lo_mask) == lo_mask) {
+            outer ^= clmul128_wide(e_hi[i >> n_lo], reduce_wide(acc));
+            inner = 0;
+        } else {
+            inner = acc;
+        }
+    }
+    result = reduce_wide(outer);
+}
+}
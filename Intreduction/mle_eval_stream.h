@@ -0,0 +1,18 @@
+#pragma once
+
+#include <ap_int.h>
+#include <ap_axi_sdata.h>
+#include <hls_stream.h>
+
+using u128 = ap_uint<128>;
+
+typedef ap_axiu<128, 0, 0, 0> axis128_t;
+
+static const int MLE_MAX_VARS = 24;   // largest table the kernel is sized for
+
+extern "C" void mle_eval_stream(
+    hls::stream<axis128_t> &point_in,
+    hls::stream<axis128_t> &table_in,
+    int n_vars,
+    u128 &result
+);
@@ -0,0 +1,102 @@
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include "mle_eval_stream.h"
+#include "host/mle.hpp"
+
+// Testbench of the MLE engine (host/mle.hpp) and the mle_eval_stream kernel:
+// every evaluation / fold path against the plain one-variable-at-a-time fold,
+// then the host evaluation rate on a 2^22 table.
+
+using ghash_host::u128_t;
+
+static const int N_VARS = 11;
+
+static uint64_t lcg_state = 0xbb67ae8584caa73bull;
+static u128_t rand128() {
+    lcg_state = lcg_state * 6364136223846793005ull + 1442695040888963407ull;
+    uint64_t hi = lcg_state ^ (lcg_state >> 29);
+    lcg_state = lcg_state * 6364136223846793005ull + 1442695040888963407ull;
+    return ghash_host::make_u128(hi, lcg_state ^ (lcg_state >> 29));
+}
+
+// reference: bind variables top-down with fold_top, one at a time
+static u128_t eval_by_folding(std::vector<u128_t> t, size_t n, const u128_t* point) {
+    for (size_t i = n; i-- > 0;) intmul_host::fold_top(t.data(), (size_t)1 << (i + 1), point[i], 1);
+    return t[0];
+}
+
+int main() {
+    const size_t len = (size_t)1 << N_VARS;
+    std::vector<u128_t> table(len), point(N_VARS);
+    for (size_t i = 0; i < len; i++) table[i] = rand128();
+    for (size_t i = 0; i < N_VARS; i++) point[i] = rand128();
+
+    const u128_t want = eval_by_folding(table, N_VARS, point.data());
+    bool ok = true;
+
+    // split-eq, lazily reduced evaluation, 1 and 4 threads
+    ok &= intmul_host::mle_eval(table.data(), N_VARS, point.data(), 1) == want;
+    ok &= intmul_host::mle_eval(table.data(), N_VARS, point.data(), 4) == want;
+
+    // streaming evaluation in uneven pieces
+    intmul_host::MleStreamEval se(point.data(), N_VARS);
+    for (size_t pos = 0, step = 1; pos < len; pos += step, step = step * 3 % 97 + 1)
+        se.push(&table[pos], std::min(step, len - pos));
+    ok &= se.done() && se.result() == want;
+    std::cout << "[TB] evaluation paths: " << (ok ? "agree" : "DIFFER") << "\n";
+
+    // fold the top 4 variables in one pass, then finish the evaluation
+    const size_t k = 4;
+    std::vector<u128_t> t = table;
+    intmul_host::fold_top_k(t.data(), N_VARS, &point[N_VARS - k], k, 2);
+    bool fold_ok = eval_by_folding(std::vector<u128_t>(t.begin(), t.begin() + (len >> k)),
+                                   N_VARS - k, point.data()) == want;
+
+    // out-of-core fold of the low 3 variables, then the rest
+    std::vector<u128_t> low;
+    intmul_host::MleStreamFolder sf(point.data(), 3);
+    sf.push(table.data(), 100, low);
+    sf.push(table.data() + 100, len - 100, low);
+    fold_ok &= low.size() == (len >> 3) && eval_by_folding(low, N_VARS - 3, point.data() + 3) == want;
+    std::cout << "[TB] top-k / streaming folds: " << (fold_ok ? "agree" : "DIFFER") << "\n";
+
+    // HLS kernel
+    hls::stream<axis128_t> point_in, table_in;
+    for (size_t i = 0; i < N_VARS; i++) {
+        axis128_t v;
+        v.data = (u128(ghash_host::hi64(point[i])) << 64) | u128(ghash_host::lo64(point[i]));
+        point_in.write(v);
+    }
+    for (size_t i = 0; i < len; i++) {
+        axis128_t v;
+        v.data = (u128(ghash_host::hi64(table[i])) << 64) | u128(ghash_host::lo64(table[i]));
+        v.last = (i == len - 1);
+        table_in.write(v);
+    }
+    u128 result = 0;
+    mle_eval_stream(point_in, table_in, N_VARS, result);
+    bool hls_ok = ghash_host::make_u128((uint64_t)(result >> 64), (uint64_t)result) == want;
+    std::cout << "[TB] mle_eval_stream: " << (hls_ok ? "matches" : "DIFFERS") << "\n";
+
+    // host evaluation rate
+    const size_t big_vars = 22;
+    std::vector<u128_t> big((size_t)1 << big_vars);
+    for (size_t i = 0; i < big.size(); i++) big[i] = (u128_t)i * 0x9e3779b97f4a7c15ull;
+    std::vector<u128_t> big_point(big_vars);
+    for (size_t i = 0; i < big_vars; i++) big_point[i] = rand128();
+    auto t0 = std::chrono::steady_clock::now();
+    intmul_host::mle_eval(big.data(), big_vars, big_point.data(), 0);
+    double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    std::cout << "[TB] mle_eval 2^" << big_vars << ": " << secs << " s, "
+              << (big.size() * 16 / secs / 1e9) << " GB/s\n";
+
+    if (ok && fold_ok && hls_ok) {
+        std::cout << "[TB] PASS\n";
+        return 0;
+    }
+    std::cout << "[TB] FAIL\n";
+    return 2;
+}
@@ -0,0 +1,151 @@
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include "additive_ntt.h"
+#include "host/additive_ntt.hpp"
+#include "host/intmul.hpp"
+
+// Testbench of the additive NTT (host/additive_ntt.hpp) and the
+// additive_ntt_stage kernel:
+//   1. forward on every coset of a small domain against plain evaluation
+//      of the novel-basis polynomial, Reed-Solomon encode, inverse
+//   2. blocked / threaded transforms above NTT_BLOCK_LOG round-trip and
+//      agree across thread counts
+//   3. the stage kernel, layer by layer, against the host transform
+//   4. forward transform rate at 2^16 .. 2^22
+
+using ghash_host::u128_t;
+
+static uint64_t lcg_state = 0x3c6ef372fe94f82bull;
+static u128_t rand128() {
+    lcg_state = lcg_state * 6364136223846793005ull + 1442695040888963407ull;
+    uint64_t hi = lcg_state ^ (lcg_state >> 29);
+    lcg_state = lcg_state * 6364136223846793005ull + 1442695040888963407ull;
+    return ghash_host::make_u128(hi, lcg_state ^ (lcg_state >> 29));
+}
+
+static u128 to_hls(u128_t x) {
+    return (u128((uint64_t)ghash_host::hi64(x)) << 64) | u128((uint64_t)ghash_host::lo64(x));
+}
+
+static u128_t to_host(u128 x) {
+    return ghash_host::make_u128((uint64_t)(x >> 64), (uint64_t)x);
+}
+
+// sum_j coeff[j] X_j(omega), X_j = prod_{bit i of j} Wh_i
+static u128_t eval_novel(const std::vector<u128_t>& coeff, int log_n, u128_t omega) {
+    std::vector<u128_t> wh(log_n);
+    for (int i = 0; i < log_n; i++) wh[i] = intmul_host::novel_basis_factor(i, omega);
+    u128_t sum = 0;
+    for (size_t j = 0; j < coeff.size(); j++) {
+        u128_t x = ghash_host::gf_one();
+        for (int i = 0; i < log_n; i++)
+            if ((j >> i) & 1) x = ghash_host::ghash_mul(x, wh[i]);
+        sum ^= ghash_host::ghash_mul(coeff[j], x);
+    }
+    return sum;
+}
+
+int main() {
+    // ---- 1. small domain ----
+    const int log_n = 5, log_rate = 2;
+    intmul_host::AdditiveNtt small(log_n + log_rate, 1);
+    std::vector<u128_t> msg(1 << log_n);
+    for (u128_t& c : msg) c = rand128();
+    std::vector<u128_t> code((size_t)1 << (log_n + log_rate));
+    small.encode(msg.data(), log_n, log_rate, code.data());
+    for (size_t u = 0; u < code.size(); u++) {
+        if (code[u] != eval_novel(msg, log_n, (u128_t)u)) {
+            std::cout << "[TB] codeword differs from plain evaluation at point " << u << "\n[TB] FAIL\n";
+            return 2;
+        }
+    }
+    for (size_t c = 0; c < ((size_t)1 << log_rate); c++) {
+        std::vector<u128_t> back(code.begin() + (c << log_n), code.begin() + ((c + 1) << log_n));
+        small.inverse(back.data(), log_n, c);
+        if (back != msg) {
+            std::cout << "[TB] inverse on coset " << c << " does not recover the message\n[TB] FAIL\n";
+            return 2;
+        }
+    }
+    std::cout << "[TB] RS encode 2^" << log_n << " x rate 2^-" << log_rate
+              << ": matches plain evaluation, inverse recovers the message\n";
+
+    // ---- 2. blocked / threaded ----
+    const int big_log = intmul_host::NTT_BLOCK_LOG + 3;
+    intmul_host::AdditiveNtt ntt(big_log + 1, 1), ntt4(big_log + 1, 4);
+    std::vector<u128_t> data((size_t)1 << big_log);
+    for (u128_t& c : data) c = rand128();
+    std::vector<u128_t> f1 = data, f4 = data;
+    ntt.forward(f1.data(), big_log, 1);
+    ntt4.forward(f4.data(), big_log, 1);
+    std::vector<u128_t> back = f4;
+    ntt4.inverse(back.data(), big_log, 1);
+    if (f1 != f4 || back != data) {
+        std::cout << "[TB] blocked transform: threads disagree or no round trip\n[TB] FAIL\n";
+        return 3;
+    }
+    std::cout << "[TB] 2^" << big_log << " blocked transform: 1 / 4 threads agree, round trip ok\n";
+
+    // cosets past the domain are rejected before any twiddle is read
+    std::vector<u128_t> keep = data;
+    if (ntt.forward(data.data(), big_log, 2) || ntt.inverse(data.data(), big_log + 2, 0) ||
+        small.encode(msg.data(), log_n, log_rate + 1, code.data()) || data != keep) {
+        std::cout << "[TB] out-of-domain coset accepted\n[TB] FAIL\n";
+        return 3;
+    }
+
+    // ---- 3. stage kernel, forward then inverse on coset 1 of a 2^(k + 1) domain ----
+    // 2^12 entries: several on-chip tiles for the low layers, runs of
+    // 2^10 .. 2^11 for the high ones
+    const int k_log = 12;
+    const size_t kn = (size_t)1 << k_log;
+    std::vector<u128_t> host_in(kn);
+    for (u128_t& c : host_in) c = rand128();
+    std::vector<u128_t> host_out = host_in;
+    ntt.forward(host_out.data(), k_log, 1);
+
+    std::vector<u128> a(kn), b(kn);
+    for (size_t j = 0; j < kn; j++) a[j] = to_hls(host_in[j]);
+    for (int pass = 0; pass < 2; pass++) {
+        for (int s = 0; s < k_log; s++) {
+            int layer = pass == 0 ? k_log - 1 - s : s;
+            // twiddles of coset 1 start at block (1 << k_log) >> (layer + 1)
+            const u128_t* tw = ntt.twiddles(layer) + (kn >> (layer + 1));
+            std::vector<u128> tw_hls(kn >> (layer + 1));
+            for (size_t j = 0; j < tw_hls.size(); j++) tw_hls[j] = to_hls(tw[j]);
+            additive_ntt_stage(a.data(), a.data(), b.data(), b.data(), tw_hls.data(),
+                               tw_hls.data(), k_log, layer, pass);
+            std::swap(a, b);
+        }
+        const std::vector<u128_t>& want = pass == 0 ? host_out : host_in;
+        for (size_t j = 0; j < kn; j++) {
+            if (to_host(a[j]) != want[j]) {
+                std::cout << "[TB] stage kernel " << (pass ? "inverse" : "forward") << " differs at "
+                          << j << "\n[TB] FAIL\n";
+                return 4;
+            }
+        }
+    }
+    std::cout << "[TB] additive_ntt_stage: forward / inverse match the host\n";
+
+    // ---- 4. rate ----
+    const int max_log = 22;
+    intmul_host::AdditiveNtt bench(max_log, 0);
+    std::vector<u128_t> buf((size_t)1 << max_log);
+    for (u128_t& c : buf) c = rand128();
+    for (int l = 16; l <= max_log; l += 2) {
+        auto t0 = std::chrono::steady_clock::now();
+        bench.forward(buf.data(), l);
+        double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+        double butterflies = (double)l * ((size_t)1 << (l - 1));
+        std::cout << "[TB] forward 2^" << l << ", " << intmul_host::resolve_threads(0)
+                  << " threads: " << secs * 1e3 << " ms, " << butterflies / secs / 1e6
+                  << " M butterflies/s\n";
+    }
+
+    std::cout << "[TB] PASS\n";
+    return 0;
+}
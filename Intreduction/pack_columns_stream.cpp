@@ -0,0 +1,79 @@
+#include <stdint.h>
+
+#include "pack_columns_stream.h"
+
+// ============================================================
+// Streaming bit transposition, HLS version of pack_columns() in
+// host/packing.cpp (group-major layout)
+//
+// Every group of 128 words leaves as 64 elements, element z = column z:
+// bit i = bit z of word i of the group. Each word shifts into the top of
+// all 64 column registers at once (wiring only, II=1). At the end of a
+// group the registers are copied to an output shift register, which
+// drains one element per cycle while the next group comes in. 64 < 128,
+// so the stream never stalls; the last group drains in a short tail.
+// TLAST marks the last element.
+// ============================================================
+
+extern "C" {
+void pack_columns_stream(
+    hls::stream<axis64_t> &words_in,
+    hls::stream<axis128_t> &cols_out,
+    int n_words
+) {
+#pragma HLS INTERFACE ap_ctrl_hs port=return
+#pragma HLS INTERFACE axis port=words_in
+#pragma HLS INTERFACE axis port=cols_out
+#pragma HLS INTERFACE s_axilite port=n_words bundle=control
+#pragma HLS INTERFACE s_axilite port=return bundle=control
+
+    u128 cols[PACK_COLUMNS];
+    u128 outq[PACK_COLUMNS];
+#pragma HLS ARRAY_PARTITION variable=cols complete
+#pragma HLS ARRAY_PARTITION variable=outq complete
+
+    const int n_out = n_words / PACK_GROUP_ROWS * PACK_COLUMNS;
+    int pending = 0;   // elements left in outq
+    int emitted = 0;
+
+    for (int i = 0; i < n_words; i++) {
+#pragma HLS PIPELINE II=1
+#pragma HLS LOOP_TRIPCOUNT min=128 max=16777216
+        if (pending > 0) {
+            axis128_t o;
+            o.data = outq[0];
+            o.keep = -1;
+            o.strb = -1;
+            o.last = (emitted == n_out - 1);
+            cols_out.write(o);
+            emitted++;
+            pending--;
+            for (int z = 0; z < PACK_COLUMNS - 1; z++) outq[z] = outq[z + 1];
+        }
+
+        u64 w = words_in.read().data;
+        for (int z = 0; z < PACK_COLUMNS; z++) {
+            cols[z] = cols[z] >> 1;
+            cols[z][127] = w[z];
+        }
+
+        if ((i & (PACK_GROUP_ROWS - 1)) == PACK_GROUP_ROWS - 1) {
+            for (int z = 0; z < PACK_COLUMNS; z++) outq[z] = cols[z];
+            pending = PACK_COLUMNS;
+        }
+    }
+
+    for (int z = 0; z < PACK_COLUMNS; z++) {
+#pragma HLS PIPELINE II=1
+        if (z < pending) {
+            axis128_t o;
+            o.data = outq[z];
+            o.keep = -1;
+            o.strb = -1;
+            o.last = (emitted == n_out - 1);
+            cols_out.write(o);
+            emitted++;
+        }
+    }
+}
+}
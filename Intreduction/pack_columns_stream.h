@@ -0,0 +1,21 @@
+#pragma once
+
+#include <ap_int.h>
+#include <ap_axi_sdata.h>
+#include <hls_stream.h>
+
+using u64  = ap_uint<64>;
+using u128 = ap_uint<128>;
+
+typedef ap_axiu<64, 0, 0, 0>  axis64_t;
+typedef ap_axiu<128, 0, 0, 0> axis128_t;
+
+static const int PACK_GROUP_ROWS = 128;
+static const int PACK_COLUMNS    = 64;
+
+// n_words must be a multiple of PACK_GROUP_ROWS
+extern "C" void pack_columns_stream(
+    hls::stream<axis64_t> &words_in,
+    hls::stream<axis128_t> &cols_out,
+    int n_words
+);
@@ -0,0 +1,106 @@
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <vector>
+
+#include "pack_columns_stream.h"
+#include "host/intmul.hpp"
+#include "host/packing.hpp"
+
+// Testbench of the value-vector packing (host/packing.hpp) and the
+// pack_columns_stream kernel:
+//   1. pack_pairs, pack_columns in both layouts against bit-by-bit packing,
+//      a short last group, unpack_columns round trip, 1 / 4 threads
+//   2. the kernel against the host group-major packing
+//   3. pack_columns rate on 2^22 words
+
+using ghash_host::u128_t;
+
+static uint64_t lcg_state = 0xa54ff53a5f1d36f1ull;
+static uint64_t rand64() {
+    lcg_state = lcg_state * 6364136223846793005ull + 1442695040888963407ull;
+    return lcg_state ^ (lcg_state >> 29);
+}
+
+static u128_t to_host(u128 x) {
+    return ghash_host::make_u128((uint64_t)(x >> 64), (uint64_t)x);
+}
+
+int main() {
+    // ---- 1. host ----
+    const size_t n = 128 * 37 + 5;
+    const size_t groups = 38;
+    std::vector<uint64_t> words(n);
+    for (uint64_t& w : words) w = rand64();
+
+    std::vector<u128_t> pairs((n + 1) / 2);
+    intmul_host::pack_pairs(words.data(), n, pairs.data(), 4);
+    bool ok = pairs.back() == (u128_t)words[n - 1];
+    for (size_t j = 0; j + 1 < pairs.size(); j++)
+        ok &= pairs[j] == ghash_host::make_u128(words[2 * j + 1], words[2 * j]);
+
+    std::vector<u128_t> want(intmul_host::packed_column_count(n), 0);
+    for (size_t r = 0; r < n; r++)
+        for (int z = 0; z < 64; z++)
+            if ((words[r] >> z) & 1) want[z * groups + r / 128] |= (u128_t)1 << (r % 128);
+
+    std::vector<u128_t> col(want.size()), col4(want.size()), grp(want.size());
+    intmul_host::pack_columns(words.data(), n, col.data(), intmul_host::PACK_COLUMN_MAJOR, 1);
+    intmul_host::pack_columns(words.data(), n, col4.data(), intmul_host::PACK_COLUMN_MAJOR, 4);
+    intmul_host::pack_columns(words.data(), n, grp.data(), intmul_host::PACK_GROUP_MAJOR, 4);
+    ok &= col == want && col4 == want;
+    for (size_t k = 0; k < groups; k++)
+        for (int z = 0; z < 64; z++) ok &= grp[k * 64 + z] == want[z * groups + k];
+
+    std::vector<uint64_t> back(n), back_g(n);
+    intmul_host::unpack_columns(col.data(), n, back.data(), intmul_host::PACK_COLUMN_MAJOR, 4);
+    intmul_host::unpack_columns(grp.data(), n, back_g.data(), intmul_host::PACK_GROUP_MAJOR, 1);
+    ok &= back == words && back_g == words;
+    std::cout << "[TB] host packing of " << n << " words: " << (ok ? "matches" : "DIFFERS") << "\n";
+    if (!ok) {
+        std::cout << "[TB] FAIL\n";
+        return 2;
+    }
+
+    // ---- 2. kernel ----
+    const size_t kn = 128 * 8;
+    hls::stream<axis64_t> in("words_in");
+    hls::stream<axis128_t> out("cols_out");
+    for (size_t r = 0; r < kn; r++) {
+        axis64_t v;
+        v.data = words[r];
+        v.keep = -1;
+        v.strb = -1;
+        v.last = (r == kn - 1);
+        in.write(v);
+    }
+    pack_columns_stream(in, out, (int)kn);
+    std::vector<u128_t> kwant(intmul_host::packed_column_count(kn));
+    intmul_host::pack_columns(words.data(), kn, kwant.data(), intmul_host::PACK_GROUP_MAJOR, 1);
+    for (size_t j = 0; j < kwant.size(); j++) {
+        axis128_t o = out.read();
+        if (to_host(o.data) != kwant[j] || (bool)o.last != (j == kwant.size() - 1)) {
+            std::cout << "[TB] pack_columns_stream differs at element " << j << "\n[TB] FAIL\n";
+            return 3;
+        }
+    }
+    if (!out.empty()) {
+        std::cout << "[TB] pack_columns_stream wrote extra elements\n[TB] FAIL\n";
+        return 3;
+    }
+    std::cout << "[TB] pack_columns_stream: " << kwant.size() << " elements match\n";
+
+    // ---- 3. rate ----
+    std::vector<uint64_t> big((size_t)1 << 22);
+    for (uint64_t& w : big) w = rand64();
+    std::vector<u128_t> packed(intmul_host::packed_column_count(big.size()));
+    intmul_host::pack_columns(big.data(), big.size(), packed.data(), intmul_host::PACK_COLUMN_MAJOR, 0);
+    auto t0 = std::chrono::steady_clock::now();
+    intmul_host::pack_columns(big.data(), big.size(), packed.data(), intmul_host::PACK_COLUMN_MAJOR, 0);
+    double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    std::cout << "[TB] pack_columns 2^22 words, " << intmul_host::resolve_threads(0) << " threads: "
+              << secs * 1e3 << " ms, " << big.size() * 8 / secs / 1e9 << " GB/s\n";
+
+    std::cout << "[TB] PASS\n";
+    return 0;
+}
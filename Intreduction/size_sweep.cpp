@@ -0,0 +1,123 @@
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <vector>
+#include <sys/resource.h>
+
+#include "intmul_size.h"
+#include "witness_to_constbase.h"
+#include "host/fixed_base.hpp"
+#include "host/intmul_reference.hpp"
+#include "host/witness_gen.hpp"
+
+// Problem-size sweep: for every N_VARS in [lo, hi] runs the kernel C model
+// (up to csim_max, its output streams hold every leaf until it returns) and
+// the host reference, and reports time, throughput and memory.
+//
+//   g++ -O2 -mpclmul -pthread -I. -Ihls_native size_sweep.cpp witness_to_constbase.cpp host/fixed_base.cpp host/intmul_reference.cpp host/witness_gen.cpp -o size_sweep
+//   ./size_sweep [lo=4] [hi=20] [csim_max=14] [threads=0]
+//
+// Columns:
+//   onchip_KB : kernel row buffers for this N (cur, b_exp, acc, c_buf = 56 B/row)
+//   rss_MB    : peak resident set of the process so far
+
+static double seconds_since(std::chrono::steady_clock::time_point t0) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+}
+
+static double peak_rss_mb() {
+    struct rusage ru;
+    getrusage(RUSAGE_SELF, &ru);
+    return ru.ru_maxrss / 1024.0;   // KB on Linux
+}
+
+// n rows of the shared seeded generator (host/witness_gen.hpp)
+static void make_rows(std::size_t n, int threads, std::vector<uint64_t>& a,
+                      std::vector<uint64_t>& b, std::vector<uint64_t>& c_lo,
+                      std::vector<uint64_t>& c_hi) {
+    a.resize(n); b.resize(n); c_lo.resize(n); c_hi.resize(n);
+    intmul_host::generate_witness_rows(0x853c49e6748fea9bull, 0, n, a.data(), b.data(),
+                                       c_lo.data(), c_hi.data(), threads);
+}
+
+template <int NV>
+static bool run_csim(const std::vector<uint64_t>& a, const std::vector<uint64_t>& b,
+                     const std::vector<uint64_t>& c_lo, const std::vector<uint64_t>& c_hi,
+                     double& secs) {
+    const int N = IntMulSize<NV>::N;
+    const int B_LEAVES_LEN = IntMulSize<NV>::B_LEAVES_LEN;
+    hls::stream<axis64_t> a_in, b_in, clo_in, chi_in, b_mask_out;
+    hls::stream<axis128_t> a_root_out, b_leaves_out;
+    ap_uint<1> roots_match = 0;
+    int mismatch_idx = 0;
+    IntMulPerf perf;
+
+    for (int i = 0; i < N; i++) {
+        axis64_t v;
+        v.data = (u64)a[i];    a_in.write(v);
+        v.data = (u64)b[i];    b_in.write(v);
+        v.data = (u64)c_lo[i]; clo_in.write(v);
+        v.data = (u64)c_hi[i]; chi_in.write(v);
+    }
+
+    auto t0 = std::chrono::steady_clock::now();
+    intmul_witness_dataflow<NV, 6>(a_in, b_in, clo_in, chi_in, a_root_out, b_leaves_out,
+                                   b_mask_out, 0, N, 0, roots_match, mismatch_idx, perf);
+    for (int i = 0; i < N; i++) a_root_out.read();
+    for (int i = 0; i < B_LEAVES_LEN; i++) b_leaves_out.read();
+    secs = seconds_since(t0);
+    return roots_match;
+}
+
+template <int NV>
+static void run_size(int csim_max, int threads) {
+    const std::size_t n = (std::size_t)1 << NV;
+    std::vector<uint64_t> a, b, c_lo, c_hi;
+    make_rows(n, threads, a, b, c_lo, c_hi);
+
+    double t_csim = 0;
+    bool csim_ok = true;
+    if (NV <= csim_max) csim_ok = run_csim<NV>(a, b, c_lo, c_hi, t_csim);
+
+    intmul_host::IntMulInputs in = { a.data(), b.data(), c_lo.data(), c_hi.data(), n };
+    intmul_host::ReferenceOptions opt;
+    opt.threads = threads;
+    intmul_host::ReferenceResult ref;
+    auto t0 = std::chrono::steady_clock::now();
+    intmul_host::run_reference(in, opt, ref);
+    double t_ref = seconds_since(t0);
+
+    std::printf("%6d %9zu ", NV, n);
+    if (NV <= csim_max) std::printf("%10.4f %12.0f ", t_csim, n / t_csim);
+    else                std::printf("%10s %12s ", "-", "-");
+    std::printf("%10.4f %12.0f %10.1f %9.1f  %s\n", t_ref, n / t_ref, 56.0 * n / 1024,
+                peak_rss_mb(), (csim_ok && ref.roots_match) ? "ok" : "MISMATCH");
+}
+
+template <int NV>
+struct Sweep {
+    static void run(int lo, int hi, int csim_max, int threads) {
+        Sweep<NV - 1>::run(lo, hi, csim_max, threads);
+        if (NV >= lo && NV <= hi) run_size<NV>(csim_max, threads);
+    }
+};
+
+template <>
+struct Sweep<0> {
+    static void run(int, int, int, int) {}
+};
+
+int main(int argc, char** argv) {
+    int lo       = argc > 1 ? std::atoi(argv[1]) : 4;
+    int hi       = argc > 2 ? std::atoi(argv[2]) : 20;
+    int csim_max = argc > 3 ? std::atoi(argv[3]) : 14;
+    int threads  = argc > 4 ? std::atoi(argv[4]) : 0;
+
+    ghash_host::fixed_base_g();
+    ghash_host::fixed_base_g_c_hi();
+
+    std::printf("%6s %9s %10s %12s %10s %12s %10s %9s\n", "n_vars", "rows", "csim_s",
+                "csim_rows/s", "ref_s", "ref_rows/s", "onchip_KB", "rss_MB");
+    Sweep<20>::run(lo, hi, csim_max, threads);
+    return 0;
+}
@@ -0,0 +1,118 @@
+#include <stdint.h>
+
+#include "ghash_hls.h"
+#include "sumcheck_round.h"
+
+// ============================================================
+// One prodcheck sumcheck round (host/sumcheck.hpp) over m_axi tables
+//
+//   g(t) = sum_j eq_t[j] * lo_t[j] * hi_t[j],  a_t[j] = a[j] + t (a[j] + a[j + half])
+//
+// evaluated at t = 0, x, x + 1 (g(1) = claim + g(0) on the host).
+//
+// fold = 1 fuses the previous round's fold into the same pass: the input
+// tables (n_in entries) are bound to r on their top variable while they
+// are read, the folded tables (n_in / 2) are written out and this round's
+// sums are taken over them. Every table is read as four quarter streams
+// (j, j + q, j + 2q, j + 3q): quarters 0/2 fold into entry j, quarters
+// 1/3 into entry j + q, and (j, j + q) is exactly the pair this round
+// needs. fold = 0 (first round) reads the two halves and writes nothing.
+// The host swaps in / out between rounds.
+// ============================================================
+
+static const int MAX_PAIRS = 1 << SUMCHECK_MAX_VARS;   // loop trip count bound
+
+static u128 mul_x(u128 a) {
+#pragma HLS INLINE
+    u128 r = a << 1;
+    if (a[127]) r ^= (u128)0x87;
+    return r;
+}
+
+static u128 fold_pair(u128 a, u128 b, u128 r) {
+#pragma HLS INLINE
+    return a ^ ghash_mul(r, a ^ b);
+}
+
+// (a, b) = (a[j], a[j + half]) of the current table -> terms at 0, x, x + 1
+static void round_terms(u128 a, u128 b, u128 &t0, u128 &t2, u128 &t3) {
+#pragma HLS INLINE
+    u128 d = a ^ b;
+    t0 = a;
+    t2 = a ^ mul_x(d);
+    t3 = t2 ^ d;
+}
+
+extern "C" {
+void prodcheck_sumcheck_round(
+    const u128 *eq_in,
+    const u128 *lo_in,
+    const u128 *hi_in,
+    u128 *eq_out,
+    u128 *lo_out,
+    u128 *hi_out,
+    int n_in,
+    ap_uint<1> fold,
+    u128 r,
+    u128 &g0,
+    u128 &g2,
+    u128 &g3
+) {
+#pragma HLS INTERFACE m_axi port=eq_in  offset=slave bundle=gmem0 max_read_burst_length=64
+#pragma HLS INTERFACE m_axi port=lo_in  offset=slave bundle=gmem1 max_read_burst_length=64
+#pragma HLS INTERFACE m_axi port=hi_in  offset=slave bundle=gmem2 max_read_burst_length=64
+#pragma HLS INTERFACE m_axi port=eq_out offset=slave bundle=gmem3 max_write_burst_length=64
+#pragma HLS INTERFACE m_axi port=lo_out offset=slave bundle=gmem4 max_write_burst_length=64
+#pragma HLS INTERFACE m_axi port=hi_out offset=slave bundle=gmem5 max_write_burst_length=64
+#pragma HLS INTERFACE s_axilite port=eq_in bundle=control
+#pragma HLS INTERFACE s_axilite port=lo_in bundle=control
+#pragma HLS INTERFACE s_axilite port=hi_in bundle=control
+#pragma HLS INTERFACE s_axilite port=eq_out bundle=control
+#pragma HLS INTERFACE s_axilite port=lo_out bundle=control
+#pragma HLS INTERFACE s_axilite port=hi_out bundle=control
+#pragma HLS INTERFACE s_axilite port=n_in bundle=control
+#pragma HLS INTERFACE s_axilite port=fold bundle=control
+#pragma HLS INTERFACE s_axilite port=r bundle=control
+#pragma HLS INTERFACE s_axilite port=g0 bundle=control
+#pragma HLS INTERFACE s_axilite port=g2 bundle=control
+#pragma HLS INTERFACE s_axilite port=g3 bundle=control
+#pragma HLS INTERFACE s_axilite port=return bundle=control
+
+    int cur  = fold ? n_in / 2 : n_in;   // entries of the table this round works on
+    int half = cur / 2;
+
+    u128 s0 = 0, s2 = 0, s3 = 0;
+    for (int j = 0; j < half; j++) {
+#pragma HLS PIPELINE II=4
+#pragma HLS LOOP_TRIPCOUNT min=1 max=MAX_PAIRS
+        u128 e0, e1, l0, l1, h0, h1;
+        if (fold) {
+            // quarters of the unfolded table: j, j + half, j + 2 half, j + 3 half
+            e0 = fold_pair(eq_in[j], eq_in[j + 2 * half], r);
+            e1 = fold_pair(eq_in[j + half], eq_in[j + 3 * half], r);
+            l0 = fold_pair(lo_in[j], lo_in[j + 2 * half], r);
+            l1 = fold_pair(lo_in[j + half], lo_in[j + 3 * half], r);
+            h0 = fold_pair(hi_in[j], hi_in[j + 2 * half], r);
+            h1 = fold_pair(hi_in[j + half], hi_in[j + 3 * half], r);
+            eq_out[j] = e0; eq_out[j + half] = e1;
+            lo_out[j] = l0; lo_out[j + half] = l1;
+            hi_out[j] = h0; hi_out[j + half] = h1;
+        } else {
+            e0 = eq_in[j]; e1 = eq_in[j + half];
+            l0 = lo_in[j]; l1 = lo_in[j + half];
+            h0 = hi_in[j]; h1 = hi_in[j + half];
+        }
+
+        u128 et0, et2, et3, lt0, lt2, lt3, ht0, ht2, ht3;
+        round_terms(e0, e1, et0, et2, et3);
+        round_terms(l0, l1, lt0, lt2, lt3);
+        round_terms(h0, h1, ht0, ht2, ht3);
+        s0 ^= ghash_mul(ghash_mul(et0, lt0), ht0);
+        s2 ^= ghash_mul(ghash_mul(et2, lt2), ht2);
+        s3 ^= ghash_mul(ghash_mul(et3, lt3), ht3);
+    }
+    g0 = s0;
+    g2 = s2;
+    g3 = s3;
+}
+}
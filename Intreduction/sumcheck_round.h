@@ -0,0 +1,22 @@
+#pragma once
+
+#include <ap_int.h>
+
+using u128 = ap_uint<128>;
+
+static const int SUMCHECK_MAX_VARS = 24;   // largest table the round kernel is sized for
+
+extern "C" void prodcheck_sumcheck_round(
+    const u128 *eq_in,
+    const u128 *lo_in,
+    const u128 *hi_in,
+    u128 *eq_out,
+    u128 *lo_out,
+    u128 *hi_out,
+    int n_in,
+    ap_uint<1> fold,
+    u128 r,
+    u128 &g0,
+    u128 &g2,
+    u128 &g3
+);
@@ -0,0 +1,201 @@
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "sumcheck_round.h"
+#include "host/intmul_reference.hpp"
+#include "host/keccak.hpp"
+#include "host/mle.hpp"
+#include "host/sumcheck.hpp"
+#include "host/transcript.hpp"
+
+// C-sim testbench of prodcheck_sumcheck_round plus the host prover/verifier:
+//   0. Keccak-f[1600] known answer (Keccak-256 of the empty message)
+//   1. full prodcheck b_root -> b_leaves on the host with Fiat-Shamir
+//      challenges, verified, final claim checked against the leaves' MLE,
+//      tampered proof and malformed layers rejected
+//   2. the round kernel, round by round on the largest layer, against the
+//      host prover's round polynomials
+
+using ghash_host::u128_t;
+
+static const int N_VARS = 6;
+
+struct Lcg {
+    uint64_t s;
+    explicit Lcg(uint64_t seed) : s(seed) {}
+    uint64_t next() {
+        s = s * 6364136223846793005ull + 1442695040888963407ull;
+        return s ^ (s >> 29);
+    }
+    u128_t next128() { uint64_t hi = next(); return ghash_host::make_u128(hi, next()); }
+};
+
+static u128 to_hls(u128_t x) {
+    return (u128((uint64_t)ghash_host::hi64(x)) << 64) | u128((uint64_t)ghash_host::lo64(x));
+}
+
+static u128_t to_host(u128 x) {
+    return ghash_host::make_u128((uint64_t)(x >> 64), (uint64_t)x);
+}
+
+static void absorb_claim(intmul_host::Transcript& t, const intmul_host::LayerClaim& c) {
+    t.absorb_u128s(c.point.data(), c.point.size());
+    t.absorb_u128(c.value);
+}
+
+int main() {
+    // ---- 0. permutation ----
+    uint64_t st[keccak_host::KECCAK_LANES] = {};
+    st[0] ^= 0x01;
+    st[16] ^= 0x80ull << 56;
+    keccak_host::keccak_f1600(st);
+    // c5d2460186f7233c 927e7db2dcc703c0 e500b653ca82273b 7bfad8045d85a470, lanes little-endian
+    static const uint64_t EMPTY_KECCAK256[4] = {
+        0x3c23f7860146d2c5ull, 0xc003c7dcb27d7e92ull, 0x3b2782ca53b600e5ull, 0x70a4855d04d8fa7bull,
+    };
+    for (int i = 0; i < 4; i++) {
+        if (st[i] != EMPTY_KECCAK256[i]) {
+            std::cout << "[TB] keccak_f1600 known answer differs in lane " << i << "\n[TB] FAIL\n";
+            return 1;
+        }
+    }
+
+    const size_t n = (size_t)1 << N_VARS;
+    Lcg rng(0x6a09e667f3bcc908ull);
+    std::vector<uint64_t> a(n), b(n), c_lo(n), c_hi(n);
+    for (size_t i = 0; i < n; i++) {
+        a[i] = rng.next();
+        b[i] = rng.next();
+        u128_t c = (u128_t)a[i] * b[i];
+        c_lo[i] = ghash_host::lo64(c);
+        c_hi[i] = ghash_host::hi64(c);
+    }
+    intmul_host::IntMulInputs in = { a.data(), b.data(), c_lo.data(), c_hi.data(), n };
+    intmul_host::ReferenceOptions opt;
+    opt.keep_layers = true;
+    intmul_host::ReferenceResult ref;
+    intmul_host::run_reference(in, opt, ref);
+
+    // ---- 1. host prodcheck ----
+    intmul_host::LayerClaim claim;
+    for (int i = 0; i < N_VARS; i++) claim.point.push_back(rng.next128());
+    claim.value = intmul_host::mle_eval(ref.b_root.data(), N_VARS, claim.point.data(), 0);
+    const intmul_host::LayerClaim initial = claim;
+    intmul_host::LayerClaim v_claim = claim;
+
+    intmul_host::Transcript p_ts("intmul-prodcheck"), v_ts("intmul-prodcheck");
+    absorb_claim(p_ts, claim);
+    absorb_claim(v_ts, claim);
+    intmul_host::ChallengeFn p_next = intmul_host::transcript_challenges(p_ts);
+    intmul_host::ChallengeFn v_next = intmul_host::transcript_challenges(v_ts);
+
+    std::vector<intmul_host::LayerProof> proof;
+    std::string err;
+    bool ok = intmul_host::prove_prodcheck(ref.layers, claim, p_next, 0, proof, &err) &&
+              intmul_host::verify_prodcheck(proof, v_claim, v_next);
+    u128_t leaves_eval = intmul_host::mle_eval(ref.b_leaves.data(), claim.point.size(),
+                                               claim.point.data(), 0);
+    std::cout << "[TB] prodcheck: " << proof.size() << " layers, verify=" << ok
+              << ", leaf claim over " << claim.point.size() << " vars "
+              << (leaves_eval == claim.value && v_claim.value == claim.value ? "matches" : "DIFFERS")
+              << "\n";
+    if (!ok || leaves_eval != claim.value || v_claim.value != claim.value) {
+        if (!err.empty()) std::cout << "[TB] " << err << "\n";
+        std::cout << "[TB] FAIL\n";
+        return 2;
+    }
+
+    proof[2].rounds[1].at[3] ^= 1;
+    intmul_host::LayerClaim t_claim = initial;
+    intmul_host::Transcript t_ts("intmul-prodcheck");
+    absorb_claim(t_ts, initial);
+    intmul_host::ChallengeFn t_next = intmul_host::transcript_challenges(t_ts);
+    if (intmul_host::verify_prodcheck(proof, t_claim, t_next)) {
+        std::cout << "[TB] tampered proof accepted\n[TB] FAIL\n";
+        return 3;
+    }
+    std::cout << "[TB] tampered proof rejected\n";
+
+    // byte strings that differ only in trailing zeros absorb differently
+    intmul_host::Transcript s3("bytes"), s4("bytes");
+    s3.absorb_bytes("abc", 3);
+    s4.absorb_bytes("abc", 4);
+    if (s3.challenge() == s4.challenge()) {
+        std::cout << "[TB] \"abc\" and \"abc\\0\" absorb alike\n[TB] FAIL\n";
+        return 3;
+    }
+
+    // no layers, or a top layer that is not the claim's size
+    std::vector<std::vector<u128_t>> no_layers, no_root(ref.layers.begin(), ref.layers.end() - 1);
+    std::vector<intmul_host::LayerProof> bad_proof;
+    intmul_host::LayerClaim bad_claim = initial;
+    if (intmul_host::prove_prodcheck(no_layers, bad_claim, p_next, 0, bad_proof, &err) ||
+        intmul_host::prove_prodcheck(no_root, bad_claim, p_next, 0, bad_proof, &err)) {
+        std::cout << "[TB] malformed layers accepted\n[TB] FAIL\n";
+        return 3;
+    }
+
+    const int ROUNDS = 100000;
+    intmul_host::Transcript b_ts("bench");
+    intmul_host::ChallengeFn b_next = intmul_host::transcript_challenges(b_ts);
+    intmul_host::RoundPoly bp = proof[0].rounds[0];
+    auto t0 = std::chrono::steady_clock::now();
+    for (int i = 0; i < ROUNDS; i++) bp.at[0] = b_next(bp);
+    double secs = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+    std::cout << "[TB] transcript: " << secs / ROUNDS * 1e9 << " ns per round challenge\n";
+
+    // ---- 2. round kernel on layer 0 (b_leaves, N_VARS + 6 vars) ----
+    const std::vector<u128_t>& layer = ref.layers[0];
+    const size_t m = N_VARS + 5;
+    std::vector<u128_t> point(m);
+    for (size_t i = 0; i < m; i++) point[i] = rng.next128();
+    intmul_host::LayerClaim lc;
+    lc.point = point;
+    lc.value = intmul_host::mle_eval(ref.layers[1].data(), m, point.data(), 0);
+
+    intmul_host::ProdcheckSumcheckProver prover(layer.data(), m, point.data(), lc.value, 0);
+
+    const size_t len = (size_t)1 << m;
+    std::vector<u128_t> eq_h(len);
+    intmul_host::eq_table(point.data(), m, eq_h.data());
+    std::vector<u128> eq_a(len), lo_a(len), hi_a(len), eq_b(len), lo_b(len), hi_b(len);
+    for (size_t j = 0; j < len; j++) {
+        eq_a[j] = to_hls(eq_h[j]);
+        lo_a[j] = to_hls(layer[j]);
+        hi_a[j] = to_hls(layer[j + len]);
+    }
+
+    Lcg k_rng(7);
+    u128_t r_prev = 0;
+    size_t cur = len;
+    for (size_t k = 0; k < m; k++) {
+        u128 g0, g2, g3;
+        if (k == 0) {
+            prodcheck_sumcheck_round(eq_a.data(), lo_a.data(), hi_a.data(), eq_b.data(), lo_b.data(),
+                                     hi_b.data(), (int)cur, 0, 0, g0, g2, g3);
+        } else {
+            prodcheck_sumcheck_round(eq_a.data(), lo_a.data(), hi_a.data(), eq_b.data(), lo_b.data(),
+                                     hi_b.data(), (int)cur, 1, to_hls(r_prev), g0, g2, g3);
+            std::swap(eq_a, eq_b);
+            std::swap(lo_a, lo_b);
+            std::swap(hi_a, hi_b);
+            cur /= 2;
+        }
+
+        intmul_host::RoundPoly p = prover.round_poly();
+        if (to_host(g0) != p.at[0] || to_host(g2) != p.at[2] || to_host(g3) != p.at[3]) {
+            std::cout << "[TB] round kernel differs from the host prover in round " << k << "\n";
+            std::cout << "[TB] FAIL\n";
+            return 4;
+        }
+        r_prev = k_rng.next128();
+        prover.fold(r_prev, p);
+    }
+    std::cout << "[TB] round kernel: " << m << " rounds match the host prover\n";
+
+    std::cout << "[TB] PASS\n";
+    return 0;
+}
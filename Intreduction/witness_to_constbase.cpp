@@ -1,470 +1,830 @@
-#include <ap_int.h>
 #include <stdint.h>
-#include <hls_stream.h>
-#include <ap_axi_sdata.h>
-#include <ap_int.h>
 
-using u64  = ap_uint<64>;
-using u128 = ap_uint<128>;
-
-typedef ap_axiu<64, 0, 0, 0>  axis64_t;
-typedef ap_axiu<128, 0, 0, 0> axis128_t;
-
-static const int LOG_BITS = 6;
-static const int HEIGHT   = 1 << LOG_BITS;   // 64
-static const int N_VARS   = 4;
-// static const int N_VARS   = 15;
+#include "witness_to_constbase.h"
+#include "fixed_base_table.h"
+#include "ghash_hls.h"
+#include "intmul_size.h"
+
+#ifndef __SYNTHESIS__
+#include <vector>
+#endif
+
+// Stage-local row buffers: on-chip RAM in synthesis, heap in C simulation
+// so large N_VARS do not overflow the stack.
+#ifdef __SYNTHESIS__
+#define STAGE_BUFFER(type, name, len) type name[len]
+#else
+#define STAGE_BUFFER(type, name, len) \
+    std::vector<type> name##_storage(len); type* name = name##_storage.data()
+#endif
+
+// Rows a stage handles for the row_count argument: 0 (nothing read or
+// written) unless 1 <= row_count <= 2^N_VARS. Every stage applies it
+// itself, so the DATAFLOW region stays calls only.
+template <int N_VARS>
+static int slice_rows(int row_count) {
+#pragma HLS INLINE
+    return (row_count >= 1 && row_count <= (1 << N_VARS)) ? row_count : 0;
+}
 
-static const int N        = 1 << N_VARS;     // 32768
-static const int B_LEAVES_LEN = HEIGHT * N;  // 2097152
+// Pass length over n_rows rows: at least ROW_PASS_MIN, 0 for no rows
+static int row_pass(int n_rows) {
+#pragma HLS INLINE
+    return (n_rows == 0) ? 0 : (n_rows < ROW_PASS_MIN ? ROW_PASS_MIN : n_rows);
+}
 
 // ============================================================
-// GF(2^128) GHASH arithmetic
-// modulus: x^128 + x^7 + x^2 + x + 1
+// Fixed-base windowed exponentiation
+// base^e = prod_k FB_TABLE[base][k][byte k of e]
+// 8 ROM lookups + 7 multiplies in a balanced tree, no squarings.
+// Tables come from gen_fixed_base_table.cpp (fixed_base_table.h). The second
+// base is g_c_hi = iterate(g, |g| g.square()).nth(1 << log_bits), folded
+// there to g^(2^64) for log_bits = 6.
 // ============================================================
 
-static u64 reverse_bits_64(u64 x) {
+static const int FB_BASE_G      = 0;   // g
+static const int FB_BASE_G_C_HI = 1;   // g_c_hi = g^(2^64)
+
+// t[0] * t[1] * ... * t[W-1], W a power of two, log2(W) multiplier levels
+template <int W>
+static u128 product_tree(u128 t[W]) {
 #pragma HLS INLINE
-    u64 r = 0;
-    for (int i = 0; i < 64; i++) {
+    for (int w = W / 2; w > 0; w /= 2) {
+#pragma HLS UNROLL
+        for (int k = 0; k < w; k++) {
 #pragma HLS UNROLL
-        r[63 - i] = x[i];
+            t[k] = ghash_mul(t[2 * k], t[2 * k + 1]);
+        }
     }
-    return r;
+    return t[0];
 }
 
-
-static u128 reverse_bits_each_64(u128 x) {
+static u128 fixed_base_pow(int base_id, u64 exp) {
 #pragma HLS INLINE
-    u64 lo = (u64)x;
-    u64 hi = (u64)(x >> 64);
-
-    u64 lo_r = reverse_bits_64(lo);
-    u64 hi_r = reverse_bits_64(hi);
+    u128 t[FB_WINDOWS];
+#pragma HLS ARRAY_PARTITION variable=t complete
 
-    return (u128(hi_r) << 64) | u128(lo_r);
+    for (int k = 0; k < FB_WINDOWS; k++) {
+#pragma HLS UNROLL
+        ap_uint<8> idx = exp.range(8 * k + 7, 8 * k);
+        t[k] = FB_TABLE[base_id][k][idx];
+    }
+    return product_tree<FB_WINDOWS>(t);
 }
 
-static u128 shr_each_64(u128 x, unsigned s) {
+// Fused c_root unit: g^(c_lo + 2^64 * c_hi) = g^c_lo * g_c_hi^c_hi
+// 16 ROM lookups (8 per base) + 15 multiplies, 4 levels deep.
+static u128 fixed_base_pow_c(u64 c_lo, u64 c_hi) {
 #pragma HLS INLINE
-    u64 lo = (u64)x;
-    u64 hi = (u64)(x >> 64);
-
-    lo >>= s;
-    hi >>= s;
-
-    return (u128(hi) << 64) | u128(lo);
-}
+    u128 t[2 * FB_WINDOWS];
+#pragma HLS ARRAY_PARTITION variable=t complete
 
-//multiplication in GF(2), so no carry chain
-static u128 clmul64(u64 a, u64 b) {
-#pragma HLS INLINE
-    u128 acc = 0;
-    for (int i = 0; i < 64; i++) {
-#pragma HLS UNROLL factor=1
-        if (b[i]) {
-            acc ^= (u128(a) << i);
-        }
+    for (int k = 0; k < FB_WINDOWS; k++) {
+#pragma HLS UNROLL
+        ap_uint<8> lo = c_lo.range(8 * k + 7, 8 * k);
+        ap_uint<8> hi = c_hi.range(8 * k + 7, 8 * k);
+        t[k]              = FB_TABLE[FB_BASE_G][k][lo];
+        t[FB_WINDOWS + k] = FB_TABLE[FB_BASE_G_C_HI][k][hi];
     }
-    return acc;
+    return product_tree<2 * FB_WINDOWS>(t);
 }
 
-static u128 reduce_ghash_256_by_64(u64 v0, u64 v1, u64 v2, u64 v3) {
-#pragma HLS INLINE
-    v1 ^= v3 ^ (v3 << 1) ^ (v3 << 2) ^ (v3 << 7);
-    v2 ^= (v3 >> 63) ^ (v3 >> 62) ^ (v3 >> 57);
-    v0 ^= v2 ^ (v2 << 1) ^ (v2 << 2) ^ (v2 << 7);
-    v1 ^= (v2 >> 63) ^ (v2 >> 62) ^ (v2 >> 57);
-    return (u128(v1) << 64) | u128(v0);
-}
+// ============================================================
+// AXI-Stream helpers
+// ============================================================
 
-static u128 ghash_mul(u128 x, u128 y) {
+static u64 read_axis64(hls::stream<axis64_t>& s) {
 #pragma HLS INLINE
-    u64 x1 = (u64)(x >> 64);
-    u64 x0 = (u64)(x);
-    u64 y1 = (u64)(y >> 64);
-    u64 y0 = (u64)(y);
-
-    u64 x0r = reverse_bits_64(x0);
-    u64 x1r = reverse_bits_64(x1);
-    u64 x2  = x0 ^ x1;
-
-    u64 y0r = reverse_bits_64(y0);
-    u64 y1r = reverse_bits_64(y1);
-    u64 y2  = y0 ^ y1;
-
-    u128 z0  = clmul64(y0,  x0);
-    u128 z1  = clmul64(y1,  x1);
-    u128 z2  = clmul64(y2,  x2);
-
-    u128 z0h = clmul64(y0r, x0r);
-    u128 z1h = clmul64(y1r, x1r);
-    u128 z2h = clmul64(y0r ^ y1r, x0r ^ x1r);
-
-    z2  ^= z0 ^ z1;
-    z2h ^= z0h ^ z1h;
-
-z0h = shr_each_64(reverse_bits_each_64(z0h), 1);
-z1h = shr_each_64(reverse_bits_each_64(z1h), 1);
-z2h = shr_each_64(reverse_bits_each_64(z2h), 1);
-
-    u64 v0 = (u64)(z0);
-    u64 v1 = (u64)(z0h) ^ (u64)(z2);
-    u64 v2 = (u64)(z1)  ^ (u64)(z2h);
-    u64 v3 = (u64)(z1h);
-
-    return reduce_ghash_256_by_64(v0, v1, v2, v3);
+    axis64_t v = s.read();
+    return (u64)v.data;
 }
 
-static inline u128 gf_add(u128 a, u128 b) {
+static void write_axis64(hls::stream<axis64_t>& s, u64 x, bool last = false) {
 #pragma HLS INLINE
-    return a ^ b;
+    axis64_t v;
+    v.data = (ap_uint<64>)x;
+    v.keep = -1;
+    v.strb = -1;
+    v.last = last;
+    s.write(v);
 }
 
-static inline u128 gf_square(u128 a) {
+static void write_axis128(hls::stream<axis128_t>& s, u128 x, bool last = false) {
 #pragma HLS INLINE
-    return ghash_mul(a, a);
+    axis128_t v;
+    v.data = (ap_uint<128>)x;
+    v.keep = -1;
+    v.strb = -1;
+    v.last = last;
+    s.write(v);
 }
 
-static inline u128 gf_one() {
-#pragma HLS INLINE
-    return (u128)1;
-}
+// ============================================================
+// Build root table for BinaryTree::constant_base(log_bits=6, base, exponents)
+// Since the full tree root equals base^(exponent[i]) per vertex, we can compute
+// the final root directly.
+//
+// Streaming stage: one exponent in, one root out per cycle. The root is sent
+// both to the output writer and to the b-leaf expansion. cycles counts every
+// iteration of the polling loop, including those waiting on a stream.
+// ============================================================
 
-static u128 gf_pow_u64(u128 base, u64 exp) {
+template <int N_VARS>
+static void build_constant_base_root(
+    hls::stream<u64> &exp_in,
+    int n_rows,
+    int base_id,
+    hls::stream<u128> &root_out,
+    hls::stream<u128> &root_fwd,
+    perf_t &cycles
+) {
 #pragma HLS INLINE off
-    u128 result = gf_one();
-    u128 cur = base;
-    for (int i = 0; i < 64; i++) {
+#pragma HLS ARRAY_PARTITION variable=FB_TABLE dim=1 complete
+#pragma HLS ARRAY_PARTITION variable=FB_TABLE dim=2 complete
+#pragma HLS BIND_STORAGE variable=FB_TABLE type=rom_1p impl=bram
+    n_rows = slice_rows<N_VARS>(n_rows);
+    perf_t n_cycles = 0;
+    int i = 0;
+    while (i < n_rows) {
 #pragma HLS PIPELINE II=1
-        if (exp[i]) {
-            result = ghash_mul(result, cur);
+#pragma HLS LOOP_TRIPCOUNT min=1 max=(1 << N_VARS)
+        if (!exp_in.empty() && !root_out.full() && !root_fwd.full()) {
+            u128 r = fixed_base_pow(base_id, exp_in.read());
+            root_out.write(r);
+            root_fwd.write(r);
+            i++;
         }
-        cur = gf_square(cur);
+        n_cycles++;
     }
-    return result;
+    cycles = n_cycles;
 }
 
 // ============================================================
-// GHASH field constants from Rust
+// compute_b_leaves(log_bits, bases=a_root, exponents=b)
+// out[z * N + i] = bit z of b[i] ? (a_root[i])^(2^z) : 1
+// (N = n_rows of this invocation)
+//
+// Emitted in z-major order without materializing b_leaves: pass z = 0
+// consumes a_root/b as they arrive, later passes replay the running
+// squares kept in cur[] (N entries instead of HEIGHT * N).
+//
+// compress = 1: the constant-1 leaves are dropped. mask_out carries b[i]
+// per row (bit z set <=> leaf (z, i) is sent) and leaves_out only the
+// non-trivial leaves. One word is held back so TLAST marks the last leaf
+// in both modes. leaves_fwd always carries the full z-major sequence for
+// the b_root reduction.
+//
+// The (z, i) passes run as one polling loop so that the cycle and stall
+// counters advance while a stream blocks; stall_leaves / stall_mask count
+// the cycles leaves_out / mask_out were full. A pass is at least
+// ROW_PASS_MIN slots long (idle slots past n_rows), which keeps the
+// cur[] / b_exp[] read of row i at least that many cycles after its write.
 // ============================================================
 
-// F::MULTIPLICATIVE_GENERATOR for BinaryField128bGhash
-static const u128 GHASH_GENERATOR =
-    (((u128)0x494ef99794d5244full) << 64) |
-     (u128)0x9152df59d87a9186ull;
-
-// g_c_hi = iterate(g, |g| g.square()).nth(1 << log_bits)
-// log_bits = 6 => 64 squarings
-static u128 compute_g_c_hi() {
+template <int N_VARS, int LOG_BITS>
+static void build_b_leaves(
+    hls::stream<u128> &a_root_in,
+    hls::stream<u64> &b_in,
+    int n_rows,
+    ap_uint<1> compress,
+    hls::stream<axis128_t> &leaves_out,
+    hls::stream<axis64_t> &mask_out,
+    hls::stream<u128> &leaves_fwd,
+    perf_t &cycles,
+    perf_t &stall_leaves,
+    perf_t &stall_mask
+) {
 #pragma HLS INLINE off
-    u128 g = GHASH_GENERATOR;
-    for (int i = 0; i < HEIGHT; i++) {
+    const int N      = 1 << N_VARS;
+    const int HEIGHT = 1 << LOG_BITS;
+    STAGE_BUFFER(u128, cur, N);
+    STAGE_BUFFER(u64, b_exp, N);
+#pragma HLS BIND_STORAGE variable=cur type=ram_2p impl=uram
+#pragma HLS BIND_STORAGE variable=b_exp type=ram_2p impl=bram
+#pragma HLS DEPENDENCE variable=cur inter false     // distance >= ROW_PASS_MIN
+#pragma HLS DEPENDENCE variable=b_exp inter false
+    n_rows = slice_rows<N_VARS>(n_rows);
+    const int pass = row_pass(n_rows);
+
+    u128 pending = 0;
+    bool has_pending = false;
+    perf_t n_cycles = 0, n_stall_leaves = 0, n_stall_mask = 0;
+
+    int z = (pass == 0) ? HEIGHT : 0, i = 0;
+    while (z < HEIGHT) {
 #pragma HLS PIPELINE II=1
-        g = gf_square(g);
+#pragma HLS LOOP_TRIPCOUNT min=1 max=HEIGHT*N
+        bool row       = i < n_rows;   // else an idle slot of a short pass
+        bool in_ok     = z != 0 || (!a_root_in.empty() && !b_in.empty());
+        bool mask_ok   = z != 0 || !compress || !mask_out.full();
+        bool leaves_ok = !leaves_out.full();   // a held-back word may go out
+        if (!row) {
+            if (++i == pass) {
+                i = 0;
+                z++;
+            }
+        } else if (in_ok && mask_ok && leaves_ok && !leaves_fwd.full()) {
+            u128 r;
+            u64 exp;
+            if (z == 0) {
+                r   = a_root_in.read();
+                exp = b_in.read();
+                b_exp[i] = exp;
+                if (compress) write_axis64(mask_out, exp, i == n_rows - 1);
+            } else {
+                r   = cur[i];
+                exp = b_exp[i];
+            }
+
+            bool bit = exp[z];
+            u128 leaf = bit ? r : gf_one();
+            leaves_fwd.write(leaf);
+            if (bit || !compress) {
+                if (has_pending) write_axis128(leaves_out, pending, false);
+                pending = leaf;
+                has_pending = true;
+            }
+            cur[i] = gf_square(r);
+
+            if (++i == pass) {
+                i = 0;
+                z++;
+            }
+        } else {
+            if (!leaves_ok) n_stall_leaves++;
+            if (!mask_ok) n_stall_mask++;
+        }
+        n_cycles++;
     }
-    return g;
+
+    if (has_pending) write_axis128(leaves_out, pending, true);
+    cycles       = n_cycles;
+    stall_leaves = n_stall_leaves;
+    stall_mask   = n_stall_mask;
 }
 
 // ============================================================
-// Build root table for BinaryTree::constant_base(log_bits=6, base, exponents)
-// Since the full tree root equals base^(exponent[i]) per vertex, we can compute
-// the final root directly.
+// ProdcheckProver::new(k=6, witness=b_leaves)
+// Final products layer => b_root
+//
+// Each reduction halves the front dimension by the pairwise product of its
+// split halves, so after LOG_BITS rounds b_root has N entries, and layer k+1
+// entry (z, i) is the product of layer k entries (z, i) and (z + half, i):
+// every b_root[i] is the product of the 64 leaves of row i.
+//
+// Streaming reduction: leaves arrive z-major and the row products are built
+// in acc[] (N entries) as they arrive; the multiplication order differs from
+// the layered tree, the field product does not. The last pass multiplies and
+// emits b_root[i] directly instead of storing it. As in build_b_leaves, a
+// pass is at least ROW_PASS_MIN slots, so acc[i] is read well after the
+// multiplier wrote it.
 // ============================================================
 
-static void build_constant_base_root(
-    const u64 exponents[N],
-    u128 base,
-    u128 root_out[N]
+template <int N_VARS, int LOG_BITS>
+static void build_b_root(
+    hls::stream<u128> &leaves_in,
+    int n_rows,
+    hls::stream<u128> &b_root_out
 ) {
 #pragma HLS INLINE off
-    for (int i = 0; i < N; i++) {
+    const int N      = 1 << N_VARS;
+    const int HEIGHT = 1 << LOG_BITS;
+    STAGE_BUFFER(u128, acc, N);
+#pragma HLS BIND_STORAGE variable=acc type=ram_2p impl=uram
+#pragma HLS DEPENDENCE variable=acc inter false   // distance >= ROW_PASS_MIN
+    n_rows = slice_rows<N_VARS>(n_rows);
+    const int pass = row_pass(n_rows);
+
+    for (int z = 0; z < HEIGHT; z++) {
+        for (int i = 0; i < pass; i++) {
 #pragma HLS PIPELINE II=1
-        root_out[i] = gf_pow_u64(base, exponents[i]);
+#pragma HLS LOOP_TRIPCOUNT min=1 max=N
+            if (i >= n_rows) continue;   // idle slot of a short pass
+            u128 leaf = leaves_in.read();
+            u128 p = (z == 0) ? leaf : ghash_mul(acc[i], leaf);
+            if (z == HEIGHT - 1) {
+                b_root_out.write(p);
+            } else {
+                acc[i] = p;
+            }
+        }
     }
 }
 
 // ============================================================
-// compute_b_leaves(log_bits, bases=a_root, exponents=b)
-// out[z * N + i] = bit z of b[i] ? (a_root[i])^(2^z) : 1
+// c_root = c_lo.root * c_hi.root = g^(c_lo + 2^64 * c_hi)
 // ============================================================
 
-static void build_b_leaves(
-    const u128 a_root[N],
-    const u64 b_exp[N],
-    u128 b_leaves[B_LEAVES_LEN]
+template <int N_VARS>
+static void build_c_root(
+    hls::stream<u64> &clo_in,
+    hls::stream<u64> &chi_in,
+    int n_rows,
+    hls::stream<u128> &c_root_out
 ) {
 #pragma HLS INLINE off
-    for (int i = 0; i < N; i++) {
-#pragma HLS PIPELINE off
-        u128 cur = a_root[i];
-        u64 exp  = b_exp[i];
-
-        for (int z = 0; z < HEIGHT; z++) {
+#pragma HLS ARRAY_PARTITION variable=FB_TABLE dim=1 complete
+#pragma HLS ARRAY_PARTITION variable=FB_TABLE dim=2 complete
+#pragma HLS BIND_STORAGE variable=FB_TABLE type=rom_1p impl=bram
+    n_rows = slice_rows<N_VARS>(n_rows);
+    for (int i = 0; i < n_rows; i++) {
 #pragma HLS PIPELINE II=1
-            bool bit = (bool)((exp >> z) & 1);
-            b_leaves[z * N + i] = bit ? cur : gf_one();
-            cur = gf_square(cur);
-        }
+#pragma HLS LOOP_TRIPCOUNT min=1 max=(1 << N_VARS)
+        c_root_out.write(fixed_base_pow_c(clo_in.read(), chi_in.read()));
     }
 }
 
 // ============================================================
-// ProdcheckProver::new(k=6, witness=b_leaves)
-// Final products layer => b_root
+// a * b = c  <=>  g^(a*b) = g^c  <=>  b_root[i] == c_root[i]
 //
-// witness length = 2^(n_vars + log_bits) = 2^21
-// each reduction halves the front dimension by pairwise product of split halves
-// after 6 rounds => length 2^15 = 32768
+// c_root is ready during the first b-leaf pass, b_root only after the
+// last one, so c_root is parked in c_buf[] meanwhile. Reports the first
+// mismatching row as a global index (row_offset + local row, -1 if none).
 // ============================================================
 
-// static void build_b_root_from_b_leaves(
-//     const u128 b_leaves[B_LEAVES_LEN],
-//     u128 b_root[N]
-// ) {
-// #pragma HLS INLINE off
-
-//     static u128 layer0[B_LEAVES_LEN];
-//     static u128 layer1[B_LEAVES_LEN / 2];
-//     static u128 layer2[B_LEAVES_LEN / 4];
-//     static u128 layer3[B_LEAVES_LEN / 8];
-//     static u128 layer4[B_LEAVES_LEN / 16];
-//     static u128 layer5[B_LEAVES_LEN / 32];
-// #pragma HLS BIND_STORAGE variable=layer0 type=ram_2p impl=uram
-// #pragma HLS BIND_STORAGE variable=layer1 type=ram_2p impl=uram
-// #pragma HLS BIND_STORAGE variable=layer2 type=ram_2p impl=uram
-// #pragma HLS BIND_STORAGE variable=layer3 type=ram_2p impl=uram
-// #pragma HLS BIND_STORAGE variable=layer4 type=ram_2p impl=uram
-// #pragma HLS BIND_STORAGE variable=layer5 type=ram_2p impl=uram
-
-//     for (int i = 0; i < B_LEAVES_LEN; i++) {
-// #pragma HLS PIPELINE II=1
-//         layer0[i] = b_leaves[i];
-//     }
-
-//     // 2^21 -> 2^20
-//     for (int i = 0; i < (B_LEAVES_LEN / 2); i++) {
-// #pragma HLS PIPELINE II=1
-//         layer1[i] = ghash_mul(layer0[i], layer0[i + (B_LEAVES_LEN / 2)]);
-//     }
-
-//     // 2^20 -> 2^19
-//     for (int i = 0; i < (B_LEAVES_LEN / 4); i++) {
-// #pragma HLS PIPELINE II=1
-//         layer2[i] = ghash_mul(layer1[i], layer1[i + (B_LEAVES_LEN / 4)]);
-//     }
-
-//     // 2^19 -> 2^18
-//     for (int i = 0; i < (B_LEAVES_LEN / 8); i++) {
-// #pragma HLS PIPELINE II=1
-//         layer3[i] = ghash_mul(layer2[i], layer2[i + (B_LEAVES_LEN / 8)]);
-//     }
-
-//     // 2^18 -> 2^17
-//     for (int i = 0; i < (B_LEAVES_LEN / 16); i++) {
-// #pragma HLS PIPELINE II=1
-//         layer4[i] = ghash_mul(layer3[i], layer3[i + (B_LEAVES_LEN / 16)]);
-//     }
-
-//     // 2^17 -> 2^16
-//     for (int i = 0; i < (B_LEAVES_LEN / 32); i++) {
-// #pragma HLS PIPELINE II=1
-//         layer5[i] = ghash_mul(layer4[i], layer4[i + (B_LEAVES_LEN / 32)]);
-//     }
-
-//     // 2^16 -> 2^15 = b_root
-//     for (int i = 0; i < N; i++) {
-// #pragma HLS PIPELINE II=1
-//         b_root[i] = ghash_mul(layer5[i], layer5[i + N]);
-//     }
-// }
+template <int N_VARS>
+static void check_roots(
+    hls::stream<u128> &b_root_in,
+    hls::stream<u128> &c_root_in,
+    int n_rows,
+    int row_offset,
+    ap_uint<1> &roots_match,
+    int &mismatch_idx
+) {
+#pragma HLS INLINE off
+    const int N = 1 << N_VARS;
+    STAGE_BUFFER(u128, c_buf, N);
+#pragma HLS BIND_STORAGE variable=c_buf type=ram_2p impl=uram
+    n_rows = slice_rows<N_VARS>(n_rows);
+
+    for (int i = 0; i < n_rows; i++) {
+#pragma HLS PIPELINE II=1
+#pragma HLS LOOP_TRIPCOUNT min=1 max=N
+        c_buf[i] = c_root_in.read();
+    }
+
+    int first = -1;
+    for (int i = 0; i < n_rows; i++) {
+#pragma HLS PIPELINE II=1
+#pragma HLS LOOP_TRIPCOUNT min=1 max=N
+        u128 b = b_root_in.read();
+        if (first < 0 && b != c_buf[i]) first = i;
+    }
+
+    roots_match  = n_rows > 0 && first < 0;   // a rejected row_count never matches
+    mismatch_idx = (first < 0) ? -1 : row_offset + first;
+}
 
 // ============================================================
-// c_root = c_lo.root * c_hi.root
+// DATAFLOW input / output stages
 // ============================================================
 
-static void build_c_root(
-    const u128 clo_root[N],
-    const u128 chi_root[N],
-    u128 c_root[N]
+// Both poll their streams so the counters keep running while a port
+// stalls: an AXIS input counts a stall for every cycle it is empty while
+// the row waits, the AXIS output for every cycle it is full.
+
+template <int N_VARS>
+static void read_inputs(
+    hls::stream<axis64_t> &a_in,
+    hls::stream<axis64_t> &b_in,
+    hls::stream<axis64_t> &clo_in,
+    hls::stream<axis64_t> &chi_in,
+    hls::stream<u64> &a_s,
+    hls::stream<u64> &b_s,
+    hls::stream<u64> &clo_s,
+    hls::stream<u64> &chi_s,
+    int n_rows,
+    perf_t &read_cycles,
+    perf_t &stall_a_in,
+    perf_t &stall_b_in,
+    perf_t &stall_clo_in,
+    perf_t &stall_chi_in
 ) {
 #pragma HLS INLINE off
-    for (int i = 0; i < N; i++) {
+    n_rows = slice_rows<N_VARS>(n_rows);
+    perf_t n_cycles = 0, n_stall_a = 0, n_stall_b = 0, n_stall_clo = 0, n_stall_chi = 0;
+    int i = 0;
+    while (i < n_rows) {
 #pragma HLS PIPELINE II=1
-        c_root[i] = ghash_mul(clo_root[i], chi_root[i]);
+#pragma HLS LOOP_TRIPCOUNT min=1 max=(1 << N_VARS)
+        bool a_ok = !a_in.empty(), b_ok = !b_in.empty();
+        bool clo_ok = !clo_in.empty(), chi_ok = !chi_in.empty();
+        bool out_ok = !a_s.full() && !b_s.full() && !clo_s.full() && !chi_s.full();
+        if (a_ok && b_ok && clo_ok && chi_ok && out_ok) {
+            a_s.write(read_axis64(a_in));
+            b_s.write(read_axis64(b_in));
+            clo_s.write(read_axis64(clo_in));
+            chi_s.write(read_axis64(chi_in));
+            i++;
+        } else {
+            if (!a_ok) n_stall_a++;
+            if (!b_ok) n_stall_b++;
+            if (!clo_ok) n_stall_clo++;
+            if (!chi_ok) n_stall_chi++;
+        }
+        n_cycles++;
     }
+    read_cycles  = n_cycles;
+    stall_a_in   = n_stall_a;
+    stall_b_in   = n_stall_b;
+    stall_clo_in = n_stall_clo;
+    stall_chi_in = n_stall_chi;
 }
 
-
-static u64 read_axis64(hls::stream<axis64_t>& s) {
-#pragma HLS INLINE
-    axis64_t v = s.read();
-    return (u64)v.data;
+template <int N_VARS>
+static void write_output(
+    hls::stream<u128> &s,
+    int len,
+    hls::stream<axis128_t> &out,
+    perf_t &cycles,
+    perf_t &stall_out
+) {
+#pragma HLS INLINE off
+    len = slice_rows<N_VARS>(len);
+    perf_t n_cycles = 0, n_stall = 0;
+    int i = 0;
+    while (i < len) {
+#pragma HLS PIPELINE II=1
+#pragma HLS LOOP_TRIPCOUNT min=1 max=(1 << N_VARS)
+        bool out_ok = !out.full();
+        if (!s.empty() && out_ok) {
+            write_axis128(out, s.read(), i == len - 1);
+            i++;
+        } else if (!out_ok) {
+            n_stall++;
+        }
+        n_cycles++;
+    }
+    cycles    = n_cycles;
+    stall_out = n_stall;
 }
 
-static void write_axis128(hls::stream<axis128_t>& s, u128 x) {
-#pragma HLS INLINE
-    axis128_t v;
-    v.data = (ap_uint<128>)x;
-    s.write(v);
+// ============================================================
+// DATAFLOW body, one instantiation per problem size
+// ============================================================
+
+template <int N_VARS, int LOG_BITS>
+void intmul_witness_dataflow(
+    hls::stream<axis64_t> &a_in,
+    hls::stream<axis64_t> &b_in,
+    hls::stream<axis64_t> &clo_in,
+    hls::stream<axis64_t> &chi_in,
+    hls::stream<axis128_t> &a_root_out,
+    hls::stream<axis128_t> &b_leaves_out,
+    hls::stream<axis64_t> &b_mask_out,
+    int row_offset,
+    int row_count,
+    ap_uint<1> compress,
+    ap_uint<1> &roots_match,
+    int &mismatch_idx,
+    IntMulPerf &perf
+) {
+#pragma HLS DATAFLOW
+
+    // This invocation handles rows [row_offset, row_offset + row_count) of the
+    // full table, 1 <= row_count <= 2^N_VARS (other values are rejected). The
+    // streams carry only those rows; b_leaves comes out z-major over the
+    // slice (leaf (z, j) at z * row_count + j) and the host scheduler
+    // (host/cu_scheduler.cpp) merges the slices.
+
+    // read -> constant-base roots -> b-leaf expansion -> b_root reduction
+    // -> b_root == c_root check, all concurrent. b-leaf expansion drives
+    // b_leaves_out / b_mask_out itself (variable length in compressed mode).
+    hls::stream<u64>  a_s("a_s");
+    hls::stream<u64>  b_s("b_s");
+    hls::stream<u64>  clo_s("clo_s");
+    hls::stream<u64>  chi_s("chi_s");
+    hls::stream<u128> a_root_s("a_root_s");
+    hls::stream<u128> a_root_fwd("a_root_fwd");
+    hls::stream<u128> c_root_s("c_root_s");
+    hls::stream<u128> leaves_fwd("leaves_fwd");
+    hls::stream<u128> b_root_s("b_root_s");
+#pragma HLS STREAM variable=a_s depth=4
+#pragma HLS STREAM variable=b_s depth=16   // covers the fixed-base pipeline latency
+#pragma HLS STREAM variable=clo_s depth=4
+#pragma HLS STREAM variable=chi_s depth=4
+#pragma HLS STREAM variable=a_root_s depth=4
+#pragma HLS STREAM variable=a_root_fwd depth=4
+#pragma HLS STREAM variable=c_root_s depth=4
+#pragma HLS STREAM variable=leaves_fwd depth=4
+#pragma HLS STREAM variable=b_root_s depth=4
+
+    // Every IntMulPerf field is written by exactly one stage, which gets
+    // only the fields it owns.
+    read_inputs<N_VARS>(a_in, b_in, clo_in, chi_in, a_s, b_s, clo_s, chi_s, row_count,
+                        perf.read_cycles, perf.stall_a_in, perf.stall_b_in, perf.stall_clo_in,
+                        perf.stall_chi_in);
+    build_constant_base_root<N_VARS>(a_s, row_count, FB_BASE_G, a_root_s, a_root_fwd,
+                                     perf.root_cycles);
+    build_c_root<N_VARS>(clo_s, chi_s, row_count, c_root_s);
+    build_b_leaves<N_VARS, LOG_BITS>(a_root_fwd, b_s, row_count, compress,
+                                     b_leaves_out, b_mask_out, leaves_fwd, perf.leaves_cycles,
+                                     perf.stall_b_leaves_out, perf.stall_b_mask_out);
+    build_b_root<N_VARS, LOG_BITS>(leaves_fwd, row_count, b_root_s);
+    check_roots<N_VARS>(b_root_s, c_root_s, row_count, row_offset, roots_match, mismatch_idx);
+    write_output<N_VARS>(a_root_s, row_count, a_root_out, perf.drain_cycles, perf.stall_a_root_out);
 }
 
+#ifndef __SYNTHESIS__
+// sizes available to the C-sim testbench and the size sweep
+#define INSTANTIATE_INTMUL_WITNESS(NV) \
+    template void intmul_witness_dataflow<NV, 6>( \
+        hls::stream<axis64_t>&, hls::stream<axis64_t>&, hls::stream<axis64_t>&, \
+        hls::stream<axis64_t>&, hls::stream<axis128_t>&, hls::stream<axis128_t>&, \
+        hls::stream<axis64_t>&, int, int, ap_uint<1>, ap_uint<1>&, int&, IntMulPerf&);
+INSTANTIATE_INTMUL_WITNESS(1)  INSTANTIATE_INTMUL_WITNESS(2)  INSTANTIATE_INTMUL_WITNESS(3)
+INSTANTIATE_INTMUL_WITNESS(4)  INSTANTIATE_INTMUL_WITNESS(5)  INSTANTIATE_INTMUL_WITNESS(6)
+INSTANTIATE_INTMUL_WITNESS(7)  INSTANTIATE_INTMUL_WITNESS(8)  INSTANTIATE_INTMUL_WITNESS(9)
+INSTANTIATE_INTMUL_WITNESS(10) INSTANTIATE_INTMUL_WITNESS(11) INSTANTIATE_INTMUL_WITNESS(12)
+INSTANTIATE_INTMUL_WITNESS(13) INSTANTIATE_INTMUL_WITNESS(14) INSTANTIATE_INTMUL_WITNESS(15)
+INSTANTIATE_INTMUL_WITNESS(16) INSTANTIATE_INTMUL_WITNESS(17) INSTANTIATE_INTMUL_WITNESS(18)
+INSTANTIATE_INTMUL_WITNESS(19) INSTANTIATE_INTMUL_WITNESS(20)
+#undef INSTANTIATE_INTMUL_WITNESS
+#endif
+
 // ============================================================
 // Top function
 // ============================================================
 
-// extern "C" {
-// void intmul_witness_step(
-//     hls::stream<axis64_t> &a_in,
-//     hls::stream<axis64_t> &b_in,
-//     hls::stream<axis64_t> &clo_in,
-//     hls::stream<axis64_t> &chi_in,
-
-//     hls::stream<axis128_t> &a_root_out,
-//     hls::stream<axis128_t> &clo_root_out,
-//     hls::stream<axis128_t> &chi_root_out,
-//     hls::stream<axis128_t> &b_leaves_out
-//     // hls::stream<axis128_t> &b_root_out,
-//     // hls::stream<axis128_t> &c_root_out
-// ) {
-// #pragma HLS INTERFACE ap_ctrl_hs port=return
-
-// #pragma HLS INTERFACE axis port=a_in
-// #pragma HLS INTERFACE axis port=b_in
-// #pragma HLS INTERFACE axis port=clo_in
-// #pragma HLS INTERFACE axis port=chi_in
-
-// #pragma HLS INTERFACE axis port=a_root_out
-// #pragma HLS INTERFACE axis port=clo_root_out
-// #pragma HLS INTERFACE axis port=chi_root_out
-// #pragma HLS INTERFACE axis port=b_leaves_out
-// // #pragma HLS INTERFACE axis port=b_root_out
-// // #pragma HLS INTERFACE axis port=c_root_out
-
-// #pragma HLS INTERFACE s_axilite port=return bundle=control
-
-//     static u64 a_raw[N];
-//     static u64 b_raw[N];
-//     static u64 clo_raw[N];
-//     static u64 chi_raw[N];
-
-//     static u128 a_root[N];
-//     static u128 clo_root[N];
-//     static u128 chi_root[N];
-//     static u128 b_leaves[B_LEAVES_LEN];
-//     // static u128 b_root[N];
-//     // static u128 c_root[N];
-
-// #pragma HLS BIND_STORAGE variable=a_raw type=ram_2p impl=bram
-// #pragma HLS BIND_STORAGE variable=b_raw type=ram_2p impl=bram
-// #pragma HLS BIND_STORAGE variable=clo_raw type=ram_2p impl=bram
-// #pragma HLS BIND_STORAGE variable=chi_raw type=ram_2p impl=bram
-
-// #pragma HLS BIND_STORAGE variable=a_root type=ram_2p impl=uram
-// #pragma HLS BIND_STORAGE variable=clo_root type=ram_2p impl=uram
-// #pragma HLS BIND_STORAGE variable=chi_root type=ram_2p impl=uram
-// #pragma HLS BIND_STORAGE variable=b_leaves type=ram_2p impl=uram
-// // #pragma HLS BIND_STORAGE variable=b_root type=ram_2p impl=uram
-// // #pragma HLS BIND_STORAGE variable=c_root type=ram_2p impl=uram
-
-//     // -------------------------
-//     // Read 4 raw witness tables
-//     // -------------------------
-//     for (int i = 0; i < N; i++) {
-// #pragma HLS PIPELINE II=1
-//         a_raw[i]   = read_axis64(a_in);
-//         b_raw[i]   = read_axis64(b_in);
-//         clo_raw[i] = read_axis64(clo_in);
-//         chi_raw[i] = read_axis64(chi_in);
-//     }
-
-//     u128 g = GHASH_GENERATOR;
-//     u128 g_c_hi = compute_g_c_hi();
-
-//     // a.root = g^(a[i])
-//     build_constant_base_root(a_raw, g, a_root);
-
-//     // c_lo.root = g^(c_lo[i])
-//     build_constant_base_root(clo_raw, g, clo_root);
-
-//     // c_hi.root = g_c_hi^(c_hi[i])
-//     build_constant_base_root(chi_raw, g_c_hi, chi_root);
-
-//     // b_leaves from a_root and b
-//     build_b_leaves(a_root, b_raw, b_leaves);
-
-//     // b_root by prodcheck reduction over b_leaves
-//     // build_b_root_from_b_leaves(b_leaves, b_root);
-
-//     // c_root = c_lo.root * c_hi.root
-//     // build_c_root(clo_root, chi_root, c_root);
-
-//     // -------------------------
-//     // Stream out results
-//     // -------------------------
-//     for (int i = 0; i < N; i++) {
-// #pragma HLS PIPELINE II=1
-//         write_axis128(a_root_out, a_root[i]);
-//         write_axis128(clo_root_out, clo_root[i]);
-//         write_axis128(chi_root_out, chi_root[i]);
-//     }
-
-//     for (int i = 0; i < B_LEAVES_LEN; i++) {
-// #pragma HLS PIPELINE II=1
-//         write_axis128(b_leaves_out, b_leaves[i]);
-//     }
-
-// //     for (int i = 0; i < N; i++) {
-// // #pragma HLS PIPELINE II=1
-// //         write_axis128(b_root_out, b_root[i]);
-// //         write_axis128(c_root_out, c_root[i]);
-// //     }
-// }
-// }
-
-// systhesis get stuck, so I simplize the kernel
-
 extern "C" {
 void intmul_witness_step(
     hls::stream<axis64_t> &a_in,
     hls::stream<axis64_t> &b_in,
+    hls::stream<axis64_t> &clo_in,
+    hls::stream<axis64_t> &chi_in,
+
     hls::stream<axis128_t> &a_root_out,
-    hls::stream<axis128_t> &b_leaves_out
+    hls::stream<axis128_t> &b_leaves_out,
+    hls::stream<axis64_t> &b_mask_out,
+
+    int row_offset,
+    int row_count,
+    ap_uint<1> compress,
+    ap_uint<1> &roots_match,
+    int &mismatch_idx,
+    IntMulPerf &perf
 ) {
 #pragma HLS INTERFACE ap_ctrl_hs port=return
 #pragma HLS INTERFACE axis port=a_in
 #pragma HLS INTERFACE axis port=b_in
+#pragma HLS INTERFACE axis port=clo_in
+#pragma HLS INTERFACE axis port=chi_in
 #pragma HLS INTERFACE axis port=a_root_out
 #pragma HLS INTERFACE axis port=b_leaves_out
+#pragma HLS INTERFACE axis port=b_mask_out
+#pragma HLS INTERFACE s_axilite port=row_offset bundle=control
+#pragma HLS INTERFACE s_axilite port=row_count bundle=control
+#pragma HLS INTERFACE s_axilite port=compress bundle=control
+#pragma HLS INTERFACE s_axilite port=roots_match bundle=control
+#pragma HLS INTERFACE s_axilite port=mismatch_idx bundle=control
+#pragma HLS INTERFACE s_axilite port=perf bundle=control
+#pragma HLS DISAGGREGATE variable=perf   // one read-only register pair per counter
 #pragma HLS INTERFACE s_axilite port=return bundle=control
 
-    static u64 a_raw[N];
-    static u64 b_raw[N];
-    static u128 a_root[N];
-    static u128 b_leaves[B_LEAVES_LEN];
+    intmul_witness_dataflow<KernelSize::N_VARS, KernelSize::LOG_BITS>(
+        a_in, b_in, clo_in, chi_in, a_root_out, b_leaves_out, b_mask_out,
+        row_offset, row_count, compress, roots_match, mismatch_idx, perf);
+}
+}
 
-#pragma HLS BIND_STORAGE variable=a_raw type=ram_2p impl=bram
-#pragma HLS BIND_STORAGE variable=b_raw type=ram_2p impl=bram
-#pragma HLS BIND_STORAGE variable=a_root type=ram_2p impl=bram
-#pragma HLS BIND_STORAGE variable=b_leaves type=ram_2p impl=uram
+// ============================================================
+// DDR / HBM mode
+//
+// Inputs and outputs live in external memory behind m_axi, so nothing is
+// sized by the table: rows go through the same stages in tiles of
+// 2^MM_TILE_VARS rows, only the tile buffers (cur, b_exp, acc, c_buf) are
+// on chip. Memory layout, all 64-byte beats:
+//
+//   a, b, c_lo, c_hi : n_rows u64,  row i in beat i / 8, lane i % 8
+//   a_root           : n_rows u128, row i in beat i / 4, lane i % 4
+//   b_leaves         : 64 * n_rows u128, leaf (z, i) at z * n_rows + i
+//                      (the same z-major order as the AXIS mode)
+//
+// n_rows must be a nonzero multiple of 8, at most 2^MM_MAX_VARS. Any other
+// value is rejected before any m_axi traffic: roots_match = 0,
+// mismatch_idx = -1, nothing read or written.
+//
+// The burst engines are dataflow processes of their own; the FIFOs between
+// them and the compute stages hold two bursts, so one burst moves to or
+// from DDR while the next one fills (ping-pong). Each tile's leaves leave
+// as 64 runs of tile_rows * 16 contiguous bytes.
+// ============================================================
 
-    for (int i = 0; i < N; i++) {
-#pragma HLS PIPELINE II=1
-        a_raw[i] = read_axis64(a_in);
-        b_raw[i] = read_axis64(b_in);
+static const int MM_TILE       = 1 << MM_TILE_VARS;
+static const int MM_BURST      = 64;                   // beats per burst, 4 KB
+static const int MM_U64_LANES  = 8;
+static const int MM_U128_LANES = 4;
+
+// trip-count bounds at 2^MM_MAX_VARS rows
+static const int MM_MAX_TILES      = (1 << MM_MAX_VARS) / MM_TILE;
+static const int MM_MAX_U64_BEATS  = (1 << MM_MAX_VARS) / MM_U64_LANES;
+static const int MM_MAX_U128_BEATS = (1 << MM_MAX_VARS) / MM_U128_LANES;
+static const int MM_TILE_BEATS     = MM_TILE / MM_U128_LANES;   // u128 beats per tile
+
+static void mm_load_rows(
+    const mm_word_t *a,
+    const mm_word_t *b,
+    const mm_word_t *c_lo,
+    const mm_word_t *c_hi,
+    int n_rows,
+    hls::stream<u64> &a_s,
+    hls::stream<u64> &b_s,
+    hls::stream<u64> &clo_s,
+    hls::stream<u64> &chi_s
+) {
+#pragma HLS INLINE off
+    for (int k = 0; k < n_rows / MM_U64_LANES; k++) {
+#pragma HLS PIPELINE II=8
+#pragma HLS LOOP_TRIPCOUNT min=1 max=MM_MAX_U64_BEATS
+        mm_word_t wa = a[k], wb = b[k], wl = c_lo[k], wh = c_hi[k];
+        for (int l = 0; l < MM_U64_LANES; l++) {
+#pragma HLS UNROLL
+            a_s.write((u64)wa.range(64 * l + 63, 64 * l));
+            b_s.write((u64)wb.range(64 * l + 63, 64 * l));
+            clo_s.write((u64)wl.range(64 * l + 63, 64 * l));
+            chi_s.write((u64)wh.range(64 * l + 63, 64 * l));
+        }
     }
+}
 
-    build_constant_base_root(a_raw, GHASH_GENERATOR, a_root);
-    build_b_leaves(a_root, b_raw, b_leaves);
+static void mm_b_leaves_tiles(
+    hls::stream<u128> &a_root_in,
+    hls::stream<u64> &b_in,
+    int n_rows,
+    hls::stream<axis128_t> &leaves_out,
+    hls::stream<u128> &leaves_fwd
+) {
+#pragma HLS INLINE off
+    hls::stream<axis64_t> no_mask("no_mask");   // compress = 0: never written
+    perf_t cycles, stall_leaves, stall_mask;     // no counters in this mode
+    for (int off = 0; off < n_rows; off += MM_TILE) {
+#pragma HLS LOOP_TRIPCOUNT min=1 max=MM_MAX_TILES
+        int rows = (n_rows - off < MM_TILE) ? n_rows - off : MM_TILE;
+        build_b_leaves<MM_TILE_VARS, 6>(a_root_in, b_in, rows, 0, leaves_out, no_mask, leaves_fwd,
+                                        cycles, stall_leaves, stall_mask);
+    }
+}
 
-    for (int i = 0; i < N; i++) {
-#pragma HLS PIPELINE II=1
-        write_axis128(a_root_out, a_root[i]);
+static void mm_b_root_tiles(
+    hls::stream<u128> &leaves_in,
+    int n_rows,
+    hls::stream<u128> &b_root_out
+) {
+#pragma HLS INLINE off
+    for (int off = 0; off < n_rows; off += MM_TILE) {
+#pragma HLS LOOP_TRIPCOUNT min=1 max=MM_MAX_TILES
+        int rows = (n_rows - off < MM_TILE) ? n_rows - off : MM_TILE;
+        build_b_root<MM_TILE_VARS, 6>(leaves_in, rows, b_root_out);
     }
+}
 
-    for (int i = 0; i < B_LEAVES_LEN; i++) {
-#pragma HLS PIPELINE II=1
-        write_axis128(b_leaves_out, b_leaves[i]);
+static void mm_check_roots_tiles(
+    hls::stream<u128> &b_root_in,
+    hls::stream<u128> &c_root_in,
+    int n_rows,
+    ap_uint<1> &roots_match,
+    int &mismatch_idx
+) {
+#pragma HLS INLINE off
+    int first = -1;
+    for (int off = 0; off < n_rows; off += MM_TILE) {
+#pragma HLS LOOP_TRIPCOUNT min=1 max=MM_MAX_TILES
+        int rows = (n_rows - off < MM_TILE) ? n_rows - off : MM_TILE;
+        ap_uint<1> tile_match;
+        int tile_idx;
+        check_roots<MM_TILE_VARS>(b_root_in, c_root_in, rows, off, tile_match, tile_idx);
+        if (first < 0 && !tile_match) first = tile_idx;
+    }
+    roots_match  = (first < 0);
+    mismatch_idx = first;
+}
+
+static void mm_store_a_root(
+    hls::stream<u128> &a_root_in,
+    int n_rows,
+    mm_word_t *a_root
+) {
+#pragma HLS INLINE off
+    for (int k = 0; k < n_rows / MM_U128_LANES; k++) {
+#pragma HLS PIPELINE II=4
+#pragma HLS LOOP_TRIPCOUNT min=1 max=MM_MAX_U128_BEATS
+        mm_word_t w;
+        for (int l = 0; l < MM_U128_LANES; l++) {
+#pragma HLS UNROLL
+            w.range(128 * l + 127, 128 * l) = a_root_in.read();
+        }
+        a_root[k] = w;
+    }
+}
+
+static void mm_store_leaves(
+    hls::stream<axis128_t> &leaves_in,
+    int n_rows,
+    mm_word_t *b_leaves
+) {
+#pragma HLS INLINE off
+    const int row_beats = n_rows / MM_U128_LANES;
+    for (int off = 0; off < n_rows; off += MM_TILE) {
+#pragma HLS LOOP_TRIPCOUNT min=1 max=MM_MAX_TILES
+        int rows = (n_rows - off < MM_TILE) ? n_rows - off : MM_TILE;
+        for (int z = 0; z < 64; z++) {
+            // leaves (z, off .. off + rows) are contiguous: one run of bursts
+            mm_word_t *dst = b_leaves + z * row_beats + off / MM_U128_LANES;
+            for (int k = 0; k < rows / MM_U128_LANES; k++) {
+#pragma HLS PIPELINE II=4
+#pragma HLS LOOP_TRIPCOUNT min=1 max=MM_TILE_BEATS
+                mm_word_t w;
+                for (int l = 0; l < MM_U128_LANES; l++) {
+#pragma HLS UNROLL
+                    w.range(128 * l + 127, 128 * l) = (u128)leaves_in.read().data;
+                }
+                dst[k] = w;
+            }
+        }
+    }
+}
+
+// Dataflow body of intmul_witness_mm, entered only with a valid n_rows.
+static void mm_dataflow(
+    const mm_word_t *a,
+    const mm_word_t *b,
+    const mm_word_t *c_lo,
+    const mm_word_t *c_hi,
+    mm_word_t *a_root,
+    mm_word_t *b_leaves,
+    int n_rows,
+    ap_uint<1> &roots_match,
+    int &mismatch_idx
+) {
+#pragma HLS INLINE off
+#pragma HLS DATAFLOW
+
+    hls::stream<u64>       a_s("mm_a_s");
+    hls::stream<u64>       b_s("mm_b_s");
+    hls::stream<u64>       clo_s("mm_clo_s");
+    hls::stream<u64>       chi_s("mm_chi_s");
+    hls::stream<u128>      a_root_s("mm_a_root_s");
+    hls::stream<u128>      a_root_fwd("mm_a_root_fwd");
+    hls::stream<u128>      c_root_s("mm_c_root_s");
+    hls::stream<axis128_t> leaves_s("mm_leaves_s");
+    hls::stream<u128>      leaves_fwd("mm_leaves_fwd");
+    hls::stream<u128>      b_root_s("mm_b_root_s");
+    perf_t root_cycles;   // no counters in this mode
+#pragma HLS STREAM variable=a_s depth=16
+#pragma HLS STREAM variable=b_s depth=32
+#pragma HLS STREAM variable=clo_s depth=16
+#pragma HLS STREAM variable=chi_s depth=16
+#pragma HLS STREAM variable=a_root_s depth=512      // 2 bursts of a_root
+#pragma HLS STREAM variable=a_root_fwd depth=4
+#pragma HLS STREAM variable=c_root_s depth=4
+#pragma HLS STREAM variable=leaves_s depth=512      // 2 bursts of leaves
+#pragma HLS STREAM variable=leaves_fwd depth=4
+#pragma HLS STREAM variable=b_root_s depth=4
+
+    mm_load_rows(a, b, c_lo, c_hi, n_rows, a_s, b_s, clo_s, chi_s);
+    build_constant_base_root<MM_MAX_VARS>(a_s, n_rows, FB_BASE_G, a_root_s, a_root_fwd, root_cycles);
+    build_c_root<MM_MAX_VARS>(clo_s, chi_s, n_rows, c_root_s);
+    mm_b_leaves_tiles(a_root_fwd, b_s, n_rows, leaves_s, leaves_fwd);
+    mm_b_root_tiles(leaves_fwd, n_rows, b_root_s);
+    mm_check_roots_tiles(b_root_s, c_root_s, n_rows, roots_match, mismatch_idx);
+    mm_store_a_root(a_root_s, n_rows, a_root);
+    mm_store_leaves(leaves_s, n_rows, b_leaves);
+}
+
+extern "C" {
+void intmul_witness_mm(
+    const mm_word_t *a,
+    const mm_word_t *b,
+    const mm_word_t *c_lo,
+    const mm_word_t *c_hi,
+    mm_word_t *a_root,
+    mm_word_t *b_leaves,
+    int n_rows,
+    ap_uint<1> &roots_match,
+    int &mismatch_idx
+) {
+#pragma HLS INTERFACE m_axi port=a        offset=slave bundle=gmem0 max_read_burst_length=64 num_read_outstanding=4
+#pragma HLS INTERFACE m_axi port=b        offset=slave bundle=gmem1 max_read_burst_length=64 num_read_outstanding=4
+#pragma HLS INTERFACE m_axi port=c_lo     offset=slave bundle=gmem2 max_read_burst_length=64 num_read_outstanding=4
+#pragma HLS INTERFACE m_axi port=c_hi     offset=slave bundle=gmem3 max_read_burst_length=64 num_read_outstanding=4
+#pragma HLS INTERFACE m_axi port=a_root   offset=slave bundle=gmem4 max_write_burst_length=64 num_write_outstanding=4
+#pragma HLS INTERFACE m_axi port=b_leaves offset=slave bundle=gmem5 max_write_burst_length=64 num_write_outstanding=4
+#pragma HLS INTERFACE s_axilite port=a bundle=control
+#pragma HLS INTERFACE s_axilite port=b bundle=control
+#pragma HLS INTERFACE s_axilite port=c_lo bundle=control
+#pragma HLS INTERFACE s_axilite port=c_hi bundle=control
+#pragma HLS INTERFACE s_axilite port=a_root bundle=control
+#pragma HLS INTERFACE s_axilite port=b_leaves bundle=control
+#pragma HLS INTERFACE s_axilite port=n_rows bundle=control
+#pragma HLS INTERFACE s_axilite port=roots_match bundle=control
+#pragma HLS INTERFACE s_axilite port=mismatch_idx bundle=control
+#pragma HLS INTERFACE s_axilite port=return bundle=control
+
+    if (n_rows <= 0 || n_rows % MM_U64_LANES != 0 || n_rows > (1 << MM_MAX_VARS)) {
+        roots_match  = 0;
+        mismatch_idx = -1;
+        return;
     }
+    mm_dataflow(a, b, c_lo, c_hi, a_root, b_leaves, n_rows, roots_match, mismatch_idx);
 }
 }
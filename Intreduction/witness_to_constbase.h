@@ -0,0 +1,111 @@
+#pragma once
+
+#include <ap_int.h>
+#include <ap_axi_sdata.h>
+#include <hls_stream.h>
+
+using u64  = ap_uint<64>;
+using u128 = ap_uint<128>;
+
+typedef ap_axiu<64, 0, 0, 0>  axis64_t;
+typedef ap_axiu<128, 0, 0, 0> axis128_t;
+
+// ============================================================
+// Performance counters, read back through the control bundle
+//
+// The counted stages poll their streams (empty / full) instead of blocking,
+// so one loop iteration is one cycle at II=1 whether or not a word moved:
+//   *_cycles : cycles from the stage's first to its last iteration
+//   stall_*  : cycles the stage waited on that AXIS port, the input empty
+//              or the output full (back-pressure)
+// In C simulation the same loops count iterations: with the inputs already
+// queued, cycles equal the words moved (the ideal II=1 schedule), and input
+// stalls are the polls that found a port empty, e.g. while a testbench
+// thread is still feeding it.
+// ============================================================
+
+typedef ap_uint<64> perf_t;
+
+struct IntMulPerf {
+    perf_t read_cycles;          // read_inputs
+    perf_t root_cycles;          // build_constant_base_root (a_root)
+    perf_t leaves_cycles;        // build_b_leaves
+    perf_t drain_cycles;         // write_output (a_root_out)
+    perf_t stall_a_in;
+    perf_t stall_b_in;
+    perf_t stall_clo_in;
+    perf_t stall_chi_in;
+    perf_t stall_a_root_out;
+    perf_t stall_b_leaves_out;
+    perf_t stall_b_mask_out;
+};
+
+// Shortest pass over the rows in build_b_leaves / build_b_root. cur[] and
+// acc[] are read and written back one pass later with their dependence
+// declared false, which only holds while the pass is longer than the
+// read-square/multiply-write pipeline (URAM read + GF multiply, well under
+// 32 cycles). Shorter slices are padded with idle cycles up to this length,
+// so leaves_cycles is HEIGHT * max(row_count, ROW_PASS_MIN).
+static const int ROW_PASS_MIN = 32;
+
+// DATAFLOW body of the kernel for one problem size (see intmul_size.h).
+// C simulation builds instantiate N_VARS = 1..20 with LOG_BITS = 6.
+//
+// row_count must be 1 .. 2^N_VARS. Any other value is rejected: no stream
+// is read or written, roots_match = 0 and mismatch_idx = -1.
+template <int N_VARS, int LOG_BITS>
+void intmul_witness_dataflow(
+    hls::stream<axis64_t> &a_in,
+    hls::stream<axis64_t> &b_in,
+    hls::stream<axis64_t> &clo_in,
+    hls::stream<axis64_t> &chi_in,
+    hls::stream<axis128_t> &a_root_out,
+    hls::stream<axis128_t> &b_leaves_out,
+    hls::stream<axis64_t> &b_mask_out,
+    int row_offset,
+    int row_count,
+    ap_uint<1> compress,
+    ap_uint<1> &roots_match,
+    int &mismatch_idx,
+    IntMulPerf &perf
+);
+
+// Top function: the KernelSize instantiation
+extern "C" void intmul_witness_step(
+    hls::stream<axis64_t> &a_in,
+    hls::stream<axis64_t> &b_in,
+    hls::stream<axis64_t> &clo_in,
+    hls::stream<axis64_t> &chi_in,
+
+    hls::stream<axis128_t> &a_root_out,
+    hls::stream<axis128_t> &b_leaves_out,
+    hls::stream<axis64_t> &b_mask_out,
+
+    int row_offset,
+    int row_count,
+    ap_uint<1> compress,
+    ap_uint<1> &roots_match,
+    int &mismatch_idx,
+    IntMulPerf &perf
+);
+
+// ============================================================
+// DDR / HBM mode (m_axi): see intmul_witness_mm in witness_to_constbase.cpp
+// ============================================================
+
+typedef ap_uint<512> mm_word_t;   // one 64-byte AXI beat: 8 x u64 or 4 x u128
+
+static const int MM_MAX_VARS  = 24;   // largest table the mm top is sized for
+static const int MM_TILE_VARS = 12;   // rows per on-chip tile = 2^12
+
+extern "C" void intmul_witness_mm(
+    const mm_word_t *a,
+    const mm_word_t *b,
+    const mm_word_t *c_lo,
+    const mm_word_t *c_hi,
+    mm_word_t *a_root,
+    mm_word_t *b_leaves,
+    int n_rows,
+    ap_uint<1> &roots_match,
+    int &mismatch_idx
+);